@@ -10,6 +10,20 @@ IF(NOT DEFINED DEBUG_CONSOLE_CONFIG)
     SET(DEBUG_CONSOLE_CONFIG "-DSDK_DEBUGCONSOLE=1")  
 ENDIF()  
 
+# Stack usage (.su) and call graph (.ci) files for freertos/tools/stack_size.py.
+# Set STACK_USAGE_INFO to OFF to leave them out; the call graphs need GCC 10.
+IF(NOT DEFINED STACK_USAGE_INFO)
+    SET(STACK_USAGE_INFO ON)
+ENDIF()
+
+SET(STACK_USAGE_FLAGS "")
+IF(STACK_USAGE_INFO)
+    SET(STACK_USAGE_FLAGS "-fstack-usage")
+    IF(CMAKE_C_COMPILER_ID STREQUAL "GNU" AND NOT CMAKE_C_COMPILER_VERSION VERSION_LESS 10)
+        SET(STACK_USAGE_FLAGS "${STACK_USAGE_FLAGS} -fcallgraph-info=su")
+    ENDIF()
+ENDIF()
+
 SET(CMAKE_ASM_FLAGS_DEBUG " \
     ${CMAKE_ASM_FLAGS_DEBUG} \
     -D__STARTUP_CLEAR_BSS \
@@ -47,6 +61,7 @@ SET(CMAKE_C_FLAGS_DEBUG " \
     -mthumb \
     -mapcs \
     -std=gnu99 \
+    ${STACK_USAGE_FLAGS} \
     -mcpu=cortex-m0plus \
     ${FPU} \
     ${DEBUG_CONSOLE_CONFIG} \
@@ -68,6 +83,7 @@ SET(CMAKE_C_FLAGS_RELEASE " \
     -mthumb \
     -mapcs \
     -std=gnu99 \
+    ${STACK_USAGE_FLAGS} \
     -mcpu=cortex-m0plus \
     ${FPU} \
     ${DEBUG_CONSOLE_CONFIG} \
@@ -23,6 +23,7 @@ set(CONFIG_USE_driver_lpc_iocon_lite true)
 set(CONFIG_USE_driver_lpc_miniusart true)
 set(CONFIG_USE_driver_swm true)
 set(CONFIG_USE_driver_lpc_i2c true)
+set(CONFIG_USE_driver_lpc_i2c_queue true)
 set(CONFIG_USE_driver_syscon true)
 set(CONFIG_USE_utility_assert_lite true)
 set(CONFIG_USE_utilities_misc_utilities true)
@@ -1,6 +1,6 @@
 #include "board.h"
 #include "fsl_swm.h"
-#include "fsl_i2c.h"
+#include "fsl_i2c_queue.h"
 #include "fsl_debug_console.h"
 #include "fsl_sctimer.h"
 #include "fsl_swm.h"
@@ -8,6 +8,44 @@
 // Direccion del BH1750
 #define BH1750_ADDR	0x5c
 #define PWM_FREQ	1000
+// Periodo de lectura del BH1750 en ms, tiempo de medicion a 1 lux de resolucion
+#define BH1750_PERIOD_MS	120
+
+// Cola de transferencias del I2C1
+static i2c_queue_handle_t i2c_queue;
+// Comandos de power on y de medicion continua a 1 lux de resolucion
+static uint8_t bh1750_cmd[2] = {0x01, 0x10};
+static i2c_queue_transfer_t bh1750_init[2];
+// Lectura periodica del sensor
+static uint8_t bh1750_res[2];
+static i2c_queue_transfer_t bh1750_read;
+// Periodo y registro de match del PWM, calculados una sola vez
+static sctimer_pwm_channel_t pwm_channel;
+
+/**
+ * @brief Avanza las lecturas periodicas del I2C, cada 1 ms
+ */
+void SysTick_Handler(void) {
+	I2C_QueueTick(I2C1, &i2c_queue);
+}
+
+/**
+ * @brief Resultado de cada lectura del sensor, desde la interrupcion del I2C
+ */
+static void bh1750_callback(I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer,
+		status_t status, void *userData) {
+	if(status == kStatus_Success) {
+		// Resultado crudo, lux = raw / 1.2
+		uint32_t raw = ((uint32_t)bh1750_res[0] << 8) + bh1750_res[1];
+		// lux / 1000 en Q16 (65536 / 1200 = 27962 / 512), sin division
+		uint32_t lux_q16 = (raw * 27962U) >> 9;
+		// Ancho de pulso = 100% - lux / 10, sin pasar de 0 con mas de 1000 lux
+		uint32_t duty_q16 = (lux_q16 < SCTIMER_PWM_DUTY_Q16_MAX) ? (SCTIMER_PWM_DUTY_Q16_MAX - lux_q16) : 0U;
+		// Se aplica al final del periodo, sin detener el contador
+		SCTIMER_SetPwmDutyQ16(SCT0, &pwm_channel, duty_q16);
+	}
+}
+
 /**
  * @brief Programa principal
  */
@@ -31,17 +69,16 @@ int main(void) {
     // Usa el clock del sistema de base para generar el de la comunicacion
     I2C_MasterInit(I2C1, &config, SystemCoreClock);
 
-	if(I2C_MasterStart(I2C1, BH1750_ADDR, kI2C_Write) == kStatus_Success) {
-		// Comando de power on
-		uint8_t cmd = 0x01;
-		I2C_MasterWriteBlocking(I2C1, &cmd, 1, kI2C_TransferDefaultFlag);
-		I2C_MasterStop(I2C1);
-	}
-	if(I2C_MasterStart(I2C1, BH1750_ADDR, kI2C_Write) == kStatus_Success) {
-		// Comando de medicion continua a 1 lux de resolucion
-		uint8_t cmd = 0x10;
-		I2C_MasterWriteBlocking(I2C1, &cmd, 1, kI2C_TransferDefaultFlag);
-		I2C_MasterStop(I2C1);
+    // Las transferencias se encolan y corren una tras otra desde la interrupcion del I2C
+    I2C_QueueCreateHandle(I2C1, &i2c_queue);
+
+	// Comandos de power on y de medicion continua, sin esperar a que terminen
+	for(uint32_t i = 0; i < 2; i++) {
+		bh1750_init[i].xfer.slaveAddress = BH1750_ADDR;
+		bh1750_init[i].xfer.direction = kI2C_Write;
+		bh1750_init[i].xfer.data = &bh1750_cmd[i];
+		bh1750_init[i].xfer.dataSize = 1;
+		I2C_QueueSubmit(I2C1, &i2c_queue, &bh1750_init[i]);
 	}
 	uint32_t sctimer_clock = CLOCK_GetFreq(kCLOCK_Fro);
     sctimer_config_t sctimer_config;
@@ -66,22 +103,24 @@ int main(void) {
 		sctimer_clock,
 		&event
 	);
+    SCTIMER_GetPwmChannel(SCT0, event, &pwm_channel);
     // Inicializo el Timer
     SCTIMER_StartTimer(SCT0, kSCTIMER_Counter_U);
 
 
+	// Lectura del sensor cada BH1750_PERIOD_MS, el resultado llega a bh1750_callback
+	bh1750_read.xfer.slaveAddress = BH1750_ADDR;
+	bh1750_read.xfer.direction = kI2C_Read;
+	bh1750_read.xfer.data = bh1750_res;
+	bh1750_read.xfer.dataSize = sizeof(bh1750_res);
+	bh1750_read.callback = bh1750_callback;
+	I2C_QueueAddJob(I2C1, &i2c_queue, &bh1750_read, BH1750_PERIOD_MS);
+	// Tick de 1 ms para las lecturas periodicas
+	SysTick_Config(SystemCoreClock / 1000);
+
 	while(1) {
-		// Lectura del sensor
-		if(I2C_MasterStart(I2C1, BH1750_ADDR, kI2C_Read) == kStatus_Success) {
-			// Resultado
-			uint8_t res[2] = {0};
-			I2C_MasterReadBlocking(I2C1, res, 2, kI2C_TransferDefaultFlag);
-			I2C_MasterStop(I2C1);
-			// Devuelvo el resultado
-			float lux = ((res[0] << 8) + res[1]) / 1.2;
-			float percent = 100- (lux/10);
-            SCTIMER_UpdatePwmDutycycle(SCT0, kSCTIMER_Out_4, percent, event);
-		}
+		// Todo el trabajo se hace en las interrupciones
+		__WFI();
     }
     return 0;
 }
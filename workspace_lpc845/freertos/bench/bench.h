@@ -0,0 +1,73 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Helpers shared by the host benchmarks in this directory.  The benchmarks run
+ * on the POSIX simulator port, so the times they print are host times: they
+ * compare kernel paths with each other, not with the Cortex-M0+ target.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/* Monotonic host time in nanoseconds. */
+static inline uint64_t ullBenchTimeNs( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+
+/* Prints one result as "<name> <value> <unit>", so the output of several runs
+ * can be compared with a plain diff or joined with a script. */
+static inline void vBenchReport( const char * pcName,
+                                 double dValue,
+                                 const char * pcUnit )
+{
+    ( void ) printf( "%-40s %12.1f %s\n", pcName, dValue, pcUnit );
+    ( void ) fflush( stdout );
+}
+
+/* Counts a failed check.  A benchmark exits with a non-zero status when any
+ * check failed, so ctest reports it. */
+#define benchCHECK( ulFailures, x )                                                 \
+    do {                                                                            \
+        if( !( x ) )                                                                \
+        {                                                                           \
+            ( void ) printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #x ); \
+            ( ulFailures )++;                                                       \
+        }                                                                           \
+    } while( 0 )
+
+#endif /* BENCH_H */
@@ -0,0 +1,353 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Replays a trace of allocations and frees against the heap the program is
+ * linked with.  bench/CMakeLists.txt builds it once with heap_2.c and once
+ * with heap_6.c, so the two print comparable results for the same trace:
+ *
+ * + the mean and the worst time of a pvPortMalloc() or vPortFree() call,
+ * + the allocations that failed,
+ * + the lowest free heap size seen,
+ * + the fragmentation of the free space at the end of the trace, as
+ *   1 - largest allocatable block / free bytes.
+ *
+ * The times include vTaskSuspendAll() and xTaskResumeAll(), which on the
+ * simulator block and unblock the tick signal, so they are the same for both
+ * heaps.
+ *
+ * The trace is a text file given on the command line, one operation per line:
+ *
+ *     a <slot> <bytes>    allocate <bytes> and keep the block in <slot>
+ *     f <slot>            free the block kept in <slot>
+ *
+ * Without a file a built in trace is replayed.  It models an application
+ * that keeps creating and deleting tasks, queues and timers while passing
+ * short lived buffers around, the workload that fragments heap_2.c.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "bench.h"
+
+#define replayMAX_SLOTS            512U
+#define replayGENERATED_OPS        200000UL
+
+/* The built in trace keeps about this share of the heap allocated. */
+#define replayLIVE_BYTES_TARGET    ( ( configTOTAL_HEAP_SIZE * 6U ) / 10U )
+
+typedef struct REPLAY_OP
+{
+    char cOp;      /*< 'a' or 'f'. */
+    uint16_t usSlot;
+    uint32_t ulBytes;
+} ReplayOp_t;
+
+/*-----------------------------------------------------------*/
+
+static ReplayOp_t * pxOps = NULL;
+static size_t xOpCount = 0;
+static size_t xOpsAllocated = 0;
+static uint32_t ulRandom = 0x2545F491UL;
+
+/*-----------------------------------------------------------*/
+
+static void prvAddOp( char cOp,
+                      uint16_t usSlot,
+                      uint32_t ulBytes )
+{
+    if( xOpCount == xOpsAllocated )
+    {
+        xOpsAllocated = ( xOpsAllocated == 0U ) ? 1024U : ( xOpsAllocated * 2U );
+        pxOps = realloc( pxOps, xOpsAllocated * sizeof( ReplayOp_t ) );
+
+        if( pxOps == NULL )
+        {
+            exit( EXIT_FAILURE );
+        }
+    }
+
+    pxOps[ xOpCount ].cOp = cOp;
+    pxOps[ xOpCount ].usSlot = usSlot;
+    pxOps[ xOpCount ].ulBytes = ulBytes;
+    xOpCount++;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( uint32_t ulRange )
+{
+    /* xorshift32, the trace has to be the same for every heap. */
+    ulRandom ^= ulRandom << 13;
+    ulRandom ^= ulRandom >> 17;
+    ulRandom ^= ulRandom << 5;
+
+    return ulRandom % ulRange;
+}
+/*-----------------------------------------------------------*/
+
+/* Size of the next object of the built in trace.  Sizes follow the kernel
+ * objects of the 64-bit simulator: a task is a TCB and a stack, a queue a
+ * Queue_t and its storage. */
+static uint32_t prvObjectSize( BaseType_t * pxShortLived )
+{
+    uint32_t ulKind = prvRandom( 100U );
+    uint32_t ulBytes;
+
+    *pxShortLived = pdFALSE;
+
+    if( ulKind < 10U )
+    {
+        /* Task stack, configMINIMAL_STACK_SIZE to 8 times that. */
+        ulBytes = ( uint32_t ) ( sizeof( StackType_t ) * configMINIMAL_STACK_SIZE ) * ( 1U + prvRandom( 8U ) );
+    }
+    else if( ulKind < 20U )
+    {
+        /* Task control block. */
+        ulBytes = 160U;
+    }
+    else if( ulKind < 35U )
+    {
+        /* Queue with its storage. */
+        ulBytes = 160U + ( 8U * ( 1U + prvRandom( 32U ) ) );
+    }
+    else if( ulKind < 45U )
+    {
+        /* Timer. */
+        ulBytes = 88U;
+    }
+    else
+    {
+        /* Message or driver buffer, freed soon after. */
+        ulBytes = 8U + prvRandom( 504U );
+        *pxShortLived = pdTRUE;
+    }
+
+    return ulBytes;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGenerateTrace( void )
+{
+    static uint32_t ulSlotBytes[ replayMAX_SLOTS ];
+    static BaseType_t xSlotShortLived[ replayMAX_SLOTS ];
+    size_t xLiveBytes = 0;
+    BaseType_t xShortLived;
+    uint32_t ulBytes;
+    uint32_t ulSlot;
+    uint32_t ulTries;
+    size_t xOp;
+
+    for( xOp = 0; xOp < replayGENERATED_OPS; xOp++ )
+    {
+        ulSlot = prvRandom( replayMAX_SLOTS );
+
+        /* Short lived buffers are freed at once when picked, long lived
+         * objects only once in a while, so they end up spread over the
+         * heap between the buffers. */
+        if( ulSlotBytes[ ulSlot ] != 0U )
+        {
+            if( ( xSlotShortLived[ ulSlot ] != pdFALSE ) || ( prvRandom( 8U ) == 0U ) )
+            {
+                prvAddOp( 'f', ( uint16_t ) ulSlot, 0 );
+                xLiveBytes -= ulSlotBytes[ ulSlot ];
+                ulSlotBytes[ ulSlot ] = 0;
+            }
+
+            continue;
+        }
+
+        ulBytes = prvObjectSize( &xShortLived );
+
+        for( ulTries = 0; ( ulTries < 4U ) && ( ( xLiveBytes + ulBytes ) > replayLIVE_BYTES_TARGET ); ulTries++ )
+        {
+            ulBytes = prvObjectSize( &xShortLived );
+        }
+
+        if( ( xLiveBytes + ulBytes ) <= replayLIVE_BYTES_TARGET )
+        {
+            prvAddOp( 'a', ( uint16_t ) ulSlot, ulBytes );
+            xLiveBytes += ulBytes;
+            ulSlotBytes[ ulSlot ] = ulBytes;
+            xSlotShortLived[ ulSlot ] = xShortLived;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvLoadTrace( const char * pcPath )
+{
+    FILE * pxFile = fopen( pcPath, "r" );
+    char cOp;
+    unsigned uSlot;
+    unsigned long ulBytes;
+    BaseType_t xReturn = pdPASS;
+
+    if( pxFile == NULL )
+    {
+        return pdFAIL;
+    }
+
+    while( fscanf( pxFile, " %c %u", &cOp, &uSlot ) == 2 )
+    {
+        ulBytes = 0;
+
+        if( ( uSlot >= replayMAX_SLOTS ) ||
+            ( ( cOp == 'a' ) && ( fscanf( pxFile, "%lu", &ulBytes ) != 1 ) ) ||
+            ( ( cOp != 'a' ) && ( cOp != 'f' ) ) )
+        {
+            xReturn = pdFAIL;
+            break;
+        }
+
+        prvAddOp( cOp, ( uint16_t ) uSlot, ( uint32_t ) ulBytes );
+    }
+
+    ( void ) fclose( pxFile );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+/* Largest block pvPortMalloc() can return now, found by bisection. */
+static size_t prvLargestAllocatableBlock( void )
+{
+    size_t xLow = 0;
+    size_t xHigh = configTOTAL_HEAP_SIZE;
+    size_t xMid;
+    void * pvBlock;
+
+    while( xLow < xHigh )
+    {
+        xMid = xLow + ( ( xHigh - xLow + 1U ) / 2U );
+        pvBlock = pvPortMalloc( xMid );
+
+        if( pvBlock != NULL )
+        {
+            vPortFree( pvBlock );
+            xLow = xMid;
+        }
+        else
+        {
+            xHigh = xMid - 1U;
+        }
+    }
+
+    return xLow;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char * argv[] )
+{
+    static void * pvSlots[ replayMAX_SLOTS ];
+    uint64_t ullStart;
+    uint64_t ullTime;
+    uint64_t ullTotal = 0;
+    uint64_t ullWorst = 0;
+    size_t xFailed = 0;
+    size_t xFree;
+    size_t xMinimumFree = configTOTAL_HEAP_SIZE;
+    size_t xLargest;
+    size_t xOp;
+    uint32_t ulFailures = 0;
+    const ReplayOp_t * pxOp;
+
+    if( argc > 1 )
+    {
+        if( prvLoadTrace( argv[ 1 ] ) != pdPASS )
+        {
+            ( void ) printf( "%s: cannot read trace %s\n", argv[ 0 ], argv[ 1 ] );
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        prvGenerateTrace();
+    }
+
+    for( xOp = 0; xOp < xOpCount; xOp++ )
+    {
+        pxOp = &pxOps[ xOp ];
+
+        if( pxOp->cOp == 'a' )
+        {
+            /* A trace may allocate into a slot it never freed, that block
+             * is then leaked as it would be by the application. */
+            ullStart = ullBenchTimeNs();
+            pvSlots[ pxOp->usSlot ] = pvPortMalloc( pxOp->ulBytes );
+            ullTime = ullBenchTimeNs() - ullStart;
+
+            if( pvSlots[ pxOp->usSlot ] == NULL )
+            {
+                xFailed++;
+            }
+            else
+            {
+                /* Touch the block, a heap that hands out overlapping blocks
+                 * then corrupts its own headers and asserts. */
+                ( void ) memset( pvSlots[ pxOp->usSlot ], ( int ) pxOp->usSlot, pxOp->ulBytes );
+            }
+        }
+        else
+        {
+            ullStart = ullBenchTimeNs();
+            vPortFree( pvSlots[ pxOp->usSlot ] );
+            ullTime = ullBenchTimeNs() - ullStart;
+            pvSlots[ pxOp->usSlot ] = NULL;
+        }
+
+        ullTotal += ullTime;
+        ullWorst = ( ullTime > ullWorst ) ? ullTime : ullWorst;
+
+        xFree = xPortGetFreeHeapSize();
+        xMinimumFree = ( xFree < xMinimumFree ) ? xFree : xMinimumFree;
+    }
+
+    xFree = xPortGetFreeHeapSize();
+    xLargest = prvLargestAllocatableBlock();
+    benchCHECK( ulFailures, xOpCount != 0U );
+    benchCHECK( ulFailures, xLargest <= xFree );
+
+    ( void ) printf( "%s, %lu operations\n", HEAP_NAME, ( unsigned long ) xOpCount );
+    vBenchReport( "mean time per call", ( double ) ullTotal / ( double ) ( ( xOpCount != 0U ) ? xOpCount : 1U ), "ns" );
+    vBenchReport( "worst time per call", ( double ) ullWorst, "ns" );
+    vBenchReport( "failed allocations", ( double ) xFailed, "" );
+    vBenchReport( "minimum free heap", ( double ) xMinimumFree, "bytes" );
+    vBenchReport( "free heap at end", ( double ) xFree, "bytes" );
+    vBenchReport( "largest block at end", ( double ) xLargest, "bytes" );
+    vBenchReport( "fragmentation at end", 100.0 * ( 1.0 - ( ( double ) xLargest / ( double ) ( ( xFree != 0U ) ? xFree : 1U ) ) ), "%" );
+
+    free( pxOps );
+
+    return ( ulFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
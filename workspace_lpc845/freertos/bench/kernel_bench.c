@@ -0,0 +1,387 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Kernel benchmarks for the POSIX simulator port:
+ *
+ * + Context switch: two tasks of the same priority yield to each other.
+ * + Queue round trip: a client sends a request to a server task and blocks
+ *   until the server replies on a second queue.
+ * + Stream buffer throughput: a producer and a consumer task move data
+ *   through a stream buffer, for several write sizes.
+ * + Event group fan-out: one call to xEventGroupSetBits() unblocks 1 to
+ *   benchMAX_FAN_OUT tasks waiting for the same bit.
+ *
+ * Build with FREERTOS_PORT=POSIX and run build/bench/kernel_bench.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+
+#include "bench.h"
+
+/* The control task runs at the lowest priority, so a benchmark runs until all
+ * its tasks have blocked or finished. */
+#define benchCONTROL_PRIORITY    ( tskIDLE_PRIORITY + 1 )
+#define benchWORKER_PRIORITY     ( tskIDLE_PRIORITY + 2 )
+#define benchSETUP_PRIORITY      ( configMAX_PRIORITIES - 1 )
+#define benchSTACK_DEPTH         ( configMINIMAL_STACK_SIZE * 4 )
+
+#define benchYIELD_ROUNDS        20000UL
+#define benchQUEUE_ROUNDS        10000UL
+#define benchSTREAM_BYTES        ( 256UL * 1024UL )
+#define benchSTREAM_BUFFER_SIZE  1024U
+#define benchFAN_OUT_ROUNDS      1000UL
+#define benchMAX_FAN_OUT         8U
+
+#define benchGO_BIT              ( ( EventBits_t ) 0x01 )
+
+/*-----------------------------------------------------------*/
+
+static TaskHandle_t xControlTask = NULL;
+static volatile UBaseType_t uxWorkersRunning = 0;
+static uint32_t ulFailures = 0;
+
+static QueueHandle_t xRequestQueue = NULL;
+static QueueHandle_t xReplyQueue = NULL;
+
+static StreamBufferHandle_t xStreamBuffer = NULL;
+static size_t xStreamWriteSize = 0;
+static volatile size_t xStreamBytesReceived = 0;
+static volatile BaseType_t xStreamDataValid = pdTRUE;
+
+static EventGroupHandle_t xFanOutGroup = NULL;
+static volatile UBaseType_t uxFanOutWoken = 0;
+
+/*-----------------------------------------------------------*/
+
+/* Tells the control task that one more worker is done, then deletes the
+ * calling task. */
+static void prvWorkerDone( void )
+{
+    taskENTER_CRITICAL();
+    {
+        uxWorkersRunning--;
+
+        if( uxWorkersRunning == 0U )
+        {
+            ( void ) xTaskNotifyGive( xControlTask );
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+/* Creates the worker tasks of a benchmark while the control task runs above
+ * them, then drops the control task below the workers and times how long it
+ * takes until the last one is done. */
+static uint64_t prvRunWorkers( TaskFunction_t pxWorker1,
+                               TaskFunction_t pxWorker2 )
+{
+    uint64_t ullStart;
+
+    vTaskPrioritySet( NULL, benchSETUP_PRIORITY );
+    uxWorkersRunning = 2U;
+    benchCHECK( ulFailures, xTaskCreate( pxWorker1, "w1", benchSTACK_DEPTH, NULL, benchWORKER_PRIORITY, NULL ) == pdPASS );
+    benchCHECK( ulFailures, xTaskCreate( pxWorker2, "w2", benchSTACK_DEPTH, NULL, benchWORKER_PRIORITY, NULL ) == pdPASS );
+
+    ullStart = ullBenchTimeNs();
+    vTaskPrioritySet( NULL, benchCONTROL_PRIORITY );
+    ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+    return ullBenchTimeNs() - ullStart;
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldTask( void * pvParameters )
+{
+    uint32_t ulRound;
+
+    ( void ) pvParameters;
+
+    for( ulRound = 0; ulRound < benchYIELD_ROUNDS; ulRound++ )
+    {
+        taskYIELD();
+    }
+
+    prvWorkerDone();
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueClientTask( void * pvParameters )
+{
+    uint32_t ulRound;
+    uint32_t ulReply;
+
+    ( void ) pvParameters;
+
+    for( ulRound = 0; ulRound < benchQUEUE_ROUNDS; ulRound++ )
+    {
+        ( void ) xQueueSend( xRequestQueue, &ulRound, portMAX_DELAY );
+        ( void ) xQueueReceive( xReplyQueue, &ulReply, portMAX_DELAY );
+        benchCHECK( ulFailures, ulReply == ( ulRound + 1UL ) );
+    }
+
+    prvWorkerDone();
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueServerTask( void * pvParameters )
+{
+    uint32_t ulRound;
+    uint32_t ulRequest;
+
+    ( void ) pvParameters;
+
+    for( ulRound = 0; ulRound < benchQUEUE_ROUNDS; ulRound++ )
+    {
+        ( void ) xQueueReceive( xRequestQueue, &ulRequest, portMAX_DELAY );
+        ulRequest++;
+        ( void ) xQueueSend( xReplyQueue, &ulRequest, portMAX_DELAY );
+    }
+
+    prvWorkerDone();
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamProducerTask( void * pvParameters )
+{
+    uint8_t ucData[ benchSTREAM_BUFFER_SIZE ];
+    size_t xSent = 0;
+    size_t xIndex;
+
+    ( void ) pvParameters;
+
+    while( xSent < benchSTREAM_BYTES )
+    {
+        /* Each byte holds the low bits of its offset in the stream, so the
+         * consumer can check that nothing was lost or reordered. */
+        for( xIndex = 0; xIndex < xStreamWriteSize; xIndex++ )
+        {
+            ucData[ xIndex ] = ( uint8_t ) ( xSent + xIndex );
+        }
+
+        xSent += xStreamBufferSend( xStreamBuffer, ucData, xStreamWriteSize, portMAX_DELAY );
+    }
+
+    prvWorkerDone();
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamConsumerTask( void * pvParameters )
+{
+    uint8_t ucData[ benchSTREAM_BUFFER_SIZE ];
+    size_t xReceived;
+    size_t xIndex;
+
+    ( void ) pvParameters;
+
+    while( xStreamBytesReceived < benchSTREAM_BYTES )
+    {
+        xReceived = xStreamBufferReceive( xStreamBuffer, ucData, sizeof( ucData ), portMAX_DELAY );
+
+        for( xIndex = 0; xIndex < xReceived; xIndex++ )
+        {
+            if( ucData[ xIndex ] != ( uint8_t ) ( xStreamBytesReceived + xIndex ) )
+            {
+                xStreamDataValid = pdFALSE;
+            }
+        }
+
+        xStreamBytesReceived += xReceived;
+    }
+
+    prvWorkerDone();
+}
+/*-----------------------------------------------------------*/
+
+/* Waits for the go bit without clearing it, then parks on its notification
+ * until the control task has cleared the bit for the next round. */
+static void prvFanOutWaiterTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        ( void ) xEventGroupWaitBits( xFanOutGroup, benchGO_BIT, pdFALSE, pdTRUE, portMAX_DELAY );
+
+        /* The waiters share a priority, so a tick can switch between them
+         * in the middle of the increment. */
+        taskENTER_CRITICAL();
+        {
+            uxFanOutWoken++;
+        }
+        taskEXIT_CRITICAL();
+
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchContextSwitch( void )
+{
+    uint64_t ullElapsed;
+
+    ullElapsed = prvRunWorkers( prvYieldTask, prvYieldTask );
+    vBenchReport( "context switch (taskYIELD)", ( double ) ullElapsed / ( double ) ( 2UL * benchYIELD_ROUNDS ), "ns/switch" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchQueueRoundTrip( void )
+{
+    uint64_t ullElapsed;
+
+    xRequestQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+    xReplyQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+    benchCHECK( ulFailures, ( xRequestQueue != NULL ) && ( xReplyQueue != NULL ) );
+
+    ullElapsed = prvRunWorkers( prvQueueClientTask, prvQueueServerTask );
+    vBenchReport( "queue round trip", ( double ) ullElapsed / ( double ) benchQUEUE_ROUNDS, "ns/round trip" );
+
+    vQueueDelete( xRequestQueue );
+    vQueueDelete( xReplyQueue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchStreamBuffer( void )
+{
+    static const size_t xWriteSizes[] = { 16U, 64U, 256U };
+    char cName[ 48 ];
+    uint64_t ullElapsed;
+    size_t xSize;
+
+    for( xSize = 0; xSize < ( sizeof( xWriteSizes ) / sizeof( xWriteSizes[ 0 ] ) ); xSize++ )
+    {
+        xStreamBuffer = xStreamBufferCreate( benchSTREAM_BUFFER_SIZE, 1 );
+        benchCHECK( ulFailures, xStreamBuffer != NULL );
+        xStreamWriteSize = xWriteSizes[ xSize ];
+        xStreamBytesReceived = 0;
+        xStreamDataValid = pdTRUE;
+
+        ullElapsed = prvRunWorkers( prvStreamProducerTask, prvStreamConsumerTask );
+        benchCHECK( ulFailures, xStreamBytesReceived == benchSTREAM_BYTES );
+        benchCHECK( ulFailures, xStreamDataValid == pdTRUE );
+
+        ( void ) snprintf( cName, sizeof( cName ), "stream buffer, %u byte writes", ( unsigned ) xStreamWriteSize );
+        vBenchReport( cName, ( ( double ) benchSTREAM_BYTES * 1000.0 ) / ( double ) ullElapsed, "MB/s" );
+
+        vStreamBufferDelete( xStreamBuffer );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchEventGroupFanOut( void )
+{
+    TaskHandle_t xWaiters[ benchMAX_FAN_OUT ];
+    char cName[ 48 ];
+    uint64_t ullStart;
+    uint64_t ullElapsed;
+    uint32_t ulRound;
+    UBaseType_t uxWaiters;
+    UBaseType_t uxWaiter;
+
+    xFanOutGroup = xEventGroupCreate();
+    benchCHECK( ulFailures, xFanOutGroup != NULL );
+
+    for( uxWaiters = 1U; uxWaiters <= benchMAX_FAN_OUT; uxWaiters *= 2U )
+    {
+        /* The waiters run above the control task, so each set returns only
+         * after all of them have woken and parked again. */
+        for( uxWaiter = 0; uxWaiter < uxWaiters; uxWaiter++ )
+        {
+            benchCHECK( ulFailures, xTaskCreate( prvFanOutWaiterTask, "fan", benchSTACK_DEPTH, NULL, benchWORKER_PRIORITY, &xWaiters[ uxWaiter ] ) == pdPASS );
+        }
+
+        uxFanOutWoken = 0;
+        ullElapsed = 0;
+
+        for( ulRound = 0; ulRound < benchFAN_OUT_ROUNDS; ulRound++ )
+        {
+            ullStart = ullBenchTimeNs();
+            ( void ) xEventGroupSetBits( xFanOutGroup, benchGO_BIT );
+            ullElapsed += ullBenchTimeNs() - ullStart;
+
+            ( void ) xEventGroupClearBits( xFanOutGroup, benchGO_BIT );
+
+            for( uxWaiter = 0; uxWaiter < uxWaiters; uxWaiter++ )
+            {
+                ( void ) xTaskNotifyGive( xWaiters[ uxWaiter ] );
+            }
+        }
+
+        benchCHECK( ulFailures, uxFanOutWoken == ( uxWaiters * benchFAN_OUT_ROUNDS ) );
+
+        ( void ) snprintf( cName, sizeof( cName ), "event group fan-out to %u tasks", ( unsigned ) uxWaiters );
+        vBenchReport( cName, ( double ) ullElapsed / ( double ) benchFAN_OUT_ROUNDS, "ns/set" );
+
+        for( uxWaiter = 0; uxWaiter < uxWaiters; uxWaiter++ )
+        {
+            vTaskDelete( xWaiters[ uxWaiter ] );
+        }
+
+        /* Let the idle task free the deleted tasks. */
+        vTaskDelay( 2 );
+    }
+
+    vEventGroupDelete( xFanOutGroup );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    prvBenchContextSwitch();
+    prvBenchQueueRoundTrip();
+    prvBenchStreamBuffer();
+    prvBenchEventGroupFanOut();
+
+    vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    if( xTaskCreate( prvControlTask, "control", benchSTACK_DEPTH, NULL, benchCONTROL_PRIORITY, &xControlTask ) != pdPASS )
+    {
+        return EXIT_FAILURE;
+    }
+
+    vTaskStartScheduler();
+
+    return ( ulFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
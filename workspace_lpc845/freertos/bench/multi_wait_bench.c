@@ -0,0 +1,438 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A gateway task serving five sources, fed from a simulated interrupt and a
+ * task, implemented three ways:
+ *
+ * + multi-wait: blocks in xMultiWaitSelect() until a source is ready.
+ * + poll/yield: tests every source with a zero block time and yields when
+ *   none is ready.
+ * + poll/delay: as poll/yield, but sleeps for a tick when none is ready.
+ *
+ * The sources are a command queue written by a task every 3 ticks, and from
+ * the interrupt a sample queue every 2 ticks, a UART stream buffer every
+ * tick, notification bits every 5 ticks and a counting semaphore every 7
+ * ticks.  The interrupt is a timer callback, which runs in the tick interrupt
+ * with configTIMERS_RUN_FROM_TICK.  For each gateway the benchmark prints the
+ * mean and worst latency from the send to the gateway reading the item, how
+ * often the gateway ran, and how many loops a background task at the lowest
+ * priority got through, that is the CPU time the gateway left to the rest of
+ * the application.
+ *
+ * Needs configUSE_MULTI_WAIT and configUSE_EXECUTOR, bench/CMakeLists.txt
+ * builds it with a kernel that sets both.
+ */
+
+#include <stdlib.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "multi_wait.h"
+
+#include "bench.h"
+
+#define mwbRUN_TICKS                 500U
+#define mwbSTACK_DEPTH               ( configMINIMAL_STACK_SIZE * 4 )
+
+#define mwbBACKGROUND_PRIORITY       ( tskIDLE_PRIORITY + 1 )
+#define mwbCOMMAND_PRIORITY          ( tskIDLE_PRIORITY + 2 )
+#define mwbGATEWAY_PRIORITY          ( tskIDLE_PRIORITY + 3 )
+#define mwbCONTROL_PRIORITY          ( configMAX_PRIORITIES - 1 )
+
+#define mwbNOTIFY_BITS               ( 0x03UL )
+
+/* Sources in the order the gateways serve them. */
+#define mwbSOURCE_COMMAND            0
+#define mwbSOURCE_SAMPLE             1
+#define mwbSOURCE_UART               2
+#define mwbSOURCE_NOTIFY             3
+#define mwbSOURCE_SEMAPHORE          4
+
+typedef enum
+{
+    eGatewayPollYield = 0,
+    eGatewayPollDelay,
+    eGatewayMultiWait
+} GatewayKind_t;
+
+/*-----------------------------------------------------------*/
+
+static const char * const pcGatewayNames[] = { "poll/yield", "poll/delay", "multi-wait" };
+
+static QueueHandle_t xCommandQueue = NULL;
+static QueueHandle_t xSampleQueue = NULL;
+static StreamBufferHandle_t xUartStream = NULL;
+static SemaphoreHandle_t xEventSemaphore = NULL;
+static TimerHandle_t xInterruptTimer = NULL;
+
+static TaskHandle_t xControlTask = NULL;
+static TaskHandle_t xGatewayTask = NULL;
+static volatile BaseType_t xRunning = pdFALSE;
+
+static volatile uint32_t ulTickCount;
+static volatile uint32_t ulSent;
+static volatile uint32_t ulReceived;
+static volatile uint32_t ulGatewayRuns;
+static volatile uint64_t ullBackgroundLoops;
+static uint64_t ullLatencySum;
+static uint64_t ullLatencyWorst;
+static uint32_t ulLatencyCount;
+static uint32_t ulFailures = 0;
+
+/*-----------------------------------------------------------*/
+
+static void prvRecordLatency( uint64_t ullSentNs )
+{
+    uint64_t ullLatency = ullBenchTimeNs() - ullSentNs;
+
+    ullLatencySum += ullLatency;
+    ullLatencyWorst = ( ullLatency > ullLatencyWorst ) ? ullLatency : ullLatencyWorst;
+    ulLatencyCount++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptCallback( TimerHandle_t xTimer )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    uint64_t ullNow = ullBenchTimeNs();
+
+    ( void ) xTimer;
+
+    if( xRunning == pdFALSE )
+    {
+        return;
+    }
+
+    ulTickCount++;
+
+    if( xStreamBufferSendFromISR( xUartStream, &ullNow, sizeof( ullNow ), &xHigherPriorityTaskWoken ) == sizeof( ullNow ) )
+    {
+        ulSent++;
+    }
+
+    if( ( ( ulTickCount % 2U ) == 0U ) && ( xQueueSendFromISR( xSampleQueue, &ullNow, &xHigherPriorityTaskWoken ) == pdPASS ) )
+    {
+        ulSent++;
+    }
+
+    if( ( ulTickCount % 5U ) == 0U )
+    {
+        ( void ) xTaskNotifyIndexedFromISR( xGatewayTask, configMULTI_WAIT_NOTIFY_INDEX, mwbNOTIFY_BITS, eSetBits, &xHigherPriorityTaskWoken );
+        ulSent++;
+    }
+
+    if( ( ( ulTickCount % 7U ) == 0U ) && ( xSemaphoreGiveFromISR( xEventSemaphore, &xHigherPriorityTaskWoken ) == pdPASS ) )
+    {
+        ulSent++;
+    }
+
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCommandTask( void * pvParameters )
+{
+    uint64_t ullNow;
+
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        vTaskDelay( 3 );
+
+        if( xRunning != pdFALSE )
+        {
+            ullNow = ullBenchTimeNs();
+
+            if( xQueueSend( xCommandQueue, &ullNow, 0 ) == pdPASS )
+            {
+                ulSent++;
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvBackgroundTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        ullBackgroundLoops++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Reads one item from a source the gateway found ready. */
+static void prvServeSource( BaseType_t xSource,
+                            uint32_t ulNotified )
+{
+    uint64_t ullSentNs;
+
+    switch( xSource )
+    {
+        case mwbSOURCE_COMMAND:
+
+            if( xQueueReceive( xCommandQueue, &ullSentNs, 0 ) == pdPASS )
+            {
+                prvRecordLatency( ullSentNs );
+                ulReceived++;
+            }
+
+            break;
+
+        case mwbSOURCE_SAMPLE:
+
+            if( xQueueReceive( xSampleQueue, &ullSentNs, 0 ) == pdPASS )
+            {
+                prvRecordLatency( ullSentNs );
+                ulReceived++;
+            }
+
+            break;
+
+        case mwbSOURCE_UART:
+
+            if( xStreamBufferReceive( xUartStream, &ullSentNs, sizeof( ullSentNs ), 0 ) == sizeof( ullSentNs ) )
+            {
+                prvRecordLatency( ullSentNs );
+                ulReceived++;
+            }
+
+            break;
+
+        case mwbSOURCE_NOTIFY:
+            benchCHECK( ulFailures, ulNotified == mwbNOTIFY_BITS );
+            ulReceived++;
+            break;
+
+        case mwbSOURCE_SEMAPHORE:
+
+            if( xSemaphoreTake( xEventSemaphore, 0 ) == pdPASS )
+            {
+                ulReceived++;
+            }
+
+            break;
+
+        default:
+            ulFailures++;
+            break;
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Tests the sources in order and returns the first ready one, or -1. */
+static BaseType_t prvPollSources( uint32_t * pulNotified )
+{
+    BaseType_t xSource = -1;
+
+    if( uxQueueMessagesWaiting( xCommandQueue ) != 0U )
+    {
+        xSource = mwbSOURCE_COMMAND;
+    }
+    else if( uxQueueMessagesWaiting( xSampleQueue ) != 0U )
+    {
+        xSource = mwbSOURCE_SAMPLE;
+    }
+    else if( xStreamBufferIsEmpty( xUartStream ) == pdFALSE )
+    {
+        xSource = mwbSOURCE_UART;
+    }
+    else if( ( xTaskNotifyWaitIndexed( configMULTI_WAIT_NOTIFY_INDEX, 0UL, mwbNOTIFY_BITS, pulNotified, 0 ) == pdPASS ) &&
+             ( ( *pulNotified & mwbNOTIFY_BITS ) != 0UL ) )
+    {
+        *pulNotified &= mwbNOTIFY_BITS;
+        xSource = mwbSOURCE_NOTIFY;
+    }
+    else if( uxSemaphoreGetCount( xEventSemaphore ) != 0U )
+    {
+        xSource = mwbSOURCE_SEMAPHORE;
+    }
+
+    return xSource;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPollingGatewayTask( void * pvParameters )
+{
+    GatewayKind_t eKind = ( GatewayKind_t ) ( intptr_t ) pvParameters;
+    BaseType_t xSource;
+    uint32_t ulNotified = 0;
+
+    while( xRunning != pdFALSE )
+    {
+        ulGatewayRuns++;
+        xSource = prvPollSources( &ulNotified );
+
+        if( xSource >= 0 )
+        {
+            prvServeSource( xSource, ulNotified );
+        }
+        else if( eKind == eGatewayPollYield )
+        {
+            taskYIELD();
+        }
+        else
+        {
+            vTaskDelay( 1 );
+        }
+    }
+
+    ( void ) xTaskNotifyGive( xControlTask );
+    vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMultiWaitGatewayTask( void * pvParameters )
+{
+    MultiWait_t xGatewayWait;
+    BaseType_t xSource;
+    uint32_t ulNotified = 0;
+
+    ( void ) pvParameters;
+
+    vMultiWaitInitialise( &xGatewayWait );
+    benchCHECK( ulFailures, xMultiWaitAddQueue( &xGatewayWait, xCommandQueue ) == mwbSOURCE_COMMAND );
+    benchCHECK( ulFailures, xMultiWaitAddQueue( &xGatewayWait, xSampleQueue ) == mwbSOURCE_SAMPLE );
+    benchCHECK( ulFailures, xMultiWaitAddStreamBuffer( &xGatewayWait, xUartStream ) == mwbSOURCE_UART );
+    benchCHECK( ulFailures, xMultiWaitAddNotification( &xGatewayWait, mwbNOTIFY_BITS ) == mwbSOURCE_NOTIFY );
+    benchCHECK( ulFailures, xMultiWaitAddQueue( &xGatewayWait, xEventSemaphore ) == mwbSOURCE_SEMAPHORE );
+
+    while( xRunning != pdFALSE )
+    {
+        xSource = xMultiWaitSelect( &xGatewayWait, pdMS_TO_TICKS( 10 ), &ulNotified );
+        ulGatewayRuns++;
+
+        if( xSource != multiwaitNO_SOURCE )
+        {
+            prvServeSource( xSource, ulNotified );
+        }
+    }
+
+    /* Unregister the wait before its stack goes away. */
+    vMultiWaitRemove( &xGatewayWait );
+    ( void ) xTaskNotifyGive( xControlTask );
+    vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunGateway( GatewayKind_t eKind )
+{
+    TaskFunction_t pxGateway = ( eKind == eGatewayMultiWait ) ? prvMultiWaitGatewayTask : prvPollingGatewayTask;
+    char cName[ 48 ];
+    uint64_t ullBackground;
+
+    ulTickCount = 0;
+    ulSent = 0;
+    ulReceived = 0;
+    ulGatewayRuns = 0;
+    ullLatencySum = 0;
+    ullLatencyWorst = 0;
+    ulLatencyCount = 0;
+
+    benchCHECK( ulFailures, xTaskCreate( pxGateway, "gateway", mwbSTACK_DEPTH, ( void * ) ( intptr_t ) eKind, mwbGATEWAY_PRIORITY, &xGatewayTask ) == pdPASS );
+
+    ullBackground = ullBackgroundLoops;
+    xRunning = pdTRUE;
+    vTaskDelay( mwbRUN_TICKS );
+    xRunning = pdFALSE;
+    ullBackground = ullBackgroundLoops - ullBackground;
+
+    /* Wait for the gateway to finish its last item, then drop what it did not
+     * read, so the next gateway starts with empty sources. */
+    ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+    ( void ) xQueueReset( xCommandQueue );
+    ( void ) xQueueReset( xSampleQueue );
+    ( void ) xStreamBufferReset( xUartStream );
+
+    while( xSemaphoreTake( xEventSemaphore, 0 ) == pdPASS )
+    {
+    }
+
+    benchCHECK( ulFailures, ulSent != 0U );
+    benchCHECK( ulFailures, ulReceived <= ulSent );
+
+    ( void ) snprintf( cName, sizeof( cName ), "%s, items read", pcGatewayNames[ eKind ] );
+    vBenchReport( cName, 100.0 * ( double ) ulReceived / ( double ) ulSent, "% of sent" );
+    ( void ) snprintf( cName, sizeof( cName ), "%s, mean latency", pcGatewayNames[ eKind ] );
+    vBenchReport( cName, ( double ) ullLatencySum / ( double ) ( ( ulLatencyCount != 0U ) ? ulLatencyCount : 1U ) / 1000.0, "us" );
+    ( void ) snprintf( cName, sizeof( cName ), "%s, worst latency", pcGatewayNames[ eKind ] );
+    vBenchReport( cName, ( double ) ullLatencyWorst / 1000.0, "us" );
+    ( void ) snprintf( cName, sizeof( cName ), "%s, gateway runs", pcGatewayNames[ eKind ] );
+    vBenchReport( cName, ( double ) ulGatewayRuns / ( double ) mwbRUN_TICKS, "per tick" );
+    ( void ) snprintf( cName, sizeof( cName ), "%s, background loops", pcGatewayNames[ eKind ] );
+    vBenchReport( cName, ( double ) ullBackground / ( double ) mwbRUN_TICKS, "per tick" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    benchCHECK( ulFailures, xTimerStart( xInterruptTimer, 0 ) == pdPASS );
+
+    /* The multi-wait gateway runs last, as its task stays registered with the
+     * sources after it is done. */
+    prvRunGateway( eGatewayPollYield );
+    prvRunGateway( eGatewayPollDelay );
+    prvRunGateway( eGatewayMultiWait );
+
+    vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    xCommandQueue = xQueueCreate( 8, sizeof( uint64_t ) );
+    xSampleQueue = xQueueCreate( 16, sizeof( uint64_t ) );
+    xUartStream = xStreamBufferCreate( 32 * sizeof( uint64_t ), sizeof( uint64_t ) );
+    xEventSemaphore = xSemaphoreCreateCounting( 100, 0 );
+    xInterruptTimer = xTimerCreate( "irq", 1, pdTRUE, NULL, prvInterruptCallback );
+
+    if( ( xCommandQueue == NULL ) || ( xSampleQueue == NULL ) || ( xUartStream == NULL ) ||
+        ( xEventSemaphore == NULL ) || ( xInterruptTimer == NULL ) ||
+        ( xTaskCreate( prvCommandTask, "command", mwbSTACK_DEPTH, NULL, mwbCOMMAND_PRIORITY, NULL ) != pdPASS ) ||
+        ( xTaskCreate( prvBackgroundTask, "background", mwbSTACK_DEPTH, NULL, mwbBACKGROUND_PRIORITY, NULL ) != pdPASS ) ||
+        ( xTaskCreate( prvControlTask, "control", mwbSTACK_DEPTH, NULL, mwbCONTROL_PRIORITY, &xControlTask ) != pdPASS ) )
+    {
+        return EXIT_FAILURE;
+    }
+
+    vTaskStartScheduler();
+
+    return ( ulFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
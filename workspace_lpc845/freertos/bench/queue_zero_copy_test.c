@@ -0,0 +1,330 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Checks of the zero-copy queue API (xQueueReserve() and xQueueBorrow()):
+ *
+ * + reserve/commit/abort: a committed slot becomes an item, an aborted one is
+ *   handed out again by the next reservation, a second reservation or one on
+ *   a full queue fails, and aborting wakes a writer blocked on the
+ *   reservation.  The same from the tick interrupt with the FromISR
+ *   functions.
+ * + ordering: a producer mixing xQueueSend() with reserve/commit and
+ *   reserve/abort/commit feeds a consumer mixing xQueueReceive() with
+ *   borrow/release through a queue of three items, once with the producer
+ *   above the consumer's priority and once below it, and every item has to
+ *   arrive once and in order.
+ *
+ * Built with a kernel that sets configUSE_QUEUE_ZERO_COPY, see
+ * bench/CMakeLists.txt.
+ */
+
+#include <stdlib.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "queue.h"
+
+#include "bench.h"
+
+#if ( configUSE_QUEUE_ZERO_COPY != 1 )
+    #error queue_zero_copy_test needs configUSE_QUEUE_ZERO_COPY set to 1.
+#endif
+
+#define zcSTACK_DEPTH         ( configMINIMAL_STACK_SIZE * 4 )
+#define zcWRITER_PRIORITY     ( configMAX_PRIORITIES - 1 )
+#define zcCONTROL_PRIORITY    ( configMAX_PRIORITIES - 2 )
+#define zcLOW_PRIORITY        ( tskIDLE_PRIORITY + 1 )
+#define zcHIGH_PRIORITY       ( tskIDLE_PRIORITY + 2 )
+
+#define zcQUEUE_LENGTH        3U
+#define zcORDER_ITEMS         3000U
+
+static uint32_t ulFailures = 0;
+
+static StaticQueue_t xQueueBuffer;
+static uint8_t ucQueueStorage[ zcQUEUE_LENGTH * sizeof( uint32_t ) ];
+static QueueHandle_t xQueue = NULL;
+
+static TaskHandle_t xControlTask = NULL;
+static TaskHandle_t xWriterTask = NULL;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvReceive( void )
+{
+    uint32_t ulItem = 0U;
+
+    benchCHECK( ulFailures, xQueueReceive( xQueue, &ulItem, 0 ) == pdPASS );
+
+    return ulItem;
+}
+/*-----------------------------------------------------------*/
+
+/* Waits for the control task, then reserves a slot, blocking while the
+ * control task holds the reservation.  Runs above the control task. */
+static void prvWriterTask( void * pvParameters )
+{
+    uint32_t * pulSlot;
+
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+        if( xQueueReserve( xQueue, ( void ** ) &pulSlot, portMAX_DELAY ) == pdPASS )
+        {
+            *pulSlot = 7U;
+            vQueueCommit( xQueue );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Runs in the tick interrupt: aborts a reservation, then commits the slot it
+ * gets again. */
+static void prvISRCallback( TimerHandle_t xTimer )
+{
+    uint32_t * pulFirst = NULL;
+    uint32_t * pulSecond = NULL;
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    ( void ) xTimer;
+
+    benchCHECK( ulFailures, xQueueReserveFromISR( xQueue, ( void ** ) &pulFirst ) == pdPASS );
+
+    if( pulFirst != NULL )
+    {
+        *pulFirst = 8U;
+        vQueueAbortReserveFromISR( xQueue, &xHigherPriorityTaskWoken );
+        benchCHECK( ulFailures, xHigherPriorityTaskWoken == pdFALSE );
+    }
+
+    benchCHECK( ulFailures, xQueueReserveFromISR( xQueue, ( void ** ) &pulSecond ) == pdPASS );
+    benchCHECK( ulFailures, pulSecond == pulFirst );
+
+    if( pulSecond != NULL )
+    {
+        *pulSecond = 9U;
+        vQueueCommitFromISR( xQueue, &xHigherPriorityTaskWoken );
+        benchCHECK( ulFailures, xHigherPriorityTaskWoken == pdTRUE );
+    }
+
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckReserve( void )
+{
+    uint32_t * pulSlot = NULL;
+    uint32_t * pulAborted = NULL;
+    uint32_t * pulAgain = NULL;
+    uint32_t ulItem = 0U;
+    UBaseType_t uxIndex;
+    StaticTimer_t xTimerBuffer;
+    TimerHandle_t xTimer;
+
+    /* Commit, abort, and the aborted slot handed out again. */
+    benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulSlot, 0 ) == pdPASS );
+    *pulSlot = 1U;
+    vQueueCommit( xQueue );
+    benchCHECK( ulFailures, uxQueueMessagesWaiting( xQueue ) == 1U );
+
+    benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulAborted, 0 ) == pdPASS );
+    benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulAgain, 0 ) == errQUEUE_FULL );
+    *pulAborted = 99U;
+    vQueueAbortReserve( xQueue );
+    benchCHECK( ulFailures, uxQueueMessagesWaiting( xQueue ) == 1U );
+
+    benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulAgain, 0 ) == pdPASS );
+    benchCHECK( ulFailures, pulAgain == pulAborted );
+    *pulAgain = 2U;
+    vQueueCommit( xQueue );
+
+    benchCHECK( ulFailures, prvReceive() == 1U );
+    benchCHECK( ulFailures, prvReceive() == 2U );
+    benchCHECK( ulFailures, uxQueueMessagesWaiting( xQueue ) == 0U );
+
+    /* No slot in a full queue, nor in an empty queue to borrow. */
+    for( uxIndex = 0; uxIndex < zcQUEUE_LENGTH; uxIndex++ )
+    {
+        benchCHECK( ulFailures, xQueueSend( xQueue, &uxIndex, 0 ) == pdPASS );
+    }
+
+    benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulSlot, 0 ) == errQUEUE_FULL );
+    ( void ) xQueueReset( xQueue );
+    benchCHECK( ulFailures, xQueueBorrow( xQueue, ( void ** ) &pulSlot, 0 ) == errQUEUE_EMPTY );
+
+    /* Aborting lets a writer blocked on the reservation take the slot. */
+    benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulAborted, 0 ) == pdPASS );
+    xTaskNotifyGive( xWriterTask );
+    benchCHECK( ulFailures, eTaskGetState( xWriterTask ) == eBlocked );
+    benchCHECK( ulFailures, uxQueueMessagesWaiting( xQueue ) == 0U );
+
+    vQueueAbortReserve( xQueue );
+    benchCHECK( ulFailures, uxQueueMessagesWaiting( xQueue ) == 1U );
+    benchCHECK( ulFailures, xQueueBorrow( xQueue, ( void ** ) &pulSlot, 0 ) == pdPASS );
+    benchCHECK( ulFailures, ( pulSlot == pulAborted ) && ( *pulSlot == 7U ) );
+    vQueueRelease( xQueue );
+
+    /* The same from the tick interrupt, waking this task with the commit. */
+    xTimer = xTimerCreateStatic( "isr", 2, pdFALSE, NULL, prvISRCallback, &xTimerBuffer );
+    benchCHECK( ulFailures, xTimerStart( xTimer, 0 ) == pdPASS );
+    benchCHECK( ulFailures, xQueueReceive( xQueue, &ulItem, pdMS_TO_TICKS( 100 ) ) == pdPASS );
+    benchCHECK( ulFailures, ulItem == 9U );
+    benchCHECK( ulFailures, uxQueueMessagesWaiting( xQueue ) == 0U );
+    ( void ) xTimerDelete( xTimer, 0 );
+
+    vBenchReport( "reserve/commit/abort, failures", ( double ) ulFailures, "" );
+}
+/*-----------------------------------------------------------*/
+
+/* Sends zcORDER_ITEMS sequence numbers, in turn by copy, through a reserved
+ * slot, and through a slot reserved, aborted and reserved again. */
+static void prvProducerTask( void * pvParameters )
+{
+    uint32_t ulItem;
+    uint32_t * pulSlot;
+
+    ( void ) pvParameters;
+
+    for( ulItem = 0U; ulItem < zcORDER_ITEMS; ulItem++ )
+    {
+        switch( ulItem % 3U )
+        {
+            case 0U:
+                benchCHECK( ulFailures, xQueueSend( xQueue, &ulItem, portMAX_DELAY ) == pdPASS );
+                break;
+
+            case 1U:
+                benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulSlot, portMAX_DELAY ) == pdPASS );
+                *pulSlot = ulItem;
+                vQueueCommit( xQueue );
+                break;
+
+            default:
+                benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulSlot, portMAX_DELAY ) == pdPASS );
+                *pulSlot = ~ulItem;
+                vQueueAbortReserve( xQueue );
+                benchCHECK( ulFailures, xQueueReserve( xQueue, ( void ** ) &pulSlot, portMAX_DELAY ) == pdPASS );
+                *pulSlot = ulItem;
+                vQueueCommit( xQueue );
+                break;
+        }
+    }
+
+    xTaskNotifyGive( xControlTask );
+    vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+/* Receives the sequence numbers, in turn by copy and by borrowing them. */
+static void prvConsumerTask( void * pvParameters )
+{
+    uint32_t ulExpected;
+    uint32_t ulItem;
+    uint32_t * pulSlot;
+    uint32_t ulOutOfOrder = 0U;
+
+    ( void ) pvParameters;
+
+    for( ulExpected = 0U; ulExpected < zcORDER_ITEMS; ulExpected++ )
+    {
+        if( ( ulExpected & 1U ) == 0U )
+        {
+            benchCHECK( ulFailures, xQueueReceive( xQueue, &ulItem, portMAX_DELAY ) == pdPASS );
+        }
+        else
+        {
+            benchCHECK( ulFailures, xQueueBorrow( xQueue, ( void ** ) &pulSlot, portMAX_DELAY ) == pdPASS );
+            ulItem = *pulSlot;
+            vQueueRelease( xQueue );
+        }
+
+        if( ulItem != ulExpected )
+        {
+            ulOutOfOrder++;
+        }
+    }
+
+    benchCHECK( ulFailures, ulOutOfOrder == 0U );
+
+    xTaskNotifyGive( xControlTask );
+    vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckOrdering( const char * pcName,
+                              UBaseType_t uxProducerPriority,
+                              UBaseType_t uxConsumerPriority )
+{
+    uint64_t ullStart;
+
+    ullStart = ullBenchTimeNs();
+
+    benchCHECK( ulFailures, xTaskCreate( prvConsumerTask, "consumer", zcSTACK_DEPTH, NULL, uxConsumerPriority, NULL ) == pdPASS );
+    benchCHECK( ulFailures, xTaskCreate( prvProducerTask, "producer", zcSTACK_DEPTH, NULL, uxProducerPriority, NULL ) == pdPASS );
+
+    benchCHECK( ulFailures, ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 5000 ) ) == 1U );
+    benchCHECK( ulFailures, ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 5000 ) ) == 1U );
+    benchCHECK( ulFailures, uxQueueMessagesWaiting( xQueue ) == 0U );
+
+    vBenchReport( pcName, ( double ) ( ullBenchTimeNs() - ullStart ) / ( double ) zcORDER_ITEMS, "ns/item" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    prvCheckReserve();
+    prvCheckOrdering( "ordering, producer above consumer", zcHIGH_PRIORITY, zcLOW_PRIORITY );
+    prvCheckOrdering( "ordering, consumer above producer", zcLOW_PRIORITY, zcHIGH_PRIORITY );
+
+    vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    xQueue = xQueueCreateStatic( zcQUEUE_LENGTH, sizeof( uint32_t ), ucQueueStorage, &xQueueBuffer );
+
+    if( ( xQueue == NULL ) ||
+        ( xTaskCreate( prvControlTask, "control", zcSTACK_DEPTH, NULL, zcCONTROL_PRIORITY, &xControlTask ) != pdPASS ) ||
+        ( xTaskCreate( prvWriterTask, "writer", zcSTACK_DEPTH, NULL, zcWRITER_PRIORITY, &xWriterTask ) != pdPASS ) )
+    {
+        return EXIT_FAILURE;
+    }
+
+    vTaskStartScheduler();
+
+    return ( ulFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,215 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Cost of finding the highest priority ready list, as tasks.c does on every
+ * context switch, with the three ways the ports implement it:
+ *
+ * + generic: configUSE_PORT_OPTIMISED_TASK_SELECTION 0, the ready lists are
+ *   scanned down from uxTopReadyPriority until one is not empty.
+ * + de Bruijn: the bitmap selection of the Cortex-M0 port (inc/portmacro.h),
+ *   which has no count leading zeros instruction.  The highest bit is smeared
+ *   into the lower ones and a 32 entry table is indexed with a multiply.
+ * + clz: the bitmap selection of the simulator (portmacro_posix.h).
+ *
+ * For each priority the only ready tasks are one at that priority and the
+ * idle task, and the scan starts from the top priority, as it does after the
+ * highest priority task blocked.  The generic cost grows with the distance
+ * from the top, the bitmap costs are flat.  Results are host cycles from the
+ * time stamp counter on x86, nanoseconds elsewhere, with the loop overhead
+ * taken off.
+ */
+
+#include <stdlib.h>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+    #include <x86intrin.h>
+#endif
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "bench.h"
+
+#define selectROUNDS    2000000UL
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+    #define selectNOW()    ( ( uint64_t ) __rdtsc() )
+    #define selectUNIT     "cycles"
+#else
+    #define selectNOW()    ullBenchTimeNs()
+    #define selectUNIT     "ns"
+#endif
+
+typedef UBaseType_t ( * SelectFunction_t )( uint32_t ulReadyPriorities );
+
+/*-----------------------------------------------------------*/
+
+static List_t xReadyLists[ configMAX_PRIORITIES ];
+static ListItem_t xReadyItems[ configMAX_PRIORITIES ];
+static uint8_t ucHighestBitTable[ 32 ];
+
+/* Read through volatiles so the compiler can neither hoist the selection out
+ * of the timing loop nor drop it. */
+static volatile uint32_t ulReadyPriorities;
+static volatile UBaseType_t uxSelected;
+
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvSelectNone( uint32_t ulReady )
+{
+    return ( UBaseType_t ) ulReady;
+}
+/*-----------------------------------------------------------*/
+
+/* taskSELECT_HIGHEST_PRIORITY_TASK() of tasks.c without the port bitmap. */
+static UBaseType_t prvSelectGeneric( uint32_t ulReady )
+{
+    UBaseType_t uxTopPriority = configMAX_PRIORITIES - 1;
+
+    ( void ) ulReady;
+
+    while( listLIST_IS_EMPTY( &( xReadyLists[ uxTopPriority ] ) ) )
+    {
+        --uxTopPriority;
+    }
+
+    return uxTopPriority;
+}
+/*-----------------------------------------------------------*/
+
+/* The sequence of uxPortHighestReadyPriority() in inc/portmacro.h.  The
+ * product is truncated to 32 bits as it is on the target. */
+static UBaseType_t prvSelectDeBruijn( uint32_t ulReady )
+{
+    ulReady |= ulReady >> 1;
+    ulReady |= ulReady >> 2;
+    ulReady |= ulReady >> 4;
+    ulReady |= ulReady >> 8;
+    ulReady |= ulReady >> 16;
+
+    return ( UBaseType_t ) ucHighestBitTable[ ( ( uint32_t ) ( ulReady * 0x07c4acddUL ) ) >> 27 ];
+}
+/*-----------------------------------------------------------*/
+
+/* portGET_HIGHEST_PRIORITY() of the simulator port. */
+static UBaseType_t prvSelectClz( uint32_t ulReady )
+{
+    UBaseType_t uxTopPriority;
+
+    portGET_HIGHEST_PRIORITY( uxTopPriority, ulReady );
+
+    return uxTopPriority;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvTime( SelectFunction_t pxSelect )
+{
+    uint64_t ullStart;
+    uint32_t ulRound;
+
+    ullStart = selectNOW();
+
+    for( ulRound = 0; ulRound < selectROUNDS; ulRound++ )
+    {
+        uxSelected = pxSelect( ulReadyPriorities );
+    }
+
+    return selectNOW() - ullStart;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    static const struct
+    {
+        const char * pcName;
+        SelectFunction_t pxSelect;
+    }
+    xMethods[] =
+    {
+        { "generic",   prvSelectGeneric  },
+        { "de Bruijn", prvSelectDeBruijn },
+        { "clz",       prvSelectClz      },
+    };
+    char cName[ 48 ];
+    uint64_t ullOverhead;
+    uint64_t ullTime;
+    uint32_t ulFailures = 0;
+    uint32_t ulValue;
+    UBaseType_t uxPriority;
+    size_t xMethod;
+
+    /* The de Bruijn multiply leaves a distinct value in the top five bits for
+     * each smeared value 2^(n+1)-1, which is mapped back to n. */
+    for( ulValue = 0; ulValue < 32U; ulValue++ )
+    {
+        ucHighestBitTable[ ( ( uint32_t ) ( ( ( 2ULL << ulValue ) - 1ULL ) * 0x07c4acddUL ) ) >> 27 ] = ( uint8_t ) ulValue;
+    }
+
+    for( uxPriority = 0; uxPriority < configMAX_PRIORITIES; uxPriority++ )
+    {
+        vListInitialise( &( xReadyLists[ uxPriority ] ) );
+        vListInitialiseItem( &( xReadyItems[ uxPriority ] ) );
+    }
+
+    /* The idle task is always ready. */
+    vListInsertEnd( &( xReadyLists[ tskIDLE_PRIORITY ] ), &( xReadyItems[ tskIDLE_PRIORITY ] ) );
+
+    ulReadyPriorities = 1UL << tskIDLE_PRIORITY;
+    ullOverhead = prvTime( prvSelectNone );
+
+    for( uxPriority = 0; uxPriority < configMAX_PRIORITIES; uxPriority++ )
+    {
+        if( uxPriority != tskIDLE_PRIORITY )
+        {
+            vListInsertEnd( &( xReadyLists[ uxPriority ] ), &( xReadyItems[ uxPriority ] ) );
+        }
+
+        ulReadyPriorities = ( 1UL << uxPriority ) | ( 1UL << tskIDLE_PRIORITY );
+
+        for( xMethod = 0; xMethod < ( sizeof( xMethods ) / sizeof( xMethods[ 0 ] ) ); xMethod++ )
+        {
+            benchCHECK( ulFailures, xMethods[ xMethod ].pxSelect( ulReadyPriorities ) == uxPriority );
+
+            ullTime = prvTime( xMethods[ xMethod ].pxSelect );
+            ullTime = ( ullTime > ullOverhead ) ? ( ullTime - ullOverhead ) : 0U;
+
+            ( void ) snprintf( cName, sizeof( cName ), "priority %u, %s", ( unsigned ) uxPriority, xMethods[ xMethod ].pcName );
+            vBenchReport( cName, ( double ) ullTime / ( double ) selectROUNDS, selectUNIT );
+        }
+
+        if( uxPriority != tskIDLE_PRIORITY )
+        {
+            ( void ) uxListRemove( &( xReadyItems[ uxPriority ] ) );
+        }
+    }
+
+    return ( ulFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,532 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Checks of the ring buffers (ring_buffer.c), for both the single producer
+ * (xRingBufferCreate()) and the multi producer (xRingBufferCreateMultiProducer())
+ * variants:
+ *
+ * + full and empty: an empty buffer reads nothing and times out, a full one
+ *   takes the whole storage area and then nothing more, and a send that does
+ *   not fit stores what fits.
+ * + wrap-around: batches of every length from 1 to 16 bytes are written and
+ *   read at every position of the storage area.
+ * + blocked reader: woken by a write from a task and from the tick interrupt.
+ * + streaming: a producer task feeds a consumer task a byte sequence in
+ *   batches of varying length, once with each above the other's priority.
+ *
+ * For the multi producer variant three tasks and the tick interrupt write at
+ * the same time.  Each byte carries its producer and a sequence number, and
+ * every producer's bytes have to arrive once and in order.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "ring_buffer.h"
+
+#include "bench.h"
+
+#define rbtSTACK_DEPTH         ( configMINIMAL_STACK_SIZE * 4 )
+#define rbtCONTROL_PRIORITY    ( configMAX_PRIORITIES - 1 )
+#define rbtREADER_PRIORITY     ( configMAX_PRIORITIES - 2 )
+#define rbtLOW_PRIORITY        ( tskIDLE_PRIORITY + 1 )
+#define rbtHIGH_PRIORITY       ( tskIDLE_PRIORITY + 2 )
+
+#define rbtSIZE                16U
+#define rbtSTREAM_BYTES        20000U
+
+/* Producers of the multi producer check, the last one is the tick interrupt.
+ * A byte holds the producer in its top two bits and its sequence number in the
+ * others. */
+#define rbtPRODUCERS           4U
+#define rbtTASK_PRODUCERS      ( rbtPRODUCERS - 1U )
+#define rbtPRODUCER_BYTES      4000U
+#define rbtISR_PRODUCER_BYTES  600U
+#define rbtSEQUENCE_MASK       0x3FU
+#define rbtPRODUCER_SHIFT      6U
+
+static uint32_t ulFailures = 0;
+
+static StaticRingBuffer_t xRingBufferStruct;
+static uint8_t ucStorage[ rbtSIZE ];
+static RingBufferHandle_t xRingBuffer = NULL;
+
+static TaskHandle_t xControlTask = NULL;
+
+/* Bytes the reader task got after being woken. */
+static volatile size_t xReaderReceived = 0;
+
+/*-----------------------------------------------------------*/
+
+static uint8_t prvSequenceByte( size_t xIndex )
+{
+    return ( uint8_t ) ( ( xIndex * 7U ) + ( xIndex >> 8 ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckFullAndEmpty( void )
+{
+    uint8_t ucTx[ rbtSIZE + 8U ];
+    uint8_t ucRx[ 2U * rbtSIZE ];
+    size_t xIndex;
+    size_t xReceived;
+    TickType_t xStart;
+
+    for( xIndex = 0; xIndex < sizeof( ucTx ); xIndex++ )
+    {
+        ucTx[ xIndex ] = ( uint8_t ) xIndex;
+    }
+
+    benchCHECK( ulFailures, xRingBufferBytesAvailable( xRingBuffer ) == 0U );
+    benchCHECK( ulFailures, xRingBufferSpacesAvailable( xRingBuffer ) == rbtSIZE );
+    benchCHECK( ulFailures, xRingBufferReceive( xRingBuffer, ucRx, sizeof( ucRx ), 0 ) == 0U );
+    benchCHECK( ulFailures, xRingBufferReceiveFromISR( xRingBuffer, ucRx, sizeof( ucRx ) ) == 0U );
+
+    xStart = xTaskGetTickCount();
+    benchCHECK( ulFailures, xRingBufferReceive( xRingBuffer, ucRx, sizeof( ucRx ), 5 ) == 0U );
+    benchCHECK( ulFailures, ( xTaskGetTickCount() - xStart ) >= 5U );
+
+    /* The whole storage area is used, the rest of the batch is dropped. */
+    benchCHECK( ulFailures, xRingBufferSend( xRingBuffer, ucTx, sizeof( ucTx ) ) == rbtSIZE );
+    benchCHECK( ulFailures, xRingBufferSpacesAvailable( xRingBuffer ) == 0U );
+    benchCHECK( ulFailures, xRingBufferBytesAvailable( xRingBuffer ) == rbtSIZE );
+    benchCHECK( ulFailures, xRingBufferSend( xRingBuffer, ucTx, 1 ) == 0U );
+
+    /* Free five bytes and write seven, five of which fit, across the end of
+     * the storage area. */
+    benchCHECK( ulFailures, xRingBufferReceive( xRingBuffer, ucRx, 5, 0 ) == 5U );
+    benchCHECK( ulFailures, memcmp( ucRx, ucTx, 5 ) == 0 );
+    benchCHECK( ulFailures, xRingBufferSend( xRingBuffer, &ucTx[ rbtSIZE ], 7 ) == 5U );
+
+    xReceived = xRingBufferReceive( xRingBuffer, ucRx, sizeof( ucRx ), 0 );
+    benchCHECK( ulFailures, xReceived == rbtSIZE );
+    benchCHECK( ulFailures, memcmp( ucRx, &ucTx[ 5 ], rbtSIZE ) == 0 );
+    benchCHECK( ulFailures, xRingBufferBytesAvailable( xRingBuffer ) == 0U );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckWrapAround( void )
+{
+    uint8_t ucTx[ rbtSIZE ];
+    uint8_t ucRx[ rbtSIZE ];
+    size_t xLength;
+    size_t xOffset;
+    size_t xIndex;
+    size_t xNext = 0;
+    uint32_t ulMismatches = 0;
+
+    /* After each batch the buffer starts one byte further on, so every length
+     * is written and read at every position. */
+    for( xLength = 1U; xLength <= rbtSIZE; xLength++ )
+    {
+        for( xOffset = 0U; xOffset < rbtSIZE; xOffset++ )
+        {
+            for( xIndex = 0; xIndex < xLength; xIndex++ )
+            {
+                ucTx[ xIndex ] = prvSequenceByte( xNext + xIndex );
+            }
+
+            if( ( xRingBufferSend( xRingBuffer, ucTx, xLength ) != xLength ) ||
+                ( xRingBufferReceive( xRingBuffer, ucRx, xLength, 0 ) != xLength ) ||
+                ( memcmp( ucTx, ucRx, xLength ) != 0 ) )
+            {
+                ulMismatches++;
+            }
+
+            xNext += xLength;
+
+            /* Move on by one byte. */
+            ucTx[ 0 ] = 0U;
+
+            if( ( xRingBufferSend( xRingBuffer, ucTx, 1 ) != 1U ) ||
+                ( xRingBufferReceive( xRingBuffer, ucRx, 1, 0 ) != 1U ) )
+            {
+                ulMismatches++;
+            }
+        }
+    }
+
+    benchCHECK( ulFailures, ulMismatches == 0U );
+    benchCHECK( ulFailures, xRingBufferBytesAvailable( xRingBuffer ) == 0U );
+}
+/*-----------------------------------------------------------*/
+
+/* Blocks until the control task or the tick interrupt writes. */
+static void prvReaderTask( void * pvParameters )
+{
+    uint8_t ucRx[ rbtSIZE ];
+
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        xReaderReceived = xRingBufferReceive( xRingBuffer, ucRx, sizeof( ucRx ), portMAX_DELAY );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvWakeReaderCallback( TimerHandle_t xTimer )
+{
+    static const uint8_t ucTx[ 2 ] = { 1U, 2U };
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    ( void ) xTimer;
+
+    benchCHECK( ulFailures, xRingBufferSendFromISR( xRingBuffer, ucTx, sizeof( ucTx ), &xHigherPriorityTaskWoken ) == sizeof( ucTx ) );
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+
+static void prvCheckBlockedReader( void )
+{
+    static const uint8_t ucTx[ 3 ] = { 1U, 2U, 3U };
+    TaskHandle_t xReader = NULL;
+    StaticTimer_t xTimerBuffer;
+    TimerHandle_t xTimer;
+
+    xReaderReceived = 0U;
+    benchCHECK( ulFailures, xTaskCreate( prvReaderTask, "reader", rbtSTACK_DEPTH, NULL, rbtREADER_PRIORITY, &xReader ) == pdPASS );
+
+    /* The reader runs above the writer here, so it has read the bytes by the
+     * time the delay ends. */
+    vTaskDelay( 2 );
+    benchCHECK( ulFailures, eTaskGetState( xReader ) == eBlocked );
+    vTaskPrioritySet( NULL, rbtLOW_PRIORITY );
+    benchCHECK( ulFailures, xRingBufferSend( xRingBuffer, ucTx, sizeof( ucTx ) ) == sizeof( ucTx ) );
+    vTaskPrioritySet( NULL, rbtCONTROL_PRIORITY );
+    benchCHECK( ulFailures, xReaderReceived == sizeof( ucTx ) );
+
+    xTimer = xTimerCreateStatic( "wake", 2, pdFALSE, NULL, prvWakeReaderCallback, &xTimerBuffer );
+    benchCHECK( ulFailures, xTimerStart( xTimer, 0 ) == pdPASS );
+    vTaskDelay( 5 );
+    benchCHECK( ulFailures, xReaderReceived == 2U );
+    ( void ) xTimerDelete( xTimer, 0 );
+
+    vTaskDelete( xReader );
+    benchCHECK( ulFailures, xRingBufferBytesAvailable( xRingBuffer ) == 0U );
+}
+/*-----------------------------------------------------------*/
+
+/* Sends rbtSTREAM_BYTES bytes of the sequence in batches of 1 to 13 bytes,
+ * waiting a tick whenever the buffer is full. */
+static void prvStreamProducerTask( void * pvParameters )
+{
+    uint8_t ucTx[ 13 ];
+    size_t xNext = 0;
+    size_t xLength;
+    size_t xIndex;
+    size_t xSent;
+
+    ( void ) pvParameters;
+
+    while( xNext < rbtSTREAM_BYTES )
+    {
+        xLength = ( xNext % sizeof( ucTx ) ) + 1U;
+
+        if( xLength > ( rbtSTREAM_BYTES - xNext ) )
+        {
+            xLength = rbtSTREAM_BYTES - xNext;
+        }
+
+        for( xIndex = 0; xIndex < xLength; xIndex++ )
+        {
+            ucTx[ xIndex ] = prvSequenceByte( xNext + xIndex );
+        }
+
+        xSent = xRingBufferSend( xRingBuffer, ucTx, xLength );
+        xNext += xSent;
+
+        if( xSent < xLength )
+        {
+            vTaskDelay( 1 );
+        }
+    }
+
+    xTaskNotifyGive( xControlTask );
+    vTaskDelete( NULL );
+}
+
+static void prvStreamConsumerTask( void * pvParameters )
+{
+    uint8_t ucRx[ 11 ];
+    size_t xNext = 0;
+    size_t xReceived;
+    size_t xIndex;
+    uint32_t ulMismatches = 0;
+
+    ( void ) pvParameters;
+
+    while( xNext < rbtSTREAM_BYTES )
+    {
+        xReceived = xRingBufferReceive( xRingBuffer, ucRx, sizeof( ucRx ), pdMS_TO_TICKS( 1000 ) );
+
+        if( xReceived == 0U )
+        {
+            break;
+        }
+
+        for( xIndex = 0; xIndex < xReceived; xIndex++ )
+        {
+            if( ucRx[ xIndex ] != prvSequenceByte( xNext + xIndex ) )
+            {
+                ulMismatches++;
+            }
+        }
+
+        xNext += xReceived;
+    }
+
+    benchCHECK( ulFailures, ulMismatches == 0U );
+    benchCHECK( ulFailures, xNext == rbtSTREAM_BYTES );
+
+    xTaskNotifyGive( xControlTask );
+    vTaskDelete( NULL );
+}
+
+static void prvCheckStreaming( UBaseType_t uxProducerPriority,
+                               UBaseType_t uxConsumerPriority )
+{
+    benchCHECK( ulFailures, xTaskCreate( prvStreamConsumerTask, "consumer", rbtSTACK_DEPTH, NULL, uxConsumerPriority, NULL ) == pdPASS );
+    benchCHECK( ulFailures, xTaskCreate( prvStreamProducerTask, "producer", rbtSTACK_DEPTH, NULL, uxProducerPriority, NULL ) == pdPASS );
+
+    benchCHECK( ulFailures, ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 30000 ) ) == 1U );
+    benchCHECK( ulFailures, ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 30000 ) ) == 1U );
+    benchCHECK( ulFailures, xRingBufferBytesAvailable( xRingBuffer ) == 0U );
+}
+/*-----------------------------------------------------------*/
+
+/* Sends the bytes of one producer from xNext on, as many as fit of up to
+ * xLength bytes, and returns the number sent. */
+static size_t prvSendProducerBytes( UBaseType_t uxProducer,
+                                    size_t xNext,
+                                    size_t xLength,
+                                    BaseType_t * pxHigherPriorityTaskWoken )
+{
+    uint8_t ucTx[ 8 ];
+    size_t xIndex;
+
+    configASSERT( xLength <= sizeof( ucTx ) );
+
+    for( xIndex = 0; xIndex < xLength; xIndex++ )
+    {
+        ucTx[ xIndex ] = ( uint8_t ) ( ( uxProducer << rbtPRODUCER_SHIFT ) | ( ( xNext + xIndex ) & rbtSEQUENCE_MASK ) );
+    }
+
+    if( pxHigherPriorityTaskWoken != NULL )
+    {
+        return xRingBufferSendFromISR( xRingBuffer, ucTx, xLength, pxHigherPriorityTaskWoken );
+    }
+
+    return xRingBufferSend( xRingBuffer, ucTx, xLength );
+}
+
+static void prvRacingProducerTask( void * pvParameters )
+{
+    const UBaseType_t uxProducer = ( UBaseType_t ) ( uintptr_t ) pvParameters;
+    size_t xNext = 0;
+    size_t xLength;
+    size_t xSent;
+
+    while( xNext < rbtPRODUCER_BYTES )
+    {
+        xLength = ( ( xNext + uxProducer ) % 8U ) + 1U;
+
+        if( xLength > ( rbtPRODUCER_BYTES - xNext ) )
+        {
+            xLength = rbtPRODUCER_BYTES - xNext;
+        }
+
+        xSent = prvSendProducerBytes( uxProducer, xNext, xLength, NULL );
+        xNext += xSent;
+
+        if( xSent < xLength )
+        {
+            vTaskDelay( 1 );
+        }
+        else
+        {
+            taskYIELD();
+        }
+    }
+
+    xTaskNotifyGive( xControlTask );
+    vTaskDelete( NULL );
+}
+
+static size_t xISRProducerNext = 0;
+
+static void prvRacingProducerCallback( TimerHandle_t xTimer )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    size_t xLength = rbtISR_PRODUCER_BYTES - xISRProducerNext;
+
+    ( void ) xTimer;
+
+    if( xLength > 3U )
+    {
+        xLength = 3U;
+    }
+
+    xISRProducerNext += prvSendProducerBytes( rbtTASK_PRODUCERS, xISRProducerNext, xLength, &xHigherPriorityTaskWoken );
+
+    if( xISRProducerNext == rbtISR_PRODUCER_BYTES )
+    {
+        ( void ) xTimerStopFromISR( xTimer, NULL );
+    }
+
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+
+static void prvRacingConsumerTask( void * pvParameters )
+{
+    static const size_t xExpected[ rbtPRODUCERS ] = { rbtPRODUCER_BYTES, rbtPRODUCER_BYTES, rbtPRODUCER_BYTES, rbtISR_PRODUCER_BYTES };
+    size_t xReceivedFrom[ rbtPRODUCERS ] = { 0 };
+    size_t xTotal = ( rbtTASK_PRODUCERS * rbtPRODUCER_BYTES ) + rbtISR_PRODUCER_BYTES;
+    uint8_t ucRx[ rbtSIZE ];
+    size_t xReceived;
+    size_t xIndex;
+    UBaseType_t uxProducer;
+    uint32_t ulMismatches = 0;
+
+    ( void ) pvParameters;
+
+    while( xTotal > 0U )
+    {
+        xReceived = xRingBufferReceive( xRingBuffer, ucRx, sizeof( ucRx ), pdMS_TO_TICKS( 1000 ) );
+
+        if( xReceived == 0U )
+        {
+            break;
+        }
+
+        for( xIndex = 0; xIndex < xReceived; xIndex++ )
+        {
+            uxProducer = ( UBaseType_t ) ( ucRx[ xIndex ] >> rbtPRODUCER_SHIFT );
+
+            if( ( ucRx[ xIndex ] & rbtSEQUENCE_MASK ) != ( xReceivedFrom[ uxProducer ] & rbtSEQUENCE_MASK ) )
+            {
+                ulMismatches++;
+            }
+
+            xReceivedFrom[ uxProducer ]++;
+        }
+
+        xTotal -= ( xReceived < xTotal ) ? xReceived : xTotal;
+    }
+
+    benchCHECK( ulFailures, ulMismatches == 0U );
+
+    for( uxProducer = 0; uxProducer < rbtPRODUCERS; uxProducer++ )
+    {
+        benchCHECK( ulFailures, xReceivedFrom[ uxProducer ] == xExpected[ uxProducer ] );
+    }
+
+    xTaskNotifyGive( xControlTask );
+    vTaskDelete( NULL );
+}
+
+static void prvCheckRacingProducers( UBaseType_t uxConsumerPriority )
+{
+    StaticTimer_t xTimerBuffer;
+    TimerHandle_t xTimer;
+    UBaseType_t uxProducer;
+
+    xISRProducerNext = 0U;
+    xTimer = xTimerCreateStatic( "isr", 1, pdTRUE, NULL, prvRacingProducerCallback, &xTimerBuffer );
+
+    benchCHECK( ulFailures, xTaskCreate( prvRacingConsumerTask, "consumer", rbtSTACK_DEPTH, NULL, uxConsumerPriority, NULL ) == pdPASS );
+
+    for( uxProducer = 0; uxProducer < rbtTASK_PRODUCERS; uxProducer++ )
+    {
+        benchCHECK( ulFailures, xTaskCreate( prvRacingProducerTask, "producer", rbtSTACK_DEPTH, ( void * ) ( uintptr_t ) uxProducer, rbtLOW_PRIORITY, NULL ) == pdPASS );
+    }
+
+    benchCHECK( ulFailures, xTimerStart( xTimer, 0 ) == pdPASS );
+
+    for( uxProducer = 0; uxProducer <= rbtTASK_PRODUCERS; uxProducer++ )
+    {
+        benchCHECK( ulFailures, ulTaskNotifyTake( pdFALSE, pdMS_TO_TICKS( 30000 ) ) == 1U );
+    }
+
+    ( void ) xTimerDelete( xTimer, 0 );
+    benchCHECK( ulFailures, xRingBufferBytesAvailable( xRingBuffer ) == 0U );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckVariant( const char * pcName,
+                             BaseType_t xMultiProducer )
+{
+    uint64_t ullStart = ullBenchTimeNs();
+
+    xRingBuffer = xRingBufferGenericCreateStatic( rbtSIZE, xMultiProducer, ucStorage, &xRingBufferStruct );
+    benchCHECK( ulFailures, xRingBuffer != NULL );
+
+    prvCheckFullAndEmpty();
+    prvCheckWrapAround();
+    prvCheckBlockedReader();
+    prvCheckStreaming( rbtHIGH_PRIORITY, rbtLOW_PRIORITY );
+    prvCheckStreaming( rbtLOW_PRIORITY, rbtHIGH_PRIORITY );
+
+    if( xMultiProducer != pdFALSE )
+    {
+        prvCheckRacingProducers( rbtHIGH_PRIORITY );
+        prvCheckRacingProducers( tskIDLE_PRIORITY );
+    }
+
+    vRingBufferDelete( xRingBuffer );
+
+    vBenchReport( pcName, ( double ) ( ullBenchTimeNs() - ullStart ) / 1000000.0, "ms" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    prvCheckVariant( "single producer", pdFALSE );
+    prvCheckVariant( "multi producer", pdTRUE );
+
+    vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    if( xTaskCreate( prvControlTask, "control", rbtSTACK_DEPTH, NULL, rbtCONTROL_PRIORITY, &xControlTask ) != pdPASS )
+    {
+        return EXIT_FAILURE;
+    }
+
+    vTaskStartScheduler();
+
+    return ( ulFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
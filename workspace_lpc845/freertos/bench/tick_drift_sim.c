@@ -0,0 +1,263 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Tick drift of the WKT tickless idle of the Cortex-M0 port, simulated over
+ * hours of idle time.
+ *
+ * The time arithmetic of prvSuppressTicksWithWkt() (src/port_wkt.h) is run
+ * against a model of the SysTick and of the low power oscillator.  Time is
+ * counted in core clock cycles, and the oscillator edges fall on the first
+ * cycle at or after phase + k * period, with the period a fraction of cycles.
+ * The WKT is calibrated as prvSetupWkt() does, then the kernel alternates
+ * between running for a few ticks and sleeping for 5 to 2000 ticks.  A third
+ * of the sleeps are ended early by an interrupt.
+ *
+ * The drift is how far the next tick interrupt is from where it would be had
+ * the SysTick run through every sleep.  Most of it is the calibration error,
+ * under one cycle in configTICKLESS_WKT_CALIBRATION_COUNTS periods, times the
+ * periods slept: a rate of a few parts per million that no arithmetic can
+ * take out.  The rest, the residual, comes from the edges falling between
+ * cycles: under one cycle per sleep, of either sign, so it may only grow like
+ * a random walk, with the square root of the number of sleeps.  That shows
+ * the fractions carried from one sleep to the next do not build up.  With a
+ * whole number of cycles per period both are 0 and so is the drift.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "port_wkt.h"
+
+#include "bench.h"
+
+/* 30 MHz core clock, 1 kHz tick. */
+#define driftCOUNTS_PER_TICK      30000UL
+
+#define driftCALIBRATION_COUNTS   128UL
+#define driftRESTART_COUNTS       12UL
+
+/* Cycles from the wake up to the SysTick restart, as the calculation takes. */
+#define driftCALCULATION_COUNTS   400UL
+
+/* Cycles from the WKT alarm to the first instruction after the wfi, known to
+ * the port through configTICKLESS_DEEP_SLEEP_WAKEUP_COUNTS. */
+#define driftWAKEUP_COUNTS        900UL
+
+#define driftHOURS                4ULL
+#define driftTOTAL_COUNTS         ( driftHOURS * 3600ULL * 1000ULL * driftCOUNTS_PER_TICK )
+
+typedef struct DriftCase
+{
+    const char * pcName;
+    uint64_t ullPeriodNum; /* Oscillator period in cycles is num / den. */
+    uint64_t ullPeriodDen;
+    uint64_t ullPhase;
+} DriftCase_t;
+
+/*-----------------------------------------------------------*/
+
+static const DriftCase_t * pxCase;
+static uint32_t ulRandom = 0x2545F491UL;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( uint32_t ulRange )
+{
+    /* xorshift32, every case sees the same sequence of sleeps. */
+    ulRandom ^= ulRandom << 13;
+    ulRandom ^= ulRandom >> 17;
+    ulRandom ^= ulRandom << 5;
+
+    return ulRandom % ulRange;
+}
+/*-----------------------------------------------------------*/
+
+/* Cycle of oscillator edge ullEdge. */
+static uint64_t prvEdgeTime( uint64_t ullEdge )
+{
+    uint64_t ullScaled = ( pxCase->ullPhase * pxCase->ullPeriodDen ) + ( ullEdge * pxCase->ullPeriodNum );
+
+    return ( ullScaled + pxCase->ullPeriodDen - 1U ) / pxCase->ullPeriodDen;
+}
+/*-----------------------------------------------------------*/
+
+/* First oscillator edge after cycle ullTime. */
+static uint64_t prvNextEdge( uint64_t ullTime )
+{
+    uint64_t ullEdge = 0;
+
+    if( ullTime >= pxCase->ullPhase )
+    {
+        ullEdge = ( ( ullTime - pxCase->ullPhase ) * pxCase->ullPeriodDen ) / pxCase->ullPeriodNum;
+    }
+
+    while( prvEdgeTime( ullEdge ) <= ullTime )
+    {
+        ullEdge++;
+    }
+
+    return ullEdge;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRunCase( const DriftCase_t * pxRunCase )
+{
+    char cName[ 64 ];
+    uint32_t ulFailures = 0;
+    uint32_t ulCountsPerWktPeriod, ulFraction = 0;
+    uint32_t ulExpectedIdle, ulCountsToNextTick, ulPeriods, ulTicksBefore;
+    uint32_t ulElapsed, ulCompleteTickPeriods, ulReloadValue, ulExtraCounts;
+    uint64_t ullTime = 0, ullNextTick = driftCOUNTS_PER_TICK, ullKernelTicks = 0;
+    uint64_t ullStartEdge, ullEndEdge, ullWakeTime, ullSleptPeriods = 0, ullSleeps = 0;
+    int64_t llDrift = 0;
+    double dCalibrationError, dResidual, dMaxResidual = 0.0;
+
+    pxCase = pxRunCase;
+    ulRandom = 0x2545F491UL;
+
+    /* prvSetupWkt(): whole periods timed from one edge to another. */
+    ullStartEdge = prvNextEdge( 0 );
+    ulCountsPerWktPeriod = ulPortWktCountsPerPeriod( ( uint32_t ) ( prvEdgeTime( ullStartEdge + driftCALIBRATION_COUNTS ) - prvEdgeTime( ullStartEdge ) ),
+                                                     driftCALIBRATION_COUNTS );
+
+    /* Cycles per period the port overestimates the period by. */
+    dCalibrationError = ( ( double ) ulCountsPerWktPeriod / 65536.0 ) - ( ( double ) pxCase->ullPeriodNum / ( double ) pxCase->ullPeriodDen );
+    benchCHECK( ulFailures, fabs( dCalibrationError ) < ( 1.0 / ( double ) driftCALIBRATION_COUNTS ) + ( 1.0 / 65536.0 ) );
+
+    while( ullTime < driftTOTAL_COUNTS )
+    {
+        /* Awake for up to 20 ticks, idle from a random point in a tick. */
+        ulTicksBefore = prvRandom( 21 );
+        ullKernelTicks += ulTicksBefore;
+        ullNextTick += ( uint64_t ) ulTicksBefore * driftCOUNTS_PER_TICK;
+        ullTime += prvRandom( ( uint32_t ) ( ullNextTick - ullTime ) );
+
+        ulExpectedIdle = 5UL + prvRandom( 1996 );
+        ulTicksBefore = 0;
+
+        /* Alarm aimed before the last tick of the idle period. */
+        ulCountsToNextTick = ( uint32_t ) ( ullNextTick - ullTime );
+        ulElapsed = ulCountsToNextTick + ( driftCOUNTS_PER_TICK * ( ulExpectedIdle - 1UL ) );
+        ulPeriods = ulPortWktAlarmPeriods( ulElapsed, ulCountsPerWktPeriod );
+
+        /* SysTick stopped at the next edge, a tick may have come first. */
+        ullStartEdge = prvNextEdge( ullTime );
+
+        if( prvEdgeTime( ullStartEdge ) >= ullNextTick )
+        {
+            ulTicksBefore++;
+            ullNextTick += driftCOUNTS_PER_TICK;
+        }
+
+        ulCountsToNextTick = ( uint32_t ) ( ullNextTick - prvEdgeTime( ullStartEdge ) );
+
+        /* Woken by the alarm, or by an interrupt and timed to the next edge. */
+        ullEndEdge = ullStartEdge + ulPeriods;
+
+        if( ( prvRandom( 3 ) == 0U ) && ( ulPeriods > 1UL ) )
+        {
+            ullWakeTime = prvEdgeTime( ullStartEdge ) + prvRandom( ( uint32_t ) ( prvEdgeTime( ullEndEdge ) - prvEdgeTime( ullStartEdge ) ) );
+            ullEndEdge = prvNextEdge( ullWakeTime );
+            ullWakeTime = prvEdgeTime( ullEndEdge );
+            ulExtraCounts = 0;
+        }
+        else
+        {
+            ullWakeTime = prvEdgeTime( ullEndEdge ) + driftWAKEUP_COUNTS;
+            ulExtraCounts = driftWAKEUP_COUNTS;
+        }
+
+        ullSleptPeriods += ullEndEdge - ullStartEdge;
+        ullSleeps++;
+
+        /* The SysTick runs free from ullWakeTime and is restarted for the
+         * remainder of the tick period. */
+        ulElapsed = ulPortWktPeriodsToCounts( ( uint32_t ) ( ullEndEdge - ullStartEdge ), ulCountsPerWktPeriod, &ulFraction ) + ulExtraCounts;
+        ulCompleteTickPeriods = ulTicksBefore + ulPortWktTickPeriods( ulElapsed, ulCountsToNextTick, driftCOUNTS_PER_TICK, &ulReloadValue );
+        ulCompleteTickPeriods += ulPortWktSkipRestart( driftCALCULATION_COUNTS + driftRESTART_COUNTS, driftCOUNTS_PER_TICK, &ulReloadValue );
+
+        /* The alarm leaves the last tick period of the idle time to the
+         * SysTick, so the port never has to limit the step. */
+        benchCHECK( ulFailures, ulCompleteTickPeriods <= ulExpectedIdle );
+
+        ullKernelTicks += ulCompleteTickPeriods;
+        ullNextTick = ullWakeTime + ulReloadValue;
+        ullTime = ullWakeTime + driftCALCULATION_COUNTS + driftRESTART_COUNTS;
+
+        /* An overestimated period makes the kernel count ticks early. */
+        llDrift = ( int64_t ) ullNextTick - ( int64_t ) ( ( ullKernelTicks + 1U ) * driftCOUNTS_PER_TICK );
+        dResidual = fabs( ( double ) llDrift + ( ( double ) ullSleptPeriods * dCalibrationError ) );
+
+        if( dResidual > dMaxResidual )
+        {
+            dMaxResidual = dResidual;
+        }
+    }
+
+    ( void ) snprintf( cName, sizeof( cName ), "%s, idle", pxCase->pcName );
+    vBenchReport( cName, ( double ) ullSleeps, "periods" );
+    ( void ) snprintf( cName, sizeof( cName ), "%s, drift", pxCase->pcName );
+    vBenchReport( cName, ( double ) llDrift, "cycles" );
+    ( void ) snprintf( cName, sizeof( cName ), "%s, drift rate", pxCase->pcName );
+    vBenchReport( cName, ( double ) llDrift * 1e9 / ( double ) ullTime, "ppb" );
+    ( void ) snprintf( cName, sizeof( cName ), "%s, max residual", pxCase->pcName );
+    vBenchReport( cName, dMaxResidual, "cycles" );
+
+    benchCHECK( ulFailures, dMaxResidual < 4.0 * sqrt( ( double ) ullSleeps ) );
+
+    if( ( pxCase->ullPeriodNum % pxCase->ullPeriodDen ) == 0U )
+    {
+        benchCHECK( ulFailures, llDrift == 0 );
+    }
+
+    return ulFailures;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    static const DriftCase_t xCases[] =
+    {
+        { "LPO 3000 cycles",    3000,  1, 17 },
+        { "LPO 3000.25 cycles", 12001, 4, 5  },
+        { "LPO 2987.6 cycles",  14938, 5, 0  },
+        { "LPO 3333.3 cycles",  10000, 3, 91 },
+    };
+    uint32_t ulFailures = 0;
+    size_t xCase;
+
+    ( void ) printf( "%llu hours of simulated time per case\n", ( unsigned long long ) driftHOURS );
+
+    for( xCase = 0; xCase < ( sizeof( xCases ) / sizeof( xCases[ 0 ] ) ); xCase++ )
+    {
+        ulFailures += prvRunCase( &( xCases[ xCase ] ) );
+    }
+
+    return ( ulFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,357 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Checks of the daemon-less software timers (tick_timers.c):
+ *
+ * + ordering: one-shot and auto-reload timers started on the same tick expire
+ *   on the ticks their periods give, timers due on the same tick in the order
+ *   they were started or reloaded.
+ * + commands from a callback: a callback running in the tick restarts its own
+ *   timer, stops, changes the period of and deletes other timers, and an
+ *   auto-reload timer stops itself.
+ * + deferred callbacks: run by the timer task, where a callback may delete
+ *   its own dynamically allocated timer, and expiries that happen while the
+ *   task can't run merge into one run.
+ *
+ * Built with a kernel that sets configTIMER_DEFERRED_CALLBACKS, see
+ * bench/CMakeLists.txt.
+ */
+
+#include <stdlib.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include "bench.h"
+
+#if ( configTIMERS_RUN_FROM_TICK != 1 ) || ( configTIMER_DEFERRED_CALLBACKS != 1 )
+    #error tick_timers_test needs configTIMERS_RUN_FROM_TICK and configTIMER_DEFERRED_CALLBACKS set to 1.
+#endif
+
+#define ttSTACK_DEPTH        ( configMINIMAL_STACK_SIZE * 4 )
+#define ttCONTROL_PRIORITY   ( configMAX_PRIORITIES - 1 )
+#define ttLOG_LENGTH         32U
+#define ttTIMERS             6U
+
+/* A callback run, by timer ID and tick relative to the start of the check. */
+typedef struct
+{
+    uintptr_t uxID;
+    TickType_t xTick;
+} ExpiryRecord_t;
+
+static uint32_t ulFailures = 0;
+
+static StaticTimer_t xTimerBuffers[ ttTIMERS ];
+static TimerHandle_t xTimers[ ttTIMERS ];
+
+static ExpiryRecord_t xLog[ ttLOG_LENGTH ];
+static volatile UBaseType_t uxLogLength = 0;
+static TickType_t xStartTick = 0;
+
+/*-----------------------------------------------------------*/
+
+/* Records a callback run.  Called from the tick interrupt or the timer task,
+ * so the log is only read once the timers are stopped. */
+static void prvLog( TimerHandle_t xTimer )
+{
+    UBaseType_t uxSavedInterruptStatus;
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        if( uxLogLength < ttLOG_LENGTH )
+        {
+            xLog[ uxLogLength ].uxID = ( uintptr_t ) pvTimerGetTimerID( xTimer );
+            xLog[ uxLogLength ].xTick = xTaskGetTickCountFromISR() - xStartTick;
+            uxLogLength++;
+        }
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static TimerHandle_t prvCreate( UBaseType_t uxIndex,
+                                TickType_t xPeriod,
+                                BaseType_t xAutoReload,
+                                TimerCallbackFunction_t pxCallback )
+{
+    xTimers[ uxIndex ] = xTimerCreateStatic( "t", xPeriod, xAutoReload, ( void * ) ( uxIndex + 1U ), pxCallback, &xTimerBuffers[ uxIndex ] );
+    benchCHECK( ulFailures, xTimers[ uxIndex ] != NULL );
+
+    return xTimers[ uxIndex ];
+}
+/*-----------------------------------------------------------*/
+
+/* Starts the timers in array order on one tick, which becomes tick 0 of the
+ * log. */
+static void prvStartAll( UBaseType_t uxCount )
+{
+    UBaseType_t uxIndex;
+
+    uxLogLength = 0U;
+
+    taskENTER_CRITICAL();
+    {
+        xStartTick = xTaskGetTickCount();
+
+        for( uxIndex = 0; uxIndex < uxCount; uxIndex++ )
+        {
+            benchCHECK( ulFailures, xTimerStart( xTimers[ uxIndex ], 0 ) == pdPASS );
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvStopAll( UBaseType_t uxCount )
+{
+    UBaseType_t uxIndex;
+
+    for( uxIndex = 0; uxIndex < uxCount; uxIndex++ )
+    {
+        ( void ) xTimerStop( xTimers[ uxIndex ], 0 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckLog( const char * pcName,
+                         const ExpiryRecord_t * pxExpected,
+                         UBaseType_t uxExpected )
+{
+    UBaseType_t uxIndex;
+    uint32_t ulMismatches = 0;
+
+    for( uxIndex = 0; uxIndex < uxExpected; uxIndex++ )
+    {
+        if( ( uxIndex >= uxLogLength ) ||
+            ( xLog[ uxIndex ].uxID != pxExpected[ uxIndex ].uxID ) ||
+            ( xLog[ uxIndex ].xTick != pxExpected[ uxIndex ].xTick ) )
+        {
+            ulMismatches++;
+        }
+    }
+
+    benchCHECK( ulFailures, ulMismatches == 0U );
+
+    if( ulMismatches != 0U )
+    {
+        for( uxIndex = 0; uxIndex < uxLogLength; uxIndex++ )
+        {
+            ( void ) printf( "  %s: timer %u at tick %u\n", pcName, ( unsigned ) xLog[ uxIndex ].uxID, ( unsigned ) xLog[ uxIndex ].xTick );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* One-shot timers of 5, 3, 8 and 3 ticks and an auto-reload timer of 4 ticks.
+ * The two 3 tick timers expire in the order they were started, and the
+ * reloaded timer due on tick 8 after the one-shot timer already due then. */
+static void prvCheckOrdering( void )
+{
+    static const ExpiryRecord_t xExpected[] =
+    {
+        { 2, 3 }, { 4, 3 }, { 5, 4 }, { 1, 5 }, { 3, 8 }, { 5, 8 }, { 5, 12 }, { 5, 16 }, { 5, 20 }
+    };
+    UBaseType_t uxIndex;
+
+    ( void ) prvCreate( 0, 5, pdFALSE, prvLog );
+    ( void ) prvCreate( 1, 3, pdFALSE, prvLog );
+    ( void ) prvCreate( 2, 8, pdFALSE, prvLog );
+    ( void ) prvCreate( 3, 3, pdFALSE, prvLog );
+    ( void ) prvCreate( 4, 4, pdTRUE, prvLog );
+
+    prvStartAll( 5 );
+    vTaskDelay( 22 );
+    prvStopAll( 5 );
+
+    prvCheckLog( "ordering", xExpected, sizeof( xExpected ) / sizeof( xExpected[ 0 ] ) );
+
+    for( uxIndex = 0; uxIndex < uxLogLength; uxIndex++ )
+    {
+        benchCHECK( ulFailures, ( xLog[ uxIndex ].xTick <= 20U ) || ( xLog[ uxIndex ].uxID == 5U ) );
+    }
+
+    vBenchReport( "ordering, callbacks checked", ( double ) uxLogLength, "" );
+}
+/*-----------------------------------------------------------*/
+
+/* Timer 1, one-shot of 2 ticks: on its first run restarts itself, stops
+ * timer 2, changes the period of timer 3 to 6 ticks and deletes timer 4.
+ * Timer 5, auto-reload of 3 ticks, stops itself on its second run. */
+static void prvCommandingCallback( TimerHandle_t xTimer )
+{
+    prvLog( xTimer );
+
+    if( uxLogLength == 1U )
+    {
+        benchCHECK( ulFailures, xTimerStart( xTimer, 0 ) == pdPASS );
+        benchCHECK( ulFailures, xTimerStop( xTimers[ 1 ], 0 ) == pdPASS );
+        benchCHECK( ulFailures, xTimerChangePeriod( xTimers[ 2 ], 6, 0 ) == pdPASS );
+        benchCHECK( ulFailures, xTimerDelete( xTimers[ 3 ], 0 ) == pdPASS );
+    }
+}
+
+static void prvSelfStoppingCallback( TimerHandle_t xTimer )
+{
+    static UBaseType_t uxRuns = 0;
+
+    prvLog( xTimer );
+
+    if( ++uxRuns == 2U )
+    {
+        benchCHECK( ulFailures, xTimerStop( xTimer, 0 ) == pdPASS );
+    }
+}
+
+static void prvCheckCommandsFromCallback( void )
+{
+    static const ExpiryRecord_t xExpected[] =
+    {
+        { 1, 2 }, { 5, 3 }, { 1, 4 }, { 5, 6 }, { 3, 8 }
+    };
+
+    ( void ) prvCreate( 0, 2, pdFALSE, prvCommandingCallback );
+    ( void ) prvCreate( 1, 5, pdFALSE, prvLog );
+    ( void ) prvCreate( 2, 3, pdFALSE, prvLog );
+    ( void ) prvCreate( 3, 4, pdTRUE, prvLog );
+    ( void ) prvCreate( 4, 3, pdTRUE, prvSelfStoppingCallback );
+
+    prvStartAll( 5 );
+    vTaskDelay( 15 );
+
+    benchCHECK( ulFailures, uxLogLength == ( sizeof( xExpected ) / sizeof( xExpected[ 0 ] ) ) );
+    prvCheckLog( "commands", xExpected, sizeof( xExpected ) / sizeof( xExpected[ 0 ] ) );
+    benchCHECK( ulFailures, xTimerIsTimerActive( xTimers[ 0 ] ) == pdFALSE );
+    benchCHECK( ulFailures, xTimerIsTimerActive( xTimers[ 1 ] ) == pdFALSE );
+    benchCHECK( ulFailures, xTimerIsTimerActive( xTimers[ 4 ] ) == pdFALSE );
+    benchCHECK( ulFailures, xTimerGetPeriod( xTimers[ 2 ] ) == 6U );
+    prvStopAll( 3 );
+
+    vBenchReport( "commands from a callback, callbacks checked", ( double ) uxLogLength, "" );
+}
+/*-----------------------------------------------------------*/
+
+static volatile UBaseType_t uxDeferredRuns = 0;
+static volatile BaseType_t xRanInTimerTask = pdTRUE;
+
+/* Deferred callback of a dynamically allocated one-shot timer, which deletes
+ * it. */
+static void prvDeletingCallback( TimerHandle_t xTimer )
+{
+    prvLog( xTimer );
+
+    if( xTaskGetCurrentTaskHandle() != xTimerGetTimerDaemonTaskHandle() )
+    {
+        xRanInTimerTask = pdFALSE;
+    }
+
+    uxDeferredRuns++;
+    benchCHECK( ulFailures, xTimerDelete( xTimer, 0 ) == pdPASS );
+}
+
+/* Deferred callback of an auto-reload timer of one tick, which stops it. */
+static void prvMergedCallback( TimerHandle_t xTimer )
+{
+    if( xTaskGetCurrentTaskHandle() != xTimerGetTimerDaemonTaskHandle() )
+    {
+        xRanInTimerTask = pdFALSE;
+    }
+
+    uxDeferredRuns++;
+    benchCHECK( ulFailures, xTimerStop( xTimer, 0 ) == pdPASS );
+}
+
+static void prvCheckDeferred( void )
+{
+    TimerHandle_t xTimer;
+    TickType_t xSpinStart;
+
+    /* A dynamically allocated timer deleted by its own deferred callback. */
+    xTimer = xTimerCreate( "del", 2, pdFALSE, ( void * ) 7U, prvDeletingCallback );
+    benchCHECK( ulFailures, xTimer != NULL );
+    vTimerSetDeferredCallback( xTimer, pdTRUE );
+
+    uxDeferredRuns = 0U;
+    uxLogLength = 0U;
+    xStartTick = xTaskGetTickCount();
+    benchCHECK( ulFailures, xTimerStart( xTimer, 0 ) == pdPASS );
+    vTaskDelay( 6 );
+
+    benchCHECK( ulFailures, uxDeferredRuns == 1U );
+    benchCHECK( ulFailures, ( uxLogLength == 1U ) && ( xLog[ 0 ].xTick >= 2U ) );
+
+    /* The control task keeps the timer task from running for five expiries of
+     * a one tick timer, which then run its callback once. */
+    xTimer = prvCreate( 0, 1, pdTRUE, prvMergedCallback );
+    vTimerSetDeferredCallback( xTimer, pdTRUE );
+
+    uxDeferredRuns = 0U;
+    xSpinStart = xTaskGetTickCount();
+    benchCHECK( ulFailures, xTimerStart( xTimer, 0 ) == pdPASS );
+
+    while( ( xTaskGetTickCount() - xSpinStart ) < 6U )
+    {
+    }
+
+    benchCHECK( ulFailures, uxDeferredRuns == 0U );
+    vTaskDelay( 3 );
+
+    benchCHECK( ulFailures, uxDeferredRuns == 1U );
+    benchCHECK( ulFailures, xTimerIsTimerActive( xTimer ) == pdFALSE );
+    benchCHECK( ulFailures, xRanInTimerTask == pdTRUE );
+
+    vBenchReport( "deferred, runs for five expiries", ( double ) uxDeferredRuns, "" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    prvCheckOrdering();
+    prvCheckCommandsFromCallback();
+    prvCheckDeferred();
+
+    vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    if( xTaskCreate( prvControlTask, "control", ttSTACK_DEPTH, NULL, ttCONTROL_PRIORITY, NULL ) != pdPASS )
+    {
+        return EXIT_FAILURE;
+    }
+
+    vTaskStartScheduler();
+
+    return ( ulFailures == 0U ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -287,6 +287,14 @@
     #define configUSE_TIMERS    0
 #endif
 
+#ifndef configTIMERS_RUN_FROM_TICK
+    #define configTIMERS_RUN_FROM_TICK    0
+#endif
+
+#ifndef configTIMER_DEFERRED_CALLBACKS
+    #define configTIMER_DEFERRED_CALLBACKS    0
+#endif
+
 #ifndef configUSE_COUNTING_SEMAPHORES
     #define configUSE_COUNTING_SEMAPHORES    0
 #endif
@@ -489,8 +497,18 @@
     #define configCHECK_FOR_STACK_OVERFLOW    0
 #endif
 
+#ifndef configUSE_STACK_PROFILING
+    #define configUSE_STACK_PROFILING    0
+#endif
+
+/* The stack report needs the size of each stack, which is only kept when the
+ * high address is recorded. */
 #ifndef configRECORD_STACK_HIGH_ADDRESS
-    #define configRECORD_STACK_HIGH_ADDRESS    0
+    #define configRECORD_STACK_HIGH_ADDRESS    configUSE_STACK_PROFILING
+#endif
+
+#if ( configUSE_STACK_PROFILING == 1 ) && ( configRECORD_STACK_HIGH_ADDRESS == 0 )
+    #error configRECORD_STACK_HIGH_ADDRESS must be 1 when configUSE_STACK_PROFILING is 1
 #endif
 
 #ifndef configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H
@@ -873,6 +891,10 @@
     #define configUSE_QUEUE_SETS    0
 #endif
 
+#ifndef configUSE_QUEUE_ZERO_COPY
+    #define configUSE_QUEUE_ZERO_COPY    0
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
     #define portTASK_USES_FLOATING_POINT()
 #endif
@@ -937,6 +959,66 @@
     #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
 #endif
 
+#ifndef configUSE_KERNEL_OBJECT_TABLES
+    #define configUSE_KERNEL_OBJECT_TABLES    0
+#endif
+
+#ifndef configKERNEL_PROVIDED_STATIC_MEMORY
+    #define configKERNEL_PROVIDED_STATIC_MEMORY    0
+#endif
+
+#ifndef configUSE_EXECUTOR
+    #define configUSE_EXECUTOR    0
+#endif
+
+#ifndef configEXECUTOR_NOTIFY_INDEX
+    #define configEXECUTOR_NOTIFY_INDEX    0
+#endif
+
+#ifndef configUSE_DEFERRED_WORK
+    #define configUSE_DEFERRED_WORK    0
+#endif
+
+#ifndef configDEFERRED_WORK_LANES
+    #define configDEFERRED_WORK_LANES    2
+#endif
+
+#ifndef configDEFERRED_WORK_LANE_LENGTH
+    #define configDEFERRED_WORK_LANE_LENGTH    16
+#endif
+
+#ifndef configDEFERRED_WORK_TASK_PRIORITY
+    #define configDEFERRED_WORK_TASK_PRIORITY    ( configMAX_PRIORITIES - 1 )
+#endif
+
+#ifndef configDEFERRED_WORK_STACK_DEPTH
+    #define configDEFERRED_WORK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#endif
+
+#ifndef configEVENT_GROUP_WAITER_LISTS
+
+/* Number of lists the tasks waiting on an event group are spread over, see
+ * event_groups.c.  Each list costs a List_t and an EventBits_t per event
+ * group. */
+    #define configEVENT_GROUP_WAITER_LISTS    1
+#endif
+
+#if ( configEVENT_GROUP_WAITER_LISTS < 1 ) || ( ( configUSE_16_BIT_TICKS == 1 ) && ( configEVENT_GROUP_WAITER_LISTS > 8 ) ) || ( configEVENT_GROUP_WAITER_LISTS > 24 )
+    #error configEVENT_GROUP_WAITER_LISTS must be between 1 and the number of bits in an event group
+#endif
+
+#ifndef configUSE_MULTI_WAIT
+    #define configUSE_MULTI_WAIT    0
+#endif
+
+#ifndef configMULTI_WAIT_MAX_SOURCES
+    #define configMULTI_WAIT_MAX_SOURCES    8
+#endif
+
+#ifndef configMULTI_WAIT_NOTIFY_INDEX
+    #define configMULTI_WAIT_NOTIFY_INDEX    0
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
     #define configUSE_POSIX_ERRNO    0
 #endif
@@ -1331,6 +1413,10 @@ typedef struct xSTATIC_QUEUE
     UBaseType_t uxDummy4[ 3 ];
     uint8_t ucDummy5[ 2 ];
 
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucDummy10;
+    #endif
+
     #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
         uint8_t ucDummy6;
     #endif
@@ -1363,14 +1449,15 @@ typedef StaticQueue_t StaticSemaphore_t;
 typedef struct xSTATIC_EVENT_GROUP
 {
     TickType_t xDummy1;
-    StaticList_t xDummy2;
+    StaticList_t xDummy2[ configEVENT_GROUP_WAITER_LISTS ];
+    TickType_t xDummy3[ configEVENT_GROUP_WAITER_LISTS ];
 
     #if ( configUSE_TRACE_FACILITY == 1 )
-        UBaseType_t uxDummy3;
+        UBaseType_t uxDummy4;
     #endif
 
     #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
-        uint8_t ucDummy4;
+        uint8_t ucDummy5;
     #endif
 } StaticEventGroup_t;
 
@@ -1431,6 +1518,18 @@ typedef struct xSTATIC_STREAM_BUFFER
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * In line with the structures above, StaticRingBuffer_t matches the size and
+ * alignment of the ring buffer structure, and is used to create ring buffers
+ * without dynamic memory allocation.
+ */
+typedef struct xSTATIC_RING_BUFFER
+{
+    size_t uxDummy1[ 3 ];
+    void * pvDummy2[ 2 ];
+    uint8_t ucDummy3;
+} StaticRingBuffer_t;
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
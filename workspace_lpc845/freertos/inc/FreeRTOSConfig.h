@@ -21,7 +21,12 @@
 #define configTICK_RATE_HZ					( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES				( 8 )
 #define configMINIMAL_STACK_SIZE			( ( uint16_t ) 64 )
+#if defined( FREERTOS_PORT_POSIX )
+/* Stack words and pointers are twice as large on a 64-bit host. */
+#define configTOTAL_HEAP_SIZE				( ( size_t ) ( 64 * 1024 ) )
+#else
 #define configTOTAL_HEAP_SIZE				( ( size_t ) ( 4096 ) )
+#endif
 #define configMAX_TASK_NAME_LEN				( 10 )
 #define configUSE_TRACE_FACILITY			1
 #define configUSE_16_BIT_TICKS				0
@@ -33,17 +38,89 @@
 #define configUSE_MALLOC_FAILED_HOOK		0
 #define configUSE_APPLICATION_TASK_TAG		0
 #define configUSE_COUNTING_SEMAPHORES		1
+#ifndef configUSE_QUEUE_ZERO_COPY
+#define configUSE_QUEUE_ZERO_COPY			0
+#endif
 #define configGENERATE_RUN_TIME_STATS		0
+/* Record task switches and queue operations in a RAM ring buffer, see
+trace_recorder.h.  Takes over the CTIMER for the timestamps. */
+#define configUSE_TRACE_RECORDER			0
+/* Fill the task and interrupt stacks and track interrupt nesting, so that
+vTaskGetStackReport() can report the stack usage for tools/stack_size.py. */
+#define configUSE_STACK_PROFILING			0
 #define configUSE_TICKLESS_IDLE				1
+/* Sleep through long idle periods in deep-sleep or power-down mode, timed by
+the self wake-up timer.  Peripherals that must keep running while idle have to
+lower the mode with vPortSetTicklessModeLimit().  Off by default: every
+peripheral driver in use has to be checked against the deeper modes first. */
+#define configTICKLESS_USE_WKT				0
+/* Tasks, queues and buffers can be defined statically with the kobj macros of
+kernel_objects.h, and the kernel supplies the idle and timer task memory.  A
+library built without a heap (FREERTOS_HEAP=none) defines
+configSUPPORT_DYNAMIC_ALLOCATION as 0. */
+#define configSUPPORT_STATIC_ALLOCATION		1
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
 #define configSUPPORT_DYNAMIC_ALLOCATION	1
+#endif
+#define configUSE_KERNEL_OBJECT_TABLES		1
+#define configKERNEL_PROVIDED_STATIC_MEMORY	1
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 				0
 #define configMAX_CO_ROUTINE_PRIORITIES		( 2 )
+/* Index 0 of the task notifications is left to the application.  The
+executor uses index 1 and the multi-object wait index 2, so raise this to 2
+with configUSE_EXECUTOR, to 3 with configUSE_MULTI_WAIT as well.  Each entry
+adds 5 bytes to every task. */
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES	1
+#endif
+/* Stackless coroutines run by a host task, see executor.h.  Queues, stream
+buffers and event groups report their changes to the executor.  Off unless
+the application uses coroutines, as every change is then reported. */
+#ifndef configUSE_EXECUTOR
+#define configUSE_EXECUTOR					0
+#endif
+#define configEXECUTOR_NOTIFY_INDEX			1
+/* Interrupts hand work to worker tasks with xDeferredWorkPostFromISR(), see
+deferred_work.h.  Lane 0 runs at configDEFERRED_WORK_TASK_PRIORITY, each
+following lane one priority lower.  Left off here as the workers and lanes take
+RAM whether or not the application posts any work. */
+#define configUSE_DEFERRED_WORK				0
+#define configDEFERRED_WORK_LANES			2
+#define configDEFERRED_WORK_LANE_LENGTH		16
+#define configDEFERRED_WORK_TASK_PRIORITY	( configMAX_PRIORITIES - 1 )
+#define configDEFERRED_WORK_STACK_DEPTH		( configMINIMAL_STACK_SIZE * 2 )
+/* Tasks waiting on an event group are spread over this many lists by the bits
+they wait for, so setting bits, also from an interrupt with
+xEventGroupSetBitsFromISR(), only walks the tasks waiting for those bits.
+One list keeps the original behaviour.  Raise it, to 4 for example, when
+several tasks wait on one group for different bits and bits are set from
+interrupts.  Each list adds 24 bytes to every event group. */
+#ifndef configEVENT_GROUP_WAITER_LISTS
+#define configEVENT_GROUP_WAITER_LISTS		1
+#endif
+/* A task blocks on several queues, stream buffers and notification bits at
+once with xMultiWaitSelect(), see multi_wait.h.  Woken through the executor's
+object change reports, so needs configUSE_EXECUTOR.  Off unless the
+application turns both on. */
+#ifndef configUSE_MULTI_WAIT
+#define configUSE_MULTI_WAIT				0
+#endif
+#define configMULTI_WAIT_MAX_SOURCES		8
+#define configMULTI_WAIT_NOTIFY_INDEX		2
 /* Software timer definitions.  This example uses I2C to write to the LEDs.  As
 this takes a finite time, and because a timer callback writes to an LED, the
 priority of the timer task is kept to a minimum to ensure it does not disrupt
 test tasks that check their own execution times. */
-#define configUSE_TIMERS				0
+#define configUSE_TIMERS				1
+/* Expire timers from the tick interrupt (tick_timers.c) instead of the timer
+service task, so timers need no task stack or command queue.  Callbacks then
+run in the tick interrupt.  Set configTIMER_DEFERRED_CALLBACKS to 1 to create a
+task for the callbacks marked with vTimerSetDeferredCallback(). */
+#define configTIMERS_RUN_FROM_TICK		1
+#ifndef configTIMER_DEFERRED_CALLBACKS
+#define configTIMER_DEFERRED_CALLBACKS	0
+#endif
 #define configTIMER_TASK_PRIORITY		( 0 )
 #define configTIMER_QUEUE_LENGTH		5
 #define configTIMER_TASK_STACK_DEPTH	( configMINIMAL_STACK_SIZE * 2 )
@@ -85,4 +162,9 @@ standard names - or at least those used in the unmodified vector table. */
 #define vPortSVCHandler SVC_Handler
 #define xPortPendSVHandler PendSV_Handler
 #define xPortSysTickHandler SysTick_Handler
+#define xPortWktHandler WKT_IRQHandler
+/* The trace recorder defines the kernel trace macros. */
+#if ( configUSE_TRACE_RECORDER == 1 )
+	#include "trace_recorder.h"
+#endif
 #endif /* FREERTOS_CONFIG_H */
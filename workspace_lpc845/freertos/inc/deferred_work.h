@@ -0,0 +1,235 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Deferred interrupt work.  An interrupt that has more to do than fits in the
+ * handler posts a job, a function and two parameters, and a worker task runs
+ * the function shortly after.  This replaces the pattern of one
+ * xQueueSendFromISR() per event and a task that handles one item per wake up:
+ *
+ * + Jobs are posted to one of configDEFERRED_WORK_LANES lanes.  Each lane is
+ *   a fixed size ring of configDEFERRED_WORK_LANE_LENGTH jobs with its own
+ *   worker task.  Lane 0 is the most urgent, its worker runs at
+ *   configDEFERRED_WORK_TASK_PRIORITY, and the worker of each following lane
+ *   one priority lower.
+ *
+ * + A worker that wakes up runs every job of its lane, including those posted
+ *   while it runs, before it blocks again.  A burst of interrupts therefore
+ *   costs a single context switch, and the worker is only notified when it is
+ *   actually blocked.
+ *
+ * + Posting a job that is already waiting in the lane, the same function with
+ *   the same parameters, does not add a second copy.  An interrupt that posts
+ *   "process the receive buffer" for each byte gets it run once for all the
+ *   bytes that arrived before the worker got to it.  A job that has started
+ *   running is no longer waiting, so posting it again runs it again.
+ *
+ * + Each lane keeps statistics: jobs posted, collapsed and dropped, the
+ *   highest number of jobs waiting, the largest batch and the latency from
+ *   posting a job to the start of its function.  They show how long to make
+ *   the lanes and which lane a job belongs in.
+ *
+ * Posting never blocks.  When a lane is full the job is dropped and the post
+ * returns errQUEUE_FULL.  Jobs run in task context, so they may call any API
+ * function, but they should not block for long as that holds up every job
+ * behind them in the lane.
+ *
+ * Latencies are measured with configDEFERRED_WORK_GET_TIMESTAMP(), which
+ * defaults to the run time stats counter when configGENERATE_RUN_TIME_STATS is
+ * 1, and to the tick count otherwise.  Define it in FreeRTOSConfig.h to use a
+ * finer free running 32-bit counter.
+ *
+ * Example use:
+ * @code{c}
+ * static void prvProcessRx( void * pvParameter1, uint32_t ulParameter2 )
+ * {
+ *  // Drain the ring buffer the interrupt fills.
+ * }
+ *
+ * void USART0_IRQHandler( void )
+ * {
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *  vStoreReceivedByte( ( uint8_t ) USART0->RXDAT );
+ *  ( void ) xDeferredWorkPostFromISR( 0, prvProcessRx, NULL, 0, &xHigherPriorityTaskWoken );
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * @endcode
+ *
+ * configUSE_DEFERRED_WORK must be set to 1 in FreeRTOSConfig.h for deferred
+ * work to be available.  The workers are created by vTaskStartScheduler(), and
+ * wait on their task notification with index 0.  Jobs can be posted before the
+ * scheduler starts, they run once it has.
+ */
+
+#ifndef DEFERRED_WORK_H
+#define DEFERRED_WORK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include deferred_work.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#if ( configUSE_DEFERRED_WORK == 1 )
+
+/* Defines the prototype to which job functions must conform.  The signature
+ * matches the functions passed to xTimerPendFunctionCallFromISR(). */
+typedef void (* DeferredWorkFunction_t)( void * pvParameter1,
+                                         uint32_t ulParameter2 );
+
+/* Statistics of a lane, as returned by vDeferredWorkGetStats().  Latencies are
+ * in units of configDEFERRED_WORK_GET_TIMESTAMP(). */
+typedef struct xDEFERRED_WORK_STATS
+{
+    uint32_t ulPosted;        /*< Jobs added to the lane. */
+    uint32_t ulCollapsed;     /*< Posts that found the same job already waiting. */
+    uint32_t ulDropped;       /*< Posts refused because the lane was full. */
+    uint32_t ulRun;           /*< Jobs whose function has been called. */
+    uint32_t ulBatches;       /*< Times the worker woke up and emptied the lane. */
+    uint32_t ulTotalLatency;  /*< Sum of the latencies of the ulRun jobs. */
+    uint32_t ulMaxLatency;    /*< Longest time a job waited before running. */
+    UBaseType_t uxMaxWaiting; /*< Most jobs waiting in the lane at once. */
+    UBaseType_t uxMaxBatch;   /*< Most jobs run by the worker in one wake up. */
+} DeferredWorkStats_t;
+
+/**
+ * deferred_work.h
+ *
+ * @code{c}
+ * BaseType_t xDeferredWorkPost( UBaseType_t uxLane,
+ *                               DeferredWorkFunction_t pxFunction,
+ *                               void *pvParameter1,
+ *                               uint32_t ulParameter2 );
+ * @endcode
+ *
+ * Posts a job to a lane from a task.  Use xDeferredWorkPostFromISR() to post
+ * from an interrupt service routine.
+ *
+ * @param uxLane The lane the job runs in, less than configDEFERRED_WORK_LANES.
+ * Lane 0 is the most urgent.
+ *
+ * @param pxFunction The function the worker of the lane calls.
+ *
+ * @param pvParameter1 The first parameter passed to pxFunction.
+ *
+ * @param ulParameter2 The second parameter passed to pxFunction.
+ *
+ * @return pdPASS if the job was added to the lane or was already waiting in
+ * it, errQUEUE_FULL if the lane was full.
+ *
+ * \defgroup xDeferredWorkPost xDeferredWorkPost
+ * \ingroup DeferredWork
+ */
+BaseType_t xDeferredWorkPost( UBaseType_t uxLane,
+                              DeferredWorkFunction_t pxFunction,
+                              void * pvParameter1,
+                              uint32_t ulParameter2 ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ *
+ * @code{c}
+ * BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLane,
+ *                                      DeferredWorkFunction_t pxFunction,
+ *                                      void *pvParameter1,
+ *                                      uint32_t ulParameter2,
+ *                                      BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xDeferredWorkPost().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the post unblocked a
+ * worker that has a priority above the priority of the currently running
+ * task.  In that case a context switch should be requested before the
+ * interrupt is exited.  Only written when the worker was blocked.
+ *
+ * \defgroup xDeferredWorkPostFromISR xDeferredWorkPostFromISR
+ * \ingroup DeferredWork
+ */
+BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLane,
+                                     DeferredWorkFunction_t pxFunction,
+                                     void * pvParameter1,
+                                     uint32_t ulParameter2,
+                                     BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ *
+ * @code{c}
+ * UBaseType_t uxDeferredWorkWaiting( UBaseType_t uxLane );
+ * @endcode
+ *
+ * Returns the number of jobs waiting in a lane, not counting a job that is
+ * running.  Can be called from tasks and interrupts.
+ *
+ * \defgroup uxDeferredWorkWaiting uxDeferredWorkWaiting
+ * \ingroup DeferredWork
+ */
+UBaseType_t uxDeferredWorkWaiting( UBaseType_t uxLane ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_work.h
+ *
+ * @code{c}
+ * void vDeferredWorkGetStats( UBaseType_t uxLane, DeferredWorkStats_t *pxStats );
+ * void vDeferredWorkResetStats( UBaseType_t uxLane );
+ * @endcode
+ *
+ * vDeferredWorkGetStats() copies the statistics of a lane into *pxStats, as
+ * one consistent snapshot.  The mean latency is ulTotalLatency / ulRun.
+ * vDeferredWorkResetStats() clears them, for example to measure one phase of
+ * the application on its own.
+ *
+ * \defgroup vDeferredWorkGetStats vDeferredWorkGetStats
+ * \ingroup DeferredWork
+ */
+void vDeferredWorkGetStats( UBaseType_t uxLane,
+                            DeferredWorkStats_t * pxStats ) PRIVILEGED_FUNCTION;
+void vDeferredWorkResetStats( UBaseType_t uxLane ) PRIVILEGED_FUNCTION;
+
+/* Functions below here are not part of the public API. */
+
+/*
+ * Creates the worker tasks.  Called by vTaskStartScheduler().
+ */
+BaseType_t xDeferredWorkCreateTasks( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DEFERRED_WORK */
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( DEFERRED_WORK_H ) */
@@ -366,21 +366,8 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  *
  * A version of xEventGroupClearBits() that can be called from an interrupt.
  *
- * Setting bits in an event group is not a deterministic operation because there
- * are an unknown number of tasks that may be waiting for the bit or bits being
- * set.  FreeRTOS does not allow nondeterministic operations to be performed
- * while interrupts are disabled, so protects event groups that are accessed
- * from tasks by suspending the scheduler rather than disabling interrupts.  As
- * a result event groups cannot be accessed directly from an interrupt service
- * routine.  Therefore xEventGroupClearBitsFromISR() sends a message to the
- * timer task to have the clear operation performed in the context of the timer
- * task.
- *
- * @note If this function returns pdPASS then the timer task is ready to run
- * and a portYIELD_FROM_ISR(pdTRUE) should be executed to perform the needed
- * clear on the event group.  This behavior is different from
- * xEventGroupSetBitsFromISR because the parameter xHigherPriorityTaskWoken is
- * not present.
+ * The bits are cleared directly, inside a short critical section.  Clearing
+ * bits never unblocks a task, so no context switch is needed afterwards.
  *
  * @param xEventGroup The event group in which the bits are to be cleared.
  *
@@ -388,9 +375,8 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * For example, to clear bit 3 only, set uxBitsToClear to 0x08.  To clear bit 3
  * and bit 0 set uxBitsToClear to 0x09.
  *
- * @return If the request to execute the function was posted successfully then
- * pdPASS is returned, otherwise pdFALSE is returned.  pdFALSE will be returned
- * if the timer service queue was full.
+ * @return Always pdPASS.  It is kept for compatibility with the version that
+ * sent the clear to the timer task.
  *
  * Example usage:
  * @code{c}
@@ -404,27 +390,16 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * void anInterruptHandler( void )
  * {
  *      // Clear bit 0 and bit 4 in xEventGroup.
- *      xResult = xEventGroupClearBitsFromISR(
+ *      ( void ) xEventGroupClearBitsFromISR(
  *                          xEventGroup,     // The event group being updated.
- *                          BIT_0 | BIT_4 ); // The bits being set.
- *
- *      if( xResult == pdPASS )
- *      {
- *          // The message was posted successfully.
- *          portYIELD_FROM_ISR(pdTRUE);
- *      }
+ *                          BIT_0 | BIT_4 ); // The bits being cleared.
  * }
  * @endcode
  * \defgroup xEventGroupClearBitsFromISR xEventGroupClearBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
-    BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
-                                            const EventBits_t uxBitsToClear ) PRIVILEGED_FUNCTION;
-#else
-    #define xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear ) \
-    xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) ( xEventGroup ), ( uint32_t ) ( uxBitsToClear ), NULL )
-#endif
+BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
+                                        const EventBits_t uxBitsToClear ) PRIVILEGED_FUNCTION;
 
 /**
  * event_groups.h
@@ -509,13 +484,13 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  *
  * A version of xEventGroupSetBits() that can be called from an interrupt.
  *
- * Setting bits in an event group is not a deterministic operation because there
- * are an unknown number of tasks that may be waiting for the bit or bits being
- * set.  FreeRTOS does not allow nondeterministic operations to be performed in
- * interrupts or from critical sections.  Therefore xEventGroupSetBitsFromISR()
- * sends a message to the timer task to have the set operation performed in the
- * context of the timer task - where a scheduler lock is used in place of a
- * critical section.
+ * The bits are set directly, and the tasks whose wait condition they meet are
+ * unblocked, inside a critical section.  No timer task is involved.  The time
+ * spent in the critical section grows with the number of tasks that wait for
+ * one of the bits being set: the waiting tasks are spread over
+ * configEVENT_GROUP_WAITER_LISTS lists by the bits they wait for, and only the
+ * lists holding a task that waits for one of the bits set are walked.  Setting
+ * a bit that no task waits for unblocks nothing and walks no list.
  *
  * @param xEventGroup The event group in which the bits are to be set.
  *
@@ -523,19 +498,16 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * For example, to set bit 3 only, set uxBitsToSet to 0x08.  To set bit 3
  * and bit 0 set uxBitsToSet to 0x09.
  *
- * @param pxHigherPriorityTaskWoken As mentioned above, calling this function
- * will result in a message being sent to the timer daemon task.  If the
- * priority of the timer daemon task is higher than the priority of the
- * currently running task (the task the interrupt interrupted) then
- * *pxHigherPriorityTaskWoken will be set to pdTRUE by
- * xEventGroupSetBitsFromISR(), indicating that a context switch should be
- * requested before the interrupt exits.  For that reason
+ * @param pxHigherPriorityTaskWoken If setting the bits unblocked a task with a
+ * priority higher than the priority of the currently running task (the task
+ * the interrupt interrupted) then *pxHigherPriorityTaskWoken will be set to
+ * pdTRUE by xEventGroupSetBitsFromISR(), indicating that a context switch
+ * should be requested before the interrupt exits.  For that reason
  * *pxHigherPriorityTaskWoken must be initialised to pdFALSE.  See the
- * example code below.
+ * example code below.  Can be NULL.
  *
- * @return If the request to execute the function was posted successfully then
- * pdPASS is returned, otherwise pdFALSE is returned.  pdFALSE will be returned
- * if the timer service queue was full.
+ * @return Always pdPASS.  It is kept for compatibility with the version that
+ * sent the set to the timer task.
  *
  * Example usage:
  * @code{c}
@@ -548,39 +520,30 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  *
  * void anInterruptHandler( void )
  * {
- * BaseType_t xHigherPriorityTaskWoken, xResult;
+ * BaseType_t xHigherPriorityTaskWoken;
  *
  *      // xHigherPriorityTaskWoken must be initialised to pdFALSE.
  *      xHigherPriorityTaskWoken = pdFALSE;
  *
  *      // Set bit 0 and bit 4 in xEventGroup.
- *      xResult = xEventGroupSetBitsFromISR(
+ *      ( void ) xEventGroupSetBitsFromISR(
  *                          xEventGroup,    // The event group being updated.
- *                          BIT_0 | BIT_4   // The bits being set.
+ *                          BIT_0 | BIT_4,  // The bits being set.
  *                          &xHigherPriorityTaskWoken );
  *
- *      // Was the message posted successfully?
- *      if( xResult == pdPASS )
- *      {
- *          // If xHigherPriorityTaskWoken is now set to pdTRUE then a context
- *          // switch should be requested.  The macro used is port specific and
- *          // will be either portYIELD_FROM_ISR() or portEND_SWITCHING_ISR() -
- *          // refer to the documentation page for the port being used.
- *          portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
- *      }
+ *      // If xHigherPriorityTaskWoken is now set to pdTRUE then a context
+ *      // switch should be requested.  The macro used is port specific and
+ *      // will be either portYIELD_FROM_ISR() or portEND_SWITCHING_ISR() -
+ *      // refer to the documentation page for the port being used.
+ *      portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
  * }
  * @endcode
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
-    BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
-                                          const EventBits_t uxBitsToSet,
-                                          BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
-#else
-    #define xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken ) \
-    xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) ( xEventGroup ), ( uint32_t ) ( uxBitsToSet ), ( pxHigherPriorityTaskWoken ) )
-#endif
+BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
+                                      const EventBits_t uxBitsToSet,
+                                      BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
 /**
  * event_groups.h
@@ -0,0 +1,510 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A stackless executor runs many small cooperative state machines, called
+ * coroutines here, inside a single host task.  A coroutine has no stack of its
+ * own: its control block is a few tens of bytes, against the several hundred
+ * bytes of stack and TCB of a task.  It suits button debouncing, LED patterns,
+ * sensor polling and the like, where a design would otherwise need dozens of
+ * tasks that spend nearly all their time blocked.
+ *
+ * A coroutine is a function written between exeSTART() and exeEND().  The
+ * exeQUEUE_RECEIVE(), exeSTREAM_BUFFER_RECEIVE(), exeEVENT_GROUP_WAIT_BITS(),
+ * exeNOTIFY_WAIT(), exeDELAY() and similar macros make the function return to
+ * the executor while the coroutine waits, and continue at the same place when
+ * the executor calls it again.  Any queue, semaphore, stream buffer, message
+ * buffer or event group can be waited on, including objects that tasks and
+ * interrupts use at the same time.  The kernel lets the executor know when an
+ * object changes, so the host task stays blocked while nothing happens.
+ *
+ * As with the older co-routines in croutine.h:
+ *
+ * + Local variables of a coroutine function do not keep their value across a
+ *   wait.  Keep the state in static variables, or in a structure that starts
+ *   with the ExecutorCoroutine_t and is passed as the coroutine.
+ *
+ * + The waiting macros can only be used in the coroutine function itself, not
+ *   in functions it calls, and not from within a switch statement.
+ *
+ * + A coroutine must not call API functions that block.  Coroutines run one
+ *   at a time until they wait, yield or end, and a long running coroutine
+ *   delays all the others.
+ *
+ * Example use:
+ * @code{c}
+ * static Executor_t xExecutor;
+ * static ExecutorCoroutine_t xBlinker;
+ * static QueueHandle_t xButtonQueue;
+ *
+ * static void prvBlinker( ExecutorCoroutine_t * pxCoroutine )
+ * {
+ * static uint8_t ucButton;
+ * BaseType_t xResult;
+ *
+ *  exeSTART( pxCoroutine );
+ *
+ *  for( ;; )
+ *  {
+ *      // Toggle the LED every 500ms, or at once when a button is pressed.
+ *      exeQUEUE_RECEIVE( pxCoroutine, xButtonQueue, &ucButton, pdMS_TO_TICKS( 500 ), xResult );
+ *      vToggleLED();
+ *  }
+ *
+ *  exeEND( pxCoroutine );
+ * }
+ *
+ * static void prvHostTask( void * pvParameters )
+ * {
+ *  vExecutorRun( ( Executor_t * ) pvParameters );
+ * }
+ *
+ * void main( void )
+ * {
+ *  xButtonQueue = xQueueCreate( 4, sizeof( uint8_t ) );
+ *
+ *  vExecutorInitialise( &xExecutor );
+ *  vExecutorAddCoroutine( &xExecutor, &xBlinker, prvBlinker, NULL );
+ *  xTaskCreate( prvHostTask, "Exec", configMINIMAL_STACK_SIZE, &xExecutor, 1, NULL );
+ *
+ *  vTaskStartScheduler();
+ * }
+ * @endcode
+ *
+ * configUSE_EXECUTOR must be set to 1 in FreeRTOSConfig.h for the executor to
+ * be available.  The host task waits on its task notification with index
+ * configEXECUTOR_NOTIFY_INDEX, which must not be used for anything else.
+ */
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include executor.h"
+#endif
+
+#include "task.h"
+#include "event_groups.h"
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#if ( configUSE_EXECUTOR == 1 )
+
+struct exeCoroutineControlBlock;
+struct exeExecutorControlBlock;
+
+/* Defines the prototype to which coroutine functions must conform. */
+typedef void (* ExecutorCoroutineFunction_t)( struct exeCoroutineControlBlock * pxCoroutine );
+
+/* The coroutine control block.  Its members are used by the macros below and
+ * must not be accessed directly by the application. */
+typedef struct exeCoroutineControlBlock
+{
+    ExecutorCoroutineFunction_t pxCoroutineFunction;
+    void * pvParameters;                              /*< The parameter passed to vExecutorAddCoroutine(). */
+    struct exeCoroutineControlBlock * pxNext;         /*< The next coroutine run by the same executor. */
+    struct exeExecutorControlBlock * pxExecutor;      /*< The executor that runs the coroutine. */
+    const void * pvWaitObject;                        /*< The object waited on, or NULL when only waiting for a notification or time. */
+    TimeOut_t xTimeOut;                               /*< Start of the current wait. */
+    TickType_t xTicksToWait;                          /*< Ticks left in the current wait. */
+    volatile uint32_t ulNotifiedValue;                /*< Bits set by xExecutorNotify() and not yet taken. */
+    uint16_t usState;                                 /*< Where the coroutine function continues. */
+    uint8_t ucStatus;                                 /*< One of the exeSTATUS_ values below. */
+} ExecutorCoroutine_t;
+
+/* The executor control block.  Its members must not be accessed directly by
+ * the application. */
+typedef struct exeExecutorControlBlock
+{
+    ExecutorCoroutine_t * volatile pxCoroutines; /*< Coroutines run by the executor. */
+    struct exeExecutorControlBlock * pxNextExecutor;
+    TaskHandle_t xHostTask;                      /*< The task that called vExecutorRun(), NULL before then. */
+    volatile uint32_t ulObjectMask;              /*< A bit for each object waited on, see exeOBJECT_BIT(). */
+} Executor_t;
+
+/* Values of ExecutorCoroutine_t.ucStatus. */
+#define exeSTATUS_READY       ( ( uint8_t ) 0 )
+#define exeSTATUS_WAITING     ( ( uint8_t ) 1 )
+#define exeSTATUS_FINISHED    ( ( uint8_t ) 2 )
+
+/* Objects are hashed to one of 32 bits, so that changes to objects no
+ * coroutine waits on do not wake the host task.  Kernel objects are at least
+ * 8 byte aligned when allocated from the heap. */
+#define exeOBJECT_BIT( pvObject )    ( ( uint32_t ) 1U << ( ( ( portPOINTER_SIZE_TYPE ) ( pvObject ) >> 3 ) & ( portPOINTER_SIZE_TYPE ) 31U ) )
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorInitialise( Executor_t * pxExecutor );
+ * @endcode
+ *
+ * Prepares an executor for use.  Must be called before coroutines are added
+ * to the executor.
+ *
+ * @param pxExecutor The executor, normally a statically allocated variable.
+ *
+ * \defgroup vExecutorInitialise vExecutorInitialise
+ * \ingroup Executor
+ */
+void vExecutorInitialise( Executor_t * pxExecutor ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorAddCoroutine( Executor_t * pxExecutor,
+ *                             ExecutorCoroutine_t * pxCoroutine,
+ *                             ExecutorCoroutineFunction_t pxCoroutineFunction,
+ *                             void * pvParameters );
+ * @endcode
+ *
+ * Adds a coroutine to an executor.  The coroutine first runs the next time the
+ * executor looks at its coroutines.  Can be called before the executor runs,
+ * from a task, or from a coroutine.  A coroutine that has reached exeEND() can
+ * be added again to restart it.
+ *
+ * @param pxExecutor The executor that will run the coroutine.
+ *
+ * @param pxCoroutine The control block of the coroutine, which must stay valid
+ * for as long as the coroutine runs.
+ *
+ * @param pxCoroutineFunction The coroutine function.
+ *
+ * @param pvParameters Value the coroutine function can obtain with
+ * exeGET_PARAMETERS().
+ *
+ * \defgroup vExecutorAddCoroutine vExecutorAddCoroutine
+ * \ingroup Executor
+ */
+void vExecutorAddCoroutine( Executor_t * pxExecutor,
+                            ExecutorCoroutine_t * pxCoroutine,
+                            ExecutorCoroutineFunction_t pxCoroutineFunction,
+                            void * pvParameters ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorRun( Executor_t * pxExecutor );
+ * @endcode
+ *
+ * Runs the coroutines of the executor in the calling task, which becomes the
+ * host task of the executor.  Each coroutine that is ready, or whose wait may
+ * have ended, is called in turn.  The host task then blocks until an object a
+ * coroutine waits on changes, a coroutine is notified or added, or the
+ * earliest wait times out.  Never returns.
+ *
+ * The host task stack only needs to hold the deepest call made by any one
+ * coroutine, as coroutines do not nest.
+ *
+ * @param pxExecutor The executor to run.
+ *
+ * \defgroup vExecutorRun vExecutorRun
+ * \ingroup Executor
+ */
+void vExecutorRun( Executor_t * pxExecutor ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * BaseType_t xExecutorNotify( ExecutorCoroutine_t * pxCoroutine,
+ *                             uint32_t ulBitsToSet );
+ * BaseType_t xExecutorNotifyFromISR( ExecutorCoroutine_t * pxCoroutine,
+ *                                    uint32_t ulBitsToSet,
+ *                                    BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * The coroutine equivalent of xTaskNotify() with eSetBits.  The bits are ORed
+ * into the notification value of the coroutine, and a coroutine waiting in
+ * exeNOTIFY_WAIT() continues.  xExecutorNotify() can be called from tasks and
+ * coroutines, xExecutorNotifyFromISR() from interrupts.
+ *
+ * @param pxCoroutine The coroutine to notify.
+ *
+ * @param ulBitsToSet The bits to set in the notification value.  Must not be
+ * 0.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if notifying the coroutine
+ * unblocked a host task with a priority above that of the interrupted task.
+ *
+ * @return pdPASS.
+ *
+ * \defgroup xExecutorNotify xExecutorNotify
+ * \ingroup Executor
+ */
+BaseType_t xExecutorNotify( ExecutorCoroutine_t * pxCoroutine,
+                            uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
+
+BaseType_t xExecutorNotifyFromISR( ExecutorCoroutine_t * pxCoroutine,
+                                   uint32_t ulBitsToSet,
+                                   BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * exeSTART( ExecutorCoroutine_t * pxCoroutine );
+ * exeEND( ExecutorCoroutine_t * pxCoroutine );
+ * @endcode
+ *
+ * Must be the first and the last statements of a coroutine function.  A
+ * coroutine that reaches exeEND() is removed from its executor.
+ *
+ * \defgroup exeSTART exeSTART
+ * \ingroup Executor
+ */
+#define exeSTART( pxCoroutine )              \
+    switch( ( pxCoroutine )->usState )       \
+    {                                        \
+        case 0:
+
+#define exeEND( pxCoroutine )                           \
+    ( pxCoroutine )->ucStatus = exeSTATUS_FINISHED; \
+    }
+
+/* Returns the pvParameters value passed to vExecutorAddCoroutine(). */
+#define exeGET_PARAMETERS( pxCoroutine )    ( ( pxCoroutine )->pvParameters )
+
+/**
+ * executor.h
+ * @code{c}
+ * exeYIELD( ExecutorCoroutine_t * pxCoroutine );
+ * @endcode
+ *
+ * Returns to the executor, which runs the other coroutines and then continues
+ * this one.  A coroutine that keeps yielding keeps the host task running.
+ *
+ * \defgroup exeYIELD exeYIELD
+ * \ingroup Executor
+ */
+#define exeYIELD( pxCoroutine )                         \
+    ( pxCoroutine )->usState = ( uint16_t ) __LINE__; \
+    return;                                           \
+    case __LINE__:
+
+/**
+ * executor.h
+ * @code{c}
+ * exeAWAIT( ExecutorCoroutine_t * pxCoroutine,
+ *           const void * pvObject,
+ *           TickType_t xTicksToWait,
+ *           xCondition );
+ * @endcode
+ *
+ * Waits until the expression xCondition is true, or xTicksToWait ticks have
+ * passed.  xCondition is evaluated at once, then again each time the executor
+ * is woken while the coroutine waits, so it is normally a call that does not
+ * block, such as xQueueReceive() with a block time of 0.  The macros below are
+ * built on exeAWAIT() and cover the common cases.
+ *
+ * @param pvObject The queue, semaphore, stream buffer or event group whose
+ * changes can make xCondition true, or NULL if only a notification of the
+ * coroutine or the timeout can.
+ *
+ * @param xTicksToWait The maximum time to wait.  portMAX_DELAY waits without a
+ * timeout, provided INCLUDE_vTaskSuspend is 1.
+ *
+ * \defgroup exeAWAIT exeAWAIT
+ * \ingroup Executor
+ */
+#define exeAWAIT( pxCoroutine, pvObject, xTicksToWait, xCondition )                                     \
+    vExecutorBeginWait( ( pxCoroutine ), ( pvObject ), ( xTicksToWait ) );                            \
+    ( pxCoroutine )->usState = ( uint16_t ) __LINE__;                                                 \
+    case __LINE__:                                                                                    \
+    if( ( ( xCondition ) == pdFALSE ) && ( xExecutorContinueWait( ( pxCoroutine ) ) != pdFALSE ) ) \
+    {                                                                                                 \
+        return;                                                                                       \
+    }
+
+/**
+ * executor.h
+ * @code{c}
+ * exeDELAY( ExecutorCoroutine_t * pxCoroutine, TickType_t xTicksToDelay );
+ * @endcode
+ *
+ * Delays the coroutine for a number of ticks, letting the other coroutines
+ * run.
+ *
+ * \defgroup exeDELAY exeDELAY
+ * \ingroup Executor
+ */
+#define exeDELAY( pxCoroutine, xTicksToDelay ) \
+    exeAWAIT( ( pxCoroutine ), NULL, ( xTicksToDelay ), pdFALSE )
+
+/**
+ * executor.h
+ * @code{c}
+ * exeQUEUE_SEND( ExecutorCoroutine_t * pxCoroutine,
+ *                QueueHandle_t xQueue,
+ *                const void * pvItemToQueue,
+ *                TickType_t xTicksToWait,
+ *                BaseType_t xResult );
+ * exeQUEUE_RECEIVE( ExecutorCoroutine_t * pxCoroutine,
+ *                   QueueHandle_t xQueue,
+ *                   void * pvBuffer,
+ *                   TickType_t xTicksToWait,
+ *                   BaseType_t xResult );
+ * exeSEMAPHORE_TAKE( ExecutorCoroutine_t * pxCoroutine,
+ *                    SemaphoreHandle_t xSemaphore,
+ *                    TickType_t xTicksToWait,
+ *                    BaseType_t xResult );
+ * @endcode
+ *
+ * The coroutine versions of xQueueSend(), xQueueReceive() and
+ * xSemaphoreTake().  xResult is set to the value the API function returned,
+ * pdPASS or errQUEUE_FULL / errQUEUE_EMPTY if the wait timed out.
+ * pvItemToQueue and pvBuffer must not point to local variables.  Mutexes taken
+ * by a coroutine are held by the host task.
+ *
+ * \defgroup exeQUEUE_SEND exeQUEUE_SEND
+ * \ingroup Executor
+ */
+#define exeQUEUE_SEND( pxCoroutine, xQueue, pvItemToQueue, xTicksToWait, xResult ) \
+    exeAWAIT( ( pxCoroutine ), ( xQueue ), ( xTicksToWait ),                         \
+              ( ( ( xResult ) = xQueueSend( ( xQueue ), ( pvItemToQueue ), 0 ) ) == pdPASS ) )
+
+#define exeQUEUE_RECEIVE( pxCoroutine, xQueue, pvBuffer, xTicksToWait, xResult ) \
+    exeAWAIT( ( pxCoroutine ), ( xQueue ), ( xTicksToWait ),                       \
+              ( ( ( xResult ) = xQueueReceive( ( xQueue ), ( pvBuffer ), 0 ) ) == pdPASS ) )
+
+#define exeSEMAPHORE_TAKE( pxCoroutine, xSemaphore, xTicksToWait, xResult ) \
+    exeAWAIT( ( pxCoroutine ), ( xSemaphore ), ( xTicksToWait ),              \
+              ( ( ( xResult ) = xQueueSemaphoreTake( ( xSemaphore ), 0 ) ) == pdPASS ) )
+
+/**
+ * executor.h
+ * @code{c}
+ * exeSTREAM_BUFFER_SEND( ExecutorCoroutine_t * pxCoroutine,
+ *                        StreamBufferHandle_t xStreamBuffer,
+ *                        const void * pvTxData,
+ *                        size_t xDataLengthBytes,
+ *                        TickType_t xTicksToWait,
+ *                        size_t xBytesSent );
+ * exeSTREAM_BUFFER_RECEIVE( ExecutorCoroutine_t * pxCoroutine,
+ *                           StreamBufferHandle_t xStreamBuffer,
+ *                           void * pvRxData,
+ *                           size_t xBufferLengthBytes,
+ *                           TickType_t xTicksToWait,
+ *                           size_t xReceivedBytes );
+ * @endcode
+ *
+ * The coroutine versions of xStreamBufferSend() and xStreamBufferReceive(),
+ * which also work with message buffers.  Wait until at least one byte (or one
+ * message) could be sent or received, then set xBytesSent or xReceivedBytes
+ * to the number of bytes moved, which is 0 if the wait timed out.
+ *
+ * \defgroup exeSTREAM_BUFFER_SEND exeSTREAM_BUFFER_SEND
+ * \ingroup Executor
+ */
+#define exeSTREAM_BUFFER_SEND( pxCoroutine, xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait, xBytesSent )          \
+    exeAWAIT( ( pxCoroutine ), ( xStreamBuffer ), ( xTicksToWait ),                                                        \
+              ( ( ( xBytesSent ) = xStreamBufferSend( ( xStreamBuffer ), ( pvTxData ), ( xDataLengthBytes ), 0 ) ) != 0U ) )
+
+#define exeSTREAM_BUFFER_RECEIVE( pxCoroutine, xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait, xReceivedBytes )          \
+    exeAWAIT( ( pxCoroutine ), ( xStreamBuffer ), ( xTicksToWait ),                                                                 \
+              ( ( ( xReceivedBytes ) = xStreamBufferReceive( ( xStreamBuffer ), ( pvRxData ), ( xBufferLengthBytes ), 0 ) ) != 0U ) )
+
+/**
+ * executor.h
+ * @code{c}
+ * exeEVENT_GROUP_WAIT_BITS( ExecutorCoroutine_t * pxCoroutine,
+ *                           EventGroupHandle_t xEventGroup,
+ *                           EventBits_t uxBitsToWaitFor,
+ *                           BaseType_t xClearOnExit,
+ *                           BaseType_t xWaitForAllBits,
+ *                           TickType_t xTicksToWait,
+ *                           EventBits_t uxBits );
+ * @endcode
+ *
+ * The coroutine version of xEventGroupWaitBits().  uxBits is set to the
+ * event group bits as xEventGroupWaitBits() would return them.
+ *
+ * \defgroup exeEVENT_GROUP_WAIT_BITS exeEVENT_GROUP_WAIT_BITS
+ * \ingroup Executor
+ */
+#define exeEVENT_GROUP_WAIT_BITS( pxCoroutine, xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait, uxBits ) \
+    exeAWAIT( ( pxCoroutine ), ( xEventGroup ), ( xTicksToWait ),                                                                  \
+              xExecutorPollEventGroup( ( xEventGroup ), ( uxBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), &( uxBits ) ) )
+
+/**
+ * executor.h
+ * @code{c}
+ * exeNOTIFY_WAIT( ExecutorCoroutine_t * pxCoroutine,
+ *                 TickType_t xTicksToWait,
+ *                 uint32_t ulNotifiedValue );
+ * @endcode
+ *
+ * Waits for xExecutorNotify() or xExecutorNotifyFromISR() to notify the
+ * coroutine.  ulNotifiedValue is set to the bits set since the last wait, and
+ * the notification value is cleared.  ulNotifiedValue is 0 if the wait timed
+ * out.
+ *
+ * \defgroup exeNOTIFY_WAIT exeNOTIFY_WAIT
+ * \ingroup Executor
+ */
+#define exeNOTIFY_WAIT( pxCoroutine, xTicksToWait, ulNotifiedValue ) \
+    exeAWAIT( ( pxCoroutine ), NULL, ( xTicksToWait ),                 \
+              ( ( ( ulNotifiedValue ) = ulExecutorNotifyTake( ( pxCoroutine ) ) ) != 0UL ) )
+
+/* Functions below here are not part of the public API.  They are used by the
+ * macros above, and by the kernel to report changes of the objects coroutines
+ * wait on. */
+void vExecutorBeginWait( ExecutorCoroutine_t * pxCoroutine,
+                         const void * pvObject,
+                         TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+BaseType_t xExecutorContinueWait( ExecutorCoroutine_t * pxCoroutine ) PRIVILEGED_FUNCTION;
+
+uint32_t ulExecutorNotifyTake( ExecutorCoroutine_t * pxCoroutine ) PRIVILEGED_FUNCTION;
+
+BaseType_t xExecutorPollEventGroup( EventGroupHandle_t xEventGroup,
+                                    EventBits_t uxBitsToWaitFor,
+                                    BaseType_t xClearOnExit,
+                                    BaseType_t xWaitForAllBits,
+                                    EventBits_t * puxBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by queue.c, stream_buffer.c and event_groups.c when an object may
+ * have become ready to send to or receive from.  Wakes the host task of each
+ * executor with a coroutine that may wait on the object.  Can be called from
+ * tasks, also with interrupts masked or the scheduler suspended, and from
+ * interrupts.  Returns pdTRUE if a host task with a priority above that of the
+ * running task was unblocked.
+ */
+BaseType_t xExecutorObjectChanged( const void * pvObject ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EXECUTOR */
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( EXECUTOR_H ) */
@@ -0,0 +1,299 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Kernel object tables.  Tasks, queues, semaphores, stream buffers and message
+ * buffers are defined at file scope with the kobj macros below instead of being
+ * created at run time.  Each macro allocates the control block and the stack
+ * or storage area statically, placing them in dedicated linker sections, and
+ * adds an entry describing the object to a table in flash.
+ * xKernelObjectsCreate() walks the table once at boot and creates every object
+ * with the xxxCreateStatic() API function, storing its handle in the variable
+ * the macro defined.
+ *
+ * The RAM used by the kernel objects is therefore known at link time, and when
+ * every object is defined this way the library can be built without a heap
+ * (FREERTOS_HEAP=none in CMake, which sets configSUPPORT_DYNAMIC_ALLOCATION to
+ * 0).
+ *
+ * The linker sections used are:
+ *
+ * + freertos_object_table       The object descriptions, read only.
+ * + .bss.freertos_tcbs          Task control blocks.
+ * + .bss.freertos_stacks        Task stacks.
+ * + .bss.freertos_queues        Queue and semaphore control blocks and queue
+ *                               storage areas.
+ * + .bss.freertos_stream_buffers  Stream and message buffer control blocks and
+ *                               storage areas.
+ *
+ * The .bss sections are zero initialised by the startup code like the rest of
+ * .bss.  A linker script that does not mention them places them in .bss.  The
+ * table is located through the __start_freertos_object_table and
+ * __stop_freertos_object_table symbols, which GNU ld provides for sections it
+ * has no rule for, or which the linker script defines.
+ *
+ * Example use:
+ * @code{c}
+ * static void prvLedTask( void * pvParameters );
+ *
+ * kobjTASK( xLedTask, prvLedTask, "LED", configMINIMAL_STACK_SIZE, NULL, 1 );
+ * kobjQUEUE( xButtonQueue, 4, sizeof( uint8_t ) );
+ * kobjMUTEX( xI2CMutex );
+ *
+ * int main( void )
+ * {
+ *  // vTaskStartScheduler() calls xKernelObjectsCreate().  It only needs to be
+ *  // called here because xButtonQueue is used before the scheduler starts.
+ *  ( void ) xKernelObjectsCreate();
+ *  xQueueSend( xButtonQueue, &ucInitialState, 0 );
+ *
+ *  vTaskStartScheduler();
+ * }
+ * @endcode
+ *
+ * Handles are ordinary global variables, other files reach them with for
+ * example "extern TaskHandle_t xLedTask;".  configSUPPORT_STATIC_ALLOCATION and
+ * configUSE_KERNEL_OBJECT_TABLES must be set to 1 in FreeRTOSConfig.h.  The
+ * macros rely on GCC section attributes.
+ */
+
+#ifndef KERNEL_OBJECTS_H
+#define KERNEL_OBJECTS_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include kernel_objects.h"
+#endif
+
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#if ( configUSE_KERNEL_OBJECT_TABLES == 1 )
+
+#if ( configSUPPORT_STATIC_ALLOCATION != 1 )
+    #error configSUPPORT_STATIC_ALLOCATION must be set to 1 to use kernel object tables
+#endif
+
+#if !defined( __GNUC__ )
+    #error Kernel object tables need a compiler that supports GCC section attributes
+#endif
+
+/* Values of KernelObjectDefinition_t.ucType. */
+#define kobjTYPE_TASK                  ( ( uint8_t ) 1 )
+#define kobjTYPE_QUEUE                 ( ( uint8_t ) 2 )
+#define kobjTYPE_BINARY_SEMAPHORE      ( ( uint8_t ) 3 )
+#define kobjTYPE_COUNTING_SEMAPHORE    ( ( uint8_t ) 4 )
+#define kobjTYPE_MUTEX                 ( ( uint8_t ) 5 )
+#define kobjTYPE_RECURSIVE_MUTEX       ( ( uint8_t ) 6 )
+#define kobjTYPE_STREAM_BUFFER         ( ( uint8_t ) 7 )
+#define kobjTYPE_MESSAGE_BUFFER        ( ( uint8_t ) 8 )
+
+/* An entry of the object table, built by the macros below.  The meaning of
+ * ulSize and uxArgument depends on the type of object:
+ *
+ * + Task: stack depth in words, and priority.
+ * + Queue: length, and item size.
+ * + Counting semaphore: maximum count, and initial count.
+ * + Stream buffer: size in bytes, and trigger level.
+ * + Message buffer: size in bytes. */
+typedef struct xKERNEL_OBJECT_DEFINITION
+{
+    void * pvHandle;            /*< The variable that receives the handle of the object. */
+    void * pvObjectBuffer;      /*< The StaticTask_t, StaticQueue_t or StaticStreamBuffer_t. */
+    void * pvStorage;           /*< The stack, or the storage area of a queue or buffer. */
+    TaskFunction_t pxTaskCode;  /*< Tasks only. */
+    const char * pcName;        /*< Tasks only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    void * pvParameters;        /*< Tasks only. */
+    uint32_t ulSize;
+    UBaseType_t uxArgument;
+    uint8_t ucType;
+} KernelObjectDefinition_t;
+
+/* Section attributes of the table entries and of the memory of the objects.
+ * Table entries are aligned to a pointer so that the compiler does not pad
+ * between them, as the table is walked as an array. */
+#define kobjTABLE_SECTION            __attribute__( ( section( "freertos_object_table" ), used, aligned( sizeof( void * ) ) ) )
+#define kobjTCB_SECTION              __attribute__( ( section( ".bss.freertos_tcbs" ) ) )
+#define kobjSTACK_SECTION            __attribute__( ( section( ".bss.freertos_stacks" ) ) )
+#define kobjQUEUE_SECTION            __attribute__( ( section( ".bss.freertos_queues" ) ) )
+#define kobjSTREAM_BUFFER_SECTION    __attribute__( ( section( ".bss.freertos_stream_buffers" ) ) )
+
+/**
+ * kernel_objects.h
+ * @code{c}
+ * kobjTASK( xHandle, TaskFunction_t pxTaskCode, const char * pcName,
+ *           usStackDepth, void * pvParameters, UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Defines a task, created as xTaskCreateStatic() would with the same
+ * parameters.  Defines the variable "TaskHandle_t xHandle" that holds the
+ * handle of the task once it has been created.
+ *
+ * \defgroup kobjTASK kobjTASK
+ * \ingroup KernelObjects
+ */
+#define kobjTASK( xHandle, pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority )          \
+    TaskHandle_t xHandle = NULL;                                                                 \
+    static StaticTask_t xHandle##_TCB kobjTCB_SECTION;                                           \
+    static StackType_t xHandle##_Stack[ ( usStackDepth ) ] kobjSTACK_SECTION;                    \
+    static const KernelObjectDefinition_t xHandle##_Definition kobjTABLE_SECTION =               \
+    {                                                                                            \
+        ( void * ) &( xHandle ), ( void * ) &( xHandle##_TCB ), ( void * ) ( xHandle##_Stack ), \
+        ( pxTaskCode ), ( pcName ), ( pvParameters ), ( usStackDepth ), ( uxPriority ),          \
+        kobjTYPE_TASK                                                                            \
+    }
+
+/**
+ * kernel_objects.h
+ * @code{c}
+ * kobjQUEUE( xHandle, uxQueueLength, uxItemSize );
+ * @endcode
+ *
+ * Defines a queue, created as xQueueCreateStatic() would.  Defines the variable
+ * "QueueHandle_t xHandle".
+ *
+ * \defgroup kobjQUEUE kobjQUEUE
+ * \ingroup KernelObjects
+ */
+#define kobjQUEUE( xHandle, uxQueueLength, uxItemSize )                                               \
+    QueueHandle_t xHandle = NULL;                                                                     \
+    static StaticQueue_t xHandle##_Queue kobjQUEUE_SECTION;                                           \
+    static uint8_t xHandle##_Storage[ ( uxQueueLength ) * ( uxItemSize ) ] kobjQUEUE_SECTION;         \
+    static const KernelObjectDefinition_t xHandle##_Definition kobjTABLE_SECTION =                    \
+    {                                                                                                 \
+        ( void * ) &( xHandle ), ( void * ) &( xHandle##_Queue ), ( void * ) ( xHandle##_Storage ), \
+        NULL, NULL, NULL, ( uxQueueLength ), ( uxItemSize ), kobjTYPE_QUEUE                           \
+    }
+
+/**
+ * kernel_objects.h
+ * @code{c}
+ * kobjBINARY_SEMAPHORE( xHandle );
+ * kobjCOUNTING_SEMAPHORE( xHandle, uxMaxCount, uxInitialCount );
+ * kobjMUTEX( xHandle );
+ * kobjRECURSIVE_MUTEX( xHandle );
+ * @endcode
+ *
+ * Define semaphores and mutexes, created as xSemaphoreCreateBinaryStatic(),
+ * xSemaphoreCreateCountingStatic(), xSemaphoreCreateMutexStatic() and
+ * xSemaphoreCreateRecursiveMutexStatic() would.  Each defines the variable
+ * "SemaphoreHandle_t xHandle".
+ *
+ * \defgroup kobjBINARY_SEMAPHORE kobjBINARY_SEMAPHORE
+ * \ingroup KernelObjects
+ */
+#define kobjGENERIC_SEMAPHORE( xHandle, ucType, uxMaxCount, uxInitialCount )      \
+    SemaphoreHandle_t xHandle = NULL;                                             \
+    static StaticSemaphore_t xHandle##_Semaphore kobjQUEUE_SECTION;               \
+    static const KernelObjectDefinition_t xHandle##_Definition kobjTABLE_SECTION = \
+    {                                                                             \
+        ( void * ) &( xHandle ), ( void * ) &( xHandle##_Semaphore ), NULL,       \
+        NULL, NULL, NULL, ( uxMaxCount ), ( uxInitialCount ), ( ucType )          \
+    }
+
+#define kobjBINARY_SEMAPHORE( xHandle ) \
+    kobjGENERIC_SEMAPHORE( xHandle, kobjTYPE_BINARY_SEMAPHORE, 1, 0 )
+
+#define kobjCOUNTING_SEMAPHORE( xHandle, uxMaxCount, uxInitialCount ) \
+    kobjGENERIC_SEMAPHORE( xHandle, kobjTYPE_COUNTING_SEMAPHORE, ( uxMaxCount ), ( uxInitialCount ) )
+
+#define kobjMUTEX( xHandle ) \
+    kobjGENERIC_SEMAPHORE( xHandle, kobjTYPE_MUTEX, 1, 1 )
+
+#define kobjRECURSIVE_MUTEX( xHandle ) \
+    kobjGENERIC_SEMAPHORE( xHandle, kobjTYPE_RECURSIVE_MUTEX, 1, 1 )
+
+/**
+ * kernel_objects.h
+ * @code{c}
+ * kobjSTREAM_BUFFER( xHandle, xBufferSizeBytes, xTriggerLevelBytes );
+ * kobjMESSAGE_BUFFER( xHandle, xBufferSizeBytes );
+ * @endcode
+ *
+ * Define a stream buffer or a message buffer, created as
+ * xStreamBufferCreateStatic() and xMessageBufferCreateStatic() would.  The
+ * storage area is one byte larger than xBufferSizeBytes, as those functions
+ * require.  Define the variable "StreamBufferHandle_t xHandle" or
+ * "MessageBufferHandle_t xHandle".
+ *
+ * \defgroup kobjSTREAM_BUFFER kobjSTREAM_BUFFER
+ * \ingroup KernelObjects
+ */
+#define kobjGENERIC_STREAM_BUFFER( xHandle, xHandleType, ucType, xBufferSizeBytes, xTriggerLevelBytes )         \
+    xHandleType xHandle = NULL;                                                                                \
+    static StaticStreamBuffer_t xHandle##_Buffer kobjSTREAM_BUFFER_SECTION;                                    \
+    static uint8_t xHandle##_Storage[ ( xBufferSizeBytes ) + 1 ] kobjSTREAM_BUFFER_SECTION;                    \
+    static const KernelObjectDefinition_t xHandle##_Definition kobjTABLE_SECTION =                             \
+    {                                                                                                          \
+        ( void * ) &( xHandle ), ( void * ) &( xHandle##_Buffer ), ( void * ) ( xHandle##_Storage ),          \
+        NULL, NULL, NULL, ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( ucType )                             \
+    }
+
+#define kobjSTREAM_BUFFER( xHandle, xBufferSizeBytes, xTriggerLevelBytes ) \
+    kobjGENERIC_STREAM_BUFFER( xHandle, StreamBufferHandle_t, kobjTYPE_STREAM_BUFFER, ( xBufferSizeBytes ), ( xTriggerLevelBytes ) )
+
+#define kobjMESSAGE_BUFFER( xHandle, xBufferSizeBytes ) \
+    kobjGENERIC_STREAM_BUFFER( xHandle, MessageBufferHandle_t, kobjTYPE_MESSAGE_BUFFER, ( xBufferSizeBytes ), 0 )
+
+/**
+ * kernel_objects.h
+ * @code{c}
+ * BaseType_t xKernelObjectsCreate( void );
+ * @endcode
+ *
+ * Creates all the objects defined with the kobj macros, in a single pass over
+ * the object table.  vTaskStartScheduler() calls this function, so the
+ * application only needs to call it when it uses an object before starting
+ * the scheduler.  Calls after the first do nothing.
+ *
+ * @return pdPASS if every object was created, otherwise pdFAIL.  Creating a
+ * static object can only fail if its definition is invalid, for example a
+ * task priority that is too high, and configASSERT() reports such errors.
+ *
+ * \defgroup xKernelObjectsCreate xKernelObjectsCreate
+ * \ingroup KernelObjects
+ */
+BaseType_t xKernelObjectsCreate( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_KERNEL_OBJECT_TABLES */
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( KERNEL_OBJECTS_H ) */
@@ -0,0 +1,276 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Multi-object waits.  A task that serves several sources, for example a
+ * gateway that forwards bytes from a UART stream buffer, blocks of samples
+ * from an ADC queue and commands from a command queue, blocks in one call
+ * until any of them is ready, instead of polling each with a zero timeout:
+ *
+ * + Queues, semaphores and mutexes, stream buffers and message buffers, and
+ *   bits of the task's own notification value can be sources.
+ *
+ * + xMultiWaitSelect() returns the index of a ready source.  The task then
+ *   receives, takes or reads from that source itself, with a zero block time,
+ *   so an item is copied once, straight from its source.  Unlike a queue set
+ *   nothing is queued per event, so there is no set queue to size or keep in
+ *   step with the sources.
+ *
+ * + The sources are tested in the order they were added, so the first source
+ *   added is served first when several are ready.
+ *
+ * + The waiting task is woken through the same reports the kernel makes to
+ *   the executor when an object changes, see executor.h.  Objects are hashed to
+ *   one of 32 bits, so a change to an object that is not a source only wakes
+ *   the task when it shares the bit of a source.
+ *
+ * A source is ready when a queue holds an item, a semaphore can be taken, a
+ * stream or message buffer is not empty, or one of the notification bits of
+ * the source is set.  A stream buffer only wakes the task when it reaches its
+ * trigger level, as it would wake a task blocked in xStreamBufferReceive().
+ * Another task may empty a source between xMultiWaitSelect() returning and
+ * the read, in which case the read returns nothing and the task simply
+ * selects again.
+ *
+ * Notification sources use the notification value with index
+ * configMULTI_WAIT_NOTIFY_INDEX.  Send them with eSetBits, for example
+ * xTaskNotifyIndexed( xGateway, configMULTI_WAIT_NOTIFY_INDEX, 0x01, eSetBits ),
+ * and do not use bit 31, which the multi-object wait uses itself.
+ * xMultiWaitSelect() clears the bits of the notification source it returns.
+ *
+ * Example use:
+ * @code{c}
+ * static MultiWait_t xGatewayWait;
+ *
+ * static void prvGatewayTask( void * pvParameters )
+ * {
+ * BaseType_t xSource, xCommands, xSamples, xUart;
+ * uint32_t ulNotified;
+ *
+ *  vMultiWaitInitialise( &xGatewayWait );
+ *  xCommands = xMultiWaitAddQueue( &xGatewayWait, xCommandQueue );
+ *  xSamples = xMultiWaitAddQueue( &xGatewayWait, xAdcQueue );
+ *  xUart = xMultiWaitAddStreamBuffer( &xGatewayWait, xUartStream );
+ *
+ *  for( ;; )
+ *  {
+ *      xSource = xMultiWaitSelect( &xGatewayWait, portMAX_DELAY, &ulNotified );
+ *
+ *      if( xSource == xCommands )
+ *      {
+ *          if( xQueueReceive( xCommandQueue, &xCommand, 0 ) == pdPASS )
+ *          {
+ *              vHandleCommand( &xCommand );
+ *          }
+ *      }
+ *      else if( xSource == xSamples )
+ *      {
+ *          // As above for the ADC queue, and xStreamBufferReceive() for
+ *          // the UART.
+ *      }
+ *  }
+ * }
+ * @endcode
+ *
+ * configUSE_MULTI_WAIT must be set to 1 in FreeRTOSConfig.h for multi-object
+ * waits to be available, and configUSE_EXECUTOR as well, as it delivers the
+ * object change reports.  A MultiWait_t is registered with the kernel on the
+ * first xMultiWaitSelect() and stays registered until vMultiWaitRemove() is
+ * called or the task is deleted, and until then only the task that first
+ * selected on it may use it.
+ */
+
+#ifndef MULTI_WAIT_H
+#define MULTI_WAIT_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include multi_wait.h"
+#endif
+
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#if ( configUSE_MULTI_WAIT == 1 )
+
+/* Returned by xMultiWaitSelect() when no source became ready in time, and by
+ * the xMultiWaitAdd functions when the MultiWait_t already has
+ * configMULTI_WAIT_MAX_SOURCES sources. */
+#define multiwaitNO_SOURCE    ( ( BaseType_t ) -1 )
+
+/* The notification bit the kernel sets to wake a task in xMultiWaitSelect(). */
+#define multiwaitOBJECT_CHANGED_BIT    ( 0x80000000UL )
+
+/* A source of a multi-object wait.  Its members are used by multi_wait.c and
+ * must not be accessed directly by the application. */
+typedef struct xMULTI_WAIT_SOURCE
+{
+    void * pvObject;           /*< The queue, semaphore or stream buffer, NULL for a notification source. */
+    uint32_t ulNotifyBits;     /*< The notification bits of a notification source. */
+    uint8_t ucType;            /*< One of the multiwaitSOURCE_ values in multi_wait.c. */
+} MultiWaitSource_t;
+
+/* A set of sources waited on by one task.  Its members are used by
+ * multi_wait.c and must not be accessed directly by the application. */
+typedef struct xMULTI_WAIT
+{
+    struct xMULTI_WAIT * pxNext;                               /*< The next registered MultiWait_t. */
+    TaskHandle_t xTask;                                        /*< The task that selects, NULL before the first select. */
+    volatile BaseType_t xSelecting;                            /*< pdTRUE while the task is in xMultiWaitSelect(). */
+    volatile uint32_t ulObjectMask;                            /*< A bit for each object source, see exeOBJECT_BIT(). */
+    UBaseType_t uxSources;                                     /*< The number of sources added. */
+    MultiWaitSource_t xSources[ configMULTI_WAIT_MAX_SOURCES ]; /*< The sources, in the order they are tested. */
+} MultiWait_t;
+
+/**
+ * multi_wait.h
+ * @code{c}
+ * void vMultiWaitInitialise( MultiWait_t * pxMultiWait );
+ * @endcode
+ *
+ * Prepares a MultiWait_t, with no sources, for use.
+ *
+ * \defgroup vMultiWaitInitialise vMultiWaitInitialise
+ * \ingroup MultiWait
+ */
+void vMultiWaitInitialise( MultiWait_t * pxMultiWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * multi_wait.h
+ * @code{c}
+ * BaseType_t xMultiWaitAddQueue( MultiWait_t * pxMultiWait, QueueHandle_t xQueue );
+ * BaseType_t xMultiWaitAddStreamBuffer( MultiWait_t * pxMultiWait, StreamBufferHandle_t xStreamBuffer );
+ * BaseType_t xMultiWaitAddNotification( MultiWait_t * pxMultiWait, uint32_t ulNotifyBits );
+ * @endcode
+ *
+ * Add a source to a multi-object wait.  xMultiWaitAddQueue() also takes
+ * semaphore and mutex handles, and xMultiWaitAddStreamBuffer() message buffer
+ * handles.  A notification source is ready when any of ulNotifyBits is set in
+ * the notification value with index configMULTI_WAIT_NOTIFY_INDEX of the task
+ * that selects.
+ *
+ * Sources can be added at any time by the task that selects, but not removed.
+ *
+ * @return The index of the source, which xMultiWaitSelect() returns when the
+ * source is ready, or multiwaitNO_SOURCE if the MultiWait_t already has
+ * configMULTI_WAIT_MAX_SOURCES sources.
+ *
+ * \defgroup xMultiWaitAddQueue xMultiWaitAddQueue
+ * \ingroup MultiWait
+ */
+BaseType_t xMultiWaitAddQueue( MultiWait_t * pxMultiWait,
+                               QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+BaseType_t xMultiWaitAddStreamBuffer( MultiWait_t * pxMultiWait,
+                                      StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+BaseType_t xMultiWaitAddNotification( MultiWait_t * pxMultiWait,
+                                      uint32_t ulNotifyBits ) PRIVILEGED_FUNCTION;
+
+/**
+ * multi_wait.h
+ * @code{c}
+ * BaseType_t xMultiWaitSelect( MultiWait_t * pxMultiWait,
+ *                              TickType_t xTicksToWait,
+ *                              uint32_t * pulNotifiedBits );
+ * @endcode
+ *
+ * Blocks the calling task until one of the sources of pxMultiWait is ready,
+ * or xTicksToWait ticks have passed.  Returns at once if a source is already
+ * ready.  When several are ready the one added first is returned.
+ *
+ * @param pxMultiWait The sources to wait on.
+ *
+ * @param xTicksToWait The maximum time to wait, portMAX_DELAY to wait without
+ * a time out when INCLUDE_vTaskSuspend is 1.
+ *
+ * @param pulNotifiedBits If the source returned is a notification source, set
+ * to its bits that were set, which are then cleared in the notification value.
+ * Can be NULL.
+ *
+ * @return The index of the ready source, as returned when it was added, or
+ * multiwaitNO_SOURCE if none became ready in time.
+ *
+ * \defgroup xMultiWaitSelect xMultiWaitSelect
+ * \ingroup MultiWait
+ */
+BaseType_t xMultiWaitSelect( MultiWait_t * pxMultiWait,
+                             TickType_t xTicksToWait,
+                             uint32_t * pulNotifiedBits ) PRIVILEGED_FUNCTION;
+
+/**
+ * multi_wait.h
+ * @code{c}
+ * void vMultiWaitRemove( MultiWait_t * pxMultiWait );
+ * @endcode
+ *
+ * The first xMultiWaitSelect() on a MultiWait_t links it into a list the
+ * kernel walks whenever an object changes, and it stays linked until
+ * vMultiWaitRemove() is called.  Call it before the memory of the MultiWait_t
+ * is freed or reused, for example before returning from the function that
+ * declares it on the stack.  A MultiWait_t can be selected on again after it
+ * has been removed, by any task.
+ *
+ * When a task is deleted the MultiWait_t structures it selected on are removed
+ * by vTaskDelete(), but their memory still belongs to the application.
+ *
+ * \defgroup vMultiWaitRemove vMultiWaitRemove
+ * \ingroup MultiWait
+ */
+void vMultiWaitRemove( MultiWait_t * pxMultiWait ) PRIVILEGED_FUNCTION;
+
+/* Functions below here are not part of the public API. */
+
+/*
+ * Called by xExecutorObjectChanged() when an object may have become ready.
+ * Wakes each task selecting on a MultiWait_t with a source that may be the
+ * object.  Can be called from the same contexts as xExecutorObjectChanged(),
+ * and returns pdTRUE if a task with a priority above that of the running task
+ * was unblocked.
+ */
+BaseType_t xMultiWaitObjectChanged( const void * pvObject ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by vTaskDelete(), from within a critical section, to remove the
+ * MultiWait_t structures xTask selected on.
+ */
+void vMultiWaitRemoveTask( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MULTI_WAIT */
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( MULTI_WAIT_H ) */
@@ -27,6 +27,11 @@
  */
 
 
+/* The host simulator build replaces the Cortex-M0 definitions below. */
+#if defined( FREERTOS_PORT_POSIX )
+    #include "portmacro_posix.h"
+#endif
+
 #ifndef PORTMACRO_H
     #define PORTMACRO_H
 
@@ -108,6 +113,67 @@
         extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
         #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )    vPortSuppressTicksAndSleep( xExpectedIdleTime )
     #endif
+
+/* Low power modes tickless idle can enter when configTICKLESS_USE_WKT is 1,
+ * from the lightest to the deepest.  The values match the PM field of the PMU
+ * PCON register. */
+    #define portTICKLESS_MODE_SLEEP         ( 0UL )
+    #define portTICKLESS_MODE_DEEP_SLEEP    ( 1UL )
+    #define portTICKLESS_MODE_POWER_DOWN    ( 2UL )
+    extern void vPortSetTicklessModeLimit( uint32_t ulMode );
+/*-----------------------------------------------------------*/
+
+/* Stack profiling.  Interrupts run on the main stack, which the linker script
+ * places between __StackLimit and __StackTop.  The symbols are weak so that an
+ * image linked without them only loses the interrupt stack figures. */
+    #if ( configUSE_STACK_PROFILING == 1 )
+        extern uint32_t __StackLimit[] __attribute__( ( weak ) );
+        extern uint32_t __StackTop[] __attribute__( ( weak ) );
+        #define portISR_STACK_LIMIT                ( ( StackType_t * ) __StackLimit )
+        #define portISR_STACK_TOP                  ( ( StackType_t * ) __StackTop )
+        #define portGET_STACK_POINTER( pxStack )    __asm volatile ( "mov %0, sp" : "=r" ( pxStack ) )
+    #endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specific optimisations. */
+    #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+        #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+    #endif
+
+    #if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+/* The ready priorities are kept as a bitmap in uxTopReadyPriority.  The
+ * Cortex-M0+ has no CLZ instruction, so the highest set bit is found by
+ * smearing it into all the lower bits and indexing a table with a de Bruijn
+ * multiply, which takes the same time whatever the priority. */
+
+/* Check the configuration. */
+        #if ( configMAX_PRIORITIES > 32 )
+            #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+        #endif
+
+        extern const uint8_t ucPortHighestBitTable[ 32 ];
+
+        static inline UBaseType_t uxPortHighestReadyPriority( uint32_t ulReadyPriorities )
+        {
+            ulReadyPriorities |= ulReadyPriorities >> 1;
+            ulReadyPriorities |= ulReadyPriorities >> 2;
+            ulReadyPriorities |= ulReadyPriorities >> 4;
+            ulReadyPriorities |= ulReadyPriorities >> 8;
+            ulReadyPriorities |= ulReadyPriorities >> 16;
+
+            return ( UBaseType_t ) ucPortHighestBitTable[ ( ulReadyPriorities * 0x07c4acddUL ) >> 27 ];
+        }
+
+/* Store/clear the ready priorities in a bit map. */
+        #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )    ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+        #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )     ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+/*-----------------------------------------------------------*/
+
+        #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = uxPortHighestReadyPriority( ( uint32_t ) ( uxReadyPriorities ) )
+
+    #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site. */
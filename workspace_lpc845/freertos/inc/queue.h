@@ -1418,6 +1418,257 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
                                  void * const pvBuffer,
                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReserve(
+ *                            QueueHandle_t xQueue,
+ *                            void **ppvSlot,
+ *                            TickType_t xTicksToWait
+ *                         );
+ * @endcode
+ *
+ * Reserve the next free slot of a queue so an item can be written directly
+ * into the queue storage instead of being copied in by xQueueSend().  The item
+ * becomes visible to readers when vQueueCommit() is called, or is dropped by
+ * vQueueAbortReserve().
+ *
+ * Only one slot of a queue can be reserved at a time.  While it is reserved
+ * other writers block in xQueueReserve() as if the queue was full, and
+ * xQueueSend() and friends must not be used on the queue.
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * @param ppvSlot Set to the address of the reserved slot.  It holds
+ * uxItemSize bytes and stays valid until vQueueCommit() or
+ * vQueueAbortReserve() is called.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a slot, as for xQueueSend().
+ *
+ * @return pdPASS if a slot was reserved, otherwise errQUEUE_FULL.
+ *
+ * Example usage:
+ * @code{c}
+ * struct AMessage *pxMessage;
+ *
+ *  if( xQueueReserve( xQueue, ( void ** ) &pxMessage, portMAX_DELAY ) == pdPASS )
+ *  {
+ *      vFillSampleBlock( pxMessage );
+ *      vQueueCommit( xQueue );
+ *  }
+ * @endcode
+ * \defgroup xQueueReserve xQueueReserve
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReserve( QueueHandle_t xQueue,
+                          void ** const ppvSlot,
+                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReserveFromISR(
+ *                                   QueueHandle_t xQueue,
+ *                                   void **ppvSlot
+ *                                );
+ * @endcode
+ *
+ * A version of xQueueReserve() that can be called from an ISR.  It never
+ * blocks.
+ *
+ * @return pdPASS if a slot was reserved, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xQueueReserveFromISR xQueueReserveFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReserveFromISR( QueueHandle_t xQueue,
+                                 void ** const ppvSlot ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * void vQueueCommit( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Post the item written to the slot reserved by xQueueReserve().  Tasks
+ * blocked on the queue are unblocked as they would be by xQueueSendToBack().
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * \defgroup vQueueCommit vQueueCommit
+ * \ingroup QueueManagement
+ */
+void vQueueCommit( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * void vQueueCommitFromISR(
+ *                            QueueHandle_t xQueue,
+ *                            BaseType_t *pxHigherPriorityTaskWoken
+ *                         );
+ * @endcode
+ *
+ * A version of vQueueCommit() that can be called from an ISR, for example
+ * when a DMA transfer into a reserved slot completes.
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the commit unblocked a
+ * task of higher priority than the interrupted task.
+ *
+ * \defgroup vQueueCommitFromISR vQueueCommitFromISR
+ * \ingroup QueueManagement
+ */
+void vQueueCommitFromISR( QueueHandle_t xQueue,
+                          BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * void vQueueAbortReserve( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Give back the slot reserved by xQueueReserve() without posting an item, for
+ * example when the data to write into it turns out to be invalid.  Nothing is
+ * added to the queue, and the next xQueueReserve() returns the same slot.  A
+ * writer blocked because the slot was reserved is unblocked.
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * \defgroup vQueueAbortReserve vQueueAbortReserve
+ * \ingroup QueueManagement
+ */
+void vQueueAbortReserve( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * void vQueueAbortReserveFromISR(
+ *                                  QueueHandle_t xQueue,
+ *                                  BaseType_t *pxHigherPriorityTaskWoken
+ *                               );
+ * @endcode
+ *
+ * A version of vQueueAbortReserve() that can be called from an ISR, for
+ * example when a DMA transfer into a reserved slot fails.
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the abort unblocked a
+ * task of higher priority than the interrupted task.
+ *
+ * \defgroup vQueueAbortReserveFromISR vQueueAbortReserveFromISR
+ * \ingroup QueueManagement
+ */
+void vQueueAbortReserveFromISR( QueueHandle_t xQueue,
+                                BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueBorrow(
+ *                           QueueHandle_t xQueue,
+ *                           void **ppvSlot,
+ *                           TickType_t xTicksToWait
+ *                        );
+ * @endcode
+ *
+ * Borrow the oldest item of a queue so it can be read directly from the queue
+ * storage instead of being copied out by xQueueReceive().  The slot is given
+ * back to writers when vQueueRelease() is called.
+ *
+ * Only one item of a queue can be borrowed at a time.  While it is borrowed
+ * other readers block in xQueueBorrow() as if the queue was empty, and
+ * xQueueReceive(), xQueuePeek() and xQueueSendToFront() must not be used on
+ * the queue.
+ *
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * @param ppvSlot Set to the address of the borrowed item.  It stays valid
+ * until vQueueRelease() is called.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item, as for xQueueReceive().
+ *
+ * @return pdPASS if an item was borrowed, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xQueueBorrow xQueueBorrow
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueBorrow( QueueHandle_t xQueue,
+                         void ** const ppvSlot,
+                         TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueBorrowFromISR(
+ *                                  QueueHandle_t xQueue,
+ *                                  void **ppvSlot
+ *                               );
+ * @endcode
+ *
+ * A version of xQueueBorrow() that can be called from an ISR.  It never
+ * blocks.
+ *
+ * @return pdPASS if an item was borrowed, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xQueueBorrowFromISR xQueueBorrowFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueBorrowFromISR( QueueHandle_t xQueue,
+                                void ** const ppvSlot ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * void vQueueRelease( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Remove the item borrowed by xQueueBorrow() from the queue.  Tasks blocked
+ * on the queue are unblocked as they would be by xQueueReceive().
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * \defgroup vQueueRelease vQueueRelease
+ * \ingroup QueueManagement
+ */
+void vQueueRelease( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * void vQueueReleaseFromISR(
+ *                             QueueHandle_t xQueue,
+ *                             BaseType_t *pxHigherPriorityTaskWoken
+ *                          );
+ * @endcode
+ *
+ * A version of vQueueRelease() that can be called from an ISR.
+ *
+ * @param xQueue The handle to the queue.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the release unblocked a
+ * task of higher priority than the interrupted task.
+ *
+ * \defgroup vQueueReleaseFromISR vQueueReleaseFromISR
+ * \ingroup QueueManagement
+ */
+void vQueueReleaseFromISR( QueueHandle_t xQueue,
+                           BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from within an ISR, or within a critical section.
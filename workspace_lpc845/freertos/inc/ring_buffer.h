@@ -0,0 +1,345 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Ring buffers carry a byte stream from interrupts or tasks (the writers) to a
+ * single task or interrupt (the reader), for example received UART characters
+ * or ADC samples.  They are a lighter alternative to stream buffers:
+ *
+ * + A ring buffer created with xRingBufferCreate() accepts a single writer.
+ *   Writing and reading are lock free, the writer only ever stores the write
+ *   index and the reader only ever stores the read index, and both are plain
+ *   single word loads and stores.
+ *
+ * + A ring buffer created with xRingBufferCreateMultiProducer() accepts any
+ *   number of writers, tasks and interrupts mixed.  Each write is performed
+ *   inside a short critical section that only covers the copy into the buffer.
+ *
+ * + A single call moves a whole batch of bytes, wrapping around the end of the
+ *   storage area with at most two copies and a single index update.
+ *
+ * + Writers never block, they store as many bytes as fit and return that
+ *   number.  The reader may block waiting for data.  The task notification
+ *   machinery is only entered when the reader is actually blocked, so writes to
+ *   a buffer that nobody waits on cost a single extra load.
+ *
+ * The storage area size must be a power of two.  Unlike stream buffers the full
+ * storage area can be used.  There must only be one reader.  A blocked reader
+ * waits on its task notification, so a task should not read a ring buffer while
+ * it uses direct to task notifications for other purposes.
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include ring_buffer.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type by which ring buffers are referenced.  For example, a call to
+ * xRingBufferCreate() returns a RingBufferHandle_t variable that can then be
+ * used as a parameter to xRingBufferSend(), xRingBufferReceive(), etc.
+ */
+struct RingBufferDef_t;
+typedef struct RingBufferDef_t * RingBufferHandle_t;
+
+/**
+ * ring_buffer.h
+ *
+ * @code{c}
+ * RingBufferHandle_t xRingBufferCreate( size_t xBufferSizeBytes );
+ * RingBufferHandle_t xRingBufferCreateMultiProducer( size_t xBufferSizeBytes );
+ * @endcode
+ *
+ * Creates a new ring buffer using dynamically allocated memory.
+ * xRingBufferCreate() creates a lock free buffer for a single writer,
+ * xRingBufferCreateMultiProducer() a buffer that can be written by several
+ * tasks and interrupts.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 or left undefined in
+ * FreeRTOSConfig.h for these functions to be available.
+ *
+ * @param xBufferSizeBytes The number of bytes the ring buffer will be able to
+ * hold at any one time.  Must be a power of two.
+ *
+ * @return The handle of the created ring buffer, or NULL if there was not
+ * enough heap memory available.
+ *
+ * Example use:
+ * @code{c}
+ * static RingBufferHandle_t xRxRing;
+ *
+ * void USART0_IRQHandler( void )
+ * {
+ * uint8_t ucByte = ( uint8_t ) USART0->RXDAT;
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *  ( void ) xRingBufferSendFromISR( xRxRing, &ucByte, 1, &xHigherPriorityTaskWoken );
+ *  portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ *
+ * void vRxTask( void * pvParameters )
+ * {
+ * uint8_t ucLine[ 32 ];
+ * size_t xReceived;
+ *
+ *  xRxRing = xRingBufferCreate( 64 );
+ *
+ *  for( ;; )
+ *  {
+ *      // Wait for at least one byte, then take everything available that
+ *      // fits in ucLine.
+ *      xReceived = xRingBufferReceive( xRxRing, ucLine, sizeof( ucLine ), portMAX_DELAY );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xRingBufferCreate xRingBufferCreate
+ * \ingroup RingBufferManagement
+ */
+#define xRingBufferCreate( xBufferSizeBytes ) \
+    xRingBufferGenericCreate( ( xBufferSizeBytes ), pdFALSE )
+
+#define xRingBufferCreateMultiProducer( xBufferSizeBytes ) \
+    xRingBufferGenericCreate( ( xBufferSizeBytes ), pdTRUE )
+
+/**
+ * ring_buffer.h
+ *
+ * @code{c}
+ * RingBufferHandle_t xRingBufferCreateStatic( size_t xBufferSizeBytes,
+ *                                             uint8_t *pucRingBufferStorageArea,
+ *                                             StaticRingBuffer_t *pxStaticRingBuffer );
+ * RingBufferHandle_t xRingBufferCreateMultiProducerStatic( size_t xBufferSizeBytes,
+ *                                                          uint8_t *pucRingBufferStorageArea,
+ *                                                          StaticRingBuffer_t *pxStaticRingBuffer );
+ * @endcode
+ *
+ * Creates a new ring buffer using statically allocated memory.  See
+ * xRingBufferCreate() for the difference between the two variants.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * @param xBufferSizeBytes The size, in bytes, of the buffer pointed to by the
+ * pucRingBufferStorageArea parameter.  Must be a power of two.
+ *
+ * @param pucRingBufferStorageArea Must point to a uint8_t array that is at least
+ * xBufferSizeBytes big.
+ *
+ * @param pxStaticRingBuffer Must point to a variable of type StaticRingBuffer_t,
+ * which will be used to hold the ring buffer's data structure.
+ *
+ * @return The handle of the created ring buffer, or NULL if either
+ * pucRingBufferStorageArea or pxStaticRingBuffer are NULL.
+ *
+ * \defgroup xRingBufferCreateStatic xRingBufferCreateStatic
+ * \ingroup RingBufferManagement
+ */
+#define xRingBufferCreateStatic( xBufferSizeBytes, pucRingBufferStorageArea, pxStaticRingBuffer ) \
+    xRingBufferGenericCreateStatic( ( xBufferSizeBytes ), pdFALSE, ( pucRingBufferStorageArea ), ( pxStaticRingBuffer ) )
+
+#define xRingBufferCreateMultiProducerStatic( xBufferSizeBytes, pucRingBufferStorageArea, pxStaticRingBuffer ) \
+    xRingBufferGenericCreateStatic( ( xBufferSizeBytes ), pdTRUE, ( pucRingBufferStorageArea ), ( pxStaticRingBuffer ) )
+
+/**
+ * ring_buffer.h
+ *
+ * @code{c}
+ * size_t xRingBufferSend( RingBufferHandle_t xRingBuffer,
+ *                         const void *pvTxData,
+ *                         size_t xDataLengthBytes );
+ * @endcode
+ *
+ * Writes bytes to a ring buffer from a task.  Never blocks: if there is not
+ * enough space for all the bytes, as many as fit are written.  Use
+ * xRingBufferSendFromISR() to write from an interrupt service routine.
+ *
+ * If the ring buffer was created with xRingBufferCreate() there must be only
+ * one writer, and the write does not disable interrupts.
+ *
+ * @param xRingBuffer The handle of the ring buffer being written to.
+ *
+ * @param pvTxData A pointer to the bytes to copy into the ring buffer.
+ *
+ * @param xDataLengthBytes The maximum number of bytes to copy.
+ *
+ * @return The number of bytes written to the ring buffer.
+ *
+ * \defgroup xRingBufferSend xRingBufferSend
+ * \ingroup RingBufferManagement
+ */
+size_t xRingBufferSend( RingBufferHandle_t xRingBuffer,
+                        const void * pvTxData,
+                        size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_buffer.h
+ *
+ * @code{c}
+ * size_t xRingBufferSendFromISR( RingBufferHandle_t xRingBuffer,
+ *                                const void *pvTxData,
+ *                                size_t xDataLengthBytes,
+ *                                BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xRingBufferSend().
+ *
+ * @param xRingBuffer The handle of the ring buffer being written to.
+ *
+ * @param pvTxData A pointer to the bytes to copy into the ring buffer.
+ *
+ * @param xDataLengthBytes The maximum number of bytes to copy.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the write unblocked a
+ * reader task that has a priority above the priority of the currently running
+ * task.  In that case a context switch should be requested before the
+ * interrupt is exited.  Only written when the reader was blocked.
+ *
+ * @return The number of bytes written to the ring buffer.
+ *
+ * \defgroup xRingBufferSendFromISR xRingBufferSendFromISR
+ * \ingroup RingBufferManagement
+ */
+size_t xRingBufferSendFromISR( RingBufferHandle_t xRingBuffer,
+                               const void * pvTxData,
+                               size_t xDataLengthBytes,
+                               BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_buffer.h
+ *
+ * @code{c}
+ * size_t xRingBufferReceive( RingBufferHandle_t xRingBuffer,
+ *                            void *pvRxData,
+ *                            size_t xBufferLengthBytes,
+ *                            TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Reads bytes from a ring buffer from a task.  If the ring buffer is empty the
+ * calling task is held in the Blocked state for up to xTicksToWait ticks until
+ * at least one byte arrives.  All available bytes are then read, up to
+ * xBufferLengthBytes.  Use xRingBufferReceiveFromISR() to read from an
+ * interrupt service routine.
+ *
+ * @param xRingBuffer The handle of the ring buffer being read from.
+ *
+ * @param pvRxData A pointer to the buffer into which the bytes are copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data.
+ *
+ * @return The number of bytes read, 0 if the block time expired before any
+ * data arrived.
+ *
+ * \defgroup xRingBufferReceive xRingBufferReceive
+ * \ingroup RingBufferManagement
+ */
+size_t xRingBufferReceive( RingBufferHandle_t xRingBuffer,
+                           void * pvRxData,
+                           size_t xBufferLengthBytes,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_buffer.h
+ *
+ * @code{c}
+ * size_t xRingBufferReceiveFromISR( RingBufferHandle_t xRingBuffer,
+ *                                   void *pvRxData,
+ *                                   size_t xBufferLengthBytes );
+ * @endcode
+ *
+ * Interrupt safe version of xRingBufferReceive().  Never blocks.  Writers
+ * never block on a ring buffer, so reading does not wake any task.
+ *
+ * @return The number of bytes read.
+ *
+ * \defgroup xRingBufferReceiveFromISR xRingBufferReceiveFromISR
+ * \ingroup RingBufferManagement
+ */
+size_t xRingBufferReceiveFromISR( RingBufferHandle_t xRingBuffer,
+                                  void * pvRxData,
+                                  size_t xBufferLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_buffer.h
+ *
+ * @code{c}
+ * size_t xRingBufferBytesAvailable( RingBufferHandle_t xRingBuffer );
+ * size_t xRingBufferSpacesAvailable( RingBufferHandle_t xRingBuffer );
+ * @endcode
+ *
+ * Query the number of bytes that can currently be read from, respectively
+ * written to, the ring buffer.  Both can be called from tasks and interrupts.
+ *
+ * \defgroup xRingBufferBytesAvailable xRingBufferBytesAvailable
+ * \ingroup RingBufferManagement
+ */
+size_t xRingBufferBytesAvailable( RingBufferHandle_t xRingBuffer ) PRIVILEGED_FUNCTION;
+size_t xRingBufferSpacesAvailable( RingBufferHandle_t xRingBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_buffer.h
+ *
+ * @code{c}
+ * void vRingBufferDelete( RingBufferHandle_t xRingBuffer );
+ * @endcode
+ *
+ * Deletes a ring buffer.  If the ring buffer was created using dynamic memory
+ * the memory is freed.  A deleted ring buffer must not be used, and it must not
+ * be deleted while the reader is blocked on it.
+ *
+ * \defgroup vRingBufferDelete vRingBufferDelete
+ * \ingroup RingBufferManagement
+ */
+void vRingBufferDelete( RingBufferHandle_t xRingBuffer ) PRIVILEGED_FUNCTION;
+
+/* Functions below here are not part of the public API. */
+RingBufferHandle_t xRingBufferGenericCreate( size_t xBufferSizeBytes,
+                                             BaseType_t xMultiProducer ) PRIVILEGED_FUNCTION;
+
+RingBufferHandle_t xRingBufferGenericCreateStatic( size_t xBufferSizeBytes,
+                                                   BaseType_t xMultiProducer,
+                                                   uint8_t * const pucRingBufferStorageArea,
+                                                   StaticRingBuffer_t * const pxStaticRingBuffer ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( RING_BUFFER_H ) */
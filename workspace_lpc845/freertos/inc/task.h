@@ -245,6 +245,25 @@ typedef enum
  */
 #define taskENABLE_INTERRUPTS()            portENABLE_INTERRUPTS()
 
+/**
+ * task. h
+ *
+ * Macros to place at the start and at the end of an interrupt service routine
+ * so that vTaskGetStackReport() can report how deeply interrupts nested.  They
+ * compile to nothing unless configUSE_STACK_PROFILING is set to 1.  The tick
+ * interrupt of the port already uses them.
+ *
+ * \defgroup taskSTACK_PROFILE_ISR_ENTER taskSTACK_PROFILE_ISR_ENTER
+ * \ingroup SchedulerControl
+ */
+#if ( configUSE_STACK_PROFILING == 1 )
+    #define taskSTACK_PROFILE_ISR_ENTER()    vTaskStackProfileISREnter()
+    #define taskSTACK_PROFILE_ISR_EXIT()     vTaskStackProfileISRExit()
+#else
+    #define taskSTACK_PROFILE_ISR_ENTER()
+    #define taskSTACK_PROFILE_ISR_EXIT()
+#endif
+
 /* Definitions returned by xTaskGetSchedulerState().  taskSCHEDULER_SUSPENDED is
  * 0 to generate more optimal code when configASSERT() is defined as the constant
  * is used in assert() statements. */
@@ -1860,6 +1879,45 @@ UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
  */
 void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetStackReport( char *pcWriteBuffer, size_t xBufferLength );
+ * @endcode
+ *
+ * configUSE_STACK_PROFILING must be defined as 1 for this function to be
+ * available.  Stacks are then filled with a known value when tasks are
+ * created, and so is the unused part of the interrupt stack when the
+ * scheduler starts.
+ *
+ * Writes the stack usage of every task, and of the interrupt stack, to
+ * pcWriteBuffer as lines of tab separated fields:
+ *
+ * stack-report <version> <bytes per stack word>
+ * task <name> <stack size> <most ever used>
+ * isr <stack size> <most ever used> <deepest interrupt nesting>
+ *
+ * Sizes are in words, as passed to xTaskCreate().  The interrupt stack size
+ * is 0 when the port does not know where the interrupt stack is, and the
+ * nesting depth only counts interrupts that use taskSTACK_PROFILE_ISR_ENTER().
+ * The report is read by tools/stack_size.py, which combines it with the
+ * -fstack-usage output of the build to recommend stack sizes.  Lines that do
+ * not fit in xBufferLength bytes are left out.
+ *
+ * Like vTaskList() this function suspends the scheduler while it walks the
+ * task lists, and is intended as a debug aid.  It uses snprintf().
+ *
+ * @param pcWriteBuffer A buffer into which the report is written.
+ *
+ * @param xBufferLength The size of pcWriteBuffer in bytes.  About 32 bytes
+ * per task is enough with the default task name length.
+ *
+ * \defgroup vTaskGetStackReport vTaskGetStackReport
+ * \ingroup TaskUtils
+ */
+void vTaskGetStackReport( char * pcWriteBuffer,
+                          size_t xBufferLength ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
 /**
  * task. h
  * @code{c}
@@ -3003,6 +3061,33 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEG
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Used by event groups, whose event lists are accessed by interrupts as well
+ * as tasks, in place of vTaskPlaceOnUnorderedEventList() and
+ * vTaskRemoveFromUnorderedEventList().
+ *
+ * vTaskInsertOnUnorderedEventList() must be called with the scheduler
+ * suspended and from a critical section.  It places the calling task's event
+ * list item, holding xItemValue, at the end of pxEventList.
+ *
+ * vTaskBlockOnEventList() must then be called with the scheduler still
+ * suspended, but outside the critical section, to move the calling task to the
+ * delayed list for xTicksToWait ticks.
+ *
+ * xTaskRemoveItemFromEventList() must be called from a critical section, from
+ * a task or an ISR.  It removes pxEventListItem from its event list, stores
+ * xItemValue in it, and readies the owning task.  It returns pdTRUE if that
+ * task has a higher priority than the task that was running.
+ */
+void vTaskInsertOnUnorderedEventList( List_t * pxEventList,
+                                      const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+void vTaskBlockOnEventList( const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskRemoveItemFromEventList( ListItem_t * pxEventListItem,
+                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -3071,6 +3156,13 @@ UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 void vTaskSetTaskNumber( TaskHandle_t xTask,
                          const UBaseType_t uxHandle ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called through taskSTACK_PROFILE_ISR_ENTER() and taskSTACK_PROFILE_ISR_EXIT()
+ * to track the deepest interrupt nesting.
+ */
+void vTaskStackProfileISREnter( void ) PRIVILEGED_FUNCTION;
+void vTaskStackProfileISRExit( void ) PRIVILEGED_FUNCTION;
+
 /*
  * Only available when configUSE_TICKLESS_IDLE is set to 1.
  * If tickless mode is being used, or a low power mode is implemented, then
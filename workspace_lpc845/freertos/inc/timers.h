@@ -453,9 +453,37 @@ BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
  *
  * Simply returns the handle of the timer service/daemon task.  It it not valid
  * to call xTimerGetTimerDaemonTaskHandle() before the scheduler has been started.
+ *
+ * When configTIMERS_RUN_FROM_TICK is 1 there is no daemon task, the handle of
+ * the task that runs deferred callbacks is returned instead.
  */
 TaskHandle_t xTimerGetTimerDaemonTaskHandle( void ) PRIVILEGED_FUNCTION;
 
+#if ( configTIMERS_RUN_FROM_TICK == 1 ) && ( configTIMER_DEFERRED_CALLBACKS == 1 )
+
+/**
+ * void vTimerSetDeferredCallback( TimerHandle_t xTimer, BaseType_t xDeferred );
+ *
+ * When configTIMERS_RUN_FROM_TICK is 1, timer callbacks are called from the
+ * tick interrupt, so they must be short and only use API functions that end in
+ * "FromISR".  Passing xDeferred as pdTRUE has the callback of xTimer run by a
+ * task at configTIMER_TASK_PRIORITY instead, where it may block or use any API
+ * function.  If the timer expires again before its deferred callback has run,
+ * the callback runs once.
+ *
+ * configTIMER_DEFERRED_CALLBACKS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  The task is only created when it is set.
+ *
+ * @param xTimer The timer being updated.
+ *
+ * @param xDeferred pdTRUE to run the callback from the task, pdFALSE to run it
+ * from the tick interrupt.
+ */
+    void vTimerSetDeferredCallback( TimerHandle_t xTimer,
+                                    const BaseType_t xDeferred ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /**
  * BaseType_t xTimerStart( TimerHandle_t xTimer, TickType_t xTicksToWait );
  *
@@ -646,6 +674,11 @@ TaskHandle_t xTimerGetTimerDaemonTaskHandle( void ) PRIVILEGED_FUNCTION;
  * xTimerDelete() deletes a timer that was previously created using the
  * xTimerCreate() API function.
  *
+ * When configTIMERS_RUN_FROM_TICK is 1 the timer is freed at once, which
+ * suspends the scheduler, so a timer created with xTimerCreate() can't be
+ * deleted from a callback run by the tick interrupt.  Delete it from a task or
+ * a deferred callback instead.
+ *
  * The configUSE_TIMERS configuration constant must be set to 1 for
  * xTimerDelete() to be available.
  *
@@ -1334,6 +1367,12 @@ BaseType_t xTimerGenericCommand( TimerHandle_t xTimer,
                                  BaseType_t * const pxHigherPriorityTaskWoken,
                                  const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+#if ( configTIMERS_RUN_FROM_TICK == 1 )
+    BaseType_t xTimerIncrementTick( void ) PRIVILEGED_FUNCTION;
+    TickType_t xTimerGetTicksToNextExpiry( void ) PRIVILEGED_FUNCTION;
+    void vTimerStepTicks( const TickType_t xTicksToJump ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_TRACE_FACILITY == 1 )
     void vTimerSetTimerNumber( TimerHandle_t xTimer,
                                UBaseType_t uxTimerNumber ) PRIVILEGED_FUNCTION;
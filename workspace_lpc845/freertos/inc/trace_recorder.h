@@ -0,0 +1,266 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Trace recorder.  When configUSE_TRACE_RECORDER is set to 1 in
+ * FreeRTOSConfig.h this header maps the kernel trace macros onto a compact
+ * recorder that stores task switches, task state changes and queue operations
+ * in a RAM ring buffer:
+ *
+ * + Each event is an 8 byte record: a 32-bit timestamp read from a free running
+ *   timer (the CTIMER on the LPC845, the monotonic clock on the POSIX port),
+ *   the event code, the task or queue number it applies to and an 8-bit
+ *   parameter.
+ *
+ * + Task and queue names are kept once in a symbol table next to the records,
+ *   tasks when they are created and queues when they are added to the queue
+ *   registry.
+ *
+ * + When the buffer is full the oldest records are overwritten, so the buffer
+ *   always holds the most recent history.
+ *
+ * The whole recorder is the single variable xTraceRecorderData, which can be
+ * dumped from the debugger, or sent by the application using the pointer and
+ * size returned by pvTraceRecorderGetData().  tools/trace_decode.py turns a
+ * dump into per task CPU usage, blocking time histograms and a Chrome trace /
+ * Perfetto JSON timeline.
+ *
+ * An application that needs the CTIMER for itself can time the records with
+ * another free running 32-bit timer by defining
+ * configTRACE_RECORDER_SETUP_TIMESTAMP(), which starts the timer and returns
+ * its frequency in Hz, and configTRACE_RECORDER_GET_TIMESTAMP().
+ *
+ * The recorder numbers the queues itself, so vQueueSetQueueNumber() should not
+ * be used while it is enabled.  configUSE_TRACE_FACILITY must be set to 1.
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Number of event records kept, must be a power of two. */
+#ifndef configTRACE_RECORDER_BUFFER_ENTRIES
+    #define configTRACE_RECORDER_BUFFER_ENTRIES    128
+#endif
+
+/* Number of task and queue names kept.  Names beyond that are not recorded,
+ * the decoder then shows the object number instead. */
+#ifndef configTRACE_RECORDER_SYMBOLS
+    #define configTRACE_RECORDER_SYMBOLS    12
+#endif
+
+/* Event codes stored in the records.  tools/trace_decode.py must be kept in
+ * step with these. */
+#define traceRECORDER_EVENT_TASK_SWITCHED_IN          ( 1U )  /* Object is the task, parameter its priority. */
+#define traceRECORDER_EVENT_TASK_CREATE               ( 2U )  /* Object is the task, parameter its priority. */
+#define traceRECORDER_EVENT_TASK_DELETE               ( 3U )
+#define traceRECORDER_EVENT_TASK_READY                ( 4U )
+#define traceRECORDER_EVENT_TASK_DELAY                ( 5U )  /* Object is the delayed task. */
+#define traceRECORDER_EVENT_TASK_SUSPEND              ( 6U )
+#define traceRECORDER_EVENT_TASK_RESUME               ( 7U )
+#define traceRECORDER_EVENT_TASK_PRIORITY_SET         ( 8U )  /* Parameter is the new priority. */
+#define traceRECORDER_EVENT_TASK_NOTIFY               ( 9U )  /* Object is the notified task, parameter the index. */
+#define traceRECORDER_EVENT_TASK_NOTIFY_FROM_ISR      ( 10U )
+#define traceRECORDER_EVENT_TASK_NOTIFY_BLOCK         ( 11U ) /* Object is the blocking task, parameter the index. */
+#define traceRECORDER_EVENT_QUEUE_CREATE              ( 16U ) /* Object is the queue, parameter its queueQUEUE_TYPE_ value. */
+#define traceRECORDER_EVENT_QUEUE_DELETE              ( 17U )
+#define traceRECORDER_EVENT_QUEUE_SEND                ( 18U )
+#define traceRECORDER_EVENT_QUEUE_SEND_FAILED         ( 19U )
+#define traceRECORDER_EVENT_QUEUE_SEND_FROM_ISR       ( 20U )
+#define traceRECORDER_EVENT_QUEUE_RECEIVE             ( 21U )
+#define traceRECORDER_EVENT_QUEUE_RECEIVE_FAILED      ( 22U )
+#define traceRECORDER_EVENT_QUEUE_RECEIVE_FROM_ISR    ( 23U )
+#define traceRECORDER_EVENT_QUEUE_PEEK                ( 24U )
+#define traceRECORDER_EVENT_QUEUE_BLOCK_SEND          ( 25U ) /* Object is the queue, as for all queue events. */
+#define traceRECORDER_EVENT_QUEUE_BLOCK_RECEIVE       ( 26U )
+
+/* Kinds of symbol table entries. */
+#define traceRECORDER_SYMBOL_TASK                     ( 1U )
+#define traceRECORDER_SYMBOL_QUEUE                    ( 2U )
+
+/**
+ * trace_recorder.h
+ *
+ * @code{c}
+ * void vTraceRecorderStart( void );
+ * @endcode
+ *
+ * Starts the timestamp timer and starts recording, discarding any records
+ * already in the buffer.  Names of tasks and queues created before the call are
+ * kept, so the recorder can be started at any time, but calling it at the start
+ * of main() also records the creation of each object.
+ *
+ * On the LPC845 the CTIMER stops in deep-sleep and power-down mode, so while
+ * recording tickless idle is limited to sleep mode with
+ * vPortSetTicklessModeLimit().
+ */
+void vTraceRecorderStart( void );
+
+/**
+ * trace_recorder.h
+ *
+ * @code{c}
+ * void vTraceRecorderStop( void );
+ * @endcode
+ *
+ * Stops recording, leaving the records in the buffer for dumping.  Can be
+ * called from an interrupt or an assert handler to freeze the history leading
+ * to a fault.
+ */
+void vTraceRecorderStop( void );
+
+/**
+ * trace_recorder.h
+ *
+ * @code{c}
+ * void * pvTraceRecorderGetData( size_t * pxSize );
+ * @endcode
+ *
+ * @param pxSize Set to the number of bytes of the recorder data.
+ *
+ * @return A pointer to the recorder data, the image tools/trace_decode.py
+ * expects.  Recording should be stopped while the data is copied out.
+ */
+void * pvTraceRecorderGetData( size_t * pxSize );
+
+/* Functions below here are not part of the public API, they are called by the
+ * trace macros. */
+void vTraceRecorderEvent( uint8_t ucEvent,
+                          uint32_t ulObject,
+                          uint32_t ulParam );
+void vTraceRecorderAddSymbol( uint8_t ucKind,
+                              uint32_t ulObject,
+                              const char * pcName );
+uint32_t ulTraceRecorderNextQueueNumber( void );
+
+/* The trace macros are expanded in tasks.c and queue.c, where the TCB_t and
+ * Queue_t members they read are visible.  Tasks are identified by uxTCBNumber,
+ * which the kernel increments for every task created. */
+#define traceTASK_SWITCHED_IN()                                                            \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_SWITCHED_IN,                             \
+                         ( uint32_t ) pxCurrentTCB->uxTCBNumber, ( uint32_t ) pxCurrentTCB->uxPriority )
+
+#define traceTASK_CREATE( pxNewTCB )                                                               \
+    do {                                                                                           \
+        vTraceRecorderAddSymbol( traceRECORDER_SYMBOL_TASK, ( uint32_t ) ( pxNewTCB )->uxTCBNumber, \
+                                 ( pxNewTCB )->pcTaskName );                                       \
+        vTraceRecorderEvent( traceRECORDER_EVENT_TASK_CREATE,                                      \
+                             ( uint32_t ) ( pxNewTCB )->uxTCBNumber, ( uint32_t ) ( pxNewTCB )->uxPriority ); \
+    } while( 0 )
+
+#define traceTASK_DELETE( pxTaskToDelete )                                               \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_DELETE,                                \
+                         ( uint32_t ) ( pxTaskToDelete )->uxTCBNumber, 0UL )
+
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )                                          \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_READY,                                 \
+                         ( uint32_t ) ( pxTCB )->uxTCBNumber, 0UL )
+
+#define traceTASK_DELAY()                                                                \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_DELAY,                                 \
+                         ( uint32_t ) pxCurrentTCB->uxTCBNumber, 0UL )
+
+#define traceTASK_DELAY_UNTIL( xTimeToWake )                                             \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_DELAY,                                 \
+                         ( uint32_t ) pxCurrentTCB->uxTCBNumber, 0UL )
+
+#define traceTASK_SUSPEND( pxTaskToSuspend )                                             \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_SUSPEND,                               \
+                         ( uint32_t ) ( pxTaskToSuspend )->uxTCBNumber, 0UL )
+
+#define traceTASK_RESUME( pxTaskToResume )                                               \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_RESUME,                                \
+                         ( uint32_t ) ( pxTaskToResume )->uxTCBNumber, 0UL )
+
+#define traceTASK_RESUME_FROM_ISR( pxTaskToResume )    traceTASK_RESUME( pxTaskToResume )
+
+#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )                                  \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_PRIORITY_SET,                          \
+                         ( uint32_t ) ( pxTask )->uxTCBNumber, ( uint32_t ) ( uxNewPriority ) )
+
+#define traceTASK_NOTIFY( uxIndexToNotify )                                              \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY,                                \
+                         ( uint32_t ) pxTCB->uxTCBNumber, ( uint32_t ) ( uxIndexToNotify ) )
+
+#define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )                                     \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY_FROM_ISR,                       \
+                         ( uint32_t ) pxTCB->uxTCBNumber, ( uint32_t ) ( uxIndexToNotify ) )
+
+#define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify )    traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )
+
+#define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )                                     \
+    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY_BLOCK,                          \
+                         ( uint32_t ) pxCurrentTCB->uxTCBNumber, ( uint32_t ) ( uxIndexToWait ) )
+
+#define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )    traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )
+
+#define traceQUEUE_CREATE( pxNewQueue )                                                  \
+    do {                                                                                 \
+        ( pxNewQueue )->uxQueueNumber = ( UBaseType_t ) ulTraceRecorderNextQueueNumber(); \
+        vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_CREATE,                           \
+                             ( uint32_t ) ( pxNewQueue )->uxQueueNumber, ( uint32_t ) ( pxNewQueue )->ucQueueType ); \
+    } while( 0 )
+
+#define traceQUEUE_DELETE( pxQueue )                                                     \
+    vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_DELETE, ( uint32_t ) ( pxQueue )->uxQueueNumber, 0UL )
+
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )                                   \
+    vTraceRecorderAddSymbol( traceRECORDER_SYMBOL_QUEUE,                                 \
+                             ( uint32_t ) ( ( Queue_t * ) ( xQueue ) )->uxQueueNumber, ( pcQueueName ) )
+
+/* Queue events, including blocking on a queue, store the queue as the object.
+ * The decoder attributes them to the task that was last switched in. */
+#define traceRECORDER_QUEUE_EVENT( ucEvent, pxQueue )                                   \
+    vTraceRecorderEvent( ( ucEvent ), ( uint32_t ) ( pxQueue )->uxQueueNumber, 0UL )
+
+#define traceQUEUE_SEND( pxQueue )                     traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_SEND, pxQueue )
+#define traceQUEUE_SEND_FAILED( pxQueue )              traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_SEND_FAILED, pxQueue )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )            traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_SEND_FROM_ISR, pxQueue )
+#define traceQUEUE_RECEIVE( pxQueue )                  traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_RECEIVE, pxQueue )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )           traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_RECEIVE_FAILED, pxQueue )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )         traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_RECEIVE_FROM_ISR, pxQueue )
+#define traceQUEUE_PEEK( pxQueue )                     traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_PEEK, pxQueue )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )         traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_BLOCK_SEND, pxQueue )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )      traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_BLOCK_RECEIVE, pxQueue )
+#define traceBLOCKING_ON_QUEUE_PEEK( pxQueue )         traceRECORDER_QUEUE_EVENT( traceRECORDER_EVENT_QUEUE_BLOCK_RECEIVE, pxQueue )
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( TRACE_RECORDER_H ) */
@@ -0,0 +1,448 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+* Implementation of functions defined in portable.h for the host simulator.
+*
+* Each task is given a POSIX thread when it is created.  A thread only runs
+* while its task is the one selected by the scheduler, every other thread
+* waits on its own event.  A context switch therefore signals the event of the
+* new task and then waits on the event of the old one.
+*
+* The tick interrupt is a SIGALRM raised by an interval timer.  Disabling
+* interrupts blocks that signal in the calling thread.  Threads that are not
+* running always have it blocked, so the signal is only ever delivered to the
+* thread of the running task.
+*----------------------------------------------------------*/
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#ifndef FREERTOS_PORT_POSIX
+    #error portable/posix/port.c must be built with FREERTOS_PORT_POSIX defined
+#endif
+
+/* Period of the tick timer in microseconds. */
+#define portTICK_PERIOD_US    ( 1000000UL / configTICK_RATE_HZ )
+
+/* Binary semaphore a thread waits on until it is allowed to run. */
+typedef struct EVENT
+{
+    pthread_mutex_t xMutex;
+    pthread_cond_t xCond;
+    BaseType_t xSignalled;
+} Event_t;
+
+/* Host thread of a task.  It is placed at the top of the task stack, which the
+ * task itself does not use as it runs on the stack of its host thread. */
+typedef struct THREAD
+{
+    pthread_t xPthread;
+    TaskFunction_t pxCode;
+    void * pvParams;
+    BaseType_t xDying;
+    Event_t * pxEvent;
+} Thread_t;
+
+/*-----------------------------------------------------------*/
+
+/* Each thread keeps its own critical nesting, as a task does on the targets
+ * that save it as part of the task context. */
+static __thread UBaseType_t uxCriticalNesting = 0;
+
+/* Signalled when the scheduler is stopped, the main thread waits on it. */
+static Event_t * pxSchedulerEndEvent = NULL;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Blocks or unblocks the tick signal in the calling thread.  Returns pdTRUE if
+ * it was blocked before the call.
+ */
+static BaseType_t prvSetTickSignalBlocked( BaseType_t xBlock );
+
+/*
+ * Thread events.
+ */
+static Event_t * prvEventCreate( void );
+static void prvEventDelete( Event_t * pxEvent );
+static void prvEventSignal( Event_t * pxEvent );
+static void prvEventWait( Event_t * pxEvent );
+
+/*
+ * Returns the thread of a task, the first member of its TCB points to it.
+ */
+static Thread_t * prvGetThreadFromTask( TaskHandle_t xTask );
+
+/*
+ * Hands the processor from the thread of one task to the thread of another.
+ */
+static void prvSwitchThread( Thread_t * pxThreadToResume,
+                             Thread_t * pxThreadToSuspend );
+
+/*
+ * Entry point of every task thread.
+ */
+static void * prvThreadStart( void * pvParams );
+
+/*
+ * Tick interrupt.
+ */
+static void prvTickSignalHandler( int iSignal );
+
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSetTickSignalBlocked( BaseType_t xBlock )
+{
+    sigset_t xSignals;
+    sigset_t xPreviousSignals;
+
+    ( void ) sigemptyset( &xSignals );
+    ( void ) sigaddset( &xSignals, SIGALRM );
+    ( void ) pthread_sigmask( ( xBlock != pdFALSE ) ? SIG_BLOCK : SIG_UNBLOCK, &xSignals, &xPreviousSignals );
+
+    return ( sigismember( &xPreviousSignals, SIGALRM ) == 1 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static Event_t * prvEventCreate( void )
+{
+    Event_t * pxEvent = malloc( sizeof( Event_t ) );
+
+    if( pxEvent != NULL )
+    {
+        ( void ) pthread_mutex_init( &pxEvent->xMutex, NULL );
+        ( void ) pthread_cond_init( &pxEvent->xCond, NULL );
+        pxEvent->xSignalled = pdFALSE;
+    }
+
+    return pxEvent;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventDelete( Event_t * pxEvent )
+{
+    ( void ) pthread_mutex_destroy( &pxEvent->xMutex );
+    ( void ) pthread_cond_destroy( &pxEvent->xCond );
+    free( pxEvent );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( Event_t * pxEvent )
+{
+    ( void ) pthread_mutex_lock( &pxEvent->xMutex );
+    pxEvent->xSignalled = pdTRUE;
+    ( void ) pthread_cond_signal( &pxEvent->xCond );
+    ( void ) pthread_mutex_unlock( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventUnlock( void * pvMutex )
+{
+    ( void ) pthread_mutex_unlock( ( pthread_mutex_t * ) pvMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( Event_t * pxEvent )
+{
+    ( void ) pthread_mutex_lock( &pxEvent->xMutex );
+
+    /* The wait is a cancellation point, a deleted task is cancelled here. */
+    pthread_cleanup_push( prvEventUnlock, &pxEvent->xMutex );
+    {
+        while( pxEvent->xSignalled == pdFALSE )
+        {
+            ( void ) pthread_cond_wait( &pxEvent->xCond, &pxEvent->xMutex );
+        }
+
+        pxEvent->xSignalled = pdFALSE;
+    }
+    pthread_cleanup_pop( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static Thread_t * prvGetThreadFromTask( TaskHandle_t xTask )
+{
+    return *( ( Thread_t ** ) xTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t * pxThreadToResume,
+                             Thread_t * pxThreadToSuspend )
+{
+    BaseType_t xDying;
+
+    if( pxThreadToResume != pxThreadToSuspend )
+    {
+        /* The thread of a deleted task is joined once the new task runs, read
+         * the flag before handing over. */
+        xDying = pxThreadToSuspend->xDying;
+
+        prvEventSignal( pxThreadToResume->pxEvent );
+
+        if( xDying != pdFALSE )
+        {
+            pthread_exit( NULL );
+        }
+
+        prvEventWait( pxThreadToSuspend->pxEvent );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void * prvThreadStart( void * pvParams )
+{
+    Thread_t * pxThread = ( Thread_t * ) pvParams;
+
+    prvEventWait( pxThread->pxEvent );
+
+    /* A task starts with interrupts enabled. */
+    uxCriticalNesting = 0;
+    ( void ) prvSetTickSignalBlocked( pdFALSE );
+
+    pxThread->pxCode( pxThread->pvParams );
+
+    /* A task must not return from its implementing function, one that does is
+     * deleted rather than left running on an exited thread. */
+    vTaskDelete( NULL );
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    Thread_t * pxThread;
+    sigset_t xAllSignals;
+    sigset_t xPreviousSignals;
+    int iResult = -1;
+
+    pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+    pxThread->pxCode = pxCode;
+    pxThread->pvParams = pvParameters;
+    pxThread->xDying = pdFALSE;
+
+    /* The host allocator and the new thread must not be interrupted by the
+     * tick, and the new thread inherits a mask with every signal blocked. */
+    ( void ) sigfillset( &xAllSignals );
+    ( void ) pthread_sigmask( SIG_SETMASK, &xAllSignals, &xPreviousSignals );
+    {
+        pxThread->pxEvent = prvEventCreate();
+
+        if( pxThread->pxEvent != NULL )
+        {
+            iResult = pthread_create( &pxThread->xPthread, NULL, prvThreadStart, pxThread );
+        }
+    }
+    ( void ) pthread_sigmask( SIG_SETMASK, &xPreviousSignals, NULL );
+
+    configASSERT( iResult == 0 );
+
+    return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickSignalHandler( int iSignal )
+{
+    Thread_t * pxThreadToSuspend;
+
+    ( void ) iSignal;
+
+    /* The signal stays blocked until the handler returns, so the handler runs
+     * as an interrupt that cannot be nested. */
+    pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        vTaskSwitchContext();
+        prvSwitchThread( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ), pxThreadToSuspend );
+    }
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+    struct sigaction xTickAction;
+    struct itimerval xTimer;
+
+    /* The main thread never runs a task.  It keeps the tick blocked and waits
+     * until the scheduler is stopped. */
+    ( void ) prvSetTickSignalBlocked( pdTRUE );
+    pxSchedulerEndEvent = prvEventCreate();
+    configASSERT( pxSchedulerEndEvent != NULL );
+
+    ( void ) memset( &xTickAction, 0, sizeof( xTickAction ) );
+    xTickAction.sa_handler = prvTickSignalHandler;
+    xTickAction.sa_flags = SA_RESTART;
+    ( void ) sigemptyset( &xTickAction.sa_mask );
+    ( void ) sigaction( SIGALRM, &xTickAction, NULL );
+
+    xTimer.it_interval.tv_sec = 0;
+    xTimer.it_interval.tv_usec = ( suseconds_t ) portTICK_PERIOD_US;
+    xTimer.it_value = xTimer.it_interval;
+    ( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+    /* Start the first task. */
+    prvEventSignal( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->pxEvent );
+
+    prvEventWait( pxSchedulerEndEvent );
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+    struct itimerval xTimer;
+
+    ( void ) memset( &xTimer, 0, sizeof( xTimer ) );
+    ( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+    prvEventSignal( pxSchedulerEndEvent );
+
+    /* The calling task never runs again, its event is never signalled. */
+    prvEventWait( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->pxEvent );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    Thread_t * pxThreadToSuspend;
+
+    vPortEnterCritical();
+    {
+        pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        vTaskSwitchContext();
+        prvSwitchThread( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ), pxThreadToSuspend );
+    }
+    vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    if( uxCriticalNesting == 0 )
+    {
+        ( void ) prvSetTickSignalBlocked( pdTRUE );
+    }
+
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    configASSERT( uxCriticalNesting );
+    uxCriticalNesting--;
+
+    if( uxCriticalNesting == 0 )
+    {
+        ( void ) prvSetTickSignalBlocked( pdFALSE );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+    ( void ) prvSetTickSignalBlocked( pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+    ( void ) prvSetTickSignalBlocked( pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+    return ( UBaseType_t ) prvSetTickSignalBlocked( pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+    if( uxMask == ( UBaseType_t ) pdFALSE )
+    {
+        ( void ) prvSetTickSignalBlocked( pdFALSE );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void * pvTaskToDelete,
+                       volatile BaseType_t * pxPendYield )
+{
+    ( void ) pxPendYield;
+
+    prvGetThreadFromTask( ( TaskHandle_t ) pvTaskToDelete )->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void * pxTaskToDelete )
+{
+    Thread_t * pxThread = prvGetThreadFromTask( ( TaskHandle_t ) pxTaskToDelete );
+    sigset_t xAllSignals;
+    sigset_t xPreviousSignals;
+
+    /* The thread either waits on its event or has exited already. */
+    ( void ) sigfillset( &xAllSignals );
+    ( void ) pthread_sigmask( SIG_SETMASK, &xAllSignals, &xPreviousSignals );
+    {
+        ( void ) pthread_cancel( pxThread->xPthread );
+        ( void ) pthread_join( pxThread->xPthread, NULL );
+        prvEventDelete( pxThread->pxEvent );
+    }
+    ( void ) pthread_sigmask( SIG_SETMASK, &xPreviousSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+    ( void ) xExpectedIdleTime;
+
+    /* The tick keeps running, sleep until it fires.  The scheduler is
+     * suspended, so the tick is only counted and processed on resume. */
+    ( void ) pause();
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,438 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "deferred_work.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+#if ( configUSE_DEFERRED_WORK == 1 )
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build deferred_work.c
+    #endif
+
+    #if ( configDEFERRED_WORK_LANES < 1 )
+        #error configDEFERRED_WORK_LANES must be at least 1
+    #endif
+
+    #if ( ( configDEFERRED_WORK_LANE_LENGTH & ( configDEFERRED_WORK_LANE_LENGTH - 1 ) ) != 0 )
+        #error configDEFERRED_WORK_LANE_LENGTH must be a power of two
+    #endif
+
+    #if ( configDEFERRED_WORK_TASK_PRIORITY < configDEFERRED_WORK_LANES ) || ( configDEFERRED_WORK_TASK_PRIORITY >= configMAX_PRIORITIES )
+        #error configDEFERRED_WORK_TASK_PRIORITY must leave every worker above the idle task and below configMAX_PRIORITIES
+    #endif
+
+/* The timestamps the latencies are measured with. */
+    #ifndef configDEFERRED_WORK_GET_TIMESTAMP
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            #define configDEFERRED_WORK_GET_TIMESTAMP()    ( ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE() )
+        #else
+            #define configDEFERRED_WORK_GET_TIMESTAMP()    ( ( uint32_t ) xTaskGetTickCountFromISR() )
+        #endif
+    #endif
+
+/* The name given to the worker tasks. */
+    #ifndef configDEFERRED_WORK_TASK_NAME
+        #define configDEFERRED_WORK_TASK_NAME    "Work"
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/* A job waiting in a lane. */
+typedef struct dwJob
+{
+    DeferredWorkFunction_t pxFunction;
+    void * pvParameter1;
+    uint32_t ulParameter2;
+    uint32_t ulPostTime; /* Timestamp of the post that added the job. */
+} DeferredWorkJob_t;
+
+/* A lane.  uxHead and uxTail are free running job counts, the difference
+ * between the two is the number of jobs waiting and the low bits index xJobs.
+ * The members are only accessed with interrupts masked, posts come from tasks
+ * and interrupts alike. */
+typedef struct dwLane
+{
+    DeferredWorkJob_t xJobs[ configDEFERRED_WORK_LANE_LENGTH ];
+    UBaseType_t uxHead;                /* Number of jobs ever added.  Only updated by the posters. */
+    UBaseType_t uxTail;                /* Number of jobs ever taken.  Only updated by the worker. */
+    TaskHandle_t xWorker;              /* The worker task, NULL before the scheduler starts. */
+    BaseType_t xWorkerBlocked;         /* pdTRUE when the worker waits for its notification. */
+    DeferredWorkStats_t xStats;
+} DeferredWorkLane_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+ * which static variables must be declared volatile. */
+
+PRIVILEGED_DATA static DeferredWorkLane_t xLanes[ configDEFERRED_WORK_LANES ];
+
+/*lint -restore */
+
+/*
+ * Adds the job to the lane unless it is already waiting there.  Must be called
+ * with interrupts masked.  Sets *pxWakeWorker to pdTRUE if the worker is
+ * blocked and must be notified.
+ */
+static BaseType_t prvPostJob( DeferredWorkLane_t * const pxLane,
+                              DeferredWorkFunction_t pxFunction,
+                              void * pvParameter1,
+                              uint32_t ulParameter2,
+                              BaseType_t * const pxWakeWorker ) PRIVILEGED_FUNCTION;
+
+/*
+ * The task that runs the jobs of one lane, the lane being the parameter.
+ */
+static portTASK_FUNCTION_PROTO( prvWorkerTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeferredWorkCreateTasks( void )
+{
+    BaseType_t xReturn = pdPASS;
+    UBaseType_t uxLane;
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        static StaticTask_t xWorkerTCBs[ configDEFERRED_WORK_LANES ];
+        static StackType_t uxWorkerStacks[ configDEFERRED_WORK_LANES ][ configDEFERRED_WORK_STACK_DEPTH ];
+    #endif
+
+    for( uxLane = 0; ( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES ) && ( xReturn == pdPASS ); uxLane++ )
+    {
+        TaskHandle_t xWorker = NULL;
+        const UBaseType_t uxPriority = ( UBaseType_t ) configDEFERRED_WORK_TASK_PRIORITY - uxLane;
+
+        #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        {
+            xWorker = xTaskCreateStatic( prvWorkerTask,
+                                         configDEFERRED_WORK_TASK_NAME,
+                                         configDEFERRED_WORK_STACK_DEPTH,
+                                         &( xLanes[ uxLane ] ),
+                                         uxPriority | portPRIVILEGE_BIT,
+                                         uxWorkerStacks[ uxLane ],
+                                         &( xWorkerTCBs[ uxLane ] ) );
+        }
+        #else
+        {
+            ( void ) xTaskCreate( prvWorkerTask,
+                                  configDEFERRED_WORK_TASK_NAME,
+                                  configDEFERRED_WORK_STACK_DEPTH,
+                                  &( xLanes[ uxLane ] ),
+                                  uxPriority | portPRIVILEGE_BIT,
+                                  &xWorker );
+        }
+        #endif /* configSUPPORT_STATIC_ALLOCATION */
+
+        if( xWorker != NULL )
+        {
+            /* The scheduler has not started, nothing else runs yet. */
+            xLanes[ uxLane ].xWorker = xWorker;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+    }
+
+    configASSERT( xReturn );
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPostJob( DeferredWorkLane_t * const pxLane,
+                              DeferredWorkFunction_t pxFunction,
+                              void * pvParameter1,
+                              uint32_t ulParameter2,
+                              BaseType_t * const pxWakeWorker )
+{
+    const UBaseType_t uxWaiting = pxLane->uxHead - pxLane->uxTail;
+    DeferredWorkJob_t * pxJob;
+    UBaseType_t uxIndex;
+    BaseType_t xReturn = pdPASS;
+
+    *pxWakeWorker = pdFALSE;
+
+    /* Look for the same job among those waiting.  The lanes are short, and
+     * only jobs that have not started are looked at. */
+    for( uxIndex = pxLane->uxTail; uxIndex != pxLane->uxHead; uxIndex++ )
+    {
+        pxJob = &( pxLane->xJobs[ uxIndex & ( ( UBaseType_t ) configDEFERRED_WORK_LANE_LENGTH - 1U ) ] );
+
+        if( ( pxJob->pxFunction == pxFunction ) &&
+            ( pxJob->pvParameter1 == pvParameter1 ) &&
+            ( pxJob->ulParameter2 == ulParameter2 ) )
+        {
+            break;
+        }
+    }
+
+    if( uxIndex != pxLane->uxHead )
+    {
+        /* The waiting job keeps its timestamp, the latency is counted from
+         * the first post. */
+        pxLane->xStats.ulCollapsed++;
+    }
+    else if( uxWaiting < ( UBaseType_t ) configDEFERRED_WORK_LANE_LENGTH )
+    {
+        pxJob = &( pxLane->xJobs[ pxLane->uxHead & ( ( UBaseType_t ) configDEFERRED_WORK_LANE_LENGTH - 1U ) ] );
+        pxJob->pxFunction = pxFunction;
+        pxJob->pvParameter1 = pvParameter1;
+        pxJob->ulParameter2 = ulParameter2;
+        pxJob->ulPostTime = configDEFERRED_WORK_GET_TIMESTAMP();
+        pxLane->uxHead++;
+
+        pxLane->xStats.ulPosted++;
+
+        if( uxWaiting >= pxLane->xStats.uxMaxWaiting )
+        {
+            pxLane->xStats.uxMaxWaiting = uxWaiting + 1U;
+        }
+
+        /* The worker sets xWorkerBlocked with interrupts masked after finding
+         * the lane empty, so it either sees this job or is notified. */
+        if( pxLane->xWorkerBlocked != pdFALSE )
+        {
+            pxLane->xWorkerBlocked = pdFALSE;
+            *pxWakeWorker = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        pxLane->xStats.ulDropped++;
+        xReturn = errQUEUE_FULL;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeferredWorkPost( UBaseType_t uxLane,
+                              DeferredWorkFunction_t pxFunction,
+                              void * pvParameter1,
+                              uint32_t ulParameter2 )
+{
+    DeferredWorkLane_t * const pxLane = &( xLanes[ uxLane ] );
+    BaseType_t xReturn;
+    BaseType_t xWakeWorker;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES );
+    configASSERT( pxFunction );
+
+    /* Only masking interrupts, as done by the interrupt version, keeps posting
+     * usable before the scheduler starts. */
+    uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xReturn = prvPostJob( pxLane, pxFunction, pvParameter1, ulParameter2, &xWakeWorker );
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    if( xWakeWorker != pdFALSE )
+    {
+        ( void ) xTaskNotifyGive( pxLane->xWorker );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xDeferredWorkPostFromISR( UBaseType_t uxLane,
+                                     DeferredWorkFunction_t pxFunction,
+                                     void * pvParameter1,
+                                     uint32_t ulParameter2,
+                                     BaseType_t * pxHigherPriorityTaskWoken )
+{
+    DeferredWorkLane_t * const pxLane = &( xLanes[ uxLane ] );
+    BaseType_t xReturn;
+    BaseType_t xWakeWorker;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES );
+    configASSERT( pxFunction );
+
+    uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xReturn = prvPostJob( pxLane, pxFunction, pvParameter1, ulParameter2, &xWakeWorker );
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    if( xWakeWorker != pdFALSE )
+    {
+        vTaskNotifyGiveFromISR( pxLane->xWorker, pxHigherPriorityTaskWoken );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxDeferredWorkWaiting( UBaseType_t uxLane )
+{
+    const DeferredWorkLane_t * const pxLane = &( xLanes[ uxLane ] );
+    UBaseType_t uxReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES );
+
+    uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        uxReturn = pxLane->uxHead - pxLane->uxTail;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vDeferredWorkGetStats( UBaseType_t uxLane,
+                            DeferredWorkStats_t * pxStats )
+{
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES );
+    configASSERT( pxStats );
+
+    uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        *pxStats = xLanes[ uxLane ].xStats;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vDeferredWorkResetStats( UBaseType_t uxLane )
+{
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( uxLane < ( UBaseType_t ) configDEFERRED_WORK_LANES );
+
+    uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        ( void ) memset( &( xLanes[ uxLane ].xStats ), 0x00, sizeof( DeferredWorkStats_t ) );
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvWorkerTask, pvParameters )
+{
+    DeferredWorkLane_t * const pxLane = ( DeferredWorkLane_t * ) pvParameters;
+    DeferredWorkJob_t xJob;
+    UBaseType_t uxSavedInterruptStatus;
+    UBaseType_t uxBatch = 0;
+    uint32_t ulLatency = 0;
+    BaseType_t xHaveJob;
+
+    for( ;; )
+    {
+        /* Account for the job run last, if any, and take the next one.  One
+         * masked section per job, as the job must leave the waiting part of
+         * the ring before it runs so that posting it again runs it again. */
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( uxBatch != 0U )
+            {
+                pxLane->xStats.ulRun++;
+                pxLane->xStats.ulTotalLatency += ulLatency;
+
+                if( ulLatency > pxLane->xStats.ulMaxLatency )
+                {
+                    pxLane->xStats.ulMaxLatency = ulLatency;
+                }
+            }
+
+            if( pxLane->uxTail != pxLane->uxHead )
+            {
+                xJob = pxLane->xJobs[ pxLane->uxTail & ( ( UBaseType_t ) configDEFERRED_WORK_LANE_LENGTH - 1U ) ];
+                pxLane->uxTail++;
+                xHaveJob = pdTRUE;
+            }
+            else
+            {
+                /* The lane is empty, close the batch and block until a post
+                 * finds xWorkerBlocked set. */
+                if( uxBatch != 0U )
+                {
+                    pxLane->xStats.ulBatches++;
+
+                    if( uxBatch > pxLane->xStats.uxMaxBatch )
+                    {
+                        pxLane->xStats.uxMaxBatch = uxBatch;
+                    }
+                }
+
+                pxLane->xWorkerBlocked = pdTRUE;
+                xHaveJob = pdFALSE;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        if( xHaveJob != pdFALSE )
+        {
+            ulLatency = configDEFERRED_WORK_GET_TIMESTAMP() - xJob.ulPostTime;
+            uxBatch++;
+
+            xJob.pxFunction( xJob.pvParameter1, xJob.ulParameter2 );
+        }
+        else
+        {
+            uxBatch = 0;
+            ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_DEFERRED_WORK */
@@ -40,6 +40,10 @@
 #include "timers.h"
 #include "event_groups.h"
 
+#if ( configUSE_EXECUTOR == 1 )
+    #include "executor.h"
+#endif
+
 /* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -61,10 +65,36 @@
     #define eventEVENT_BITS_CONTROL_BYTES    0xff000000UL
 #endif
 
+/* The tasks waiting on an event group are spread over
+ * configEVENT_GROUP_WAITER_LISTS lists.  The event bits are divided into that
+ * many ranges of eventBITS_PER_WAITER_LIST bits, and a task waits on the list of
+ * the lowest range that holds one of the bits it waits for.  Each list also
+ * keeps a mask of the bits its tasks wait for, so setting bits only walks the
+ * lists that can hold a task the bits unblock.  With one list per bit the tasks
+ * walked are those waiting for one of the bits set. */
+#if configUSE_16_BIT_TICKS == 1
+    #define eventNUMBER_OF_BITS    8U
+#else
+    #define eventNUMBER_OF_BITS    24U
+#endif
+
+#define eventBITS_PER_WAITER_LIST    ( ( eventNUMBER_OF_BITS + configEVENT_GROUP_WAITER_LISTS - 1U ) / configEVENT_GROUP_WAITER_LISTS )
+#define eventWAITER_LIST_BITS( x )                                                                   \
+    ( ( ( ( ( EventBits_t ) 1 ) << eventBITS_PER_WAITER_LIST ) - ( EventBits_t ) 1 ) << ( ( x ) * eventBITS_PER_WAITER_LIST ) )
+
+/* Yields when preemption is used, after setting bits unblocked a task of
+ * higher priority. */
+#if ( configUSE_PREEMPTION == 0 )
+    #define eventYIELD_IF_USING_PREEMPTION()
+#else
+    #define eventYIELD_IF_USING_PREEMPTION()    portYIELD_WITHIN_API()
+#endif
+
 typedef struct EventGroupDef_t
 {
     EventBits_t uxEventBits;
-    List_t xTasksWaitingForBits; /*< List of tasks waiting for a bit to be set. */
+    List_t xTasksWaitingForBits[ configEVENT_GROUP_WAITER_LISTS ]; /*< Lists of tasks waiting for a bit to be set. */
+    EventBits_t uxBitsWaitedFor[ configEVENT_GROUP_WAITER_LISTS ]; /*< At least the bits the tasks of each list wait for. */
 
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxEventGroupNumber;
@@ -89,6 +119,31 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
                                         const EventBits_t uxBitsToWaitFor,
                                         const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Initialise the event bits and the waiter lists of a new event group.
+ */
+static void prvInitialiseEventGroup( EventGroup_t * pxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Place the calling task on the waiter list for uxBitsWaitedFor, which also
+ * holds the control bits.  Must be called with the scheduler suspended and
+ * from a critical section, vTaskBlockOnEventList() then blocks the task.
+ */
+static void prvPlaceOnWaiterList( EventGroup_t * pxEventBits,
+                                  const EventBits_t uxBitsWaitedFor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Set uxBitsToSet and unblock the waiting tasks whose wait condition is then
+ * met, clearing the bits of those that asked for it.  Must be called from a
+ * critical section, from a task or an ISR.  Only the waiter lists that hold a
+ * task waiting for one of uxBitsToSet are walked: a task that was not already
+ * unblocked can only have its condition met by a bit it waits for being set.
+ * Returns pdTRUE if a task of higher priority than the running task was
+ * unblocked.
+ */
+static BaseType_t prvSetBitsAndUnblockTasks( EventGroup_t * pxEventBits,
+                                             const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------*/
 
 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -115,8 +170,7 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
 
         if( pxEventBits != NULL )
         {
-            pxEventBits->uxEventBits = 0;
-            vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+            prvInitialiseEventGroup( pxEventBits );
 
             #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
             {
@@ -166,8 +220,7 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
 
         if( pxEventBits != NULL )
         {
-            pxEventBits->uxEventBits = 0;
-            vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+            prvInitialiseEventGroup( pxEventBits );
 
             #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
             {
@@ -211,46 +264,64 @@ EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup,
 
     vTaskSuspendAll();
     {
-        uxOriginalBitValue = pxEventBits->uxEventBits;
-
-        ( void ) xEventGroupSetBits( xEventGroup, uxBitsToSet );
-
-        if( ( ( uxOriginalBitValue | uxBitsToSet ) & uxBitsToWaitFor ) == uxBitsToWaitFor )
+        /* The bits are set and tested in one critical section, as interrupts
+         * can set bits too.  Tasks unblocked by the set are made ready when the
+         * scheduler is resumed. */
+        taskENTER_CRITICAL();
         {
-            /* All the rendezvous bits are now set - no need to block. */
-            uxReturn = ( uxOriginalBitValue | uxBitsToSet );
+            uxOriginalBitValue = pxEventBits->uxEventBits;
 
-            /* Rendezvous always clear the bits.  They will have been cleared
-             * already unless this is the only task in the rendezvous. */
-            pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+            traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
+            ( void ) prvSetBitsAndUnblockTasks( pxEventBits, uxBitsToSet );
 
-            xTicksToWait = 0;
-        }
-        else
-        {
-            if( xTicksToWait != ( TickType_t ) 0 )
+            if( ( ( uxOriginalBitValue | uxBitsToSet ) & uxBitsToWaitFor ) == uxBitsToWaitFor )
             {
-                traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor );
+                /* All the rendezvous bits are now set - no need to block. */
+                uxReturn = ( uxOriginalBitValue | uxBitsToSet );
 
-                /* Store the bits that the calling task is waiting for in the
-                 * task's event list item so the kernel knows when a match is
-                 * found.  Then enter the blocked state. */
-                vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                /* Rendezvous always clear the bits.  They will have been cleared
+                 * already unless this is the only task in the rendezvous. */
+                pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
 
-                /* This assignment is obsolete as uxReturn will get set after
-                 * the task unblocks, but some compilers mistakenly generate a
-                 * warning about uxReturn being returned without being set if the
-                 * assignment is omitted. */
-                uxReturn = 0;
+                xTicksToWait = 0;
             }
             else
             {
-                /* The rendezvous bits were not set, but no block time was
-                 * specified - just return the current event bit value. */
-                uxReturn = pxEventBits->uxEventBits;
-                xTimeoutOccurred = pdTRUE;
+                if( xTicksToWait != ( TickType_t ) 0 )
+                {
+                    traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor );
+
+                    /* Store the bits that the calling task is waiting for in the
+                     * task's event list item so the kernel knows when a match is
+                     * found.  The task enters the blocked state once the
+                     * critical section has been exited. */
+                    prvPlaceOnWaiterList( pxEventBits, ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ) );
+
+                    /* This assignment is obsolete as uxReturn will get set after
+                     * the task unblocks, but some compilers mistakenly generate a
+                     * warning about uxReturn being returned without being set if the
+                     * assignment is omitted. */
+                    uxReturn = 0;
+                }
+                else
+                {
+                    /* The rendezvous bits were not set, but no block time was
+                     * specified - just return the current event bit value. */
+                    uxReturn = pxEventBits->uxEventBits;
+                    xTimeoutOccurred = pdTRUE;
+                }
             }
         }
+        taskEXIT_CRITICAL();
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            vTaskBlockOnEventList( xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
     xAlreadyYielded = xTaskResumeAll();
 
@@ -336,72 +407,86 @@ EventBits_t xEventGroupWaitBits( EventGroupHandle_t xEventGroup,
     }
     #endif
 
-    vTaskSuspendAll();
+    /* uxControlBits are used to remember the specified behaviour of this call
+     * to xEventGroupWaitBits() - for use when the event bits unblock the task. */
+    if( xClearOnExit != pdFALSE )
+    {
+        uxControlBits |= eventCLEAR_EVENTS_ON_EXIT_BIT;
+    }
+    else
     {
-        const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
+        mtCOVERAGE_TEST_MARKER();
+    }
 
-        /* Check to see if the wait condition is already met or not. */
-        xWaitConditionMet = prvTestWaitCondition( uxCurrentEventBits, uxBitsToWaitFor, xWaitForAllBits );
+    if( xWaitForAllBits != pdFALSE )
+    {
+        uxControlBits |= eventWAIT_FOR_ALL_BITS;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
 
-        if( xWaitConditionMet != pdFALSE )
+    vTaskSuspendAll();
+    {
+        /* Interrupts can set bits, so the test and the placing of the task on
+         * a waiter list are one critical section. */
+        taskENTER_CRITICAL();
         {
-            /* The wait condition has already been met so there is no need to
-             * block. */
-            uxReturn = uxCurrentEventBits;
-            xTicksToWait = ( TickType_t ) 0;
+            const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
+
+            /* Check to see if the wait condition is already met or not. */
+            xWaitConditionMet = prvTestWaitCondition( uxCurrentEventBits, uxBitsToWaitFor, xWaitForAllBits );
 
-            /* Clear the wait bits if requested to do so. */
-            if( xClearOnExit != pdFALSE )
+            if( xWaitConditionMet != pdFALSE )
             {
-                pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+                /* The wait condition has already been met so there is no need to
+                 * block. */
+                uxReturn = uxCurrentEventBits;
+                xTicksToWait = ( TickType_t ) 0;
+
+                /* Clear the wait bits if requested to do so. */
+                if( xClearOnExit != pdFALSE )
+                {
+                    pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                /* The wait condition has not been met, but no block time was
+                 * specified, so just return the current value. */
+                uxReturn = uxCurrentEventBits;
+                xTimeoutOccurred = pdTRUE;
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                /* Store the bits that the calling task is waiting for in the
+                 * task's event list item so the kernel knows when a match is
+                 * found.  The task enters the blocked state once the critical
+                 * section has been exited. */
+                prvPlaceOnWaiterList( pxEventBits, ( uxBitsToWaitFor | uxControlBits ) );
+
+                /* This is obsolete as it will get set after the task unblocks, but
+                 * some compilers mistakenly generate a warning about the variable
+                 * being returned without being set if it is not done. */
+                uxReturn = 0;
+
+                traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
             }
         }
-        else if( xTicksToWait == ( TickType_t ) 0 )
+        taskEXIT_CRITICAL();
+
+        if( xTicksToWait != ( TickType_t ) 0 )
         {
-            /* The wait condition has not been met, but no block time was
-             * specified, so just return the current value. */
-            uxReturn = uxCurrentEventBits;
-            xTimeoutOccurred = pdTRUE;
+            vTaskBlockOnEventList( xTicksToWait );
         }
         else
         {
-            /* The task is going to block to wait for its required bits to be
-             * set.  uxControlBits are used to remember the specified behaviour of
-             * this call to xEventGroupWaitBits() - for use when the event bits
-             * unblock the task. */
-            if( xClearOnExit != pdFALSE )
-            {
-                uxControlBits |= eventCLEAR_EVENTS_ON_EXIT_BIT;
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
-
-            if( xWaitForAllBits != pdFALSE )
-            {
-                uxControlBits |= eventWAIT_FOR_ALL_BITS;
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
-
-            /* Store the bits that the calling task is waiting for in the
-             * task's event list item so the kernel knows when a match is
-             * found.  Then enter the blocked state. */
-            vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
-
-            /* This is obsolete as it will get set after the task unblocks, but
-             * some compilers mistakenly generate a warning about the variable
-             * being returned without being set if it is not done. */
-            uxReturn = 0;
-
-            traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
+            mtCOVERAGE_TEST_MARKER();
         }
     }
     xAlreadyYielded = xTaskResumeAll();
@@ -498,20 +583,25 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
+                                        const EventBits_t uxBitsToClear )
+{
+    EventGroup_t * pxEventBits = xEventGroup;
+    UBaseType_t uxSavedInterruptStatus;
 
-    BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
-                                            const EventBits_t uxBitsToClear )
-    {
-        BaseType_t xReturn;
+    configASSERT( xEventGroup );
+    configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
+    /* Clearing bits never unblocks a task, so the bits are cleared directly. */
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
         traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
-        xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL ); /*lint !e9087 Can't avoid cast to void* as a generic callback function not specific to this use case. Callback casts back to original type so safe. */
-
-        return xReturn;
+        pxEventBits->uxEventBits &= ~uxBitsToClear;
     }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-#endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    return pdPASS;
+}
 /*-----------------------------------------------------------*/
 
 EventBits_t xEventGroupGetBitsFromISR( EventGroupHandle_t xEventGroup )
@@ -533,96 +623,71 @@ EventBits_t xEventGroupGetBitsFromISR( EventGroupHandle_t xEventGroup )
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
                                 const EventBits_t uxBitsToSet )
 {
-    ListItem_t * pxListItem;
-    ListItem_t * pxNext;
-    ListItem_t const * pxListEnd;
-    List_t const * pxList;
-    EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
     EventGroup_t * pxEventBits = xEventGroup;
-    BaseType_t xMatchFound = pdFALSE;
+    BaseType_t xYieldRequired;
 
     /* Check the user is not attempting to set the bits used by the kernel
      * itself. */
     configASSERT( xEventGroup );
     configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-    pxList = &( pxEventBits->xTasksWaitingForBits );
-    pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
-    vTaskSuspendAll();
+    /* Interrupts set bits too, so the event group is protected by a critical
+     * section rather than by suspending the scheduler. */
+    taskENTER_CRITICAL();
     {
         traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-        pxListItem = listGET_HEAD_ENTRY( pxList );
+        xYieldRequired = prvSetBitsAndUnblockTasks( pxEventBits, uxBitsToSet );
+    }
+    taskEXIT_CRITICAL();
 
-        /* Set the bits. */
-        pxEventBits->uxEventBits |= uxBitsToSet;
+    if( xYieldRequired != pdFALSE )
+    {
+        eventYIELD_IF_USING_PREEMPTION();
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
 
-        /* See if the new bit value should unblock any tasks. */
-        while( pxListItem != pxListEnd )
-        {
-            pxNext = listGET_NEXT( pxListItem );
-            uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-            xMatchFound = pdFALSE;
+    return pxEventBits->uxEventBits;
+}
+/*-----------------------------------------------------------*/
 
-            /* Split the bits waited for from the control bits. */
-            uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-            uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
+                                      const EventBits_t uxBitsToSet,
+                                      BaseType_t * pxHigherPriorityTaskWoken )
+{
+    EventGroup_t * pxEventBits = xEventGroup;
+    UBaseType_t uxSavedInterruptStatus;
 
-            if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
-            {
-                /* Just looking for single bit being set. */
-                if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
-                {
-                    xMatchFound = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-            else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+    configASSERT( xEventGroup );
+    configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+
+        if( prvSetBitsAndUnblockTasks( pxEventBits, uxBitsToSet ) != pdFALSE )
+        {
+            if( pxHigherPriorityTaskWoken != NULL )
             {
-                /* All bits are set. */
-                xMatchFound = pdTRUE;
+                *pxHigherPriorityTaskWoken = pdTRUE;
             }
             else
             {
-                /* Need all bits to be set, but not all the bits were set. */
-            }
-
-            if( xMatchFound != pdFALSE )
-            {
-                /* The bits match.  Should the bits be cleared on exit? */
-                if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-                {
-                    uxBitsToClear |= uxBitsWaitedFor;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-
-                /* Store the actual event flag value in the task's event list
-                 * item before removing the task from the event list.  The
-                 * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-                 * that is was unblocked due to its required bits matching, rather
-                 * than because it timed out. */
-                vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+                mtCOVERAGE_TEST_MARKER();
             }
-
-            /* Move onto the next list item.  Note pxListItem->pxNext is not
-             * used here as the list item may have been removed from the event list
-             * and inserted into the ready/pending reading list. */
-            pxListItem = pxNext;
         }
-
-        /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
-         * bit was set in the control word. */
-        pxEventBits->uxEventBits &= ~uxBitsToClear;
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
-    ( void ) xTaskResumeAll();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-    return pxEventBits->uxEventBits;
+    return pdPASS;
 }
 /*-----------------------------------------------------------*/
 
@@ -630,21 +695,29 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
     EventGroup_t * pxEventBits = xEventGroup;
     const List_t * pxTasksWaitingForBits;
+    UBaseType_t uxList;
 
     configASSERT( pxEventBits );
 
-    pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
-
     vTaskSuspendAll();
     {
         traceEVENT_GROUP_DELETE( xEventGroup );
 
-        while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+        for( uxList = 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAITER_LISTS; uxList++ )
         {
-            /* Unblock the task, returning 0 as the event list is being deleted
-             * and cannot therefore have any bits set. */
-            configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-            vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+            pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits[ uxList ] );
+
+            taskENTER_CRITICAL();
+            {
+                while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+                {
+                    /* Unblock the task, returning 0 as the event list is being deleted
+                     * and cannot therefore have any bits set. */
+                    configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
+                    ( void ) xTaskRemoveItemFromEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+                }
+            }
+            taskEXIT_CRITICAL();
         }
     }
     ( void ) xTaskResumeAll();
@@ -727,21 +800,170 @@ static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits,
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+static void prvInitialiseEventGroup( EventGroup_t * pxEventBits )
+{
+    UBaseType_t uxList;
+
+    pxEventBits->uxEventBits = 0;
 
-    BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
-                                          const EventBits_t uxBitsToSet,
-                                          BaseType_t * pxHigherPriorityTaskWoken )
+    for( uxList = 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAITER_LISTS; uxList++ )
     {
-        BaseType_t xReturn;
+        vListInitialise( &( pxEventBits->xTasksWaitingForBits[ uxList ] ) );
+        pxEventBits->uxBitsWaitedFor[ uxList ] = 0;
+    }
+}
+/*-----------------------------------------------------------*/
 
-        traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
-        xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken ); /*lint !e9087 Can't avoid cast to void* as a generic callback function not specific to this use case. Callback casts back to original type so safe. */
+static void prvPlaceOnWaiterList( EventGroup_t * pxEventBits,
+                                  const EventBits_t uxBitsWaitedFor )
+{
+    UBaseType_t uxList;
 
-        return xReturn;
+    /* Find the lowest range of bits that holds a bit the task waits for.  The
+     * last list takes the tasks not placed on an earlier one. */
+    for( uxList = 0; uxList < ( UBaseType_t ) ( configEVENT_GROUP_WAITER_LISTS - 1 ); uxList++ )
+    {
+        if( ( uxBitsWaitedFor & eventWAITER_LIST_BITS( uxList ) ) != ( EventBits_t ) 0 )
+        {
+            break;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    pxEventBits->uxBitsWaitedFor[ uxList ] |= uxBitsWaitedFor & ~eventEVENT_BITS_CONTROL_BYTES;
+    vTaskInsertOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits[ uxList ] ), uxBitsWaitedFor );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSetBitsAndUnblockTasks( EventGroup_t * pxEventBits,
+                                             const EventBits_t uxBitsToSet )
+{
+    ListItem_t * pxListItem;
+    ListItem_t * pxNext;
+    ListItem_t const * pxListEnd;
+    List_t const * pxList;
+    EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits, uxStillWaitedFor;
+    BaseType_t xMatchFound, xReturn = pdFALSE;
+    UBaseType_t uxList;
+
+    /* Set the bits. */
+    pxEventBits->uxEventBits |= uxBitsToSet;
+
+    for( uxList = 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAITER_LISTS; uxList++ )
+    {
+        /* Only walk the lists on which a task waits for one of the bits set. */
+        if( ( pxEventBits->uxBitsWaitedFor[ uxList ] & uxBitsToSet ) != ( EventBits_t ) 0 )
+        {
+            pxList = &( pxEventBits->xTasksWaitingForBits[ uxList ] );
+            pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+            pxListItem = listGET_HEAD_ENTRY( pxList );
+
+            /* The mask of the list is rebuilt from the tasks left on it, dropping
+             * the bits of tasks that have since timed out or been unblocked. */
+            uxStillWaitedFor = 0;
+
+            /* See if the new bit value should unblock any tasks. */
+            while( pxListItem != pxListEnd )
+            {
+                pxNext = listGET_NEXT( pxListItem );
+                uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+                xMatchFound = pdFALSE;
+
+                /* Split the bits waited for from the control bits. */
+                uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+                uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+                if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+                {
+                    /* Just looking for single bit being set. */
+                    if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+                    {
+                        xMatchFound = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+                {
+                    /* All bits are set. */
+                    xMatchFound = pdTRUE;
+                }
+                else
+                {
+                    /* Need all bits to be set, but not all the bits were set. */
+                }
+
+                if( xMatchFound != pdFALSE )
+                {
+                    /* The bits match.  Should the bits be cleared on exit? */
+                    if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+                    {
+                        uxBitsToClear |= uxBitsWaitedFor;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Store the actual event flag value in the task's event list
+                     * item before removing the task from the event list.  The
+                     * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+                     * that is was unblocked due to its required bits matching, rather
+                     * than because it timed out. */
+                    if( xTaskRemoveItemFromEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET ) != pdFALSE )
+                    {
+                        xReturn = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    uxStillWaitedFor |= uxBitsWaitedFor;
+                }
+
+                /* Move onto the next list item.  Note pxListItem->pxNext is not
+                 * used here as the list item may have been removed from the event list
+                 * and inserted into the ready/pending reading list. */
+                pxListItem = pxNext;
+            }
+
+            pxEventBits->uxBitsWaitedFor[ uxList ] = uxStillWaitedFor;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+     * bit was set in the control word. */
+    pxEventBits->uxEventBits &= ~uxBitsToClear;
+
+    #if ( configUSE_EXECUTOR == 1 )
+    {
+        /* Coroutines waiting on the event group poll it again.
+         * xExecutorObjectChanged() is interrupt safe. */
+        if( xExecutorObjectChanged( pxEventBits ) != pdFALSE )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
+    #endif /* configUSE_EXECUTOR */
 
-#endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    return xReturn;
+}
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TRACE_FACILITY == 1 )
@@ -0,0 +1,418 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_groups.h"
+#include "executor.h"
+#include "multi_wait.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+#if ( configUSE_EXECUTOR == 1 )
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build executor.c
+    #endif
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build executor.c
+    #endif
+
+    #if ( configEXECUTOR_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+        #error configEXECUTOR_NOTIFY_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/* The executors that have started running, so xExecutorObjectChanged() can
+ * find their host tasks.  Executors are only ever added. */
+    PRIVILEGED_DATA static Executor_t * volatile pxExecutors = NULL;
+
+/*
+ * Wakes the host task of pxExecutor, if it is running, from a task or from an
+ * interrupt.
+ */
+    static BaseType_t prvWakeHostTask( const Executor_t * pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    void vExecutorInitialise( Executor_t * pxExecutor )
+    {
+        configASSERT( pxExecutor );
+
+        pxExecutor->pxCoroutines = NULL;
+        pxExecutor->pxNextExecutor = NULL;
+        pxExecutor->xHostTask = NULL;
+        pxExecutor->ulObjectMask = 0UL;
+    }
+/*-----------------------------------------------------------*/
+
+    void vExecutorAddCoroutine( Executor_t * pxExecutor,
+                                ExecutorCoroutine_t * pxCoroutine,
+                                ExecutorCoroutineFunction_t pxCoroutineFunction,
+                                void * pvParameters )
+    {
+        configASSERT( pxExecutor );
+        configASSERT( pxCoroutine );
+        configASSERT( pxCoroutineFunction );
+
+        pxCoroutine->pxCoroutineFunction = pxCoroutineFunction;
+        pxCoroutine->pvParameters = pvParameters;
+        pxCoroutine->pxExecutor = pxExecutor;
+        pxCoroutine->pvWaitObject = NULL;
+        pxCoroutine->xTicksToWait = 0;
+        pxCoroutine->ulNotifiedValue = 0UL;
+        pxCoroutine->usState = 0U;
+        pxCoroutine->ucStatus = exeSTATUS_READY;
+
+        /* Coroutines are only added at the head of the list, which the host
+         * task can cope with while it walks the list. */
+        taskENTER_CRITICAL();
+        {
+            pxCoroutine->pxNext = pxExecutor->pxCoroutines;
+            pxExecutor->pxCoroutines = pxCoroutine;
+            ( void ) prvWakeHostTask( pxExecutor );
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vExecutorRun( Executor_t * pxExecutor )
+    {
+        ExecutorCoroutine_t * pxCoroutine;
+        ExecutorCoroutine_t * pxNext;
+        ExecutorCoroutine_t ** ppxLink;
+        TickType_t xTicksToBlock;
+        uint32_t ulObjectMask;
+
+        configASSERT( pxExecutor );
+        configASSERT( pxExecutor->xHostTask == NULL );
+
+        taskENTER_CRITICAL();
+        {
+            pxExecutor->xHostTask = xTaskGetCurrentTaskHandle();
+            pxExecutor->pxNextExecutor = pxExecutors;
+            pxExecutors = pxExecutor;
+        }
+        taskEXIT_CRITICAL();
+
+        for( ; ; )
+        {
+            xTicksToBlock = portMAX_DELAY;
+            ulObjectMask = 0UL;
+
+            for( pxCoroutine = pxExecutor->pxCoroutines; pxCoroutine != NULL; pxCoroutine = pxNext )
+            {
+                /* The coroutine is left ready unless it starts or continues a
+                 * wait, or ends.  A waiting coroutine is called again each time
+                 * the host task wakes and simply polls its object again. */
+                pxCoroutine->ucStatus = exeSTATUS_READY;
+                pxCoroutine->pxCoroutineFunction( pxCoroutine );
+                pxNext = pxCoroutine->pxNext;
+
+                if( pxCoroutine->ucStatus == exeSTATUS_WAITING )
+                {
+                    if( pxCoroutine->pvWaitObject != NULL )
+                    {
+                        ulObjectMask |= exeOBJECT_BIT( pxCoroutine->pvWaitObject );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( pxCoroutine->xTicksToWait < xTicksToBlock )
+                    {
+                        xTicksToBlock = pxCoroutine->xTicksToWait;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( pxCoroutine->ucStatus == exeSTATUS_FINISHED )
+                {
+                    /* Coroutines may have been added in front of this one since
+                     * the walk started, so look for the link to it again. */
+                    taskENTER_CRITICAL();
+                    {
+                        ppxLink = ( ExecutorCoroutine_t ** ) &( pxExecutor->pxCoroutines );
+
+                        while( *ppxLink != pxCoroutine )
+                        {
+                            ppxLink = &( ( *ppxLink )->pxNext );
+                        }
+
+                        *ppxLink = pxNext;
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                else
+                {
+                    /* The coroutine yielded. */
+                    xTicksToBlock = 0;
+                }
+            }
+
+            /* The bits of objects waited on were also set by
+             * vExecutorBeginWait() before each coroutine first polled its
+             * object, so no change can be missed.  Now drop the bits of waits
+             * that have ended. */
+            pxExecutor->ulObjectMask = ulObjectMask;
+
+            if( xTicksToBlock == 0 )
+            {
+                /* Let other tasks of the same priority run before the yielding
+                 * coroutines run again. */
+                ( void ) ulTaskNotifyTakeIndexed( configEXECUTOR_NOTIFY_INDEX, pdTRUE, 0 );
+                taskYIELD();
+            }
+            else
+            {
+                ( void ) ulTaskNotifyTakeIndexed( configEXECUTOR_NOTIFY_INDEX, pdTRUE, xTicksToBlock );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vExecutorBeginWait( ExecutorCoroutine_t * pxCoroutine,
+                             const void * pvObject,
+                             TickType_t xTicksToWait )
+    {
+        Executor_t * const pxExecutor = pxCoroutine->pxExecutor;
+
+        pxCoroutine->pvWaitObject = pvObject;
+        pxCoroutine->xTicksToWait = xTicksToWait;
+        vTaskSetTimeOutState( &( pxCoroutine->xTimeOut ) );
+
+        /* Only the host task writes the mask, interrupts and other tasks only
+         * read it. */
+        if( pvObject != NULL )
+        {
+            pxExecutor->ulObjectMask |= exeOBJECT_BIT( pvObject );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xExecutorContinueWait( ExecutorCoroutine_t * pxCoroutine )
+    {
+        BaseType_t xReturn;
+
+        if( xTaskCheckForTimeOut( &( pxCoroutine->xTimeOut ), &( pxCoroutine->xTicksToWait ) ) == pdFALSE )
+        {
+            pxCoroutine->ucStatus = exeSTATUS_WAITING;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulExecutorNotifyTake( ExecutorCoroutine_t * pxCoroutine )
+    {
+        uint32_t ulReturn;
+
+        taskENTER_CRITICAL();
+        {
+            ulReturn = pxCoroutine->ulNotifiedValue;
+            pxCoroutine->ulNotifiedValue = 0UL;
+        }
+        taskEXIT_CRITICAL();
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xExecutorPollEventGroup( EventGroupHandle_t xEventGroup,
+                                        EventBits_t uxBitsToWaitFor,
+                                        BaseType_t xClearOnExit,
+                                        BaseType_t xWaitForAllBits,
+                                        EventBits_t * puxBits )
+    {
+        EventBits_t uxBits;
+        BaseType_t xReturn;
+
+        uxBits = xEventGroupWaitBits( xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, 0 );
+
+        if( xWaitForAllBits != pdFALSE )
+        {
+            xReturn = ( ( uxBits & uxBitsToWaitFor ) == uxBitsToWaitFor ) ? pdTRUE : pdFALSE;
+        }
+        else
+        {
+            xReturn = ( ( uxBits & uxBitsToWaitFor ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE;
+        }
+
+        *puxBits = uxBits;
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xExecutorNotify( ExecutorCoroutine_t * pxCoroutine,
+                                uint32_t ulBitsToSet )
+    {
+        configASSERT( pxCoroutine );
+        configASSERT( ulBitsToSet != 0UL );
+
+        taskENTER_CRITICAL();
+        {
+            pxCoroutine->ulNotifiedValue |= ulBitsToSet;
+
+            if( prvWakeHostTask( pxCoroutine->pxExecutor ) != pdFALSE )
+            {
+                portYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return pdPASS;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xExecutorNotifyFromISR( ExecutorCoroutine_t * pxCoroutine,
+                                       uint32_t ulBitsToSet,
+                                       BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxCoroutine );
+        configASSERT( ulBitsToSet != 0UL );
+
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            pxCoroutine->ulNotifiedValue |= ulBitsToSet;
+
+            if( ( prvWakeHostTask( pxCoroutine->pxExecutor ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+            {
+                *pxHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return pdPASS;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xExecutorObjectChanged( const void * pvObject )
+    {
+        const uint32_t ulObjectBit = exeOBJECT_BIT( pvObject );
+        const Executor_t * pxExecutor;
+        BaseType_t xReturn = pdFALSE;
+
+        /* Called on every send and receive, so only the executors with a
+         * coroutine that may wait on the object are woken. */
+        for( pxExecutor = pxExecutors; pxExecutor != NULL; pxExecutor = pxExecutor->pxNextExecutor )
+        {
+            if( ( pxExecutor->ulObjectMask & ulObjectBit ) != 0UL )
+            {
+                if( prvWakeHostTask( pxExecutor ) != pdFALSE )
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        #if ( configUSE_MULTI_WAIT == 1 )
+        {
+            /* Tasks in xMultiWaitSelect() wait on the same reports. */
+            if( xMultiWaitObjectChanged( pvObject ) != pdFALSE )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_MULTI_WAIT */
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWakeHostTask( const Executor_t * pxExecutor )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        /* The interrupt safe version masks interrupts itself, so this can be
+         * used from a task, from a critical section, with the scheduler
+         * suspended, or from an interrupt. */
+        if( pxExecutor->xHostTask != NULL )
+        {
+            vTaskNotifyGiveIndexedFromISR( pxExecutor->xHostTask, configEXECUTOR_NOTIFY_INDEX, &xHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xHigherPriorityTaskWoken;
+    }
+
+#endif /* configUSE_EXECUTOR */
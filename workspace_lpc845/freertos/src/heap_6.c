@@ -0,0 +1,575 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that keeps the
+ * free blocks in segregated size classes and combines adjacent free blocks
+ * as soon as a block is freed.
+ *
+ * Free block i of size S is linked into the list of class floor( log2( S ) ).
+ * A bitmap records which class lists are not empty, so a block that is
+ * guaranteed to be large enough is found without walking any list: every
+ * block of a class above the class of the request is large enough.  Each
+ * block starts with a header holding its own size and the size of the block
+ * physically before it, so both neighbours of a freed block can be merged
+ * with it in constant time.  Unlike heap_2.c the heap therefore does not
+ * fragment under a create/delete workload.
+ *
+ * vPortGetHeapStats() reports the usual statistics.  The fragmentation of the
+ * free space can be derived from it as
+ * 1 - ( xSizeOfLargestFreeBlockInBytes / xAvailableHeapSpaceInBytes ).
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of
+ * https://www.FreeRTOS.org for more information.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE           ( ( size_t ) 8 )
+
+/* Max value that fits in a size_t type. */
+#define heapSIZE_MAX                ( ~( ( size_t ) 0 ) )
+
+/* Check if multiplying a and b will result in overflow. */
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )    ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Check if adding a and b will result in overflow. */
+#define heapADD_WILL_OVERFLOW( a, b )         ( ( a ) > ( heapSIZE_MAX - ( b ) ) )
+
+/* MSB of the xBlockSize member of an BlockLink_t structure is used to track
+ * the allocation status of a block.  When MSB of the xBlockSize member of
+ * an BlockLink_t structure is set then the block belongs to the application.
+ * When the bit is free the block is still part of the free heap space. */
+#define heapBLOCK_ALLOCATED_BITMASK    ( ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+#define heapBLOCK_SIZE_IS_VALID( xBlockSize )    ( ( ( xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) == 0 )
+#define heapBLOCK_IS_ALLOCATED( pxBlock )        ( ( ( pxBlock->xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) != 0 )
+#define heapALLOCATE_BLOCK( pxBlock )            ( ( pxBlock->xBlockSize ) |= heapBLOCK_ALLOCATED_BITMASK )
+#define heapFREE_BLOCK( pxBlock )                ( ( pxBlock->xBlockSize ) &= ~heapBLOCK_ALLOCATED_BITMASK )
+#define heapBLOCK_SIZE( pxBlock )                ( ( pxBlock->xBlockSize ) & ~heapBLOCK_ALLOCATED_BITMASK )
+
+/* Round a size up to the byte alignment of the port. */
+#define heapALIGN_UP( x )    ( ( ( x ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* One size class per power of two, tracked in a 32-bit bitmap. */
+#define heapNUMBER_OF_SIZE_CLASSES    ( 32U )
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the heap. */
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Header at the start of every block.  The free list links are only valid
+ * while the block is free, an allocated block uses that space for its data. */
+typedef struct A_BLOCK_LINK
+{
+    size_t xPreviousBlockSize;             /*<< The size of the block physically before this one, 0 for the first block. */
+    size_t xBlockSize;                     /*<< The size of this block, header included. */
+    struct A_BLOCK_LINK * pxNextFreeBlock; /*<< The next free block in the same size class. */
+    struct A_BLOCK_LINK * pxPrevFreeBlock; /*<< The previous free block in the same size class. */
+} BlockLink_t;
+
+/* Part of the header kept by allocated blocks, and smallest block that can
+ * hold the free list links once it is freed. */
+#define heapHEADER_SIZE           heapALIGN_UP( offsetof( BlockLink_t, pxNextFreeBlock ) )
+#define heapMINIMUM_BLOCK_SIZE    heapALIGN_UP( sizeof( BlockLink_t ) )
+
+/* Heads of the free lists, one per size class, and the bitmap of the classes
+ * that have at least one free block. */
+PRIVILEGED_DATA static BlockLink_t * pxFreeLists[ heapNUMBER_OF_SIZE_CLASSES ];
+PRIVILEGED_DATA static uint32_t ulFreeListsBitmap = 0;
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfFreeBlocks = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialises the heap structures before their first use.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the size class of a block size.
+ */
+static UBaseType_t prvSizeClass( size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index of the lowest bit set in a non zero value.
+ */
+static UBaseType_t prvLowestBitSet( uint32_t ulValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a block into, or remove it from, the free list of its size class.
+ */
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns a free block of at least xWantedSize bytes, or NULL.
+ */
+static BlockLink_t * prvFindFreeBlock( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvLowestBitSet( uint32_t ulValue )
+{
+    /* De Bruijn sequence lookup, Cortex-M0 has no count leading zeros
+     * instruction. */
+    static const uint8_t ucBitPosition[ 32 ] =
+    {
+        0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U,  8U,
+        31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U
+    };
+
+    return ( UBaseType_t ) ucBitPosition[ ( uint32_t ) ( ( ulValue & ( 0U - ulValue ) ) * 0x077CB531UL ) >> 27 ];
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvSizeClass( size_t xSize )
+{
+    uint32_t ulValue;
+
+    if( xSize >= ( ( size_t ) 1 << ( heapNUMBER_OF_SIZE_CLASSES - 1U ) ) )
+    {
+        return heapNUMBER_OF_SIZE_CLASSES - 1U;
+    }
+
+    /* Keep only the highest bit set. */
+    ulValue = ( uint32_t ) xSize;
+    ulValue |= ulValue >> 1;
+    ulValue |= ulValue >> 2;
+    ulValue |= ulValue >> 4;
+    ulValue |= ulValue >> 8;
+    ulValue |= ulValue >> 16;
+
+    return prvLowestBitSet( ulValue ^ ( ulValue >> 1 ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert )
+{
+    UBaseType_t uxClass = prvSizeClass( pxBlockToInsert->xBlockSize );
+
+    pxBlockToInsert->pxPrevFreeBlock = NULL;
+    pxBlockToInsert->pxNextFreeBlock = pxFreeLists[ uxClass ];
+
+    if( pxFreeLists[ uxClass ] != NULL )
+    {
+        pxFreeLists[ uxClass ]->pxPrevFreeBlock = pxBlockToInsert;
+    }
+
+    pxFreeLists[ uxClass ] = pxBlockToInsert;
+    ulFreeListsBitmap |= ( 1UL << uxClass );
+    xNumberOfFreeBlocks++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove )
+{
+    UBaseType_t uxClass = prvSizeClass( pxBlockToRemove->xBlockSize );
+
+    if( pxBlockToRemove->pxPrevFreeBlock != NULL )
+    {
+        pxBlockToRemove->pxPrevFreeBlock->pxNextFreeBlock = pxBlockToRemove->pxNextFreeBlock;
+    }
+    else
+    {
+        pxFreeLists[ uxClass ] = pxBlockToRemove->pxNextFreeBlock;
+
+        if( pxFreeLists[ uxClass ] == NULL )
+        {
+            ulFreeListsBitmap &= ~( 1UL << uxClass );
+        }
+    }
+
+    if( pxBlockToRemove->pxNextFreeBlock != NULL )
+    {
+        pxBlockToRemove->pxNextFreeBlock->pxPrevFreeBlock = pxBlockToRemove->pxPrevFreeBlock;
+    }
+
+    xNumberOfFreeBlocks--;
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvFindFreeBlock( size_t xWantedSize )
+{
+    UBaseType_t uxClass = prvSizeClass( xWantedSize );
+    BlockLink_t * pxBlock = pxFreeLists[ uxClass ];
+    uint32_t ulLargerClasses;
+
+    /* The first block of the class of the request is often large enough. */
+    if( ( pxBlock != NULL ) && ( pxBlock->xBlockSize >= xWantedSize ) )
+    {
+        return pxBlock;
+    }
+
+    /* Any block of a larger class is large enough, take the smallest class. */
+    ulLargerClasses = ( uxClass < ( heapNUMBER_OF_SIZE_CLASSES - 1U ) ) ? ( ulFreeListsBitmap & ~( ( 2UL << uxClass ) - 1UL ) ) : 0UL;
+
+    if( ulLargerClasses != 0UL )
+    {
+        return pxFreeLists[ prvLowestBitSet( ulLargerClasses ) ];
+    }
+
+    /* Last resort before failing, the rest of the class of the request. */
+    while( ( pxBlock != NULL ) && ( pxBlock->xBlockSize < xWantedSize ) )
+    {
+        pxBlock = pxBlock->pxNextFreeBlock;
+    }
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxNewBlockLink;
+    BlockLink_t * pxNextBlock;
+    PRIVILEGED_DATA static BaseType_t xHeapHasBeenInitialised = pdFALSE;
+    void * pvReturn = NULL;
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc then the heap will require
+         * initialisation to setup the list of free blocks. */
+        if( xHeapHasBeenInitialised == pdFALSE )
+        {
+            prvHeapInit();
+            xHeapHasBeenInitialised = pdTRUE;
+        }
+
+        if( xWantedSize > 0 )
+        {
+            /* The wanted size must be increased so it can contain the block
+             * header in addition to the requested amount of bytes, and be large
+             * enough to hold the free list links once it is freed. */
+            if( heapADD_WILL_OVERFLOW( xWantedSize, heapHEADER_SIZE + portBYTE_ALIGNMENT_MASK ) == 0 )
+            {
+                xWantedSize = heapALIGN_UP( xWantedSize + heapHEADER_SIZE );
+
+                if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+                {
+                    xWantedSize = heapMINIMUM_BLOCK_SIZE;
+                }
+            }
+            else
+            {
+                xWantedSize = 0;
+            }
+        }
+
+        /* Check the block size we are trying to allocate is not so large that the
+         * top bit is set.  The top bit of the block size member of the BlockLink_t
+         * structure is used to determine who owns the block - the application or
+         * the kernel, so it must be free. */
+        if( heapBLOCK_SIZE_IS_VALID( xWantedSize ) != 0 )
+        {
+            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            {
+                pxBlock = prvFindFreeBlock( xWantedSize );
+
+                if( pxBlock != NULL )
+                {
+                    /* This block is being returned for use so must be taken out of the
+                     * list of free blocks. */
+                    prvRemoveBlockFromFreeList( pxBlock );
+
+                    /* If the block is larger than required it can be split into two. */
+                    if( ( pxBlock->xBlockSize - xWantedSize ) >= heapMINIMUM_BLOCK_SIZE )
+                    {
+                        /* This block is to be split into two.  Create a new block
+                         * following the number of bytes requested. The void cast is
+                         * used to prevent byte alignment warnings from the compiler. */
+                        pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                        pxNextBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + pxBlock->xBlockSize );
+
+                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                        pxNewBlockLink->xPreviousBlockSize = xWantedSize;
+                        pxNextBlock->xPreviousBlockSize = pxNewBlockLink->xBlockSize;
+                        pxBlock->xBlockSize = xWantedSize;
+
+                        /* Insert the new block into the list of free blocks. */
+                        prvInsertBlockIntoFreeList( pxNewBlockLink );
+                    }
+
+                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                    {
+                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                    }
+
+                    /* The block is being returned - it is allocated and owned
+                     * by the application. */
+                    heapALLOCATE_BLOCK( pxBlock );
+                    xNumberOfSuccessfulAllocations++;
+
+                    /* Return the memory space - jumping over the block header. */
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapHEADER_SIZE );
+                }
+            }
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+    }
+    #endif
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+    BlockLink_t * pxNeighbour;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have a block header immediately
+         * before it. */
+        puc -= heapHEADER_SIZE;
+
+        /* This unexpected casting is to keep some compilers from issuing
+         * byte alignment warnings. */
+        pxLink = ( void * ) puc;
+
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
+
+        if( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 )
+        {
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                ( void ) memset( puc + heapHEADER_SIZE, 0, heapBLOCK_SIZE( pxLink ) - heapHEADER_SIZE );
+            }
+            #endif
+
+            vTaskSuspendAll();
+            {
+                /* The block is being returned to the heap - it is no longer
+                 * allocated.  This is done with the scheduler suspended as a
+                 * concurrent free may want to merge with this block. */
+                heapFREE_BLOCK( pxLink );
+                xFreeBytesRemaining += pxLink->xBlockSize;
+                traceFREE( pv, pxLink->xBlockSize );
+                xNumberOfSuccessfulFrees++;
+
+                /* Merge with the block that follows if it is free.  The end
+                 * marker is allocated, so this never runs off the heap. */
+                pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxLink ) + pxLink->xBlockSize );
+
+                if( heapBLOCK_IS_ALLOCATED( pxNeighbour ) == 0 )
+                {
+                    prvRemoveBlockFromFreeList( pxNeighbour );
+                    pxLink->xBlockSize += pxNeighbour->xBlockSize;
+                }
+
+                /* Merge with the block that precedes it if it is free. */
+                if( pxLink->xPreviousBlockSize != 0U )
+                {
+                    pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxLink ) - pxLink->xPreviousBlockSize );
+
+                    if( heapBLOCK_IS_ALLOCATED( pxNeighbour ) == 0 )
+                    {
+                        prvRemoveBlockFromFreeList( pxNeighbour );
+                        pxNeighbour->xBlockSize += pxLink->xBlockSize;
+                        pxLink = pxNeighbour;
+                    }
+                }
+
+                /* The block after the merged block must know its new size. */
+                pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxLink ) + pxLink->xBlockSize );
+                pxNeighbour->xPreviousBlockSize = pxLink->xBlockSize;
+
+                /* Add this block to the list of free blocks. */
+                prvInsertBlockIntoFreeList( pxLink );
+            }
+            ( void ) xTaskResumeAll();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxFirstFreeBlock;
+    BlockLink_t * pxEndMarker;
+    uint8_t * pucAlignedHeap;
+    size_t xHeapSize;
+
+    /* Ensure the heap starts on a correctly aligned boundary. */
+    pucAlignedHeap = ( uint8_t * ) ( ( ( portPOINTER_SIZE_TYPE ) & ucHeap[ portBYTE_ALIGNMENT - 1 ] ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) );
+    xHeapSize = ( configTOTAL_HEAP_SIZE - ( size_t ) ( pucAlignedHeap - ucHeap ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+    /* An allocated block header of size 0 at the end of the heap stops the
+     * merging of the last block. */
+    xHeapSize -= heapHEADER_SIZE;
+    pxEndMarker = ( void * ) ( pucAlignedHeap + xHeapSize );
+    pxEndMarker->xPreviousBlockSize = xHeapSize;
+    pxEndMarker->xBlockSize = 0;
+    heapALLOCATE_BLOCK( pxEndMarker );
+
+    /* To start with there is a single free block that is sized to take up the
+     * entire heap space. */
+    pxFirstFreeBlock = ( void * ) pucAlignedHeap;
+    pxFirstFreeBlock->xPreviousBlockSize = 0;
+    pxFirstFreeBlock->xBlockSize = xHeapSize;
+    prvInsertBlockIntoFreeList( pxFirstFreeBlock );
+
+    xFreeBytesRemaining = xHeapSize;
+    xMinimumEverFreeBytesRemaining = xHeapSize;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    size_t xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    UBaseType_t uxClass;
+
+    vTaskSuspendAll();
+    {
+        /* The largest block is in the highest class that is not empty and
+         * the smallest block in the lowest one, only those lists are walked. */
+        if( ulFreeListsBitmap != 0UL )
+        {
+            for( uxClass = heapNUMBER_OF_SIZE_CLASSES - 1U; pxFreeLists[ uxClass ] == NULL; uxClass-- )
+            {
+            }
+
+            for( pxBlock = pxFreeLists[ uxClass ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                if( pxBlock->xBlockSize > xMaxSize )
+                {
+                    xMaxSize = pxBlock->xBlockSize;
+                }
+            }
+
+            for( pxBlock = pxFreeLists[ prvLowestBitSet( ulFreeListsBitmap ) ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                if( pxBlock->xBlockSize < xMinSize )
+                {
+                    xMinSize = pxBlock->xBlockSize;
+                }
+            }
+        }
+        else
+        {
+            xMinSize = 0;
+        }
+
+        pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+        pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+        pxHeapStats->xNumberOfFreeBlocks = xNumberOfFreeBlocks;
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    ( void ) xTaskResumeAll();
+}
@@ -0,0 +1,242 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "kernel_objects.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+#if ( configUSE_KERNEL_OBJECT_TABLES == 1 )
+
+/* The bounds of the object table.  They are weak so that an application
+ * without any kobj definitions, whose image has no table section, still
+ * links. */
+    extern const KernelObjectDefinition_t __start_freertos_object_table[] __attribute__( ( weak ) );
+    extern const KernelObjectDefinition_t __stop_freertos_object_table[] __attribute__( ( weak ) );
+
+/* Set once the objects have been created. */
+    PRIVILEGED_DATA static BaseType_t xObjectsCreated = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xKernelObjectsCreate( void )
+    {
+        const KernelObjectDefinition_t * pxDefinition;
+        void * pvCreated;
+        BaseType_t xReturn = pdPASS;
+
+        /* Called from main() or vTaskStartScheduler(), before the scheduler
+         * runs, so no critical section is needed. */
+        if( xObjectsCreated == pdFALSE )
+        {
+            xObjectsCreated = pdTRUE;
+
+            for( pxDefinition = __start_freertos_object_table; pxDefinition < __stop_freertos_object_table; pxDefinition++ )
+            {
+                switch( pxDefinition->ucType )
+                {
+                    case kobjTYPE_TASK:
+                    {
+                        TaskHandle_t xTask;
+
+                        xTask = xTaskCreateStatic( pxDefinition->pxTaskCode,
+                                                   pxDefinition->pcName,
+                                                   pxDefinition->ulSize,
+                                                   pxDefinition->pvParameters,
+                                                   pxDefinition->uxArgument,
+                                                   ( StackType_t * ) pxDefinition->pvStorage,
+                                                   ( StaticTask_t * ) pxDefinition->pvObjectBuffer );
+                        *( ( TaskHandle_t * ) pxDefinition->pvHandle ) = xTask;
+                        pvCreated = ( void * ) xTask;
+                        break;
+                    }
+
+                    case kobjTYPE_QUEUE:
+                    case kobjTYPE_BINARY_SEMAPHORE:
+                    case kobjTYPE_COUNTING_SEMAPHORE:
+                    case kobjTYPE_MUTEX:
+                    case kobjTYPE_RECURSIVE_MUTEX:
+                    {
+                        QueueHandle_t xQueue = NULL;
+
+                        if( pxDefinition->ucType == kobjTYPE_QUEUE )
+                        {
+                            xQueue = xQueueGenericCreateStatic( ( UBaseType_t ) pxDefinition->ulSize,
+                                                                pxDefinition->uxArgument,
+                                                                ( uint8_t * ) pxDefinition->pvStorage,
+                                                                ( StaticQueue_t * ) pxDefinition->pvObjectBuffer,
+                                                                queueQUEUE_TYPE_BASE );
+                        }
+                        else if( pxDefinition->ucType == kobjTYPE_BINARY_SEMAPHORE )
+                        {
+                            xQueue = xQueueGenericCreateStatic( ( UBaseType_t ) 1,
+                                                                semSEMAPHORE_QUEUE_ITEM_LENGTH,
+                                                                NULL,
+                                                                ( StaticQueue_t * ) pxDefinition->pvObjectBuffer,
+                                                                queueQUEUE_TYPE_BINARY_SEMAPHORE );
+                        }
+
+                        #if ( configUSE_COUNTING_SEMAPHORES == 1 )
+                            else if( pxDefinition->ucType == kobjTYPE_COUNTING_SEMAPHORE )
+                            {
+                                xQueue = xQueueCreateCountingSemaphoreStatic( ( UBaseType_t ) pxDefinition->ulSize,
+                                                                              pxDefinition->uxArgument,
+                                                                              ( StaticQueue_t * ) pxDefinition->pvObjectBuffer );
+                            }
+                        #endif
+
+                        #if ( configUSE_MUTEXES == 1 )
+                            else if( pxDefinition->ucType == kobjTYPE_MUTEX )
+                            {
+                                xQueue = xQueueCreateMutexStatic( queueQUEUE_TYPE_MUTEX,
+                                                                  ( StaticQueue_t * ) pxDefinition->pvObjectBuffer );
+                            }
+                        #endif
+
+                        #if ( configUSE_RECURSIVE_MUTEXES == 1 )
+                            else if( pxDefinition->ucType == kobjTYPE_RECURSIVE_MUTEX )
+                            {
+                                xQueue = xQueueCreateMutexStatic( queueQUEUE_TYPE_RECURSIVE_MUTEX,
+                                                                  ( StaticQueue_t * ) pxDefinition->pvObjectBuffer );
+                            }
+                        #endif
+                        else
+                        {
+                            /* The kernel was built without this type of
+                             * semaphore, xQueue stays NULL. */
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        *( ( QueueHandle_t * ) pxDefinition->pvHandle ) = xQueue;
+                        pvCreated = ( void * ) xQueue;
+                        break;
+                    }
+
+                    case kobjTYPE_STREAM_BUFFER:
+                    case kobjTYPE_MESSAGE_BUFFER:
+                    {
+                        StreamBufferHandle_t xStreamBuffer;
+
+                        xStreamBuffer = xStreamBufferGenericCreateStatic( ( size_t ) pxDefinition->ulSize,
+                                                                          ( size_t ) pxDefinition->uxArgument,
+                                                                          ( pxDefinition->ucType == kobjTYPE_MESSAGE_BUFFER ) ? pdTRUE : pdFALSE,
+                                                                          ( uint8_t * ) pxDefinition->pvStorage,
+                                                                          ( StaticStreamBuffer_t * ) pxDefinition->pvObjectBuffer,
+                                                                          NULL,
+                                                                          NULL );
+                        *( ( StreamBufferHandle_t * ) pxDefinition->pvHandle ) = xStreamBuffer;
+                        pvCreated = ( void * ) xStreamBuffer;
+                        break;
+                    }
+
+                    default:
+                        pvCreated = NULL;
+                        break;
+                }
+
+                /* Creating an object from static memory only fails when its
+                 * definition is invalid. */
+                configASSERT( pvCreated );
+
+                if( pvCreated == NULL )
+                {
+                    xReturn = pdFAIL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_KERNEL_OBJECT_TABLES */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configKERNEL_PROVIDED_STATIC_MEMORY == 1 )
+
+/* The idle task, and the timer service task when there is one, need memory
+ * from the application when static allocation is supported.  Provide it here,
+ * in the same sections as the objects of the object table, so applications do
+ * not each have to define these callbacks. */
+    #if defined( __GNUC__ )
+        #define kobjKERNEL_TCB_SECTION      __attribute__( ( section( ".bss.freertos_tcbs" ) ) )
+        #define kobjKERNEL_STACK_SECTION    __attribute__( ( section( ".bss.freertos_stacks" ) ) )
+    #else
+        #define kobjKERNEL_TCB_SECTION
+        #define kobjKERNEL_STACK_SECTION
+    #endif
+
+    void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                        StackType_t ** ppxIdleTaskStackBuffer,
+                                        uint32_t * pulIdleTaskStackSize )
+    {
+        static StaticTask_t xIdleTaskTCB kobjKERNEL_TCB_SECTION;
+        static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ] kobjKERNEL_STACK_SECTION;
+
+        *ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+        *ppxIdleTaskStackBuffer = uxIdleTaskStack;
+        *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMERS == 1 ) && ( ( configTIMERS_RUN_FROM_TICK == 0 ) || ( configTIMER_DEFERRED_CALLBACKS == 1 ) )
+
+        void vApplicationGetTimerTaskMemory( StaticTask_t ** ppxTimerTaskTCBBuffer,
+                                             StackType_t ** ppxTimerTaskStackBuffer,
+                                             uint32_t * pulTimerTaskStackSize )
+        {
+            static StaticTask_t xTimerTaskTCB kobjKERNEL_TCB_SECTION;
+            static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ] kobjKERNEL_STACK_SECTION;
+
+            *ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+            *ppxTimerTaskStackBuffer = uxTimerTaskStack;
+            *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+        }
+
+    #endif /* configUSE_TIMERS */
+
+#endif /* configKERNEL_PROVIDED_STATIC_MEMORY */
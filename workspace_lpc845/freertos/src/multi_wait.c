@@ -0,0 +1,404 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+#include "executor.h"
+#include "multi_wait.h"
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+#if ( configUSE_MULTI_WAIT == 1 )
+
+    #if ( configUSE_EXECUTOR != 1 )
+        #error configUSE_EXECUTOR must be set to 1 to build multi_wait.c, the kernel reports object changes through executor.c
+    #endif
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build multi_wait.c
+    #endif
+
+    #if ( configMULTI_WAIT_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+        #error configMULTI_WAIT_NOTIFY_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES
+    #endif
+
+/* Values of MultiWaitSource_t.ucType. */
+    #define multiwaitSOURCE_QUEUE            ( ( uint8_t ) 0 )
+    #define multiwaitSOURCE_STREAM_BUFFER    ( ( uint8_t ) 1 )
+    #define multiwaitSOURCE_NOTIFICATION     ( ( uint8_t ) 2 )
+
+/*-----------------------------------------------------------*/
+
+/* The MultiWait_t structures tasks have selected on, so
+ * xMultiWaitObjectChanged() can find the tasks.  Changed from critical
+ * sections and walked with interrupts masked. */
+    PRIVILEGED_DATA static MultiWait_t * volatile pxMultiWaits = NULL;
+
+/*
+ * Unlinks pxMultiWait from pxMultiWaits.  Called from a critical section.
+ */
+    static void prvUnlink( MultiWait_t * pxMultiWait );
+
+/*
+ * Adds a source of the given type to pxMultiWait.
+ */
+    static BaseType_t prvAddSource( MultiWait_t * pxMultiWait,
+                                    void * pvObject,
+                                    uint32_t ulNotifyBits,
+                                    uint8_t ucType ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index of the first ready source of pxMultiWait, or
+ * multiwaitNO_SOURCE.  The bits of a ready notification source are taken
+ * from the notification value and written to *pulNotifiedBits.
+ */
+    static BaseType_t prvFindReadySource( const MultiWait_t * pxMultiWait,
+                                          uint32_t * pulNotifiedBits ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    void vMultiWaitInitialise( MultiWait_t * pxMultiWait )
+    {
+        configASSERT( pxMultiWait );
+
+        pxMultiWait->pxNext = NULL;
+        pxMultiWait->xTask = NULL;
+        pxMultiWait->xSelecting = pdFALSE;
+        pxMultiWait->ulObjectMask = 0UL;
+        pxMultiWait->uxSources = 0;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMultiWaitAddQueue( MultiWait_t * pxMultiWait,
+                                   QueueHandle_t xQueue )
+    {
+        configASSERT( xQueue );
+
+        return prvAddSource( pxMultiWait, ( void * ) xQueue, 0UL, multiwaitSOURCE_QUEUE );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMultiWaitAddStreamBuffer( MultiWait_t * pxMultiWait,
+                                          StreamBufferHandle_t xStreamBuffer )
+    {
+        configASSERT( xStreamBuffer );
+
+        return prvAddSource( pxMultiWait, ( void * ) xStreamBuffer, 0UL, multiwaitSOURCE_STREAM_BUFFER );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMultiWaitAddNotification( MultiWait_t * pxMultiWait,
+                                          uint32_t ulNotifyBits )
+    {
+        configASSERT( ulNotifyBits != 0UL );
+        configASSERT( ( ulNotifyBits & multiwaitOBJECT_CHANGED_BIT ) == 0UL );
+
+        return prvAddSource( pxMultiWait, NULL, ulNotifyBits, multiwaitSOURCE_NOTIFICATION );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvAddSource( MultiWait_t * pxMultiWait,
+                                    void * pvObject,
+                                    uint32_t ulNotifyBits,
+                                    uint8_t ucType )
+    {
+        MultiWaitSource_t * pxSource;
+        BaseType_t xReturn;
+
+        configASSERT( pxMultiWait );
+
+        if( pxMultiWait->uxSources < ( UBaseType_t ) configMULTI_WAIT_MAX_SOURCES )
+        {
+            pxSource = &( pxMultiWait->xSources[ pxMultiWait->uxSources ] );
+            pxSource->pvObject = pvObject;
+            pxSource->ulNotifyBits = ulNotifyBits;
+            pxSource->ucType = ucType;
+
+            xReturn = ( BaseType_t ) pxMultiWait->uxSources;
+            pxMultiWait->uxSources++;
+
+            /* Only the selecting task writes the mask, interrupts and other
+             * tasks only read it. */
+            if( pvObject != NULL )
+            {
+                pxMultiWait->ulObjectMask |= exeOBJECT_BIT( pvObject );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xReturn = multiwaitNO_SOURCE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMultiWaitSelect( MultiWait_t * pxMultiWait,
+                                 TickType_t xTicksToWait,
+                                 uint32_t * pulNotifiedBits )
+    {
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn;
+
+        configASSERT( pxMultiWait );
+
+        if( pxMultiWait->xTask == NULL )
+        {
+            /* First select, register so the kernel can wake the task. */
+            taskENTER_CRITICAL();
+            {
+                pxMultiWait->xTask = xTaskGetCurrentTaskHandle();
+                pxMultiWait->pxNext = pxMultiWaits;
+                pxMultiWaits = pxMultiWait;
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            configASSERT( pxMultiWait->xTask == xTaskGetCurrentTaskHandle() );
+        }
+
+        /* Changes are only reported while the task selects, so that the task
+         * reading from its sources between selects does not notify itself.
+         * A change made before this point is seen by the first test below. */
+        pxMultiWait->xSelecting = pdTRUE;
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            /* Clear the change bit before testing the sources.  A change after
+             * the test sets it again, and the notification state, so the wait
+             * below returns at once. */
+            ( void ) ulTaskNotifyValueClearIndexed( NULL, configMULTI_WAIT_NOTIFY_INDEX, multiwaitOBJECT_CHANGED_BIT );
+
+            xReturn = prvFindReadySource( pxMultiWait, pulNotifiedBits );
+
+            if( xReturn != multiwaitNO_SOURCE )
+            {
+                break;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                /* Returns at once if the task was notified since it last
+                 * waited, in which case the sources are simply tested again. */
+                ( void ) xTaskNotifyWaitIndexed( configMULTI_WAIT_NOTIFY_INDEX, 0UL, 0UL, NULL, xTicksToWait );
+            }
+        }
+
+        pxMultiWait->xSelecting = pdFALSE;
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvFindReadySource( const MultiWait_t * pxMultiWait,
+                                          uint32_t * pulNotifiedBits )
+    {
+        const MultiWaitSource_t * pxSource;
+        UBaseType_t uxSource;
+        uint32_t ulBits;
+        BaseType_t xReturn = multiwaitNO_SOURCE;
+
+        for( uxSource = 0; ( uxSource < pxMultiWait->uxSources ) && ( xReturn == multiwaitNO_SOURCE ); uxSource++ )
+        {
+            pxSource = &( pxMultiWait->xSources[ uxSource ] );
+
+            if( pxSource->ucType == multiwaitSOURCE_QUEUE )
+            {
+                if( uxQueueMessagesWaiting( ( QueueHandle_t ) pxSource->pvObject ) != ( UBaseType_t ) 0 )
+                {
+                    xReturn = ( BaseType_t ) uxSource;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( pxSource->ucType == multiwaitSOURCE_STREAM_BUFFER )
+            {
+                if( xStreamBufferIsEmpty( ( StreamBufferHandle_t ) pxSource->pvObject ) == pdFALSE )
+                {
+                    xReturn = ( BaseType_t ) uxSource;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Reading and clearing the bits is atomic, so bits set by an
+                 * interrupt are either returned now or left for later. */
+                ulBits = ulTaskNotifyValueClearIndexed( NULL, configMULTI_WAIT_NOTIFY_INDEX, pxSource->ulNotifyBits ) & pxSource->ulNotifyBits;
+
+                if( ulBits != 0UL )
+                {
+                    if( pulNotifiedBits != NULL )
+                    {
+                        *pulNotifiedBits = ulBits;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xReturn = ( BaseType_t ) uxSource;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvUnlink( MultiWait_t * pxMultiWait )
+    {
+        MultiWait_t * volatile * ppxLink;
+
+        for( ppxLink = &pxMultiWaits; *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxNext ) )
+        {
+            if( *ppxLink == pxMultiWait )
+            {
+                *ppxLink = pxMultiWait->pxNext;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* Registered again on the next select. */
+        pxMultiWait->pxNext = NULL;
+        pxMultiWait->xTask = NULL;
+        pxMultiWait->xSelecting = pdFALSE;
+    }
+/*-----------------------------------------------------------*/
+
+    void vMultiWaitRemove( MultiWait_t * pxMultiWait )
+    {
+        configASSERT( pxMultiWait );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxMultiWait->xTask != NULL )
+            {
+                prvUnlink( pxMultiWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vMultiWaitRemoveTask( TaskHandle_t xTask )
+    {
+        MultiWait_t * pxMultiWait = pxMultiWaits;
+        MultiWait_t * pxNext;
+
+        while( pxMultiWait != NULL )
+        {
+            pxNext = pxMultiWait->pxNext;
+
+            if( pxMultiWait->xTask == xTask )
+            {
+                prvUnlink( pxMultiWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxMultiWait = pxNext;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMultiWaitObjectChanged( const void * pvObject )
+    {
+        const uint32_t ulObjectBit = exeOBJECT_BIT( pvObject );
+        const MultiWait_t * pxMultiWait;
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Masking interrupts stops the list changing during the walk, and
+         * nests, so this works from any of the contexts the kernel reports
+         * changes from. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+
+        for( pxMultiWait = pxMultiWaits; pxMultiWait != NULL; pxMultiWait = pxMultiWait->pxNext )
+        {
+            if( ( pxMultiWait->xSelecting != pdFALSE ) && ( ( pxMultiWait->ulObjectMask & ulObjectBit ) != 0UL ) )
+            {
+                /* The interrupt safe version masks interrupts itself, so this
+                 * can be used from any of the contexts the kernel reports
+                 * changes from. */
+                ( void ) xTaskNotifyIndexedFromISR( pxMultiWait->xTask, configMULTI_WAIT_NOTIFY_INDEX, multiwaitOBJECT_CHANGED_BIT, eSetBits, &xHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xHigherPriorityTaskWoken;
+    }
+
+#endif /* configUSE_MULTI_WAIT */
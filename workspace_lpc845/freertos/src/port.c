@@ -85,6 +85,71 @@
     #define portTASK_RETURN_ADDRESS    prvTaskExitError
 #endif
 
+/* When configTICKLESS_USE_WKT is 1, idle periods long enough for the deep-sleep
+ * or power-down mode of the LPC845 are timed by the self wake-up timer (WKT)
+ * running from the low power oscillator, as these modes stop the SysTick. */
+#ifndef configTICKLESS_USE_WKT
+    #define configTICKLESS_USE_WKT    0
+#endif
+
+#if ( configUSE_TICKLESS_IDLE == 1 ) && ( configTICKLESS_USE_WKT == 1 )
+
+/* Minimum expected idle time, in ticks, to enter each mode.  Shorter idle
+ * periods use sleep mode with the SysTick kept running. */
+    #ifndef configTICKLESS_DEEP_SLEEP_MIN_TICKS
+        #define configTICKLESS_DEEP_SLEEP_MIN_TICKS    ( 5 )
+    #endif
+
+    #ifndef configTICKLESS_POWER_DOWN_MIN_TICKS
+        #define configTICKLESS_POWER_DOWN_MIN_TICKS    ( 100 )
+    #endif
+
+/* Deepest mode tickless idle may use, can be lowered at run time with
+ * vPortSetTicklessModeLimit() while peripherals that need their clock in
+ * idle periods are active. */
+    #ifndef configTICKLESS_LOWEST_POWER_MODE
+        #define configTICKLESS_LOWEST_POWER_MODE    portTICKLESS_MODE_POWER_DOWN
+    #endif
+
+/* SysTick counts from the WKT alarm to the first instruction after the wfi,
+ * for each mode.  Added to the time slept when the alarm ends the sleep. */
+    #ifndef configTICKLESS_DEEP_SLEEP_WAKEUP_COUNTS
+        #define configTICKLESS_DEEP_SLEEP_WAKEUP_COUNTS    ( 0UL )
+    #endif
+
+    #ifndef configTICKLESS_POWER_DOWN_WAKEUP_COUNTS
+        #define configTICKLESS_POWER_DOWN_WAKEUP_COUNTS    ( 0UL )
+    #endif
+
+/* Number of low power oscillator periods timed against the SysTick to
+ * calibrate the WKT when the scheduler starts. */
+    #ifndef configTICKLESS_WKT_CALIBRATION_COUNTS
+        #define configTICKLESS_WKT_CALIBRATION_COUNTS    ( 128UL )
+    #endif
+
+/* The idle period has to leave at least one tick period after a tick that
+ * became due on entry. */
+    #if ( configTICKLESS_DEEP_SLEEP_MIN_TICKS < 2 ) || ( configTICKLESS_POWER_DOWN_MIN_TICKS < 2 )
+        #error The tickless deep-sleep and power-down thresholds must be at least 2 ticks.
+    #endif
+
+/* SysTick counts lost while the SysTick is reloaded after a WKT sleep. */
+    #ifndef portWKT_RESTART_COUNTS
+        #define portWKT_RESTART_COUNTS    ( 12UL )
+    #endif
+
+/* The WKT, PMU and SYSCON registers come from the device header of the
+ * application, see CMakeLists.txt. */
+    #include "fsl_device_registers.h"
+
+/* Time arithmetic of the WKT sleeps. */
+    #include "port_wkt.h"
+
+    #define portWKT_CTRL_LPO                   ( WKT_CTRL_CLKSEL_MASK )
+    #define portPMU_PCON_FLAGS_MASK            ( PMU_PCON_SLEEPFLAG_MASK | PMU_PCON_DPDFLAG_MASK )
+
+#endif /* ( configUSE_TICKLESS_IDLE == 1 ) && ( configTICKLESS_USE_WKT == 1 ) */
+
 /*
  * Setup the timer to generate the tick interrupts.  The implementation in this
  * file is weak to allow application writers to change the timer used to
@@ -115,6 +180,19 @@ static void prvTaskExitError( void );
  * variable. */
 static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
 
+/*
+ * Position of the highest set bit, indexed by the top five bits of the
+ * smeared bit map multiplied by the de Bruijn constant 0x07c4acdd.  Used by
+ * portGET_HIGHEST_PRIORITY().
+ */
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+    const uint8_t ucPortHighestBitTable[ 32 ] =
+    {
+        0U,  9U,  1U,  10U, 13U, 21U, 2U,  29U, 11U, 14U, 16U, 18U, 22U, 25U, 3U, 30U,
+        8U,  12U, 20U, 28U, 15U, 17U, 24U, 7U,  19U, 27U, 23U, 6U,  26U, 5U,  4U, 31U
+    };
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -140,6 +218,61 @@ static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
     static uint32_t ulStoppedTimerCompensation = 0;
 #endif /* configUSE_TICKLESS_IDLE */
 
+#if ( configUSE_TICKLESS_IDLE == 1 ) && ( configTICKLESS_USE_WKT == 1 )
+
+/*
+ * SysTick counts per low power oscillator period, 16.16 fixed point, measured
+ * when the scheduler starts.  0 if the oscillator could not be calibrated, in
+ * which case only sleep mode is used.
+ */
+    static uint32_t ulCountsPerWktPeriod = 0;
+
+/*
+ * Fraction of a SysTick count, 16.16 fixed point, carried from one WKT sleep
+ * to the next so rounding does not accumulate into tick drift.
+ */
+    static uint32_t ulWktCountFraction = 0;
+
+/*
+ * The maximum number of tick periods that fit a single WKT sleep without
+ * overflowing the 32-bit SysTick count arithmetic.
+ */
+    static uint32_t xMaximumWktSuppressedTicks = 0;
+
+/*
+ * Deepest mode tickless idle may currently use.
+ */
+    static volatile uint32_t ulTicklessModeLimit = configTICKLESS_LOWEST_POWER_MODE;
+
+/*
+ * Enable the WKT and the low power oscillator, and calibrate the oscillator
+ * against the SysTick.
+ */
+    static void prvSetupWkt( void );
+
+/*
+ * Return the current WKT count, read until stable as the counter is clocked
+ * from the low power oscillator.
+ */
+    static uint32_t prvReadWktCount( void );
+
+/*
+ * Busy wait for the next low power oscillator edge, the WKT must be running.
+ * Returns the count after the edge.
+ */
+    static uint32_t prvWaitWktEdge( void );
+
+/*
+ * Suppress ticks for up to xExpectedIdleTime ticks in deep-sleep or
+ * power-down mode, timed by the WKT.
+ */
+    static void prvSuppressTicksWithWkt( TickType_t xExpectedIdleTime,
+                                         uint32_t ulMode );
+
+    void xPortWktHandler( void );
+
+#endif /* ( configUSE_TICKLESS_IDLE == 1 ) && ( configTICKLESS_USE_WKT == 1 ) */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -374,6 +507,8 @@ void xPortSysTickHandler( void )
 {
     uint32_t ulPreviousMask;
 
+    taskSTACK_PROFILE_ISR_ENTER();
+
     ulPreviousMask = portSET_INTERRUPT_MASK_FROM_ISR();
     {
         /* Increment the RTOS tick. */
@@ -384,6 +519,8 @@ void xPortSysTickHandler( void )
         }
     }
     portCLEAR_INTERRUPT_MASK_FROM_ISR( ulPreviousMask );
+
+    taskSTACK_PROFILE_ISR_EXIT();
 }
 /*-----------------------------------------------------------*/
 
@@ -402,6 +539,14 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
     }
     #endif /* configUSE_TICKLESS_IDLE */
 
+    #if ( configUSE_TICKLESS_IDLE == 1 ) && ( configTICKLESS_USE_WKT == 1 )
+    {
+        /* Uses the SysTick, so must run before the tick is configured. */
+        xMaximumWktSuppressedTicks = 0x7fffffffUL / ulTimerCountsForOneTick;
+        prvSetupWkt();
+    }
+    #endif
+
     /* Stop and reset the SysTick. */
     portNVIC_SYSTICK_CTRL_REG = 0UL;
     portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
@@ -419,6 +564,39 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
         uint32_t ulReloadValue, ulCompleteTickPeriods, ulCompletedSysTickDecrements, ulSysTickDecrementsLeft;
         TickType_t xModifiableIdleTime;
 
+        #if ( configTICKLESS_USE_WKT == 1 )
+        {
+            uint32_t ulMode = portTICKLESS_MODE_SLEEP;
+
+            /* Deep-sleep and power-down require the FRO to clock the core
+             * directly, as asserted by POWER_EnterDeepSleep(). */
+            if( ( ulCountsPerWktPeriod != 0UL ) &&
+                ( ( SYSCON->MAINCLKSEL & SYSCON_MAINCLKSEL_SEL_MASK ) == 0UL ) &&
+                ( ( SYSCON->MAINCLKPLLSEL & SYSCON_MAINCLKPLLSEL_SEL_MASK ) == 0UL ) )
+            {
+                if( xExpectedIdleTime >= ( TickType_t ) configTICKLESS_POWER_DOWN_MIN_TICKS )
+                {
+                    ulMode = portTICKLESS_MODE_POWER_DOWN;
+                }
+                else if( xExpectedIdleTime >= ( TickType_t ) configTICKLESS_DEEP_SLEEP_MIN_TICKS )
+                {
+                    ulMode = portTICKLESS_MODE_DEEP_SLEEP;
+                }
+
+                if( ulMode > ulTicklessModeLimit )
+                {
+                    ulMode = ulTicklessModeLimit;
+                }
+            }
+
+            if( ulMode != portTICKLESS_MODE_SLEEP )
+            {
+                prvSuppressTicksWithWkt( xExpectedIdleTime, ulMode );
+                return;
+            }
+        }
+        #endif /* configTICKLESS_USE_WKT */
+
         /* Make sure the SysTick reload value does not overflow the counter. */
         if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
         {
@@ -631,3 +809,267 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
     }
 
 #endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE == 1 ) && ( configTICKLESS_USE_WKT == 1 )
+
+    #if ( portNVIC_SYSTICK_CLK_BIT_CONFIG != portNVIC_SYSTICK_CLK_BIT )
+        #error configTICKLESS_USE_WKT requires the SysTick to be clocked from the core clock.
+    #endif
+
+    static void prvSetupWkt( void )
+    {
+        uint32_t ulCount, ulStartCount, ulStartValue;
+
+        SYSCON->SYSAHBCLKCTRL0 |= SYSCON_SYSAHBCLKCTRL0_WKT_MASK;
+        PMU->DPDCTRL |= PMU_DPDCTRL_LPOSCEN_MASK;
+        WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_CLEARCTR_MASK;
+        WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_ALARMFLAG_MASK;
+
+        /* Let the SysTick run free to time the oscillator.  Interrupts are
+         * still disabled as the scheduler is being started. */
+        portNVIC_SYSTICK_CTRL_REG = 0UL;
+        portNVIC_SYSTICK_LOAD_REG = portMAX_24_BIT_NUMBER;
+        portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+        portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_ENABLE_BIT;
+
+        WKT->COUNT = configTICKLESS_WKT_CALIBRATION_COUNTS + 2UL;
+
+        /* Allow the oscillator one tick period to start.  If it does not,
+         * ulCountsPerWktPeriod is left at 0 and only sleep mode is used. */
+        ulCount = prvReadWktCount();
+        ulStartValue = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+        while( ( prvReadWktCount() == ulCount ) &&
+               ( ( ( ulStartValue - portNVIC_SYSTICK_CURRENT_VALUE_REG ) & portMAX_24_BIT_NUMBER ) < ulTimerCountsForOneTick ) )
+        {
+        }
+
+        if( prvReadWktCount() != ulCount )
+        {
+            /* Time whole oscillator periods, from one edge to another, so the
+             * result does not depend on when the WKT was started. */
+            ulStartCount = prvWaitWktEdge();
+            ulStartValue = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+            do
+            {
+                ulCount = prvWaitWktEdge();
+            } while( ( ulStartCount - ulCount ) < configTICKLESS_WKT_CALIBRATION_COUNTS );
+
+            ulCount = ( ulStartValue - portNVIC_SYSTICK_CURRENT_VALUE_REG ) & portMAX_24_BIT_NUMBER;
+            ulCountsPerWktPeriod = ulPortWktCountsPerPeriod( ulCount, configTICKLESS_WKT_CALIBRATION_COUNTS );
+        }
+
+        WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_CLEARCTR_MASK;
+        WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_ALARMFLAG_MASK;
+        NVIC_ClearPendingIRQ( WKT_IRQn );
+
+        /* The WKT alarm has to wake the MCU from deep-sleep and power-down. */
+        SYSCON->STARTERP1 |= SYSCON_STARTERP1_WKT_MASK;
+        NVIC_EnableIRQ( WKT_IRQn );
+    }
+/*-----------------------------------------------------------*/
+
+    static uint32_t prvReadWktCount( void )
+    {
+        uint32_t ulCount;
+
+        do
+        {
+            ulCount = WKT->COUNT;
+        } while( ulCount != WKT->COUNT );
+
+        return ulCount;
+    }
+/*-----------------------------------------------------------*/
+
+    static uint32_t prvWaitWktEdge( void )
+    {
+        uint32_t ulCount, ulStartCount;
+
+        ulStartCount = prvReadWktCount();
+
+        do
+        {
+            ulCount = prvReadWktCount();
+        } while( ulCount == ulStartCount );
+
+        return ulCount;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSuppressTicksWithWkt( TickType_t xExpectedIdleTime,
+                                         uint32_t ulMode )
+    {
+        uint32_t ulTicksBefore = 0UL, ulCountsToNextTick, ulPeriods, ulStartCount, ulEndCount;
+        uint32_t ulElapsed, ulExtraCounts, ulCompleteTickPeriods, ulReloadValue, ulRestartCounts;
+        TickType_t xModifiableIdleTime;
+
+        /* Make sure the SysTick count arithmetic does not overflow. */
+        if( xExpectedIdleTime > xMaximumWktSuppressedTicks )
+        {
+            xExpectedIdleTime = xMaximumWktSuppressedTicks;
+        }
+
+        /* Enter a critical section but don't use the taskENTER_CRITICAL()
+         * method as that will mask interrupts that should exit sleep mode. */
+        __asm volatile ( "cpsid i" ::: "memory" );
+        __asm volatile ( "dsb" );
+        __asm volatile ( "isb" );
+
+        /* If a context switch is pending or a task is waiting for the scheduler
+         * to be unsuspended then abandon the low power entry. */
+        if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+        {
+            __asm volatile ( "cpsie i" ::: "memory" );
+        }
+        else
+        {
+            /* A tick that fell due after xExpectedIdleTime was calculated is
+             * counted here instead of by the tick interrupt. */
+            if( ( portNVIC_INT_CTRL_REG & portNVIC_PEND_SYSTICK_SET_BIT ) != 0 )
+            {
+                portNVIC_INT_CTRL_REG = portNVIC_PEND_SYSTICK_CLEAR_BIT;
+                ulTicksBefore++;
+            }
+
+            ulCountsToNextTick = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+            if( ulCountsToNextTick == 0UL )
+            {
+                ulCountsToNextTick = ulTimerCountsForOneTick;
+            }
+
+            /* Aim the alarm just before the last tick of the idle period, the
+             * SysTick then generates that tick as usual.  One oscillator period
+             * is taken off as the WKT only starts counting at the next edge. */
+            ulElapsed = ulCountsToNextTick + ( ulTimerCountsForOneTick * ( xExpectedIdleTime - ulTicksBefore - 1UL ) );
+            ulPeriods = ulPortWktAlarmPeriods( ulElapsed, ulCountsPerWktPeriod );
+
+            WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_CLEARCTR_MASK;
+            WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_ALARMFLAG_MASK;
+            WKT->COUNT = ulPeriods + 1UL;
+
+            /* The sleep is timed from the first oscillator edge, so it lasts an
+             * exact number of oscillator periods.  The SysTick is stopped at
+             * that edge and the time to the next tick taken from it. */
+            ulStartCount = prvWaitWktEdge();
+            portNVIC_SYSTICK_CTRL_REG = ( portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_INT_BIT );
+            ulCountsToNextTick = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+            if( ulCountsToNextTick == 0UL )
+            {
+                ulCountsToNextTick = ulTimerCountsForOneTick;
+            }
+
+            if( ( portNVIC_INT_CTRL_REG & portNVIC_PEND_SYSTICK_SET_BIT ) != 0 )
+            {
+                portNVIC_INT_CTRL_REG = portNVIC_PEND_SYSTICK_CLEAR_BIT;
+                ulTicksBefore++;
+            }
+
+            /* Keep the current power configuration on wake up, and select the
+             * mode entered by wfi. */
+            SYSCON->PDAWAKECFG = SYSCON->PDRUNCFG;
+            PMU->PCON = ( PMU->PCON & ~( PMU_PCON_PM_MASK | portPMU_PCON_FLAGS_MASK ) ) | ulMode;
+            SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+
+            /* Sleep until something happens.  See vPortSuppressTicksAndSleep()
+             * for configPRE_SLEEP_PROCESSING(). */
+            xModifiableIdleTime = xExpectedIdleTime;
+            configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+
+            if( xModifiableIdleTime > 0 )
+            {
+                __asm volatile ( "dsb" ::: "memory" );
+                __asm volatile ( "wfi" );
+                __asm volatile ( "isb" );
+            }
+
+            configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+            SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+            PMU->PCON = PMU->PCON & ~( PMU_PCON_PM_MASK | portPMU_PCON_FLAGS_MASK );
+
+            /* Find the oscillator edge the sleep is measured to.  Interrupts
+             * stay masked until then, so an interrupt that ended the sleep early
+             * runs up to one oscillator period late. */
+            ulEndCount = prvReadWktCount();
+
+            if( ulEndCount == 0UL )
+            {
+                /* The alarm ended the sleep, add the wake up time. */
+                if( ulMode == portTICKLESS_MODE_POWER_DOWN )
+                {
+                    ulExtraCounts = configTICKLESS_POWER_DOWN_WAKEUP_COUNTS;
+                }
+                else
+                {
+                    ulExtraCounts = configTICKLESS_DEEP_SLEEP_WAKEUP_COUNTS;
+                }
+            }
+            else
+            {
+                ulEndCount = prvWaitWktEdge();
+                ulExtraCounts = 0UL;
+            }
+
+            /* Let the SysTick run free from here so the time taken by the
+             * calculation below is accounted for. */
+            portNVIC_SYSTICK_LOAD_REG = portMAX_24_BIT_NUMBER;
+            portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+            portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_ENABLE_BIT;
+
+            WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_CLEARCTR_MASK;
+            WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_ALARMFLAG_MASK;
+            NVIC_ClearPendingIRQ( WKT_IRQn );
+
+            /* Convert the oscillator periods slept to SysTick counts, and count
+             * the tick periods that ended. */
+            ulElapsed = ulPortWktPeriodsToCounts( ulStartCount - ulEndCount, ulCountsPerWktPeriod, &ulWktCountFraction ) + ulExtraCounts;
+            ulCompleteTickPeriods = ulTicksBefore + ulPortWktTickPeriods( ulElapsed, ulCountsToNextTick, ulTimerCountsForOneTick, &ulReloadValue );
+
+            /* Take out the counts since the SysTick was let run free, then
+             * restart it for the remainder of the current tick period. */
+            ulRestartCounts = ( portMAX_24_BIT_NUMBER - portNVIC_SYSTICK_CURRENT_VALUE_REG ) + portWKT_RESTART_COUNTS;
+            ulCompleteTickPeriods += ulPortWktSkipRestart( ulRestartCounts, ulTimerCountsForOneTick, &ulReloadValue );
+
+            portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_INT_BIT;
+            portNVIC_SYSTICK_LOAD_REG = ( ulReloadValue - ulRestartCounts ) - 1UL;
+            portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+            portNVIC_SYSTICK_CTRL_REG = portNVIC_SYSTICK_CLK_BIT_CONFIG | portNVIC_SYSTICK_INT_BIT | portNVIC_SYSTICK_ENABLE_BIT;
+            portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+
+            /* The alarm is set to end the sleep before the last tick period of
+             * the idle time, so this only limits the step if the wake up took
+             * longer than configured. */
+            if( ulCompleteTickPeriods > xExpectedIdleTime )
+            {
+                ulCompleteTickPeriods = xExpectedIdleTime;
+            }
+
+            /* Step the tick to account for any tick periods that elapsed. */
+            vTaskStepTick( ulCompleteTickPeriods );
+
+            /* Exit with interrupts enabled. */
+            __asm volatile ( "cpsie i" ::: "memory" );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void xPortWktHandler( void )
+    {
+        /* The alarm only wakes the MCU, the time slept is accounted for by
+         * prvSuppressTicksWithWkt(). */
+        WKT->CTRL = portWKT_CTRL_LPO | WKT_CTRL_ALARMFLAG_MASK;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortSetTicklessModeLimit( uint32_t ulMode )
+    {
+        configASSERT( ulMode <= portTICKLESS_MODE_POWER_DOWN );
+        ulTicklessModeLimit = ulMode;
+    }
+
+#endif /* ( configUSE_TICKLESS_IDLE == 1 ) && ( configTICKLESS_USE_WKT == 1 ) */
@@ -0,0 +1,134 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Time arithmetic of the tickless idle sleeps timed by the self wake-up timer
+ * (WKT), see prvSuppressTicksWithWkt() in port.c.  Kept free of register
+ * accesses so the host test in bench/tick_drift_sim.c runs the same code.
+ *
+ * SysTick counts per WKT period are held as 16.16 fixed point.
+ */
+
+#ifndef PORT_WKT_H
+#define PORT_WKT_H
+
+#include <stdint.h>
+
+/*
+ * SysTick counts per WKT period, from ulCounts SysTick counts timed over
+ * ulPeriods whole WKT periods.
+ */
+static inline uint32_t ulPortWktCountsPerPeriod( uint32_t ulCounts,
+                                                 uint32_t ulPeriods )
+{
+    return ( uint32_t ) ( ( ( uint64_t ) ulCounts << 16 ) / ulPeriods );
+}
+
+/*
+ * WKT periods to sleep for at most ulCounts SysTick counts.  One period is
+ * taken off as the WKT only starts counting at the next oscillator edge.
+ */
+static inline uint32_t ulPortWktAlarmPeriods( uint32_t ulCounts,
+                                              uint32_t ulCountsPerWktPeriod )
+{
+    uint32_t ulPeriods;
+
+    ulPeriods = ( uint32_t ) ( ( ( uint64_t ) ulCounts << 16 ) / ulCountsPerWktPeriod );
+
+    if( ulPeriods > 1UL )
+    {
+        ulPeriods--;
+    }
+
+    return ulPeriods;
+}
+
+/*
+ * SysTick counts in ulPeriods WKT periods.  The fraction of a count left over
+ * is kept in *pulFraction and added to the next conversion, so rounding does
+ * not accumulate over many sleeps.
+ */
+static inline uint32_t ulPortWktPeriodsToCounts( uint32_t ulPeriods,
+                                                 uint32_t ulCountsPerWktPeriod,
+                                                 uint32_t * pulFraction )
+{
+    uint64_t ullScaled;
+
+    ullScaled = ( ( uint64_t ) ulPeriods * ulCountsPerWktPeriod ) + *pulFraction;
+    *pulFraction = ( uint32_t ) ullScaled & 0xffffUL;
+
+    return ( uint32_t ) ( ullScaled >> 16 );
+}
+
+/*
+ * Tick periods that ended ulElapsed SysTick counts after the SysTick was
+ * stopped ulCountsToNextTick counts before a tick.  *pulReloadValue is set to
+ * the counts left until the next tick.
+ */
+static inline uint32_t ulPortWktTickPeriods( uint32_t ulElapsed,
+                                             uint32_t ulCountsToNextTick,
+                                             uint32_t ulCountsForOneTick,
+                                             uint32_t * pulReloadValue )
+{
+    uint32_t ulTickPeriods;
+
+    if( ulElapsed < ulCountsToNextTick )
+    {
+        ulTickPeriods = 0UL;
+        *pulReloadValue = ulCountsToNextTick - ulElapsed;
+    }
+    else
+    {
+        ulElapsed -= ulCountsToNextTick;
+        ulTickPeriods = 1UL + ( ulElapsed / ulCountsForOneTick );
+        *pulReloadValue = ulCountsForOneTick - ( ulElapsed % ulCountsForOneTick );
+    }
+
+    return ulTickPeriods;
+}
+
+/*
+ * Tick periods that end before the SysTick can be restarted ulRestartCounts
+ * counts after the wake up.  *pulReloadValue is moved on past them.
+ */
+static inline uint32_t ulPortWktSkipRestart( uint32_t ulRestartCounts,
+                                             uint32_t ulCountsForOneTick,
+                                             uint32_t * pulReloadValue )
+{
+    uint32_t ulTickPeriods = 0UL;
+
+    while( *pulReloadValue <= ulRestartCounts )
+    {
+        *pulReloadValue += ulCountsForOneTick;
+        ulTickPeriods++;
+    }
+
+    return ulTickPeriods;
+}
+
+#endif /* PORT_WKT_H */
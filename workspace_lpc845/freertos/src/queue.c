@@ -42,6 +42,10 @@
     #include "croutine.h"
 #endif
 
+#if ( configUSE_EXECUTOR == 1 )
+    #include "executor.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -83,6 +87,10 @@ typedef struct SemaphoreData
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH    ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME          ( ( TickType_t ) 0U )
 
+/* Bits of ucZeroCopyState. */
+#define queueZERO_COPY_RESERVED             ( ( uint8_t ) 0x01U )
+#define queueZERO_COPY_BORROWED             ( ( uint8_t ) 0x02U )
+
 #if ( configUSE_PREEMPTION == 0 )
 
 /* If the cooperative scheduler is being used then a yield should not be
@@ -118,6 +126,10 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
     volatile int8_t cRxLock;                /*< Stores the number of items received from the queue (removed from the queue) while the queue was locked.  Set to queueUNLOCKED when the queue is not locked. */
     volatile int8_t cTxLock;                /*< Stores the number of items transmitted to the queue (added to the queue) while the queue was locked.  Set to queueUNLOCKED when the queue is not locked. */
 
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucZeroCopyState; /*< Records whether a slot is reserved by a writer and whether one is borrowed by a reader, see xQueueReserve() and xQueueBorrow(). */
+    #endif
+
     #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
         uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
     #endif
@@ -203,6 +215,58 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/*
+ * Checks, from a critical section, whether a writer can reserve the next
+ * slot (xReserve set) or a reader can borrow the oldest item.
+ */
+    static BaseType_t prvIsZeroCopySlotAvailable( const Queue_t * pxQueue,
+                                                  const BaseType_t xReserve ) PRIVILEGED_FUNCTION;
+
+/*
+ * Marks the slot as reserved or borrowed and returns its address.
+ */
+    static void * prvTakeZeroCopySlot( Queue_t * const pxQueue,
+                                       const BaseType_t xReserve ) PRIVILEGED_FUNCTION;
+
+/*
+ * Commits the reserved slot (xCommit set) or releases the borrowed one.
+ */
+    static void prvGiveBackZeroCopySlot( Queue_t * const pxQueue,
+                                         const BaseType_t xCommit ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks the tasks a commit or a release lets go on.  Returns pdTRUE if one
+ * of them has a priority above the running task.
+ */
+    static BaseType_t prvUnblockZeroCopyWaiters( Queue_t * const pxQueue,
+                                                 const BaseType_t xCommit ) PRIVILEGED_FUNCTION;
+
+/*
+ * Task and ISR implementations shared by the reserve/commit and the
+ * borrow/release functions.
+ */
+    static BaseType_t prvAcquireZeroCopySlot( Queue_t * const pxQueue,
+                                              void ** const ppvSlot,
+                                              TickType_t xTicksToWait,
+                                              const BaseType_t xReserve ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvAcquireZeroCopySlotFromISR( Queue_t * const pxQueue,
+                                                     void ** const ppvSlot,
+                                                     const BaseType_t xReserve ) PRIVILEGED_FUNCTION;
+    static void prvFinishZeroCopySlot( Queue_t * const pxQueue,
+                                       const BaseType_t xCommit ) PRIVILEGED_FUNCTION;
+    static void prvFinishZeroCopySlotFromISR( Queue_t * const pxQueue,
+                                              const BaseType_t xCommit,
+                                              BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Ends the reservation of a slot without posting an item.  Returns pdTRUE if
+ * a task unblocked by it has a priority above the running task.
+ */
+    static BaseType_t prvAbortZeroCopyReserve( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_QUEUE_ZERO_COPY */
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
@@ -315,6 +379,12 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
+            #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+            {
+                pxQueue->ucZeroCopyState = 0U;
+            }
+            #endif
+
             if( xNewQueue == pdFALSE )
             {
                 /* If there are tasks blocked waiting to read from the queue, then
@@ -337,6 +407,20 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
+
+                #if ( configUSE_EXECUTOR == 1 )
+                {
+                    /* Coroutines waiting to send to the queue poll it again. */
+                    if( xExecutorObjectChanged( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_EXECUTOR */
             }
             else
             {
@@ -961,6 +1045,20 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 }
                 #endif /* configUSE_QUEUE_SETS */
 
+                #if ( configUSE_EXECUTOR == 1 )
+                {
+                    /* Coroutines waiting on the queue poll it again. */
+                    if( xExecutorObjectChanged( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_EXECUTOR */
+
                 taskEXIT_CRITICAL();
                 return pdPASS;
             }
@@ -1195,6 +1293,20 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                 prvIncrementQueueTxLock( pxQueue, cTxLock );
             }
 
+            #if ( configUSE_EXECUTOR == 1 )
+            {
+                /* Coroutines waiting on the queue poll it again. */
+                if( ( xExecutorObjectChanged( pxQueue ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_EXECUTOR */
+
             xReturn = pdPASS;
         }
         else
@@ -1361,6 +1473,20 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
                 prvIncrementQueueTxLock( pxQueue, cTxLock );
             }
 
+            #if ( configUSE_EXECUTOR == 1 )
+            {
+                /* Coroutines waiting on the queue poll it again. */
+                if( ( xExecutorObjectChanged( pxQueue ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_EXECUTOR */
+
             xReturn = pdPASS;
         }
         else
@@ -1434,6 +1560,20 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                     mtCOVERAGE_TEST_MARKER();
                 }
 
+                #if ( configUSE_EXECUTOR == 1 )
+                {
+                    /* Coroutines waiting on the queue poll it again. */
+                    if( xExecutorObjectChanged( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_EXECUTOR */
+
                 taskEXIT_CRITICAL();
                 return pdPASS;
             }
@@ -1597,6 +1737,20 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                     mtCOVERAGE_TEST_MARKER();
                 }
 
+                #if ( configUSE_EXECUTOR == 1 )
+                {
+                    /* Coroutines waiting on the queue poll it again. */
+                    if( xExecutorObjectChanged( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_EXECUTOR */
+
                 taskEXIT_CRITICAL();
                 return pdPASS;
             }
@@ -1958,6 +2112,20 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
                 prvIncrementQueueRxLock( pxQueue, cRxLock );
             }
 
+            #if ( configUSE_EXECUTOR == 1 )
+            {
+                /* Coroutines waiting on the queue poll it again. */
+                if( ( xExecutorObjectChanged( pxQueue ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_EXECUTOR */
+
             xReturn = pdPASS;
         }
         else
@@ -1972,6 +2140,591 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    static BaseType_t prvIsZeroCopySlotAvailable( const Queue_t * pxQueue,
+                                                  const BaseType_t xReserve )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        /* This function is called from a critical section. */
+
+        if( xReserve != pdFALSE )
+        {
+            /* Only one slot can be reserved at a time, it is always the one
+             * pcWriteTo points to. */
+            if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) &&
+                ( ( pxQueue->ucZeroCopyState & queueZERO_COPY_RESERVED ) == 0U ) )
+            {
+                xReturn = pdTRUE;
+            }
+        }
+        else
+        {
+            /* Only one slot can be borrowed at a time, it is always the one
+             * after pcReadFrom. */
+            if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&
+                ( ( pxQueue->ucZeroCopyState & queueZERO_COPY_BORROWED ) == 0U ) )
+            {
+                xReturn = pdTRUE;
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void * prvTakeZeroCopySlot( Queue_t * const pxQueue,
+                                       const BaseType_t xReserve )
+    {
+        int8_t * pcSlot;
+
+        /* This function is called from a critical section. */
+
+        if( xReserve != pdFALSE )
+        {
+            pxQueue->ucZeroCopyState |= queueZERO_COPY_RESERVED;
+            pcSlot = pxQueue->pcWriteTo;
+        }
+        else
+        {
+            pxQueue->ucZeroCopyState |= queueZERO_COPY_BORROWED;
+            pcSlot = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+            if( pcSlot >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+            {
+                pcSlot = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return ( void * ) pcSlot;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvGiveBackZeroCopySlot( Queue_t * const pxQueue,
+                                         const BaseType_t xCommit )
+    {
+        /* This function is called from a critical section.  The slot is
+         * accounted for in the same way prvCopyDataToQueue() and
+         * prvCopyDataFromQueue() do, only without the copy. */
+
+        if( xCommit != pdFALSE )
+        {
+            configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_RESERVED ) != 0U );
+            pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_RESERVED;
+
+            pxQueue->pcWriteTo += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+            if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+            {
+                pxQueue->pcWriteTo = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1;
+        }
+        else
+        {
+            configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_BORROWED ) != 0U );
+            pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_BORROWED;
+
+            pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+
+            if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+            {
+                pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->uxMessagesWaiting = pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvUnblockZeroCopyWaiters( Queue_t * const pxQueue,
+                                                 const BaseType_t xCommit )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        const int8_t cTxLock = pxQueue->cTxLock;
+        const int8_t cRxLock = pxQueue->cRxLock;
+        BaseType_t xWakeReceiver = pdTRUE;
+
+        /* This function is called from a critical section, or from an ISR
+         * with interrupts masked.  A task only ever finds the queue unlocked,
+         * an ISR may find it locked and then leaves the event lists to the task
+         * that unlocks the queue, as xQueueGenericSendFromISR() does.
+         *
+         * A commit adds an item and ends a reservation, a release frees a slot
+         * and ends a borrow.  Either can let both a reader and a writer go
+         * on. */
+        #if ( configUSE_QUEUE_SETS == 1 )
+        {
+            if( pxQueue->pxQueueSetContainer != NULL )
+            {
+                /* Readers wait on the set.  The set already holds an entry for
+                 * every item but the one just committed. */
+                xWakeReceiver = pdFALSE;
+
+                if( xCommit != pdFALSE )
+                {
+                    if( cTxLock == queueUNLOCKED )
+                    {
+                        if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                        {
+                            xHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        prvIncrementQueueTxLock( pxQueue, cTxLock );
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else /* configUSE_QUEUE_SETS */
+        {
+            /* Only needed to notify a queue set. */
+            ( void ) xCommit;
+        }
+        #endif /* configUSE_QUEUE_SETS */
+
+        if( ( xWakeReceiver != pdFALSE ) && ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) )
+        {
+            if( cTxLock == queueUNLOCKED )
+            {
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        xHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                prvIncrementQueueTxLock( pxQueue, cTxLock );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+        {
+            if( cRxLock == queueUNLOCKED )
+            {
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        xHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                prvIncrementQueueRxLock( pxQueue, cRxLock );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( configUSE_EXECUTOR == 1 )
+        {
+            /* Coroutines waiting on the queue poll it again. */
+            if( xExecutorObjectChanged( pxQueue ) != pdFALSE )
+            {
+                xHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_EXECUTOR */
+
+        return xHigherPriorityTaskWoken;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvAcquireZeroCopySlot( Queue_t * const pxQueue,
+                                              void ** const ppvSlot,
+                                              TickType_t xTicksToWait,
+                                              const BaseType_t xReserve )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE, xAvailable;
+        TimeOut_t xTimeOut;
+        List_t * const pxWaitList = ( xReserve != pdFALSE ) ? &( pxQueue->xTasksWaitingToSend ) : &( pxQueue->xTasksWaitingToReceive );
+
+        configASSERT( pxQueue );
+        configASSERT( ppvSlot );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /* Same blocking scheme as xQueueGenericSend() and xQueueReceive(),
+         * waiting for a slot rather than for space or data. */
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( prvIsZeroCopySlotAvailable( pxQueue, xReserve ) != pdFALSE )
+                {
+                    *ppvSlot = prvTakeZeroCopySlot( pxQueue, xReserve );
+                    taskEXIT_CRITICAL();
+                    return pdPASS;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        taskEXIT_CRITICAL();
+
+                        if( xReserve != pdFALSE )
+                        {
+                            traceQUEUE_SEND_FAILED( pxQueue );
+                            return errQUEUE_FULL;
+                        }
+                        else
+                        {
+                            traceQUEUE_RECEIVE_FAILED( pxQueue );
+                            return errQUEUE_EMPTY;
+                        }
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        /* Entry time was already set. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            taskENTER_CRITICAL();
+            {
+                xAvailable = prvIsZeroCopySlotAvailable( pxQueue, xReserve );
+            }
+            taskEXIT_CRITICAL();
+
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( xAvailable == pdFALSE )
+                {
+                    if( xReserve != pdFALSE )
+                    {
+                        traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    }
+                    else
+                    {
+                        traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    }
+
+                    vTaskPlaceOnEventList( pxWaitList, xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        portYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* A slot became available.  Loop back to take it. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out.  Loop back once more with no block time so a slot
+                 * that became available at the last moment is still taken. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvAcquireZeroCopySlotFromISR( Queue_t * const pxQueue,
+                                                     void ** const ppvSlot,
+                                                     const BaseType_t xReserve )
+    {
+        BaseType_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxQueue );
+        configASSERT( ppvSlot );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        /* See the comment in xQueueGenericSendFromISR(). */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( prvIsZeroCopySlotAvailable( pxQueue, xReserve ) != pdFALSE )
+            {
+                *ppvSlot = prvTakeZeroCopySlot( pxQueue, xReserve );
+                xReturn = pdPASS;
+            }
+            else if( xReserve != pdFALSE )
+            {
+                traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+                xReturn = errQUEUE_FULL;
+            }
+            else
+            {
+                traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+                xReturn = errQUEUE_EMPTY;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvFinishZeroCopySlot( Queue_t * const pxQueue,
+                                       const BaseType_t xCommit )
+    {
+        configASSERT( pxQueue );
+
+        taskENTER_CRITICAL();
+        {
+            if( xCommit != pdFALSE )
+            {
+                traceQUEUE_SEND( pxQueue );
+            }
+            else
+            {
+                traceQUEUE_RECEIVE( pxQueue );
+            }
+
+            prvGiveBackZeroCopySlot( pxQueue, xCommit );
+
+            if( prvUnblockZeroCopyWaiters( pxQueue, xCommit ) != pdFALSE )
+            {
+                /* Yes it is ok to do this from within the critical section -
+                 * the kernel takes care of that. */
+                queueYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvFinishZeroCopySlotFromISR( Queue_t * const pxQueue,
+                                              const BaseType_t xCommit,
+                                              BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxQueue );
+
+        /* See the comment in xQueueGenericSendFromISR(). */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( xCommit != pdFALSE )
+            {
+                traceQUEUE_SEND_FROM_ISR( pxQueue );
+            }
+            else
+            {
+                traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+            }
+
+            prvGiveBackZeroCopySlot( pxQueue, xCommit );
+
+            if( ( prvUnblockZeroCopyWaiters( pxQueue, xCommit ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+            {
+                *pxHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvAbortZeroCopyReserve( Queue_t * const pxQueue )
+    {
+        /* This function is called from a critical section.  pcWriteTo is left
+         * where it is, so the next reservation gets the same slot. */
+        configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_RESERVED ) != 0U );
+        pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_RESERVED;
+
+        /* A writer blocked on the reservation can take the slot. */
+        return prvUnblockZeroCopyWaiters( pxQueue, pdFALSE );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueReserve( QueueHandle_t xQueue,
+                              void ** const ppvSlot,
+                              TickType_t xTicksToWait )
+    {
+        return prvAcquireZeroCopySlot( xQueue, ppvSlot, xTicksToWait, pdTRUE );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueReserveFromISR( QueueHandle_t xQueue,
+                                     void ** const ppvSlot )
+    {
+        return prvAcquireZeroCopySlotFromISR( xQueue, ppvSlot, pdTRUE );
+    }
+/*-----------------------------------------------------------*/
+
+    void vQueueCommit( QueueHandle_t xQueue )
+    {
+        prvFinishZeroCopySlot( xQueue, pdTRUE );
+    }
+/*-----------------------------------------------------------*/
+
+    void vQueueCommitFromISR( QueueHandle_t xQueue,
+                              BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        prvFinishZeroCopySlotFromISR( xQueue, pdTRUE, pxHigherPriorityTaskWoken );
+    }
+/*-----------------------------------------------------------*/
+
+    void vQueueAbortReserve( QueueHandle_t xQueue )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        configASSERT( pxQueue );
+
+        taskENTER_CRITICAL();
+        {
+            if( prvAbortZeroCopyReserve( pxQueue ) != pdFALSE )
+            {
+                queueYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vQueueAbortReserveFromISR( QueueHandle_t xQueue,
+                                    BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        Queue_t * const pxQueue = xQueue;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxQueue );
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( ( prvAbortZeroCopyReserve( pxQueue ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+            {
+                *pxHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueBorrow( QueueHandle_t xQueue,
+                             void ** const ppvSlot,
+                             TickType_t xTicksToWait )
+    {
+        return prvAcquireZeroCopySlot( xQueue, ppvSlot, xTicksToWait, pdFALSE );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueBorrowFromISR( QueueHandle_t xQueue,
+                                    void ** const ppvSlot )
+    {
+        return prvAcquireZeroCopySlotFromISR( xQueue, ppvSlot, pdFALSE );
+    }
+/*-----------------------------------------------------------*/
+
+    void vQueueRelease( QueueHandle_t xQueue )
+    {
+        prvFinishZeroCopySlot( xQueue, pdFALSE );
+    }
+/*-----------------------------------------------------------*/
+
+    void vQueueReleaseFromISR( QueueHandle_t xQueue,
+                               BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        prvFinishZeroCopySlotFromISR( xQueue, pdFALSE, pxHigherPriorityTaskWoken );
+    }
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
                               void * const pvBuffer )
 {
@@ -2181,6 +2934,15 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 
     /* This function is called from a critical section. */
 
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    {
+        /* The reserved slot is the one pcWriteTo points to, and an item sent
+         * to the front would be placed before the borrowed one. */
+        configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_RESERVED ) == 0U );
+        configASSERT( !( ( xPosition != queueSEND_TO_BACK ) && ( ( pxQueue->ucZeroCopyState & queueZERO_COPY_BORROWED ) != 0U ) ) );
+    }
+    #endif
+
     uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
     if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
@@ -2258,6 +3020,13 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer )
 {
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    {
+        /* The oldest item is the borrowed one. */
+        configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_BORROWED ) == 0U );
+    }
+    #endif
+
     if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
     {
         pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;           /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
@@ -0,0 +1,591 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ring_buffer.h"
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+    #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build ring_buffer.c
+#endif
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+    #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build ring_buffer.c
+#endif
+
+/* Lint e961, e9021 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021. */
+
+/* Bits that can be set in RingBuffer_t.ucFlags. */
+#define rbFLAGS_MULTI_PRODUCER             ( ( uint8_t ) 1 ) /* Set if the ring buffer accepts several writers. */
+#define rbFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 2 ) /* Set if the ring buffer was created using statically allocated memory. */
+
+/*-----------------------------------------------------------*/
+
+/* Structure that hold state information on the ring buffer.  xHead and xTail
+ * are free running byte counts, the difference between the two is the number
+ * of bytes in the buffer and the low bits index the storage area.  Each index
+ * is only ever stored by one side, which is what makes the single writer
+ * variant lock free. */
+typedef struct RingBufferDef_t                  /*lint !e9058 Style convention uses tag. */
+{
+    volatile size_t xHead;                       /* Number of bytes ever written.  Only updated by the writer(s). */
+    volatile size_t xTail;                       /* Number of bytes ever read.  Only updated by the reader. */
+    size_t xMask;                                /* Size of the storage area minus one, the size being a power of two. */
+    uint8_t * pucBuffer;                         /* Points to the storage area. */
+    volatile TaskHandle_t xTaskWaitingToReceive; /* Holds the handle of the reader if it is blocked waiting for data, otherwise NULL. */
+    uint8_t ucFlags;
+} RingBuffer_t;
+
+/*
+ * Copies xCount bytes into the storage area starting at the free running
+ * index xHead, wrapping around the end of the storage area if necessary.
+ */
+static void prvWriteBytes( RingBuffer_t * const pxRingBuffer,
+                           size_t xHead,
+                           const uint8_t * pucData,
+                           size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies xCount bytes out of the storage area starting at the free running
+ * index xTail, wrapping around the end of the storage area if necessary.
+ */
+static void prvReadBytes( const RingBuffer_t * const pxRingBuffer,
+                          size_t xTail,
+                          uint8_t * pucData,
+                          size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Writes as many bytes as fit and publishes them to the reader.  Must be called
+ * with interrupts masked if the ring buffer has several writers.
+ */
+static size_t prvWriteToRingBuffer( RingBuffer_t * const pxRingBuffer,
+                                    const uint8_t * pucData,
+                                    size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Reads as many bytes as available, up to xBufferLengthBytes, and hands the
+ * space back to the writer(s).
+ */
+static size_t prvReadFromRingBuffer( RingBuffer_t * const pxRingBuffer,
+                                     uint8_t * pucData,
+                                     size_t xBufferLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by both the dynamic and static creation functions to initialise the
+ * ring buffer structure.
+ */
+static void prvInitialiseNewRingBuffer( RingBuffer_t * const pxRingBuffer,
+                                        uint8_t * const pucBuffer,
+                                        size_t xBufferSizeBytes,
+                                        uint8_t ucFlags ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    RingBufferHandle_t xRingBufferGenericCreate( size_t xBufferSizeBytes,
+                                                 BaseType_t xMultiProducer )
+    {
+        uint8_t * pucAllocatedMemory = NULL;
+        uint8_t ucFlags;
+
+        /* The storage area is indexed with a mask. */
+        configASSERT( xBufferSizeBytes > ( size_t ) 0 );
+        configASSERT( ( xBufferSizeBytes & ( xBufferSizeBytes - ( size_t ) 1 ) ) == ( size_t ) 0 );
+
+        if( xMultiProducer != pdFALSE )
+        {
+            ucFlags = rbFLAGS_MULTI_PRODUCER;
+        }
+        else
+        {
+            ucFlags = 0;
+        }
+
+        /* The structure and the storage area are allocated in one block, as
+         * done for stream buffers.  Check for addition overflow first. */
+        if( xBufferSizeBytes < ( xBufferSizeBytes + sizeof( RingBuffer_t ) ) )
+        {
+            pucAllocatedMemory = ( uint8_t * ) pvPortMalloc( xBufferSizeBytes + sizeof( RingBuffer_t ) ); /*lint !e9079 malloc() only returns void*. */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pucAllocatedMemory != NULL )
+        {
+            prvInitialiseNewRingBuffer( ( RingBuffer_t * ) pucAllocatedMemory,       /* Structure at the start of the allocated memory. */ /*lint !e9087 Safe cast as allocated memory is aligned. */ /*lint !e826 Area is not too small and alignment is guaranteed provided malloc() behaves as expected and returns aligned buffer. */
+                                        pucAllocatedMemory + sizeof( RingBuffer_t ), /* Storage area follows. */ /*lint !e9016 Indexing past structure valid for uint8_t pointer, also storage area has no alignment requirement. */
+                                        xBufferSizeBytes,
+                                        ucFlags );
+        }
+
+        return ( RingBufferHandle_t ) pucAllocatedMemory; /*lint !e9087 !e826 Safe cast as allocated memory is aligned. */
+    }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+    RingBufferHandle_t xRingBufferGenericCreateStatic( size_t xBufferSizeBytes,
+                                                       BaseType_t xMultiProducer,
+                                                       uint8_t * const pucRingBufferStorageArea,
+                                                       StaticRingBuffer_t * const pxStaticRingBuffer )
+    {
+        RingBuffer_t * const pxRingBuffer = ( RingBuffer_t * ) pxStaticRingBuffer; /*lint !e740 !e9087 Safe cast as StaticRingBuffer_t is opaque RingBuffer_t. */
+        RingBufferHandle_t xReturn;
+        uint8_t ucFlags;
+
+        configASSERT( pucRingBufferStorageArea );
+        configASSERT( pxStaticRingBuffer );
+        configASSERT( xBufferSizeBytes > ( size_t ) 0 );
+        configASSERT( ( xBufferSizeBytes & ( xBufferSizeBytes - ( size_t ) 1 ) ) == ( size_t ) 0 );
+
+        if( xMultiProducer != pdFALSE )
+        {
+            ucFlags = rbFLAGS_MULTI_PRODUCER | rbFLAGS_IS_STATICALLY_ALLOCATED;
+        }
+        else
+        {
+            ucFlags = rbFLAGS_IS_STATICALLY_ALLOCATED;
+        }
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* Sanity check that the size of the structure used to declare a
+             * variable of type StaticRingBuffer_t equals the size of the real
+             * ring buffer structure. */
+            volatile size_t xSize = sizeof( StaticRingBuffer_t );
+            configASSERT( xSize == sizeof( RingBuffer_t ) );
+        } /*lint !e529 xSize is referenced is configASSERT() is defined. */
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pucRingBufferStorageArea != NULL ) && ( pxStaticRingBuffer != NULL ) )
+        {
+            prvInitialiseNewRingBuffer( pxRingBuffer,
+                                        pucRingBufferStorageArea,
+                                        xBufferSizeBytes,
+                                        ucFlags );
+
+            xReturn = ( RingBufferHandle_t ) pxStaticRingBuffer; /*lint !e9087 Data hiding requires cast to opaque type. */
+        }
+        else
+        {
+            xReturn = NULL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+void vRingBufferDelete( RingBufferHandle_t xRingBuffer )
+{
+    RingBuffer_t * pxRingBuffer = xRingBuffer;
+
+    configASSERT( pxRingBuffer );
+    configASSERT( pxRingBuffer->xTaskWaitingToReceive == NULL );
+
+    if( ( pxRingBuffer->ucFlags & rbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+    {
+        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        {
+            /* Both the structure and the storage area were allocated in one
+             * block, so a single free is needed. */
+            vPortFree( ( void * ) pxRingBuffer ); /*lint !e9087 Standard free() semantics require void *, plus pxRingBuffer was allocated by pvPortMalloc(). */
+        }
+        #else
+        {
+            /* Should not be possible to get here, ucFlags must be corrupt.
+             * Force an assert. */
+            configASSERT( xRingBuffer == ( RingBufferHandle_t ) ~0 );
+        }
+        #endif
+    }
+    else
+    {
+        /* The structure was allocated statically, just clear it. */
+        ( void ) memset( pxRingBuffer, 0x00, sizeof( RingBuffer_t ) );
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xRingBufferBytesAvailable( RingBufferHandle_t xRingBuffer )
+{
+    const RingBuffer_t * const pxRingBuffer = xRingBuffer;
+
+    configASSERT( pxRingBuffer );
+
+    /* Unsigned arithmetic handles the free running counts wrapping. */
+    return pxRingBuffer->xHead - pxRingBuffer->xTail;
+}
+/*-----------------------------------------------------------*/
+
+size_t xRingBufferSpacesAvailable( RingBufferHandle_t xRingBuffer )
+{
+    const RingBuffer_t * const pxRingBuffer = xRingBuffer;
+    size_t xTail;
+
+    configASSERT( pxRingBuffer );
+
+    /* Read the reader's index first so a concurrent read can only make the
+     * result too small, never too large. */
+    xTail = pxRingBuffer->xTail;
+
+    return ( pxRingBuffer->xMask + ( size_t ) 1 ) - ( pxRingBuffer->xHead - xTail );
+}
+/*-----------------------------------------------------------*/
+
+size_t xRingBufferSend( RingBufferHandle_t xRingBuffer,
+                        const void * pvTxData,
+                        size_t xDataLengthBytes )
+{
+    RingBuffer_t * const pxRingBuffer = xRingBuffer;
+    size_t xReturn;
+
+    configASSERT( pvTxData );
+    configASSERT( pxRingBuffer );
+
+    if( ( pxRingBuffer->ucFlags & rbFLAGS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+    {
+        taskENTER_CRITICAL();
+        {
+            xReturn = prvWriteToRingBuffer( pxRingBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes );
+        }
+        taskEXIT_CRITICAL();
+    }
+    else
+    {
+        xReturn = prvWriteToRingBuffer( pxRingBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes );
+    }
+
+    /* Only take the notification path if the reader is blocked.  The reader
+     * registers itself inside a critical section after finding the buffer
+     * empty, so either it saw the bytes written above or it is registered by
+     * now. */
+    if( ( xReturn != ( size_t ) 0 ) && ( pxRingBuffer->xTaskWaitingToReceive != NULL ) )
+    {
+        vTaskSuspendAll();
+        {
+            if( pxRingBuffer->xTaskWaitingToReceive != NULL )
+            {
+                ( void ) xTaskNotify( pxRingBuffer->xTaskWaitingToReceive, ( uint32_t ) 0, eNoAction );
+                pxRingBuffer->xTaskWaitingToReceive = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xRingBufferSendFromISR( RingBufferHandle_t xRingBuffer,
+                               const void * pvTxData,
+                               size_t xDataLengthBytes,
+                               BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    RingBuffer_t * const pxRingBuffer = xRingBuffer;
+    size_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( pvTxData );
+    configASSERT( pxRingBuffer );
+
+    if( ( pxRingBuffer->ucFlags & rbFLAGS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+    {
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = prvWriteToRingBuffer( pxRingBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+    else
+    {
+        xReturn = prvWriteToRingBuffer( pxRingBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes );
+    }
+
+    if( ( xReturn != ( size_t ) 0 ) && ( pxRingBuffer->xTaskWaitingToReceive != NULL ) )
+    {
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( pxRingBuffer->xTaskWaitingToReceive != NULL )
+            {
+                ( void ) xTaskNotifyFromISR( pxRingBuffer->xTaskWaitingToReceive,
+                                             ( uint32_t ) 0,
+                                             eNoAction,
+                                             pxHigherPriorityTaskWoken );
+                pxRingBuffer->xTaskWaitingToReceive = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xRingBufferReceive( RingBufferHandle_t xRingBuffer,
+                           void * pvRxData,
+                           size_t xBufferLengthBytes,
+                           TickType_t xTicksToWait )
+{
+    RingBuffer_t * const pxRingBuffer = xRingBuffer;
+    size_t xReceivedLength;
+    BaseType_t xWaiting;
+    TimeOut_t xTimeOut;
+
+    configASSERT( pvRxData );
+    configASSERT( pxRingBuffer );
+
+    xReceivedLength = prvReadFromRingBuffer( pxRingBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes );
+
+    if( ( xReceivedLength == ( size_t ) 0 ) && ( xBufferLengthBytes != ( size_t ) 0 ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+    {
+        vTaskSetTimeOutState( &xTimeOut );
+
+        do
+        {
+            /* Checking if there is data and registering as the waiting reader
+             * must be performed atomically with respect to the writers. */
+            taskENTER_CRITICAL();
+            {
+                if( pxRingBuffer->xHead == pxRingBuffer->xTail )
+                {
+                    /* Clear notification state as going to wait for data. */
+                    ( void ) xTaskNotifyStateClear( NULL );
+
+                    /* Should only be one reader. */
+                    configASSERT( pxRingBuffer->xTaskWaitingToReceive == NULL );
+                    pxRingBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                    xWaiting = pdTRUE;
+                }
+                else
+                {
+                    xWaiting = pdFALSE;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xWaiting != pdFALSE )
+            {
+                ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxRingBuffer->xTaskWaitingToReceive = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReceivedLength = prvReadFromRingBuffer( pxRingBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes );
+
+            /* Go round again after a stale notification, xTicksToWait is
+             * updated to the remaining block time. */
+        } while( ( xReceivedLength == ( size_t ) 0 ) && ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE ) );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xRingBufferReceiveFromISR( RingBufferHandle_t xRingBuffer,
+                                  void * pvRxData,
+                                  size_t xBufferLengthBytes )
+{
+    RingBuffer_t * const pxRingBuffer = xRingBuffer;
+
+    configASSERT( pvRxData );
+    configASSERT( pxRingBuffer );
+
+    return prvReadFromRingBuffer( pxRingBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteToRingBuffer( RingBuffer_t * const pxRingBuffer,
+                                    const uint8_t * pucData,
+                                    size_t xDataLengthBytes )
+{
+    size_t xHead, xTail, xCount;
+
+    /* Each index is loaded once.  The reader may advance xTail at any time,
+     * which only means there is more space than was calculated here. */
+    xHead = pxRingBuffer->xHead;
+    xTail = pxRingBuffer->xTail;
+    xCount = configMIN( xDataLengthBytes, ( pxRingBuffer->xMask + ( size_t ) 1 ) - ( xHead - xTail ) );
+
+    if( xCount != ( size_t ) 0 )
+    {
+        /* The space being written was released by the reader before xTail was
+         * loaded, so it is not read from anymore. */
+        portMEMORY_BARRIER();
+        prvWriteBytes( pxRingBuffer, xHead, pucData, xCount );
+
+        /* The bytes must be in the storage area before the reader can see the
+         * new head index. */
+        portMEMORY_BARRIER();
+        pxRingBuffer->xHead = xHead + xCount;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadFromRingBuffer( RingBuffer_t * const pxRingBuffer,
+                                     uint8_t * pucData,
+                                     size_t xBufferLengthBytes )
+{
+    size_t xHead, xTail, xCount;
+
+    /* Only the reader updates xTail.  A writer may advance xHead at any time,
+     * which only means more bytes are available than read here. */
+    xTail = pxRingBuffer->xTail;
+    xHead = pxRingBuffer->xHead;
+    xCount = configMIN( xBufferLengthBytes, xHead - xTail );
+
+    if( xCount != ( size_t ) 0 )
+    {
+        /* Do not read the storage area before the head index that published
+         * it. */
+        portMEMORY_BARRIER();
+        prvReadBytes( pxRingBuffer, xTail, pucData, xCount );
+
+        /* The bytes must be copied out before the space is handed back to the
+         * writer(s). */
+        portMEMORY_BARRIER();
+        pxRingBuffer->xTail = xTail + xCount;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteBytes( RingBuffer_t * const pxRingBuffer,
+                           size_t xHead,
+                           const uint8_t * pucData,
+                           size_t xCount )
+{
+    size_t xOffset, xFirstLength;
+
+    xOffset = xHead & pxRingBuffer->xMask;
+
+    /* Write as many bytes as can be written in the first write, up to the end
+     * of the storage area, then wrap to its start for the rest. */
+    xFirstLength = configMIN( ( pxRingBuffer->xMask + ( size_t ) 1 ) - xOffset, xCount );
+    ( void ) memcpy( ( void * ) ( &( pxRingBuffer->pucBuffer[ xOffset ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+    if( xCount > xFirstLength )
+    {
+        ( void ) memcpy( ( void * ) pxRingBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvReadBytes( const RingBuffer_t * const pxRingBuffer,
+                          size_t xTail,
+                          uint8_t * pucData,
+                          size_t xCount )
+{
+    size_t xOffset, xFirstLength;
+
+    xOffset = xTail & pxRingBuffer->xMask;
+
+    /* Read as many bytes as can be read in the first read, up to the end of
+     * the storage area, then wrap to its start for the rest. */
+    xFirstLength = configMIN( ( pxRingBuffer->xMask + ( size_t ) 1 ) - xOffset, xCount );
+    ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxRingBuffer->pucBuffer[ xOffset ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+
+    if( xCount > xFirstLength )
+    {
+        ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( const void * ) pxRingBuffer->pucBuffer, xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewRingBuffer( RingBuffer_t * const pxRingBuffer,
+                                        uint8_t * const pucBuffer,
+                                        size_t xBufferSizeBytes,
+                                        uint8_t ucFlags )
+{
+    ( void ) memset( ( void * ) pxRingBuffer, 0x00, sizeof( RingBuffer_t ) ); /*lint !e9087 memset() requires void *. */
+    pxRingBuffer->pucBuffer = pucBuffer;
+    pxRingBuffer->xMask = xBufferSizeBytes - ( size_t ) 1;
+    pxRingBuffer->ucFlags = ucFlags;
+}
@@ -40,6 +40,10 @@
 #include "task.h"
 #include "stream_buffer.h"
 
+#if ( configUSE_EXECUTOR == 1 )
+    #include "executor.h"
+#endif
+
 #if ( configUSE_TASK_NOTIFICATIONS != 1 )
     #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build stream_buffer.c
 #endif
@@ -169,6 +173,30 @@
     #define prvSEND_COMPLETED( pxStreamBuffer )    sbSEND_COMPLETED( ( pxStreamBuffer ) )
 #endif /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
 
+/* Let coroutines waiting on the stream buffer poll it again, see executor.h.
+ * Used next to the completed macros above, which only know of tasks. */
+#if ( configUSE_EXECUTOR == 1 )
+    #define prvEXECUTOR_OBJECT_CHANGED( pxStreamBuffer )                  \
+    {                                                                     \
+        if( xExecutorObjectChanged( ( pxStreamBuffer ) ) != pdFALSE )     \
+        {                                                                 \
+            taskYIELD();                                                  \
+        }                                                                 \
+    }
+
+    #define prvEXECUTOR_OBJECT_CHANGED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) \
+    {                                                                                        \
+        if( ( xExecutorObjectChanged( ( pxStreamBuffer ) ) != pdFALSE ) &&                   \
+            ( ( pxHigherPriorityTaskWoken ) != NULL ) )                                      \
+        {                                                                                    \
+            *( pxHigherPriorityTaskWoken ) = pdTRUE;                                         \
+        }                                                                                    \
+    }
+#else
+    #define prvEXECUTOR_OBJECT_CHANGED( pxStreamBuffer )
+    #define prvEXECUTOR_OBJECT_CHANGED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )
+#endif /* configUSE_EXECUTOR */
+
 
 #ifndef sbSEND_COMPLETE_FROM_ISR
     #define sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )       \
@@ -754,6 +782,7 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
             prvSEND_COMPLETED( pxStreamBuffer );
+            prvEXECUTOR_OBJECT_CHANGED( pxStreamBuffer );
         }
         else
         {
@@ -804,6 +833,7 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
             prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            prvEXECUTOR_OBJECT_CHANGED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
         }
         else
         {
@@ -959,6 +989,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         {
             traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
             prvRECEIVE_COMPLETED( xStreamBuffer );
+            prvEXECUTOR_OBJECT_CHANGED( xStreamBuffer );
         }
         else
         {
@@ -1055,6 +1086,7 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
         if( xReceivedLength != ( size_t ) 0 )
         {
             prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            prvEXECUTOR_OBJECT_CHANGED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
         }
         else
         {
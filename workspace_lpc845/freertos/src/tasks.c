@@ -41,6 +41,18 @@
 #include "timers.h"
 #include "stack_macros.h"
 
+#if ( configUSE_KERNEL_OBJECT_TABLES == 1 )
+    #include "kernel_objects.h"
+#endif
+
+#if ( configUSE_DEFERRED_WORK == 1 )
+    #include "deferred_work.h"
+#endif
+
+#if ( configUSE_MULTI_WAIT == 1 )
+    #include "multi_wait.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
@@ -58,6 +70,13 @@
     #include <stdio.h>
 #endif /* configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) */
 
+#if ( configUSE_STACK_PROFILING == 1 )
+
+/* vTaskGetStackReport() formats its report with vsnprintf(). */
+    #include <stdarg.h>
+    #include <stdio.h>
+#endif
+
 #if ( configUSE_PREEMPTION == 0 )
 
 /* If the cooperative scheduler is being used then a yield should not be
@@ -78,6 +97,10 @@
  */
 #define tskSTACK_FILL_BYTE                        ( 0xa5U )
 
+/* Words left unfilled below the stack pointer when the interrupt stack is
+ * filled for stack profiling. */
+#define tskISR_STACK_FILL_GAP                     ( 16 )
+
 /* Bits used to record how a task's stack and TCB were allocated. */
 #define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB    ( ( uint8_t ) 0 )
 #define tskSTATICALLY_ALLOCATED_STACK_ONLY        ( ( uint8_t ) 1 )
@@ -86,7 +109,7 @@
 /* If any of the following are set then task stacks are filled with a known
  * value so the high water mark can be determined.  If none of the following are
  * set then don't fill the stack so there is no unnecessary dependency on memset. */
-#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILING == 1 ) )
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    1
 #else
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    0
@@ -394,6 +417,15 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t
 
 #endif
 
+#if ( configUSE_STACK_PROFILING == 1 )
+
+/* Interrupt nesting as counted by taskSTACK_PROFILE_ISR_ENTER() and
+ * taskSTACK_PROFILE_ISR_EXIT(), and the deepest nesting seen. */
+    PRIVILEGED_DATA static volatile UBaseType_t uxISRNesting = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static volatile UBaseType_t uxISRNestingHighWaterMark = ( UBaseType_t ) 0U;
+
+#endif
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -489,12 +521,42 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  * This function determines the 'high water mark' of the task stack by
  * determining how much of the stack remains at the original preset value.
  */
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILING == 1 ) )
 
     static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configUSE_STACK_PROFILING == 1 )
+
+/*
+ * Appends a line to the stack report for each task in pxList.  Returns pdFALSE
+ * once the buffer is full.
+ */
+    static BaseType_t prvWriteStackReportForList( List_t * pxList,
+                                                  char ** ppcWriteBuffer,
+                                                  size_t * pxBufferLength ) PRIVILEGED_FUNCTION;
+
+/*
+ * Appends one line to the stack report, unless it does not fit.
+ */
+    static BaseType_t prvWriteStackReportLine( char ** ppcWriteBuffer,
+                                               size_t * pxBufferLength,
+                                               const char * pcFormat,
+                                               ... ) PRIVILEGED_FUNCTION;
+
+    #ifdef portISR_STACK_LIMIT
+
+/*
+ * Fills the unused part of the interrupt stack with the known value, so its
+ * high water mark can be found as for task stacks.  Called with interrupts
+ * disabled before the scheduler starts.
+ */
+        static void prvFillISRStack( void ) PRIVILEGED_FUNCTION;
+
+    #endif
+#endif /* configUSE_STACK_PROFILING */
+
 /*
  * Return the amount of time, in ticks, that will pass before the kernel will
  * next move a task from the Blocked state to the Running state.
@@ -1139,6 +1201,13 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            #if ( configUSE_MULTI_WAIT == 1 )
+            {
+                /* Stop objects that change waking the deleted task. */
+                vMultiWaitRemoveTask( pxTCB );
+            }
+            #endif
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -1955,6 +2024,14 @@ void vTaskStartScheduler( void )
 {
     BaseType_t xReturn;
 
+    #if ( configUSE_KERNEL_OBJECT_TABLES == 1 )
+    {
+        /* Create the tasks, queues and buffers defined with the kobj macros,
+         * unless the application has already done so. */
+        ( void ) xKernelObjectsCreate();
+    }
+    #endif /* configUSE_KERNEL_OBJECT_TABLES */
+
     /* Add the idle task at the lowest priority. */
     #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
     {
@@ -2007,6 +2084,19 @@ void vTaskStartScheduler( void )
     }
     #endif /* configUSE_TIMERS */
 
+    #if ( configUSE_DEFERRED_WORK == 1 )
+    {
+        if( xReturn == pdPASS )
+        {
+            xReturn = xDeferredWorkCreateTasks();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_DEFERRED_WORK */
+
     if( xReturn == pdPASS )
     {
         /* freertos_tasks_c_additions_init() should only be called if the user
@@ -2025,6 +2115,12 @@ void vTaskStartScheduler( void )
          * starts to run. */
         portDISABLE_INTERRUPTS();
 
+        #if ( configUSE_STACK_PROFILING == 1 ) && defined( portISR_STACK_LIMIT )
+        {
+            prvFillISRStack();
+        }
+        #endif
+
         #if ( ( configUSE_NEWLIB_REENTRANT == 1 ) || ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 ) )
         {
             /* Switch C-Runtime's TLS Block to point to the TLS
@@ -2163,6 +2259,19 @@ void vTaskSuspendAll( void )
         else
         {
             xReturn = xNextTaskUnblockTime - xTickCount;
+
+            #if ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 1 )
+            {
+                /* Timers are expired by the tick interrupt, so the tick must
+                 * not be suppressed past the next expiry either. */
+                TickType_t xTicksToTimerExpiry = xTimerGetTicksToNextExpiry();
+
+                if( xTicksToTimerExpiry < xReturn )
+                {
+                    xReturn = xTicksToTimerExpiry;
+                }
+            }
+            #endif
         }
 
         return xReturn;
@@ -2580,12 +2689,33 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
 
     void vTaskStepTick( TickType_t xTicksToJump )
     {
+        BaseType_t xPendLastTick = pdFALSE;
+
         /* Correct the tick count value after a period during which the tick
          * was suppressed.  Note this does *not* call the tick hook function for
          * each stepped tick. */
         configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
 
         if( ( xTickCount + xTicksToJump ) == xNextTaskUnblockTime )
+        {
+            xPendLastTick = pdTRUE;
+        }
+
+        #if ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 1 )
+        {
+            TickType_t xTicksToTimerExpiry = xTimerGetTicksToNextExpiry();
+
+            /* Likewise the tick that expires the next software timer. */
+            configASSERT( xTicksToJump <= xTicksToTimerExpiry );
+
+            if( xTicksToJump == xTicksToTimerExpiry )
+            {
+                xPendLastTick = pdTRUE;
+            }
+        }
+        #endif
+
+        if( xPendLastTick != pdFALSE )
         {
             /* Arrange for xTickCount to reach xNextTaskUnblockTime in
              * xTaskIncrementTick() when the scheduler resumes.  This ensures
@@ -2608,6 +2738,12 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
 
         xTickCount += xTicksToJump;
         traceINCREASE_TICK_COUNT( xTicksToJump );
+
+        #if ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 1 )
+        {
+            vTimerStepTicks( xTicksToJump );
+        }
+        #endif
     }
 
 #endif /* configUSE_TICKLESS_IDLE */
@@ -2833,6 +2969,26 @@ BaseType_t xTaskIncrementTick( void )
             }
         }
 
+        /* Expire the software timers when they run from the tick rather than
+         * from the timer service task.  A switch is only requested when a
+         * deferred callback wakes the task that runs it. */
+        #if ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 1 )
+        {
+            if( xTimerIncrementTick() != pdFALSE )
+            {
+                #if ( configUSE_PREEMPTION == 1 )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 1 ) */
+
         /* Tasks of equal priority to the currently running task will share
          * processing time (time slice) if preemption is on, and the application
          * writer has not explicitly turned time slicing off. */
@@ -3131,6 +3287,36 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
 }
 /*-----------------------------------------------------------*/
 
+void vTaskInsertOnUnorderedEventList( List_t * pxEventList,
+                                      const TickType_t xItemValue )
+{
+    configASSERT( pxEventList );
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED AND FROM A
+     * CRITICAL SECTION.  It is used by the event groups implementation, whose
+     * event lists are also walked by interrupts that set bits.  Only the event
+     * list is updated here, vTaskBlockOnEventList() moves the task to the
+     * delayed list once the critical section has been exited. */
+    configASSERT( uxSchedulerSuspended != 0 );
+
+    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+}
+/*-----------------------------------------------------------*/
+
+void vTaskBlockOnEventList( const TickType_t xTicksToWait )
+{
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED, after
+     * vTaskInsertOnUnorderedEventList().  An interrupt may already have removed
+     * the task from the event list, in which case the task is on the pending
+     * ready list and xTaskResumeAll() moves it back to a ready list from the
+     * delayed list. */
+    configASSERT( uxSchedulerSuspended != 0 );
+
+    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TIMERS == 1 )
 
     void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
@@ -3283,6 +3469,59 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 }
 /*-----------------------------------------------------------*/
 
+BaseType_t xTaskRemoveItemFromEventList( ListItem_t * pxEventListItem,
+                                         const TickType_t xItemValue )
+{
+    TCB_t * pxUnblockedTCB;
+    BaseType_t xReturn;
+
+    /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+     * called from a critical section within an ISR.  It is the unordered
+     * counterpart of xTaskRemoveFromEventList(), used by event groups to remove
+     * any waiting task rather than the head of the event list. */
+
+    /* Store the new item value in the event list item. */
+    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+    configASSERT( pxUnblockedTCB );
+    listREMOVE_ITEM( pxEventListItem );
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+    {
+        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+        prvAddTaskToReadyList( pxUnblockedTCB );
+
+        #if ( configUSE_TICKLESS_IDLE != 0 )
+        {
+            /* See xTaskRemoveFromEventList(). */
+            prvResetNextTaskUnblockTime();
+        }
+        #endif
+    }
+    else
+    {
+        /* The delayed and ready lists cannot be accessed, so hold this task
+         * pending until the scheduler is resumed. */
+        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+    }
+
+    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    {
+        /* As in xTaskRemoveFromEventList(), also mark the yield as pending for
+         * callers that do not use the return value. */
+        xReturn = pdTRUE;
+        xYieldPending = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
     configASSERT( pxTimeOut );
@@ -3853,7 +4092,7 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILING == 1 ) )
 
     static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
     {
@@ -3870,7 +4109,7 @@ static void prvCheckTasksWaitingTermination( void )
         return ( configSTACK_DEPTH_TYPE ) ulCount;
     }
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_STACK_PROFILING == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
@@ -3941,6 +4180,211 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STACK_PROFILING == 1 )
+
+    void vTaskStackProfileISREnter( void )
+    {
+        /* Interrupts nest strictly, so an interrupt that preempts this
+         * increment has restored uxISRNesting by the time it returns. */
+        const UBaseType_t uxNesting = uxISRNesting + ( UBaseType_t ) 1U;
+
+        uxISRNesting = uxNesting;
+
+        if( uxNesting > uxISRNestingHighWaterMark )
+        {
+            uxISRNestingHighWaterMark = uxNesting;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskStackProfileISRExit( void )
+    {
+        uxISRNesting--;
+    }
+/*-----------------------------------------------------------*/
+
+    #ifdef portISR_STACK_LIMIT
+
+        static void prvFillISRStack( void )
+        {
+            StackType_t * pxStackPointer;
+            uint8_t * pucByte;
+
+            if( portISR_STACK_LIMIT != NULL )
+            {
+                portGET_STACK_POINTER( pxStackPointer );
+
+                /* Stop short of the stack pointer, so the fill does not reach
+                 * anything this function or its callers still use.  The gap is
+                 * reported as used. */
+                pxStackPointer -= tskISR_STACK_FILL_GAP;
+
+                for( pucByte = ( uint8_t * ) portISR_STACK_LIMIT; pucByte < ( uint8_t * ) pxStackPointer; pucByte++ )
+                {
+                    *pucByte = ( uint8_t ) tskSTACK_FILL_BYTE;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* portISR_STACK_LIMIT */
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWriteStackReportLine( char ** ppcWriteBuffer,
+                                               size_t * pxBufferLength,
+                                               const char * pcFormat,
+                                               ... )
+    {
+        va_list xArguments;
+        int iLength;
+        BaseType_t xReturn = pdFALSE;
+
+        va_start( xArguments, pcFormat );
+        iLength = vsnprintf( *ppcWriteBuffer, *pxBufferLength, pcFormat, xArguments ); /*lint !e586 vsnprintf() allowed as this is a debug aid, not part of the core kernel implementation. */
+        va_end( xArguments );
+
+        if( ( iLength >= 0 ) && ( ( size_t ) iLength < *pxBufferLength ) )
+        {
+            *ppcWriteBuffer += iLength;
+            *pxBufferLength -= ( size_t ) iLength;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            /* Drop the partial line. */
+            **ppcWriteBuffer = ( char ) 0x00;
+            *pxBufferLength = 0;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWriteStackReportForList( List_t * pxList,
+                                                  char ** ppcWriteBuffer,
+                                                  size_t * pxBufferLength )
+    {
+        configLIST_VOLATILE TCB_t * pxNextTCB;
+        configLIST_VOLATILE TCB_t * pxFirstTCB;
+        uint32_t ulSize;
+        uint32_t ulFree;
+        BaseType_t xReturn = pdTRUE;
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            do
+            {
+                listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                ulSize = ( uint32_t ) ( pxNextTCB->pxEndOfStack - pxNextTCB->pxStack ) + 1UL;
+
+                #if ( portSTACK_GROWTH > 0 )
+                {
+                    ulFree = ( uint32_t ) prvTaskCheckFreeStackSpace( ( uint8_t * ) pxNextTCB->pxEndOfStack );
+                }
+                #else
+                {
+                    ulFree = ( uint32_t ) prvTaskCheckFreeStackSpace( ( uint8_t * ) pxNextTCB->pxStack );
+                }
+                #endif
+
+                xReturn = prvWriteStackReportLine( ppcWriteBuffer, pxBufferLength, "task\t%s\t%lu\t%lu\r\n",
+                                                   pxNextTCB->pcTaskName,
+                                                   ( unsigned long ) ulSize,
+                                                   ( unsigned long ) ( ulSize - ulFree ) );
+            } while( ( pxNextTCB != pxFirstTCB ) && ( xReturn != pdFALSE ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetStackReport( char * pcWriteBuffer,
+                              size_t xBufferLength )
+    {
+        UBaseType_t uxQueue = configMAX_PRIORITIES;
+        uint32_t ulISRStackSize = 0UL;
+        uint32_t ulISRStackUsed = 0UL;
+        BaseType_t xSpace;
+
+        configASSERT( pcWriteBuffer );
+        configASSERT( xBufferLength > ( size_t ) 0 );
+
+        /* Make sure the write buffer does not contain a string. */
+        *pcWriteBuffer = ( char ) 0x00;
+
+        xSpace = prvWriteStackReportLine( &pcWriteBuffer, &xBufferLength, "stack-report\t1\t%u\r\n", ( unsigned int ) sizeof( StackType_t ) );
+
+        vTaskSuspendAll();
+        {
+            /* The same lists as uxTaskGetSystemState(). */
+            while( ( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ) && ( xSpace != pdFALSE ) )
+            {
+                uxQueue--;
+                xSpace = prvWriteStackReportForList( &( pxReadyTasksLists[ uxQueue ] ), &pcWriteBuffer, &xBufferLength );
+            }
+
+            if( xSpace != pdFALSE )
+            {
+                xSpace = prvWriteStackReportForList( ( List_t * ) pxDelayedTaskList, &pcWriteBuffer, &xBufferLength );
+            }
+
+            if( xSpace != pdFALSE )
+            {
+                xSpace = prvWriteStackReportForList( ( List_t * ) pxOverflowDelayedTaskList, &pcWriteBuffer, &xBufferLength );
+            }
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+            {
+                if( xSpace != pdFALSE )
+                {
+                    xSpace = prvWriteStackReportForList( &xTasksWaitingTermination, &pcWriteBuffer, &xBufferLength );
+                }
+            }
+            #endif
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+            {
+                if( xSpace != pdFALSE )
+                {
+                    xSpace = prvWriteStackReportForList( &xSuspendedTaskList, &pcWriteBuffer, &xBufferLength );
+                }
+            }
+            #endif
+        }
+        ( void ) xTaskResumeAll();
+
+        #ifdef portISR_STACK_LIMIT
+        {
+            if( portISR_STACK_LIMIT != NULL )
+            {
+                ulISRStackSize = ( uint32_t ) ( portISR_STACK_TOP - portISR_STACK_LIMIT );
+                ulISRStackUsed = ulISRStackSize - ( uint32_t ) prvTaskCheckFreeStackSpace( ( uint8_t * ) portISR_STACK_LIMIT );
+            }
+        }
+        #endif
+
+        if( xSpace != pdFALSE )
+        {
+            ( void ) prvWriteStackReportLine( &pcWriteBuffer, &xBufferLength, "isr\t%lu\t%lu\t%u\r\n",
+                                              ( unsigned long ) ulISRStackSize,
+                                              ( unsigned long ) ulISRStackUsed,
+                                              ( unsigned int ) uxISRNestingHighWaterMark );
+        }
+    }
+
+#endif /* configUSE_STACK_PROFILING */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_vTaskDelete == 1 )
 
     static void prvDeleteTCB( TCB_t * pxTCB )
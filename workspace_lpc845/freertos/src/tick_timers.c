@@ -0,0 +1,869 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Software timers without the timer service task.  Selected instead of
+ * timers.c by setting configTIMERS_RUN_FROM_TICK to 1 in FreeRTOSConfig.h.
+ *
+ * Active timers are kept in a list sorted by expiry time, each holding the
+ * number of ticks between its own expiry and that of the timer in front of it.
+ * The tick interrupt only decrements the first entry, and calls the callbacks
+ * of the timers that reach zero directly from xTaskIncrementTick().  The API
+ * functions act on the list at once instead of posting commands to a queue, so
+ * no timer task stack, timer queue or context switch is needed.
+ *
+ * Callbacks therefore run in interrupt context: they must be short and must
+ * not block.  Other than the timer functions in this file, which only mask
+ * interrupts and so may be called from a callback, they must only call API
+ * functions that end in "FromISR".  xTimerDelete() is the exception: freeing a
+ * timer created with xTimerCreate() suspends the scheduler, so such a timer
+ * must be deleted from a task or a deferred callback.  When
+ * configTIMER_DEFERRED_CALLBACKS is 1, callbacks marked with
+ * vTimerSetDeferredCallback() are instead run by a task created at
+ * configTIMER_TASK_PRIORITY, which the tick interrupt notifies.
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+/* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
+ * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e9021 !e961 !e750. */
+
+#if ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 1 )
+
+    #if ( INCLUDE_xTimerPendFunctionCall == 1 )
+        #error xTimerPendFunctionCall() needs the timer service task, set configTIMERS_RUN_FROM_TICK to 0 to use it.
+    #endif
+
+    #if ( configTIMER_DEFERRED_CALLBACKS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to run deferred timer callbacks.
+    #endif
+
+/* The name assigned to the task that runs deferred callbacks.  This can be
+ * overridden by defining configTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
+    #ifndef configTIMER_SERVICE_TASK_NAME
+        #define configTIMER_SERVICE_TASK_NAME    "Tmr Svc"
+    #endif
+
+/* Bit definitions used in the ucStatus member of a timer structure. */
+    #define tmrSTATUS_IS_ACTIVE                  ( ( uint8_t ) 0x01 )
+    #define tmrSTATUS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 0x02 )
+    #define tmrSTATUS_IS_AUTORELOAD              ( ( uint8_t ) 0x04 )
+    #define tmrSTATUS_IS_DEFERRED                ( ( uint8_t ) 0x08 )
+    #define tmrSTATUS_IS_PENDING                 ( ( uint8_t ) 0x10 )
+
+/* The definition of the timers themselves.  The struct tag matches timers.c
+ * as TimerHandle_t is declared from it. */
+    typedef struct tmrTimerControl
+    {
+        const char * pcTimerName;                   /*<< Text name.  This is not used by the kernel, it is included simply to make debugging easier. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+        struct tmrTimerControl * pxNext;            /*<< Next timer in the active list. */
+        TickType_t xDelta;                          /*<< Ticks from the expiry of the previous timer in the active list, or from now for the first one. */
+        TickType_t xTimerPeriodInTicks;             /*<< How quickly and often the timer expires. */
+        void * pvTimerID;                           /*<< An ID to identify the timer.  This allows the timer to be identified when the same callback is used for multiple timers. */
+        TimerCallbackFunction_t pxCallbackFunction; /*<< The function that will be called when the timer expires. */
+        #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+            struct tmrTimerControl * pxNextPending; /*<< Next timer waiting for its deferred callback to run. */
+        #endif
+        #if ( configUSE_TRACE_FACILITY == 1 )
+            UBaseType_t uxTimerNumber;              /*<< An ID assigned by trace tools such as FreeRTOS+Trace */
+        #endif
+        uint8_t ucStatus;                           /*<< Holds bits to say if the timer was statically allocated or not, if it is active or not, and how its callback is run. */
+    } xTIMER;
+
+    typedef xTIMER Timer_t;
+
+/*lint -save -e956 A manual analysis and inspection has been used to determine
+ * which static variables must be declared volatile. */
+
+/* The first active timer, the one that expires next.  Accessed from the tick
+ * interrupt, so only ever modified inside a critical section. */
+    PRIVILEGED_DATA static Timer_t * volatile pxActiveTimers = NULL;
+
+/* Set while xTimerIncrementTick() runs callbacks in the tick interrupt. */
+    PRIVILEGED_DATA static BaseType_t xInTickCallbacks = pdFALSE;
+
+    #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+
+/* Expired timers whose callback waits for the deferred callback task, oldest
+ * first. */
+        PRIVILEGED_DATA static Timer_t * pxPendingHead = NULL;
+        PRIVILEGED_DATA static Timer_t * pxPendingTail = NULL;
+
+        PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
+
+    #endif
+
+/*lint -restore */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called after a Timer_t structure has been allocated either statically or
+ * dynamically to fill in the structure's members.
+ */
+    static void prvInitialiseNewTimer( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                       const TickType_t xTimerPeriodInTicks,
+                                       const BaseType_t xAutoReload,
+                                       void * const pvTimerID,
+                                       TimerCallbackFunction_t pxCallbackFunction,
+                                       Timer_t * pxNewTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert the timer in the active list to expire xTicks ticks from now.  Must be
+ * called from a critical section, with the timer not in the list.
+ */
+    static void prvInsertTimer( Timer_t * const pxTimer,
+                                TickType_t xTicks ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove the timer from the active list, and from the list of pending deferred
+ * callbacks, if it is in them.  Must be called from a critical section.
+ */
+    static void prvRemoveTimer( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+    #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+
+/*
+ * The task that runs the deferred callbacks.
+ */
+        static portTASK_FUNCTION_PROTO( prvTimerTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+    #endif
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTimerCreateTimerTask( void )
+    {
+        BaseType_t xReturn = pdPASS;
+
+        /* This function is called when the scheduler is started.  A task is only
+         * needed to run deferred callbacks. */
+        #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+        {
+            #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+            {
+                StaticTask_t * pxTimerTaskTCBBuffer = NULL;
+                StackType_t * pxTimerTaskStackBuffer = NULL;
+                uint32_t ulTimerTaskStackSize;
+
+                vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
+                xTimerTaskHandle = xTaskCreateStatic( prvTimerTask,
+                                                      configTIMER_SERVICE_TASK_NAME,
+                                                      ulTimerTaskStackSize,
+                                                      NULL,
+                                                      ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+                                                      pxTimerTaskStackBuffer,
+                                                      pxTimerTaskTCBBuffer );
+
+                if( xTimerTaskHandle == NULL )
+                {
+                    xReturn = pdFAIL;
+                }
+            }
+            #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+            {
+                xReturn = xTaskCreate( prvTimerTask,
+                                       configTIMER_SERVICE_TASK_NAME,
+                                       configTIMER_TASK_STACK_DEPTH,
+                                       NULL,
+                                       ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
+                                       &xTimerTaskHandle );
+            }
+            #endif /* configSUPPORT_STATIC_ALLOCATION */
+        }
+        #endif /* configTIMER_DEFERRED_CALLBACKS */
+
+        configASSERT( xReturn );
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        TimerHandle_t xTimerCreate( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                    const TickType_t xTimerPeriodInTicks,
+                                    const BaseType_t xAutoReload,
+                                    void * const pvTimerID,
+                                    TimerCallbackFunction_t pxCallbackFunction )
+        {
+            Timer_t * pxNewTimer;
+
+            pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of Timer_t is always a pointer to the timer's mame. */
+
+            if( pxNewTimer != NULL )
+            {
+                pxNewTimer->ucStatus = 0x00;
+                prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction, pxNewTimer );
+            }
+
+            return pxNewTimer;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        TimerHandle_t xTimerCreateStatic( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                          const TickType_t xTimerPeriodInTicks,
+                                          const BaseType_t xAutoReload,
+                                          void * const pvTimerID,
+                                          TimerCallbackFunction_t pxCallbackFunction,
+                                          StaticTimer_t * pxTimerBuffer )
+        {
+            Timer_t * pxNewTimer;
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* StaticTimer_t is sized for the timer of timers.c, which is
+                 * at least as large as the timer used here. */
+                volatile size_t xSize = sizeof( StaticTimer_t );
+                configASSERT( xSize >= sizeof( Timer_t ) );
+                ( void ) xSize; /* Keeps lint quiet when configASSERT() is not defined. */
+            }
+            #endif /* configASSERT_DEFINED */
+
+            /* A pointer to a StaticTimer_t structure MUST be provided, use it. */
+            configASSERT( pxTimerBuffer );
+            pxNewTimer = ( Timer_t * ) pxTimerBuffer; /*lint !e740 !e9087 StaticTimer_t is at least as large as Timer_t and has the same alignment. */
+
+            if( pxNewTimer != NULL )
+            {
+                pxNewTimer->ucStatus = tmrSTATUS_IS_STATICALLY_ALLOCATED;
+                prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction, pxNewTimer );
+            }
+
+            return pxNewTimer;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewTimer( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                       const TickType_t xTimerPeriodInTicks,
+                                       const BaseType_t xAutoReload,
+                                       void * const pvTimerID,
+                                       TimerCallbackFunction_t pxCallbackFunction,
+                                       Timer_t * pxNewTimer )
+    {
+        /* 0 is not a valid value for xTimerPeriodInTicks. */
+        configASSERT( ( xTimerPeriodInTicks > 0 ) );
+
+        pxNewTimer->pcTimerName = pcTimerName;
+        pxNewTimer->pxNext = NULL;
+        pxNewTimer->xDelta = 0;
+        pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
+        pxNewTimer->pvTimerID = pvTimerID;
+        pxNewTimer->pxCallbackFunction = pxCallbackFunction;
+
+        #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+        {
+            pxNewTimer->pxNextPending = NULL;
+        }
+        #endif
+
+        if( xAutoReload != pdFALSE )
+        {
+            pxNewTimer->ucStatus |= tmrSTATUS_IS_AUTORELOAD;
+        }
+
+        traceTIMER_CREATE( pxNewTimer );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInsertTimer( Timer_t * const pxTimer,
+                                TickType_t xTicks )
+    {
+        Timer_t * volatile * ppxLink = &pxActiveTimers;
+        Timer_t * pxNext;
+
+        /* Walk past the timers that expire no later than this one, so timers
+         * that expire on the same tick are called in the order they were
+         * started. */
+        for( pxNext = *ppxLink; ( pxNext != NULL ) && ( pxNext->xDelta <= xTicks ); pxNext = *ppxLink )
+        {
+            xTicks -= pxNext->xDelta;
+            ppxLink = &( pxNext->pxNext );
+        }
+
+        /* The following timer now expires relative to this one. */
+        if( pxNext != NULL )
+        {
+            pxNext->xDelta -= xTicks;
+        }
+
+        pxTimer->xDelta = xTicks;
+        pxTimer->pxNext = pxNext;
+        *ppxLink = pxTimer;
+        pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRemoveTimer( Timer_t * const pxTimer )
+    {
+        Timer_t * volatile * ppxLink;
+
+        if( ( pxTimer->ucStatus & tmrSTATUS_IS_ACTIVE ) != 0U )
+        {
+            for( ppxLink = &pxActiveTimers; *ppxLink != pxTimer; ppxLink = &( ( *ppxLink )->pxNext ) )
+            {
+                /* A timer marked active is always in the list. */
+                configASSERT( *ppxLink != NULL );
+            }
+
+            /* The following timer keeps its expiry time. */
+            if( pxTimer->pxNext != NULL )
+            {
+                pxTimer->pxNext->xDelta += pxTimer->xDelta;
+            }
+
+            *ppxLink = pxTimer->pxNext;
+            pxTimer->pxNext = NULL;
+            pxTimer->ucStatus &= ( uint8_t ) ~tmrSTATUS_IS_ACTIVE;
+        }
+
+        #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+        {
+            Timer_t * pxPrevious = NULL;
+            Timer_t * pxPending;
+
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_PENDING ) != 0U )
+            {
+                for( pxPending = pxPendingHead; pxPending != pxTimer; pxPending = pxPending->pxNextPending )
+                {
+                    configASSERT( pxPending != NULL );
+                    pxPrevious = pxPending;
+                }
+
+                if( pxPrevious == NULL )
+                {
+                    pxPendingHead = pxTimer->pxNextPending;
+                }
+                else
+                {
+                    pxPrevious->pxNextPending = pxTimer->pxNextPending;
+                }
+
+                if( pxPendingTail == pxTimer )
+                {
+                    pxPendingTail = pxPrevious;
+                }
+
+                pxTimer->pxNextPending = NULL;
+                pxTimer->ucStatus &= ( uint8_t ) ~tmrSTATUS_IS_PENDING;
+            }
+        }
+        #endif /* configTIMER_DEFERRED_CALLBACKS */
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTimerGenericCommand( TimerHandle_t xTimer,
+                                     const BaseType_t xCommandID,
+                                     const TickType_t xOptionalValue,
+                                     BaseType_t * const pxHigherPriorityTaskWoken,
+                                     const TickType_t xTicksToWait )
+    {
+        Timer_t * pxTimer = xTimer;
+        BaseType_t xReturn = pdPASS;
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xDeleteTimer = pdFALSE;
+
+        /* Commands are carried out at once, so never need to wait or wake a
+         * task. */
+        ( void ) xTicksToWait;
+        ( void ) pxHigherPriorityTaskWoken;
+
+        configASSERT( xTimer );
+
+        /* Interrupts are masked rather than a critical section entered, even
+         * for the task versions of the commands, as callbacks running in the
+         * tick interrupt commonly restart or stop timers. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            switch( xCommandID )
+            {
+                case tmrCOMMAND_START:
+                case tmrCOMMAND_START_DONT_TRACE:
+                case tmrCOMMAND_START_FROM_ISR:
+                case tmrCOMMAND_RESET:
+                case tmrCOMMAND_RESET_FROM_ISR:
+                    /* Expire one period from now.  The expiry is counted from
+                     * the time of the call rather than from xOptionalValue as
+                     * the command does not wait in a queue. */
+                    prvRemoveTimer( pxTimer );
+                    prvInsertTimer( pxTimer, pxTimer->xTimerPeriodInTicks );
+                    break;
+
+                case tmrCOMMAND_STOP:
+                case tmrCOMMAND_STOP_FROM_ISR:
+                    prvRemoveTimer( pxTimer );
+                    break;
+
+                case tmrCOMMAND_CHANGE_PERIOD:
+                case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
+                    /* The new period is counted from now and starts the timer,
+                     * as in timers.c. */
+                    configASSERT( ( xOptionalValue > 0 ) );
+                    pxTimer->xTimerPeriodInTicks = xOptionalValue;
+                    prvRemoveTimer( pxTimer );
+                    prvInsertTimer( pxTimer, xOptionalValue );
+                    break;
+
+                case tmrCOMMAND_DELETE:
+                    prvRemoveTimer( pxTimer );
+                    xDeleteTimer = pdTRUE;
+                    break;
+
+                default:
+                    xReturn = pdFAIL;
+                    break;
+            }
+        }
+
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        /* The timer is out of both lists, so can be freed outside the critical
+         * section. */
+        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        {
+            if( ( xDeleteTimer != pdFALSE ) && ( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == 0U ) )
+            {
+                /* vPortFree() suspends the scheduler, which can't be done from
+                 * the tick interrupt or any other. */
+                configASSERT( xInTickCallbacks == pdFALSE );
+                portASSERT_IF_IN_ISR();
+                vPortFree( pxTimer );
+            }
+        }
+        #else
+        {
+            ( void ) xDeleteTimer;
+        }
+        #endif
+
+        traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTimerIncrementTick( void )
+    {
+        Timer_t * pxTimer;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* Called from xTaskIncrementTick() with interrupts masked, once per
+         * tick, so only the first timer's delta has to change. */
+        pxTimer = pxActiveTimers;
+
+        if( pxTimer != NULL )
+        {
+            xInTickCallbacks = pdTRUE;
+
+            if( pxTimer->xDelta > ( TickType_t ) 0U )
+            {
+                pxTimer->xDelta--;
+            }
+
+            while( ( pxTimer != NULL ) && ( pxTimer->xDelta == ( TickType_t ) 0U ) )
+            {
+                /* Take the timer off the list, and put it back one period later
+                 * if it reloads, before the callback can restart or stop it. */
+                pxActiveTimers = pxTimer->pxNext;
+                pxTimer->pxNext = NULL;
+                pxTimer->ucStatus &= ( uint8_t ) ~tmrSTATUS_IS_ACTIVE;
+
+                if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+                {
+                    prvInsertTimer( pxTimer, pxTimer->xTimerPeriodInTicks );
+                }
+
+                traceTIMER_EXPIRED( pxTimer );
+
+                #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+                    if( ( pxTimer->ucStatus & tmrSTATUS_IS_DEFERRED ) != 0U )
+                    {
+                        /* A callback still waiting to run from an earlier expiry
+                         * runs once for both. */
+                        if( ( pxTimer->ucStatus & tmrSTATUS_IS_PENDING ) == 0U )
+                        {
+                            pxTimer->ucStatus |= tmrSTATUS_IS_PENDING;
+                            pxTimer->pxNextPending = NULL;
+
+                            if( pxPendingTail == NULL )
+                            {
+                                pxPendingHead = pxTimer;
+                            }
+                            else
+                            {
+                                pxPendingTail->pxNextPending = pxTimer;
+                            }
+
+                            pxPendingTail = pxTimer;
+                        }
+
+                        vTaskNotifyGiveFromISR( xTimerTaskHandle, &xSwitchRequired );
+                    }
+                    else
+                #endif /* configTIMER_DEFERRED_CALLBACKS */
+                {
+                    pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                }
+
+                pxTimer = pxActiveTimers;
+            }
+
+            xInTickCallbacks = pdFALSE;
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    TickType_t xTimerGetTicksToNextExpiry( void )
+    {
+        TickType_t xReturn = portMAX_DELAY;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Called by the idle task with the scheduler suspended. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( pxActiveTimers != NULL )
+            {
+                xReturn = pxActiveTimers->xDelta;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTimerStepTicks( const TickType_t xTicksToJump )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Ticks that were suppressed in tickless idle.  The idle time is limited
+         * by xTimerGetTicksToNextExpiry(), and the tick that expires the first
+         * timer is left to xTaskIncrementTick().  The ports call this with
+         * interrupts disabled, which a critical section would re-enable. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( pxActiveTimers != NULL )
+            {
+                configASSERT( xTicksToJump < pxActiveTimers->xDelta );
+                pxActiveTimers->xDelta -= xTicksToJump;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+
+        static portTASK_FUNCTION( prvTimerTask, pvParameters )
+        {
+            Timer_t * pxTimer;
+
+            /* Just to avoid compiler warnings. */
+            ( void ) pvParameters;
+
+            for( ; ; )
+            {
+                ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+                for( ; ; )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        pxTimer = pxPendingHead;
+
+                        if( pxTimer != NULL )
+                        {
+                            pxPendingHead = pxTimer->pxNextPending;
+
+                            if( pxPendingHead == NULL )
+                            {
+                                pxPendingTail = NULL;
+                            }
+
+                            pxTimer->pxNextPending = NULL;
+                            pxTimer->ucStatus &= ( uint8_t ) ~tmrSTATUS_IS_PENDING;
+                        }
+                    }
+                    taskEXIT_CRITICAL();
+
+                    if( pxTimer == NULL )
+                    {
+                        break;
+                    }
+
+                    /* Runs in task context, so the callback may use any API
+                     * function, including deleting its own timer. */
+                    pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                }
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        void vTimerSetDeferredCallback( TimerHandle_t xTimer,
+                                        const BaseType_t xDeferred )
+        {
+            Timer_t * pxTimer = xTimer;
+            UBaseType_t uxSavedInterruptStatus;
+
+            configASSERT( xTimer );
+            uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+            {
+                if( xDeferred != pdFALSE )
+                {
+                    pxTimer->ucStatus |= tmrSTATUS_IS_DEFERRED;
+                }
+                else
+                {
+                    pxTimer->ucStatus &= ( uint8_t ) ~tmrSTATUS_IS_DEFERRED;
+                }
+            }
+            portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        }
+
+    #endif /* configTIMER_DEFERRED_CALLBACKS */
+/*-----------------------------------------------------------*/
+
+    TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
+    {
+        TaskHandle_t xReturn = NULL;
+
+        /* Only the deferred callback task exists, and only once the scheduler
+         * has been started. */
+        #if ( configTIMER_DEFERRED_CALLBACKS == 1 )
+        {
+            xReturn = xTimerTaskHandle;
+        }
+        #endif
+
+        configASSERT( ( xReturn != NULL ) );
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    TickType_t xTimerGetPeriod( TimerHandle_t xTimer )
+    {
+        Timer_t * pxTimer = xTimer;
+
+        configASSERT( xTimer );
+        return pxTimer->xTimerPeriodInTicks;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTimerSetReloadMode( TimerHandle_t xTimer,
+                              const BaseType_t xAutoReload )
+    {
+        Timer_t * pxTimer = xTimer;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xTimer );
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( xAutoReload != pdFALSE )
+            {
+                pxTimer->ucStatus |= tmrSTATUS_IS_AUTORELOAD;
+            }
+            else
+            {
+                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_AUTORELOAD );
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTimerGetReloadMode( TimerHandle_t xTimer )
+    {
+        Timer_t * pxTimer = xTimer;
+        BaseType_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xTimer );
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) == 0 )
+            {
+                /* Not an auto-reload timer. */
+                xReturn = pdFALSE;
+            }
+            else
+            {
+                /* Is an auto-reload timer. */
+                xReturn = pdTRUE;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+
+    UBaseType_t uxTimerGetReloadMode( TimerHandle_t xTimer )
+    {
+        return ( UBaseType_t ) xTimerGetReloadMode( xTimer );
+    }
+/*-----------------------------------------------------------*/
+
+    TickType_t xTimerGetExpiryTime( TimerHandle_t xTimer )
+    {
+        Timer_t * pxTimer = xTimer;
+        Timer_t * pxActive;
+        TickType_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xTimer );
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            /* The expiry time is the sum of the deltas up to the timer.  As for
+             * timers.c the result is meaningless if the timer is not active. */
+            xReturn = xTaskGetTickCountFromISR();
+
+            for( pxActive = pxActiveTimers; pxActive != NULL; pxActive = pxActive->pxNext )
+            {
+                xReturn += pxActive->xDelta;
+
+                if( pxActive == pxTimer )
+                {
+                    break;
+                }
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    const char * pcTimerGetName( TimerHandle_t xTimer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    {
+        Timer_t * pxTimer = xTimer;
+
+        configASSERT( xTimer );
+        return pxTimer->pcTimerName;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer )
+    {
+        BaseType_t xReturn;
+        Timer_t * pxTimer = xTimer;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xTimer );
+
+        /* Is the timer in the list of active timers? */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_ACTIVE ) == 0 )
+            {
+                xReturn = pdFALSE;
+            }
+            else
+            {
+                xReturn = pdTRUE;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    } /*lint !e818 Can't be pointer to const due to the typedef. */
+/*-----------------------------------------------------------*/
+
+    void * pvTimerGetTimerID( const TimerHandle_t xTimer )
+    {
+        Timer_t * const pxTimer = xTimer;
+        void * pvReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xTimer );
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            pvReturn = pxTimer->pvTimerID;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTimerSetTimerID( TimerHandle_t xTimer,
+                           void * pvNewID )
+    {
+        Timer_t * const pxTimer = xTimer;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( xTimer );
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            pxTimer->pvTimerID = pvNewID;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TRACE_FACILITY == 1 )
+
+        UBaseType_t uxTimerGetTimerNumber( TimerHandle_t xTimer )
+        {
+            return ( ( Timer_t * ) xTimer )->uxTimerNumber;
+        }
+
+    #endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TRACE_FACILITY == 1 )
+
+        void vTimerSetTimerNumber( TimerHandle_t xTimer,
+                                   UBaseType_t uxTimerNumber )
+        {
+            ( ( Timer_t * ) xTimer )->uxTimerNumber = uxTimerNumber;
+        }
+
+    #endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#endif /* ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 1 ) */
@@ -53,8 +53,9 @@
 /* This entire source file will be skipped if the application is not configured
  * to include software timer functionality.  This #if is closed at the very bottom
  * of this file.  If you want to include software timer functionality then ensure
- * configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
-#if ( configUSE_TIMERS == 1 )
+ * configUSE_TIMERS is set to 1 in FreeRTOSConfig.h.  When configTIMERS_RUN_FROM_TICK
+ * is 1 the timers are provided by tick_timers.c instead. */
+#if ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 0 )
 
 /* Misc definitions. */
     #define tmrNO_DELAY                    ( ( TickType_t ) 0U )
@@ -1121,4 +1122,4 @@
 /* This entire source file will be skipped if the application is not configured
  * to include software timer functionality.  If you want to include software timer
  * functionality then ensure configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
-#endif /* configUSE_TIMERS == 1 */
+#endif /* ( configUSE_TIMERS == 1 ) && ( configTIMERS_RUN_FROM_TICK == 0 ) */
@@ -0,0 +1,321 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <string.h>
+
+#if defined( FREERTOS_PORT_POSIX )
+    #include <time.h>
+#endif
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+#if ( configUSE_TRACE_FACILITY != 1 )
+    #error configUSE_TRACE_FACILITY must be set to 1 to build trace_recorder.c
+#endif
+
+#if ( ( configTRACE_RECORDER_BUFFER_ENTRIES & ( configTRACE_RECORDER_BUFFER_ENTRIES - 1 ) ) != 0 )
+    #error configTRACE_RECORDER_BUFFER_ENTRIES must be a power of two
+#endif
+
+/* The application can time the records with its own free running 32-bit
+ * timer by defining both macros in FreeRTOSConfig.h.  The setup macro starts
+ * the timer and returns its frequency in Hz. */
+#ifndef configTRACE_RECORDER_SETUP_TIMESTAMP
+    #define configTRACE_RECORDER_SETUP_TIMESTAMP()    prvSetupTimestamp()
+    #define configTRACE_RECORDER_GET_TIMESTAMP()      prvGetTimestamp()
+    #define trcUSE_DEFAULT_TIMESTAMP    1
+#else
+    #define trcUSE_DEFAULT_TIMESTAMP    0
+#endif
+
+/* Frequency the default CTIMER timestamp is prescaled to. */
+#ifndef configTRACE_RECORDER_TIMESTAMP_HZ
+    #define configTRACE_RECORDER_TIMESTAMP_HZ    1000000UL
+#endif
+
+/* "FRTR", followed by the format version, at the start of the recorder data
+ * so the decoder can recognise a dump. */
+#define trcMAGIC                  ( 0x52545246UL )
+#define trcVERSION                ( 1UL )
+
+/* Names are stored padded to a multiple of four bytes, so every field of the
+ * recorder data is naturally aligned and the layout has no padding. */
+#define trcNAME_LENGTH            ( ( configMAX_TASK_NAME_LEN + 3 ) & ~3 )
+
+#if ( trcUSE_DEFAULT_TIMESTAMP == 1 ) && !defined( FREERTOS_PORT_POSIX )
+    /* CTIMER registers of the LPC845. */
+    #define trcSYSCON_SYSAHBCLKCTRL0_REG        ( *( ( volatile uint32_t * ) 0x40048080 ) )
+    #define trcSYSCON_PRESETCTRL0_REG           ( *( ( volatile uint32_t * ) 0x40048088 ) )
+    #define trcCTIMER_TCR_REG                   ( *( ( volatile uint32_t * ) 0x40038004 ) )
+    #define trcCTIMER_TC_REG                    ( *( ( volatile uint32_t * ) 0x40038008 ) )
+    #define trcCTIMER_PR_REG                    ( *( ( volatile uint32_t * ) 0x4003800c ) )
+    #define trcCTIMER_MCR_REG                   ( *( ( volatile uint32_t * ) 0x40038014 ) )
+    #define trcCTIMER_CTCR_REG                  ( *( ( volatile uint32_t * ) 0x40038070 ) )
+    #define trcSYSCON_CTIMER_BIT                ( 1UL << 25UL )
+    #define trcCTIMER_TCR_CEN_BIT               ( 1UL << 0UL )
+    #define trcCTIMER_TCR_CRST_BIT              ( 1UL << 1UL )
+#endif
+
+/*-----------------------------------------------------------*/
+
+typedef struct TraceRecord
+{
+    uint32_t ulTimestamp;
+    uint16_t usObject;  /* Task or queue number. */
+    uint8_t ucEvent;    /* One of the traceRECORDER_EVENT_ codes. */
+    uint8_t ucParam;
+} TraceRecord_t;
+
+typedef struct TraceSymbol
+{
+    uint16_t usObject;
+    uint8_t ucKind;     /* One of the traceRECORDER_SYMBOL_ kinds. */
+    uint8_t ucUnused;
+    char cName[ trcNAME_LENGTH ];
+} TraceSymbol_t;
+
+/* Layout read by tools/trace_decode.py, all fields little endian. */
+typedef struct TraceRecorderData
+{
+    uint32_t ulMagic;
+    uint32_t ulVersion;
+    uint32_t ulTimestampHz;
+    uint32_t ulBufferEntries;
+    uint32_t ulSymbolEntries;
+    uint32_t ulNameLength;
+    volatile uint32_t ulSymbolCount;   /* Number of symbol table entries in use. */
+    volatile uint32_t ulRecordCount;   /* Number of records ever written, the next one goes in slot ulRecordCount % ulBufferEntries. */
+    TraceSymbol_t xSymbols[ configTRACE_RECORDER_SYMBOLS ];
+    TraceRecord_t xRecords[ configTRACE_RECORDER_BUFFER_ENTRIES ];
+} TraceRecorderData_t;
+
+/* Not static so it can be dumped by name from the debugger. */
+TraceRecorderData_t xTraceRecorderData;
+
+static volatile BaseType_t xRecording = pdFALSE;
+
+static uint32_t ulNextQueueNumber = 0;
+
+/*-----------------------------------------------------------*/
+
+#if ( trcUSE_DEFAULT_TIMESTAMP == 1 )
+
+/*
+ * Start the free running timestamp timer, returning its frequency.
+ */
+    static uint32_t prvSetupTimestamp( void );
+
+/*
+ * Read the timestamp timer.
+ */
+    static uint32_t prvGetTimestamp( void );
+
+#endif /* trcUSE_DEFAULT_TIMESTAMP */
+
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( void )
+{
+    uint32_t ulTimestampHz;
+
+    xRecording = pdFALSE;
+
+    ulTimestampHz = configTRACE_RECORDER_SETUP_TIMESTAMP();
+
+    #if ( configUSE_TICKLESS_IDLE == 1 ) && defined( configTICKLESS_USE_WKT ) && !defined( FREERTOS_PORT_POSIX )
+        #if ( configTICKLESS_USE_WKT == 1 )
+        {
+            /* Deeper modes stop the timestamp timer. */
+            vPortSetTicklessModeLimit( portTICKLESS_MODE_SLEEP );
+        }
+        #endif
+    #endif
+
+    taskENTER_CRITICAL();
+    {
+        xTraceRecorderData.ulMagic = trcMAGIC;
+        xTraceRecorderData.ulVersion = trcVERSION;
+        xTraceRecorderData.ulTimestampHz = ulTimestampHz;
+        xTraceRecorderData.ulBufferEntries = configTRACE_RECORDER_BUFFER_ENTRIES;
+        xTraceRecorderData.ulSymbolEntries = configTRACE_RECORDER_SYMBOLS;
+        xTraceRecorderData.ulNameLength = trcNAME_LENGTH;
+        xTraceRecorderData.ulRecordCount = 0;
+        xRecording = pdTRUE;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+    xRecording = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void * pvTraceRecorderGetData( size_t * pxSize )
+{
+    configASSERT( pxSize );
+
+    *pxSize = sizeof( xTraceRecorderData );
+
+    return ( void * ) &xTraceRecorderData;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderEvent( uint8_t ucEvent,
+                          uint32_t ulObject,
+                          uint32_t ulParam )
+{
+    UBaseType_t uxSavedInterruptStatus;
+    TraceRecord_t * pxRecord;
+
+    if( xRecording != pdFALSE )
+    {
+        /* Called from tasks, interrupts and the scheduler alike. */
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            pxRecord = &( xTraceRecorderData.xRecords[ xTraceRecorderData.ulRecordCount & ( configTRACE_RECORDER_BUFFER_ENTRIES - 1UL ) ] );
+            pxRecord->ulTimestamp = configTRACE_RECORDER_GET_TIMESTAMP();
+            pxRecord->usObject = ( uint16_t ) ulObject;
+            pxRecord->ucEvent = ucEvent;
+            pxRecord->ucParam = ( uint8_t ) ulParam;
+            xTraceRecorderData.ulRecordCount++;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderAddSymbol( uint8_t ucKind,
+                              uint32_t ulObject,
+                              const char * pcName )
+{
+    UBaseType_t uxSavedInterruptStatus;
+    TraceSymbol_t * pxSymbol;
+    uint32_t ulIndex;
+
+    /* Symbols are kept whether or not the recorder is running, so the names of
+     * objects created before vTraceRecorderStart() are known. */
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        ulIndex = xTraceRecorderData.ulSymbolCount;
+
+        if( ( ulIndex < configTRACE_RECORDER_SYMBOLS ) && ( pcName != NULL ) )
+        {
+            pxSymbol = &( xTraceRecorderData.xSymbols[ ulIndex ] );
+            pxSymbol->usObject = ( uint16_t ) ulObject;
+            pxSymbol->ucKind = ucKind;
+            ( void ) strncpy( pxSymbol->cName, pcName, trcNAME_LENGTH - 1 );
+            pxSymbol->cName[ trcNAME_LENGTH - 1 ] = '\0';
+            xTraceRecorderData.ulSymbolCount = ulIndex + 1UL;
+        }
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulTraceRecorderNextQueueNumber( void )
+{
+    uint32_t ulQueueNumber;
+
+    /* Queues are created from tasks, or before the scheduler starts. */
+    taskENTER_CRITICAL();
+    {
+        ulNextQueueNumber++;
+        ulQueueNumber = ulNextQueueNumber;
+    }
+    taskEXIT_CRITICAL();
+
+    return ulQueueNumber;
+}
+/*-----------------------------------------------------------*/
+
+#if ( trcUSE_DEFAULT_TIMESTAMP == 1 )
+
+    #if defined( FREERTOS_PORT_POSIX )
+
+        static uint32_t prvSetupTimestamp( void )
+        {
+            return 1000000UL;
+        }
+/*-----------------------------------------------------------*/
+
+        static uint32_t prvGetTimestamp( void )
+        {
+            struct timespec xNow;
+
+            ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+            return ( uint32_t ) ( ( ( uint64_t ) xNow.tv_sec * 1000000ULL ) + ( ( uint64_t ) xNow.tv_nsec / 1000ULL ) );
+        }
+
+    #else /* if defined( FREERTOS_PORT_POSIX ) */
+
+        static uint32_t prvSetupTimestamp( void )
+        {
+            uint32_t ulPrescale;
+
+            /* The CTIMER is clocked from the system clock. */
+            ulPrescale = configCPU_CLOCK_HZ / configTRACE_RECORDER_TIMESTAMP_HZ;
+
+            if( ulPrescale == 0UL )
+            {
+                ulPrescale = 1UL;
+            }
+
+            trcSYSCON_SYSAHBCLKCTRL0_REG |= trcSYSCON_CTIMER_BIT;
+            trcSYSCON_PRESETCTRL0_REG &= ~trcSYSCON_CTIMER_BIT;
+            trcSYSCON_PRESETCTRL0_REG |= trcSYSCON_CTIMER_BIT;
+
+            /* Timer mode, counting up to 0xffffffff and wrapping. */
+            trcCTIMER_TCR_REG = trcCTIMER_TCR_CRST_BIT;
+            trcCTIMER_CTCR_REG = 0UL;
+            trcCTIMER_MCR_REG = 0UL;
+            trcCTIMER_PR_REG = ulPrescale - 1UL;
+            trcCTIMER_TCR_REG = trcCTIMER_TCR_CEN_BIT;
+
+            return configCPU_CLOCK_HZ / ulPrescale;
+        }
+/*-----------------------------------------------------------*/
+
+        static uint32_t prvGetTimestamp( void )
+        {
+            return trcCTIMER_TC_REG;
+        }
+
+    #endif /* if defined( FREERTOS_PORT_POSIX ) */
+
+#endif /* trcUSE_DEFAULT_TIMESTAMP */
+
+#endif /* configUSE_TRACE_RECORDER */
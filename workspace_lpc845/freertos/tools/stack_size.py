@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+"""Recommend task and interrupt stack sizes from a FreeRTOS stack report.
+
+The report is the text written by vTaskGetStackReport() (src/tasks.c) when
+configUSE_STACK_PROFILING is 1, for example printed on the debug console and
+saved to a file after the application has exercised its worst cases.
+
+The measured high water marks only cover the paths the application actually
+took.  Give the build directories with --build to add what the compiler knows:
+the frame of every function from -fstack-usage (.su files), and with
+-fcallgraph-info=su (.ci files) the deepest call chain below each task entry
+function named with --entry and below each interrupt handler.  The
+recommendation for each stack is the larger of the measured and the static
+figure, plus a safety margin.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+from collections import defaultdict
+
+REPORT_VERSION = 1
+
+# Words a Cortex-M0+ task stack needs on top of its deepest call chain: the
+# eight word exception frame stacked when it is interrupted, and the eight
+# registers the context switch saves.
+CONTEXT_WORDS = 16
+
+# Words stacked by the hardware for each interrupt that nests on the main
+# stack.
+EXCEPTION_FRAME_WORDS = 8
+
+# Handlers that run on the main stack but never nest like interrupts.
+NOT_INTERRUPTS = ("Reset_Handler", "Default_Handler")
+
+SU_LINE = re.compile(r"^(?P<location>.*):(?P<function>[^:\s]+)\s+(?P<bytes>\d+)\s+(?P<kind>[\w,]+)\s*$")
+CI_NODE = re.compile(r'node:\s*{\s*title:\s*"(?P<title>[^"]+)"\s*label:\s*"(?P<label>[^"]*)"')
+CI_EDGE = re.compile(r'edge:\s*{\s*sourcename:\s*"(?P<source>[^"]+)"\s*targetname:\s*"(?P<target>[^"]+)"')
+CI_BYTES = re.compile(r"(\d+) bytes \((\w+)\)")
+
+
+class Report:
+    """Task and interrupt stack figures from vTaskGetStackReport(), in words."""
+
+    def __init__(self, text):
+        self.word_bytes = None
+        self.tasks = []           # (name, size, used)
+        self.isr = None           # (size, used, nesting)
+
+        for line in text.splitlines():
+            fields = line.strip("\r\n").split("\t")
+            if fields[0] == "stack-report" and len(fields) >= 3:
+                if int(fields[1]) != REPORT_VERSION:
+                    raise ValueError("unsupported report version %s" % fields[1])
+                self.word_bytes = int(fields[2])
+            elif self.word_bytes is None:
+                # Console output before the report.
+                continue
+            elif fields[0] == "task" and len(fields) >= 4:
+                self.tasks.append((fields[1], int(fields[2]), int(fields[3])))
+            elif fields[0] == "isr" and len(fields) >= 4:
+                self.isr = (int(fields[1]), int(fields[2]), int(fields[3]))
+
+        if self.word_bytes is None:
+            raise ValueError("no stack-report line found")
+
+
+class StackUsage:
+    """Frame sizes and, when available, the call graph of a build."""
+
+    def __init__(self):
+        self.frames = {}                  # function -> bytes
+        self.bounded = {}                 # function -> False if dynamic
+        self.calls = defaultdict(set)     # function -> callees
+        self.have_call_graph = False
+
+    def load(self, directory):
+        for root, _, files in os.walk(directory):
+            for name in files:
+                path = os.path.join(root, name)
+                if name.endswith(".su"):
+                    self._load_su(path)
+                elif name.endswith(".ci"):
+                    self._load_ci(path)
+
+    def _set_frame(self, function, size, kind):
+        # Static functions of different files can share a name, keep the
+        # larger frame.
+        if size >= self.frames.get(function, -1):
+            self.frames[function] = size
+            self.bounded[function] = not kind.startswith("dynamic") or "bounded" in kind
+
+    def _load_su(self, path):
+        with open(path) as su_file:
+            for line in su_file:
+                match = SU_LINE.match(line)
+                if match:
+                    self._set_frame(match.group("function"), int(match.group("bytes")), match.group("kind"))
+
+    def _load_ci(self, path):
+        self.have_call_graph = True
+        with open(path) as ci_file:
+            for line in ci_file:
+                match = CI_NODE.search(line)
+                if match:
+                    size = CI_BYTES.search(match.group("label"))
+                    if size:
+                        self._set_frame(match.group("title"), int(size.group(1)), size.group(2))
+                    continue
+                match = CI_EDGE.search(line)
+                if match:
+                    self.calls[match.group("source")].add(match.group("target"))
+
+    def handlers(self):
+        return sorted(function for function in self.frames
+                      if function.endswith("Handler") and function not in NOT_INTERRUPTS)
+
+    def worst_path(self, function):
+        """Bytes of the deepest call chain from function, and the reasons the
+        figure may be too low (recursion, indirect calls, functions without
+        stack usage information, dynamic frames)."""
+        notes = set()
+        memo = {}
+
+        def visit(name, active):
+            if name in memo:
+                return memo[name]
+            if name in active:
+                notes.add("recursion through %s" % name)
+                return 0
+            if name == "__indirect_call":
+                notes.add("indirect calls")
+                return 0
+            if name not in self.frames:
+                notes.add("no figure for %s" % name)
+                return 0
+            if not self.bounded[name]:
+                notes.add("dynamic frame in %s" % name)
+
+            active.add(name)
+            deepest = 0
+            for callee in self.calls.get(name, ()):
+                deepest = max(deepest, visit(callee, active))
+            active.discard(name)
+
+            memo[name] = self.frames[name] + deepest
+            return memo[name]
+
+        return visit(function, set()), sorted(notes)
+
+
+def round_up_words(words):
+    # Keep stacks a multiple of 8 bytes, as the AAPCS requires of the stack
+    # pointer at public interfaces.
+    return int(2 * math.ceil(words / 2.0))
+
+
+def recommend(measured, static, margin):
+    return round_up_words(max(measured, static or 0) * (1.0 + margin / 100.0))
+
+
+def print_report(report, usage, entries, margin, out):
+    word = report.word_bytes
+
+    out.write("Task stacks (words of %d bytes, %d%% margin)\n" % (word, margin))
+    out.write("  %-16s %6s %6s %7s %6s %7s\n" % ("task", "size", "used", "static", "recom.", "change"))
+
+    total_now = 0
+    total_recommended = 0
+    notes = []
+    for name, size, used in report.tasks:
+        static = None
+        entry = entries.get(name)
+        if entry is not None and entry not in usage.frames:
+            notes.append("%s: no stack usage figure for %s" % (name, entry))
+        elif entry is not None and usage.have_call_graph:
+            path, reasons = usage.worst_path(entry)
+            static = int(math.ceil(path / float(word))) + CONTEXT_WORDS
+            for reason in reasons:
+                notes.append("%s: static figure from %s may be low, %s" % (name, entry, reason))
+        elif entry is not None:
+            notes.append("%s: no call graph, build with -fcallgraph-info=su" % name)
+
+        recommended = recommend(used, static, margin)
+        total_now += size
+        total_recommended += recommended
+        out.write("  %-16s %6d %6d %7s %6d %+7d\n" %
+                  (name, size, used, "-" if static is None else static, recommended, recommended - size))
+        if used >= size:
+            notes.append("%s: the whole stack was used, it has probably overflowed" % name)
+
+    out.write("  %-16s %6d %6s %7s %6d %+7d\n" %
+              ("total", total_now, "", "", total_recommended, total_recommended - total_now))
+
+    if report.isr is not None:
+        size, used, nesting = report.isr
+        out.write("\nInterrupt stack (words)\n")
+        if size == 0:
+            out.write("  not measured by the port\n")
+        static = None
+        handlers = usage.handlers()
+        if handlers and nesting > 0:
+            costs = []
+            for handler in handlers:
+                if usage.have_call_graph:
+                    path, reasons = usage.worst_path(handler)
+                    for reason in reasons:
+                        notes.append("%s may need more than its figure, %s" % (handler, reason))
+                else:
+                    path = usage.frames[handler]
+                costs.append((path, handler))
+            costs.sort(reverse=True)
+            deepest = costs[:nesting]
+            static = sum(int(math.ceil(path / float(word))) + EXCEPTION_FRAME_WORDS for path, _ in deepest)
+            out.write("  deepest nesting %d, largest handlers: %s\n" %
+                      (nesting, ", ".join("%s %d bytes" % (handler, path) for path, handler in deepest)))
+        elif nesting == 0:
+            notes.append("no interrupt nesting recorded, use taskSTACK_PROFILE_ISR_ENTER() in the handlers")
+
+        if size:
+            recommended = recommend(used, static, margin)
+            out.write("  size %d, used %d, static %s, recommended %d words\n" %
+                      (size, used, "-" if static is None else static, recommended))
+            out.write("  link with -Xlinker --defsym=__stack_size__=0x%x\n" % (recommended * word))
+            if used >= size:
+                notes.append("the whole interrupt stack was used, it has probably overflowed")
+
+    if notes:
+        out.write("\nNotes\n")
+        for note in notes:
+            out.write("  %s\n" % note)
+
+
+def parse_entry(text):
+    if "=" not in text:
+        raise argparse.ArgumentTypeError("expected TASK=FUNCTION")
+    return tuple(text.split("=", 1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("report", help="text written by vTaskGetStackReport()")
+    parser.add_argument("--build", metavar="DIR", action="append", default=[],
+                        help="build directory searched for .su and .ci files, can be repeated")
+    parser.add_argument("--entry", metavar="TASK=FUNCTION", action="append", default=[], type=parse_entry,
+                        help="entry function of a task, for the static call chain figure")
+    parser.add_argument("--margin", metavar="PERCENT", type=int, default=25,
+                        help="safety margin added to the larger figure (default 25)")
+    args = parser.parse_args()
+
+    with open(args.report) as report_file:
+        text = report_file.read()
+
+    try:
+        report = Report(text)
+    except ValueError as error:
+        sys.exit("%s: %s" % (args.report, error))
+
+    usage = StackUsage()
+    for directory in args.build:
+        usage.load(directory)
+
+    print_report(report, usage, dict(args.entry), args.margin, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
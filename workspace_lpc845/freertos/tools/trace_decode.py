@@ -0,0 +1,309 @@
+#!/usr/bin/env python3
+"""Decode a dump of the FreeRTOS trace recorder (src/trace_recorder.c).
+
+The dump is the raw image of xTraceRecorderData, for example saved from GDB
+with
+
+    dump binary value trace.bin xTraceRecorderData
+
+The report printed gives the CPU usage of each task and a histogram of the
+time each task spent blocked.  With --json a Chrome trace / Perfetto timeline
+is written as well, which can be opened in https://ui.perfetto.dev or
+chrome://tracing.
+"""
+
+import argparse
+import json
+import struct
+import sys
+from collections import defaultdict
+
+MAGIC = 0x52545246
+VERSION = 1
+
+HEADER = struct.Struct("<8I")
+RECORD = struct.Struct("<IHBB")
+
+# Event codes, in step with the traceRECORDER_EVENT_ definitions in
+# inc/trace_recorder.h.
+TASK_SWITCHED_IN = 1
+TASK_CREATE = 2
+TASK_DELETE = 3
+TASK_READY = 4
+TASK_DELAY = 5
+TASK_SUSPEND = 6
+TASK_RESUME = 7
+TASK_PRIORITY_SET = 8
+TASK_NOTIFY = 9
+TASK_NOTIFY_FROM_ISR = 10
+TASK_NOTIFY_BLOCK = 11
+QUEUE_CREATE = 16
+QUEUE_DELETE = 17
+QUEUE_SEND = 18
+QUEUE_SEND_FAILED = 19
+QUEUE_SEND_FROM_ISR = 20
+QUEUE_RECEIVE = 21
+QUEUE_RECEIVE_FAILED = 22
+QUEUE_RECEIVE_FROM_ISR = 23
+QUEUE_PEEK = 24
+QUEUE_BLOCK_SEND = 25
+QUEUE_BLOCK_RECEIVE = 26
+
+SYMBOL_TASK = 1
+SYMBOL_QUEUE = 2
+
+QUEUE_EVENT_NAMES = {
+    QUEUE_SEND: "send",
+    QUEUE_SEND_FAILED: "send failed",
+    QUEUE_SEND_FROM_ISR: "send from ISR",
+    QUEUE_RECEIVE: "receive",
+    QUEUE_RECEIVE_FAILED: "receive failed",
+    QUEUE_RECEIVE_FROM_ISR: "receive from ISR",
+    QUEUE_PEEK: "peek",
+    QUEUE_BLOCK_SEND: "block on send",
+    QUEUE_BLOCK_RECEIVE: "block on receive",
+}
+
+# Events after which the running task is blocked until its next ready event.
+BLOCKING_EVENTS = (TASK_DELAY, TASK_NOTIFY_BLOCK, QUEUE_BLOCK_SEND,
+                   QUEUE_BLOCK_RECEIVE)
+
+# queueQUEUE_TYPE_ values from queue.h.
+QUEUE_TYPES = {
+    0: "queue",
+    1: "mutex",
+    2: "counting semaphore",
+    3: "binary semaphore",
+    4: "recursive mutex",
+    5: "queue set",
+}
+
+
+class Dump:
+    """Header, symbol table and records of a recorder dump, the records in
+    the order they were written with their timestamps unwrapped."""
+
+    def __init__(self, data):
+        if len(data) < HEADER.size:
+            raise ValueError("dump too short for the recorder header")
+
+        (magic, version, self.timestamp_hz, entries, symbol_entries,
+         name_length, symbol_count, record_count) = HEADER.unpack_from(data)
+
+        if magic != MAGIC:
+            raise ValueError("not a trace recorder dump (bad magic 0x%08x)" % magic)
+        if version != VERSION:
+            raise ValueError("unsupported recorder version %d" % version)
+
+        symbol_size = 4 + name_length
+        offset = HEADER.size
+        needed = offset + symbol_entries * symbol_size + entries * RECORD.size
+        if len(data) < needed:
+            raise ValueError("dump is %d bytes, the recorder needs %d" % (len(data), needed))
+
+        self.task_names = {}
+        self.queue_names = {}
+        for index in range(min(symbol_count, symbol_entries)):
+            start = offset + index * symbol_size
+            number, kind = struct.unpack_from("<HB", data, start)
+            name = data[start + 4:start + symbol_size].split(b"\0", 1)[0]
+            name = name.decode("ascii", "replace")
+            if kind == SYMBOL_TASK:
+                self.task_names[number] = name
+            elif kind == SYMBOL_QUEUE:
+                self.queue_names[number] = name
+
+        offset += symbol_entries * symbol_size
+
+        # Once the buffer has wrapped the oldest record is the one the next
+        # write would overwrite.
+        if record_count > entries:
+            self.lost = record_count - entries
+            first = record_count % entries
+            order = list(range(first, entries)) + list(range(first))
+        else:
+            self.lost = 0
+            order = range(record_count)
+
+        self.records = []
+        time = None
+        previous = 0
+        for slot in order:
+            stamp, obj, event, param = RECORD.unpack_from(data, offset + slot * RECORD.size)
+            if time is None:
+                time = 0
+            else:
+                time += (stamp - previous) & 0xFFFFFFFF
+            previous = stamp
+            self.records.append((time, event, obj, param))
+
+    def seconds(self, ticks):
+        return ticks / float(self.timestamp_hz)
+
+    def task_name(self, number):
+        return self.task_names.get(number, "task %d" % number)
+
+    def queue_name(self, number):
+        return self.queue_names.get(number, "queue %d" % number)
+
+
+class Analysis:
+    """Running slices and blocked intervals of each task, found by replaying
+    the records."""
+
+    def __init__(self, dump):
+        self.slices = []           # (task, start, end)
+        self.blocked = []          # (task, start, end, reason)
+        self.queue_events = []     # (time, task or None, event, queue)
+        self.queue_types = {}
+        self.span = 0
+
+        running = None
+        running_since = 0
+        blocked_since = {}
+
+        for time, event, obj, param in dump.records:
+            self.span = time
+
+            if event == TASK_SWITCHED_IN:
+                if running is not None and time > running_since:
+                    self.slices.append((running, running_since, time))
+                running = obj
+                running_since = time
+            elif event == TASK_READY or event == TASK_RESUME:
+                start = blocked_since.pop(obj, None)
+                if start is not None:
+                    self.blocked.append((obj, start[0], time, start[1]))
+            elif event == TASK_SUSPEND:
+                blocked_since[obj] = (time, "suspended")
+            elif event == TASK_DELAY or event == TASK_NOTIFY_BLOCK:
+                reason = "delay" if event == TASK_DELAY else "notification"
+                blocked_since[obj] = (time, reason)
+            elif event == TASK_DELETE:
+                blocked_since.pop(obj, None)
+            elif event == QUEUE_CREATE:
+                self.queue_types[obj] = QUEUE_TYPES.get(param, "queue")
+            elif event in QUEUE_EVENT_NAMES:
+                from_isr = event in (QUEUE_SEND_FROM_ISR, QUEUE_RECEIVE_FROM_ISR)
+                task = None if from_isr else running
+                self.queue_events.append((time, task, event, obj))
+                if event in BLOCKING_EVENTS and running is not None:
+                    blocked_since[running] = (time, dump.queue_name(obj))
+
+        if running is not None and self.span > running_since:
+            self.slices.append((running, running_since, self.span))
+
+    def cpu_time(self):
+        totals = defaultdict(int)
+        for task, start, end in self.slices:
+            totals[task] += end - start
+        return totals
+
+
+def histogram_bucket(microseconds):
+    """Power of two bucket, as the upper bound in microseconds."""
+    bound = 1
+    while bound < microseconds:
+        bound *= 2
+    return bound
+
+
+def format_us(microseconds):
+    if microseconds >= 1000000:
+        return "%gs" % (microseconds / 1000000)
+    if microseconds >= 1000:
+        return "%gms" % (microseconds / 1000)
+    return "%dus" % microseconds
+
+
+def print_report(dump, analysis, out):
+    span = analysis.span
+    out.write("%d records over %.6f s, timestamps at %d Hz" %
+              (len(dump.records), dump.seconds(span), dump.timestamp_hz))
+    if dump.lost:
+        out.write(", %d older records overwritten" % dump.lost)
+    out.write("\n\nCPU usage\n")
+
+    totals = analysis.cpu_time()
+    for task, ticks in sorted(totals.items(), key=lambda item: -item[1]):
+        share = 100.0 * ticks / span if span else 0.0
+        out.write("  %-16s %12.6f s  %6.2f %%\n" %
+                  (dump.task_name(task), dump.seconds(ticks), share))
+
+    out.write("\nBlocking time\n")
+    per_task = defaultdict(lambda: defaultdict(int))
+    for task, start, end, _ in analysis.blocked:
+        microseconds = int(dump.seconds(end - start) * 1000000)
+        per_task[task][histogram_bucket(microseconds)] += 1
+
+    if not per_task:
+        out.write("  no completed blocked intervals\n")
+
+    for task in sorted(per_task):
+        buckets = per_task[task]
+        count = sum(buckets.values())
+        widest = max(buckets.values())
+        out.write("  %s (%d)\n" % (dump.task_name(task), count))
+        for bound in sorted(buckets):
+            bar = "#" * max(1, int(40 * buckets[bound] / widest))
+            out.write("    <= %-8s %6d %s\n" % (format_us(bound), buckets[bound], bar))
+
+
+def chrome_trace(dump, analysis):
+    """Chrome trace event format, one thread per task."""
+    def us(ticks):
+        return dump.seconds(ticks) * 1000000
+
+    events = []
+    for task, name in sorted(dump.task_names.items()):
+        events.append({"ph": "M", "name": "thread_name", "pid": 1, "tid": task,
+                       "args": {"name": name}})
+
+    for task, start, end in analysis.slices:
+        events.append({"ph": "X", "name": dump.task_name(task), "cat": "running",
+                       "pid": 1, "tid": task, "ts": us(start), "dur": us(end - start)})
+
+    for task, start, end, reason in analysis.blocked:
+        events.append({"ph": "X", "name": "blocked: " + reason, "cat": "blocked",
+                       "pid": 2, "tid": task, "ts": us(start), "dur": us(end - start)})
+
+    for time, task, event, queue in analysis.queue_events:
+        events.append({"ph": "i", "s": "t", "name": "%s %s" % (QUEUE_EVENT_NAMES[event], dump.queue_name(queue)),
+                       "cat": analysis.queue_types.get(queue, "queue"),
+                       "pid": 1, "tid": task if task is not None else 0, "ts": us(time)})
+
+    events.append({"ph": "M", "name": "process_name", "pid": 1, "args": {"name": "running"}})
+    events.append({"ph": "M", "name": "process_name", "pid": 2, "args": {"name": "blocked"}})
+    events.append({"ph": "M", "name": "thread_name", "pid": 1, "tid": 0, "args": {"name": "interrupts"}})
+    for task, name in sorted(dump.task_names.items()):
+        events.append({"ph": "M", "name": "thread_name", "pid": 2, "tid": task,
+                       "args": {"name": name}})
+
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("dump", help="binary image of xTraceRecorderData")
+    parser.add_argument("--json", metavar="FILE",
+                        help="write a Chrome trace / Perfetto timeline to FILE")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump_file:
+        data = dump_file.read()
+
+    try:
+        dump = Dump(data)
+    except ValueError as error:
+        sys.exit("%s: %s" % (args.dump, error))
+
+    analysis = Analysis(dump)
+    print_report(dump, analysis, sys.stdout)
+
+    if args.json:
+        with open(args.json, "w") as json_file:
+            json.dump(chrome_trace(dump, analysis), json_file)
+
+
+if __name__ == "__main__":
+    main()
@@ -157,6 +157,9 @@
 #  # description: SCT Driver
 #  set(CONFIG_USE_driver_sctimer true)
 
+#  # description: SCT DMA Driver
+#  set(CONFIG_USE_driver_sctimer_dma true)
+
 #  # description: PINT Driver
 #  set(CONFIG_USE_driver_pint true)
 
@@ -166,9 +169,15 @@
 #  # description: USART Driver
 #  set(CONFIG_USE_driver_lpc_miniusart true)
 
+#  # description: USART DMA Driver
+#  set(CONFIG_USE_driver_lpc_miniusart_dma true)
+
 #  # description: SPI Driver
 #  set(CONFIG_USE_driver_lpc_minispi true)
 
+#  # description: SPI DMA Driver
+#  set(CONFIG_USE_driver_lpc_minispi_dma true)
+
 #  # description: IOCON Driver
 #  set(CONFIG_USE_driver_lpc_iocon_lite true)
 
@@ -178,21 +187,33 @@
 #  # description: I2C Driver
 #  set(CONFIG_USE_driver_lpc_i2c_dma true)
 
+#  # description: I2C Queue Driver
+#  set(CONFIG_USE_driver_lpc_i2c_queue true)
+
 #  # description: GPIO Driver
 #  set(CONFIG_USE_driver_lpc_gpio true)
 
 #  # description: DMA Driver
 #  set(CONFIG_USE_driver_lpc_dma true)
 
+#  # description: DMA Queue Driver
+#  set(CONFIG_USE_driver_lpc_dma_queue true)
+
 #  # description: DAC Driver
 #  set(CONFIG_USE_driver_lpc_dac true)
 
 #  # description: CRC Driver
 #  set(CONFIG_USE_driver_lpc_crc true)
 
+#  # description: LPC CRC DMA Driver
+#  set(CONFIG_USE_driver_lpc_crc_dma true)
+
 #  # description: ADC Driver
 #  set(CONFIG_USE_driver_lpc_adc true)
 
+#  # description: ADC DMA Driver
+#  set(CONFIG_USE_driver_lpc_adc_dma true)
+
 #  # description: LPC_ACOMP Driver
 #  set(CONFIG_USE_driver_lpc_acomp true)
 
@@ -403,20 +424,27 @@ include_if_use(driver_inputmux.LPC845)
 include_if_use(driver_inputmux_connections.LPC845)
 include_if_use(driver_lpc_acomp.LPC845)
 include_if_use(driver_lpc_adc.LPC845)
+include_if_use(driver_lpc_adc_dma.LPC845)
 include_if_use(driver_lpc_crc.LPC845)
+include_if_use(driver_lpc_crc_dma.LPC845)
 include_if_use(driver_lpc_dac.LPC845)
 include_if_use(driver_lpc_dma.LPC845)
+include_if_use(driver_lpc_dma_queue.LPC845)
 include_if_use(driver_lpc_gpio.LPC845)
 include_if_use(driver_lpc_i2c.LPC845)
 include_if_use(driver_lpc_i2c_dma.LPC845)
+include_if_use(driver_lpc_i2c_queue.LPC845)
 include_if_use(driver_lpc_iocon_lite.LPC845)
 include_if_use(driver_lpc_minispi.LPC845)
+include_if_use(driver_lpc_minispi_dma.LPC845)
 include_if_use(driver_lpc_miniusart.LPC845)
+include_if_use(driver_lpc_miniusart_dma.LPC845)
 include_if_use(driver_mrt.LPC845)
 include_if_use(driver_pint.LPC845)
 include_if_use(driver_power.LPC845)
 include_if_use(driver_reset.LPC845)
 include_if_use(driver_sctimer.LPC845)
+include_if_use(driver_sctimer_dma.LPC845)
 include_if_use(driver_swm.LPC845)
 include_if_use(driver_swm_connections.LPC845)
 include_if_use(driver_syscon.LPC845)
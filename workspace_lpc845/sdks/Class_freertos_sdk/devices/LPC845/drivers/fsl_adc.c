@@ -31,7 +31,13 @@ static const reset_ip_name_t s_adcResets[] = ADC_RESETS_ARRAY;
 
 #define FREQUENCY_1MHZ (1000000UL)
 
-static uint32_t ADC_GetInstance(ADC_Type *base)
+/*!
+ * brief Returns an instance number given a base address.
+ *
+ * param base ADC peripheral base address.
+ * return ADC instance number starting from 0.
+ */
+uint32_t ADC_GetInstance(ADC_Type *base)
 {
     uint32_t instance;
 
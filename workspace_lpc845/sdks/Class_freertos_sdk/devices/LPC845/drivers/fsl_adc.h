@@ -23,8 +23,8 @@
 
 /*! @name Driver version */
 /*! @{ */
-/*! @brief ADC driver version 2.6.0. */
-#define FSL_ADC_DRIVER_VERSION (MAKE_VERSION(2, 6, 0))
+/*! @brief ADC driver version 2.7.0. */
+#define FSL_ADC_DRIVER_VERSION (MAKE_VERSION(2, 7, 0))
 /*! @} */
 
 /*!
@@ -383,6 +383,17 @@ void ADC_Deinit(ADC_Type *base);
  */
 void ADC_GetDefaultConfig(adc_config_t *config);
 
+/*!
+ * @brief Returns an instance number given a base address.
+ *
+ * If an invalid base address is passed, debug builds will assert. Release builds will just return
+ * instance number 0.
+ *
+ * @param base ADC peripheral base address.
+ * @return ADC instance number starting from 0.
+ */
+uint32_t ADC_GetInstance(ADC_Type *base);
+
 #if !(defined(FSL_FEATURE_ADC_HAS_NO_CALIB_FUNC) && FSL_FEATURE_ADC_HAS_NO_CALIB_FUNC)
 #if defined(FSL_FEATURE_ADC_HAS_CALIB_REG) && FSL_FEATURE_ADC_HAS_CALIB_REG
 /*!
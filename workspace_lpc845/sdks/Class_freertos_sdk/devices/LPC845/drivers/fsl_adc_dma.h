@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_ADC_DMA_H_
+#define FSL_ADC_DMA_H_
+
+#include "fsl_adc.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup adc_dma_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief ADC DMA driver version. */
+#define FSL_ADC_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 1))
+/*! @} */
+
+/*! @brief Maximum number of samples in one block (determined by capability of the DMA engine) */
+#define ADC_DMA_MAX_SAMPLES_PER_BLOCK DMA_MAX_TRANSFER_COUNT
+
+/*! @brief Get the conversion result from a sample word written by the stream. */
+#define ADC_DMA_SAMPLE_RESULT(sample) (((sample) & ADC_SEQ_GDAT_RESULT_MASK) >> ADC_SEQ_GDAT_RESULT_SHIFT)
+
+/*! @brief Get the channel number from a sample word written by the stream. */
+#define ADC_DMA_SAMPLE_CHANNEL(sample) (((sample) & ADC_SEQ_GDAT_CHN_MASK) >> ADC_SEQ_GDAT_CHN_SHIFT)
+
+/*! @brief ADC DMA transfer status. */
+enum
+{
+    kStatus_ADC_DMA_Busy          = MAKE_STATUS(kStatusGroup_LPC_ADC, 0), /*!< A stream is already running. */
+    kStatus_ADC_DMA_TransferError = MAKE_STATUS(kStatusGroup_LPC_ADC, 1), /*!< DMA reported a transfer error. */
+};
+
+/*! @brief ADC DMA handle typedef. */
+typedef struct _adc_dma_handle adc_dma_handle_t;
+
+/*!
+ * @brief ADC DMA block callback typedef.
+ *
+ * Invoked from the DMA interrupt each time one of the ping-pong buffers is filled. @p block points to the
+ * buffer that has just been completed and holds handle->samplesPerBlock raw sample words. The DMA keeps filling
+ * the other buffer meanwhile, so the block must be consumed before that buffer completes.
+ */
+typedef void (*adc_dma_block_callback_t)(
+    ADC_Type *base, adc_dma_handle_t *handle, status_t status, uint32_t *block, void *userData);
+
+/*! @brief ADC DMA stream configuration. */
+typedef struct _adc_dma_stream_config
+{
+    uint32_t *blockBuffer[2]; /*!< Ping-pong sample buffers, each holding samplesPerBlock words. */
+    uint32_t samplesPerBlock; /*!< Number of conversions per block, up to ADC_DMA_MAX_SAMPLES_PER_BLOCK. */
+    bool enableBurstMode;     /*!< Free-run sequence A in burst mode. When false, the conversions are launched by the
+                                   hardware triggers selected in the sequence A configuration. */
+} adc_dma_stream_config_t;
+
+/*! @brief ADC DMA handle structure. */
+struct _adc_dma_handle
+{
+    dma_handle_t *dmaHandle;           /*!< The DMA handler used. */
+    uint32_t *blockBuffer[2];          /*!< Ping-pong sample buffers of the current stream. */
+    uint32_t samplesPerBlock;          /*!< Number of samples per block. */
+    volatile uint32_t blockCount;      /*!< Number of blocks completed since the stream was started. */
+    volatile bool isStreaming;         /*!< Stream running flag. */
+    adc_dma_block_callback_t callback; /*!< Callback function called when a block is completed. */
+    void *userData;                    /*!< Callback parameter passed to callback function. */
+    uint32_t seqCtrlMode;              /*!< Sequence A interrupt mode before the stream was started. */
+    bool seqInterruptEnabled;          /*!< Sequence A interrupt enable before the stream was started. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus. */
+
+/*!
+ * @name ADC DMA Stream Operation
+ * @{
+ */
+
+/*!
+ * @brief Init the ADC handle which is used in the DMA stream functions.
+ *
+ * The DMA channel must be routed to the sequence A interrupt by the application before the stream is started, for
+ * example with INPUTMUX_AttachSignal(INPUTMUX, channel, kINPUTMUX_AdcASeqaIrqToDma).
+ *
+ * @param base ADC peripheral base address.
+ * @param handle pointer to adc_dma_handle_t structure.
+ * @param callback pointer to user callback function.
+ * @param userData user param passed to the callback function.
+ * @param dmaHandle DMA handle pointer.
+ */
+void ADC_TransferCreateHandleDMA(ADC_Type *base,
+                                 adc_dma_handle_t *handle,
+                                 adc_dma_block_callback_t callback,
+                                 void *userData,
+                                 dma_handle_t *dmaHandle);
+
+/*!
+ * @brief Starts continuous sampling of conversion sequence A into ping-pong buffers.
+ *
+ * Sequence A must be configured and enabled with ADC_SetConvSeqAConfig() and ADC_EnableConvSeqA() beforehand. This
+ * function switches the sequence to raise its DMA trigger at the end of each conversion, links two DMA descriptors
+ * reading the sequence A global data register into a ping-pong chain and then arms the sequence. Every conversion is
+ * moved by the DMA without CPU intervention; the CPU is only interrupted once per completed block.
+ *
+ * @param base ADC peripheral base address.
+ * @param handle pointer to adc_dma_handle_t structure.
+ * @param config pointer to stream configuration.
+ * @retval kStatus_Success Stream started.
+ * @retval kStatus_InvalidArgument Invalid buffer or block size.
+ * @retval kStatus_ADC_DMA_Busy A stream is already running on this handle.
+ */
+status_t ADC_TransferStartStreamDMA(ADC_Type *base, adc_dma_handle_t *handle, const adc_dma_stream_config_t *config);
+
+/*!
+ * @brief Stops a running sequence A stream.
+ *
+ * Burst mode is turned off and sequence A gets back the interrupt mode and the interrupt enable it had before
+ * ADC_TransferStartStreamDMA().
+ *
+ * @param base ADC peripheral base address.
+ * @param handle pointer to adc_dma_handle_t structure.
+ */
+void ADC_TransferStopStreamDMA(ADC_Type *base, adc_dma_handle_t *handle);
+
+/*!
+ * @brief Gets the number of blocks completed by a running stream.
+ *
+ * @param base ADC peripheral base address.
+ * @param handle pointer to adc_dma_handle_t structure.
+ * @param count Number of blocks completed since the stream was started.
+ * @retval kStatus_Success Count returned.
+ * @retval kStatus_NoTransferInProgress No stream is running.
+ */
+status_t ADC_TransferGetBlockCountDMA(ADC_Type *base, adc_dma_handle_t *handle, uint32_t *count);
+
+/*! @} */
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus. */
+/*! @} */
+#endif /*FSL_ADC_DMA_H_*/
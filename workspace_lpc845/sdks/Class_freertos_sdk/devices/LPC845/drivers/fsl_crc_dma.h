@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_CRC_DMA_H_
+#define FSL_CRC_DMA_H_
+
+#include "fsl_crc.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup crc_dma_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief CRC DMA driver version. */
+#define FSL_CRC_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*!
+ * @brief Number of link descriptors used to feed the CRC engine.
+ *
+ * A descriptor moves up to 4 KB of word aligned data. When the regions need more descriptors than available, the
+ * chain is refilled from the DMA interrupt, so this value only sets how often the CPU is interrupted.
+ */
+#ifndef CRC_DMA_MAX_LINK_DESCRIPTORS
+#define CRC_DMA_MAX_LINK_DESCRIPTORS (4U)
+#endif
+
+/*! @brief Memory region fed to the CRC engine. */
+typedef struct _crc_dma_region
+{
+    const uint8_t *data; /*!< Start address of the region. */
+    size_t dataSize;     /*!< Size of the region in bytes. */
+} crc_dma_region_t;
+
+/*! @brief CRC DMA handle typedef. */
+typedef struct _crc_dma_handle crc_dma_handle_t;
+
+/*! @brief CRC DMA callback called when all regions have been written to the CRC engine. */
+typedef void (*crc_dma_callback_t)(CRC_Type *base, crc_dma_handle_t *handle, status_t status, void *userData);
+
+/*! @brief CRC DMA handle, users should not touch the content of the handle. */
+struct _crc_dma_handle
+{
+    CRC_Type *base;                   /*!< CRC peripheral base address. */
+    dma_handle_t *dmaHandle;          /*!< DMA handle used to feed the CRC engine. */
+    crc_dma_callback_t callback;      /*!< Callback function. */
+    void *userData;                   /*!< CRC callback function parameter. */
+    const crc_dma_region_t *regions;  /*!< Regions of the running transfer. */
+    uint32_t regionCount;             /*!< Number of regions of the running transfer. */
+    uint32_t regionIndex;             /*!< Region the next chain starts in. */
+    size_t regionOffset;              /*!< Offset in the region the next chain starts at. */
+    crc_dma_region_t singleRegion;    /*!< Region storage used by CRC_WriteDataDMA(). */
+    volatile bool busy;               /*!< Transfer in progress. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name DMA transactional
+ * @{
+ */
+
+/*!
+ * @brief Initializes the CRC DMA handle.
+ *
+ * The DMA channel is used for memory to memory transfers, so any channel without a peripheral request in use can be
+ * taken.
+ *
+ * @param base CRC peripheral base address.
+ * @param handle CRC DMA handle pointer.
+ * @param callback Callback function called when all data has been written to the CRC engine.
+ * @param userData User data for callback.
+ * @param dmaHandle DMA handle pointer, the handle shall be static allocated by users.
+ * @retval kStatus_Success Handle initialized.
+ */
+status_t CRC_TransferCreateHandleDMA(CRC_Type *base,
+                                     crc_dma_handle_t *handle,
+                                     crc_dma_callback_t callback,
+                                     void *userData,
+                                     dma_handle_t *dmaHandle);
+
+/*!
+ * @brief Writes data to the CRC engine using DMA.
+ *
+ * Equivalent to CRC_WriteData() but returns immediately, the callback is invoked with kStatus_Success when the last
+ * byte has been written. The CRC engine keeps its current configuration and sum, the result is then read with
+ * CRC_Get16bitResult() or CRC_Get32bitResult().
+ *
+ * @param base CRC peripheral base address.
+ * @param handle CRC DMA handle pointer.
+ * @param data Input data, must stay valid until the callback.
+ * @param dataSize Size of the input data in bytes.
+ * @retval kStatus_Success Transfer started.
+ * @retval kStatus_InvalidArgument Input argument is invalid.
+ * @retval kStatus_Busy Previous transfer on going.
+ */
+status_t CRC_WriteDataDMA(CRC_Type *base, crc_dma_handle_t *handle, const uint8_t *data, size_t dataSize);
+
+/*!
+ * @brief Writes several discontiguous regions to the CRC engine using DMA.
+ *
+ * The regions are checksummed as one stream, in the given order, for example the sections of a flash image.
+ *
+ * @param base CRC peripheral base address.
+ * @param handle CRC DMA handle pointer.
+ * @param regions Array of regions, the array and the data must stay valid until the callback.
+ * @param regionCount Number of regions.
+ * @retval kStatus_Success Transfer started.
+ * @retval kStatus_InvalidArgument Input argument is invalid.
+ * @retval kStatus_Busy Previous transfer on going.
+ */
+status_t CRC_WriteRegionsDMA(CRC_Type *base,
+                             crc_dma_handle_t *handle,
+                             const crc_dma_region_t *regions,
+                             uint32_t regionCount);
+
+/*!
+ * @brief Computes the CRC of several regions asynchronously.
+ *
+ * Initializes the CRC engine with @p config, which restarts the computation from the seed, then starts
+ * CRC_WriteRegionsDMA().
+ *
+ * @code
+ *   crc_config_t config;
+ *   crc_dma_region_t regions[] = {{textStart, textSize}, {dataStart, dataSize}};
+ *
+ *   CRC_GetDefaultConfig(&config);
+ *   CRC_ComputeAsync(CRC, &handle, &config, regions, 2U);
+ *   ... in the callback ...
+ *   crc = CRC_Get16bitResult(CRC);
+ * @endcode
+ *
+ * @param base CRC peripheral base address.
+ * @param handle CRC DMA handle pointer.
+ * @param config CRC configuration.
+ * @param regions Array of regions, the array and the data must stay valid until the callback.
+ * @param regionCount Number of regions.
+ * @retval kStatus_Success Transfer started.
+ * @retval kStatus_InvalidArgument Input argument is invalid.
+ * @retval kStatus_Busy Previous transfer on going.
+ */
+status_t CRC_ComputeAsync(CRC_Type *base,
+                          crc_dma_handle_t *handle,
+                          const crc_config_t *config,
+                          const crc_dma_region_t *regions,
+                          uint32_t regionCount);
+
+/*!
+ * @brief Aborts a CRC DMA transfer.
+ *
+ * The CRC sum then covers an undefined part of the data.
+ *
+ * @param base CRC peripheral base address.
+ * @param handle CRC DMA handle pointer.
+ */
+void CRC_TransferAbortDMA(CRC_Type *base, crc_dma_handle_t *handle);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* FSL_CRC_DMA_H_ */
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_I2C_QUEUE_H_
+#define FSL_I2C_QUEUE_H_
+
+#include "fsl_i2c.h"
+
+/*!
+ * @addtogroup i2c_queue_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief I2C queue driver version. */
+#define FSL_I2C_QUEUE_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*! @brief I2C queue handle typedef. */
+typedef struct _i2c_queue_handle i2c_queue_handle_t;
+
+/*! @brief I2C queue transfer typedef. */
+typedef struct _i2c_queue_transfer i2c_queue_transfer_t;
+
+/*!
+ * @brief I2C queue transfer callback typedef.
+ *
+ * Invoked from the I2C interrupt when @p transfer is done, after the next queued transfer has been started. The
+ * transfer is no longer queued, so the callback may submit it again or reuse its memory.
+ */
+typedef void (*i2c_queue_callback_t)(I2C_Type *base,
+                                     i2c_queue_handle_t *handle,
+                                     i2c_queue_transfer_t *transfer,
+                                     status_t status,
+                                     void *userData);
+
+/*!
+ * @brief I2C queue transfer structure.
+ *
+ * Owned by the application and linked into the queue without copying, so it must stay valid until its callback has
+ * been invoked, or as long as it is a polling job.
+ */
+struct _i2c_queue_transfer
+{
+    i2c_master_transfer_t xfer;    /*!< Transfer to run. A register write or a repeated start register read is a
+                                        transfer with a subaddress, see I2C_MasterTransferNonBlocking(). */
+    i2c_queue_callback_t callback; /*!< Callback function, can be NULL. */
+    void *userData;                /*!< Callback parameter passed to callback function. */
+
+    /* Private members, set by the driver. */
+    i2c_queue_transfer_t *next;    /*!< Next transfer in the queue. */
+    i2c_queue_transfer_t *nextJob; /*!< Next polling job. */
+    uint32_t periodTicks;          /*!< Polling period in ticks, 0 if the transfer is not a polling job. */
+    uint32_t ticksLeft;            /*!< Ticks until the polling job is queued again. */
+    volatile bool queued;          /*!< Queued or running flag. */
+};
+
+/*!
+ * @brief I2C queue handle structure.
+ * @note The contents of this structure are private and subject to change.
+ */
+struct _i2c_queue_handle
+{
+    I2C_Type *base;                      /*!< I2C peripheral base address. */
+    i2c_master_handle_t masterHandle;    /*!< Non-blocking handle running the transfers. */
+    i2c_queue_transfer_t *volatile head; /*!< Running transfer, followed by the queued ones. */
+    i2c_queue_transfer_t *tail;          /*!< Last queued transfer. */
+    i2c_queue_transfer_t *jobs;          /*!< Polling jobs. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus. */
+
+/*!
+ * @name I2C Queue Operation
+ * @{
+ */
+
+/*!
+ * @brief Init the I2C queue handle.
+ *
+ * The queue runs transfers to any number of devices on one bus one after the other, each started from the I2C
+ * interrupt that completes the previous one, so the bus is only idle while the interrupt handler runs. The queue
+ * uses the non-blocking master handle of the instance, I2C_MasterTransferNonBlocking() must not be used on the
+ * same instance while the queue is in use.
+ *
+ * @param base I2C peripheral base address, the master must already be initialized with I2C_MasterInit().
+ * @param handle pointer to i2c_queue_handle_t structure.
+ */
+void I2C_QueueCreateHandle(I2C_Type *base, i2c_queue_handle_t *handle);
+
+/*!
+ * @brief Queues a transfer.
+ *
+ * The transfer starts at once if the bus is idle, otherwise after the transfers queued before it. Can be called
+ * from interrupts, including the transfer callbacks.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_queue_handle_t structure.
+ * @param transfer pointer to the transfer, its xfer, callback and userData members must be set.
+ * @retval kStatus_Success Transfer queued.
+ * @retval kStatus_InvalidArgument Subaddress longer than 4 bytes.
+ * @retval kStatus_I2C_Busy The transfer is still queued or running.
+ */
+status_t I2C_QueueSubmit(I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer);
+
+/*!
+ * @brief Adds a polling job.
+ *
+ * The transfer is queued every @p periodTicks calls of I2C_QueueTick(), the first time after @p periodTicks calls.
+ * Jobs due on the same tick are queued in the order they were added and run back to back, which batches the
+ * reads of several sensors into one bus burst. A job still queued from the previous period is not queued twice.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_queue_handle_t structure.
+ * @param transfer pointer to the transfer, its xfer, callback and userData members must be set.
+ * @param periodTicks polling period in ticks, not 0.
+ */
+void I2C_QueueAddJob(I2C_Type *base,
+                     i2c_queue_handle_t *handle,
+                     i2c_queue_transfer_t *transfer,
+                     uint32_t periodTicks);
+
+/*!
+ * @brief Removes a polling job.
+ *
+ * A transfer of the job already queued still runs and invokes its callback.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_queue_handle_t structure.
+ * @param transfer pointer to the transfer given to I2C_QueueAddJob().
+ */
+void I2C_QueueRemoveJob(I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer);
+
+/*!
+ * @brief Advances the polling jobs by one tick.
+ *
+ * Call it periodically, for example from the SysTick or a timer interrupt.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_queue_handle_t structure.
+ */
+void I2C_QueueTick(I2C_Type *base, i2c_queue_handle_t *handle);
+
+/*!
+ * @brief Aborts the running transfer and discards the queued ones.
+ *
+ * The callbacks of the discarded transfers are not invoked. The polling jobs are kept and queued again on their
+ * next period.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_queue_handle_t structure.
+ */
+void I2C_QueueAbort(I2C_Type *base, i2c_queue_handle_t *handle);
+
+/*!
+ * @brief Tells whether transfers are queued or running.
+ *
+ * @param handle pointer to i2c_queue_handle_t structure.
+ * @retval true A transfer is running.
+ * @retval false The queue is empty.
+ */
+static inline bool I2C_QueueIsBusy(i2c_queue_handle_t *handle)
+{
+    return (handle->head != NULL);
+}
+
+/*! @} */
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus. */
+/*! @} */
+#endif /*FSL_I2C_QUEUE_H_*/
@@ -0,0 +1,310 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_sctimer_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.sctimer_dma"
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Gets the DMA request register of a request line.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param request DMA request line.
+ * @return Pointer to DMAREQ0 or DMAREQ1.
+ */
+static volatile uint32_t *SCTIMER_GetDmaRequestRegister(SCT_Type *base, sctimer_dma_request_t request);
+
+/*!
+ * @brief DMA callback for SCTimer DMA driver.
+ *
+ * @param handle DMA handler for SCTimer DMA driver
+ * @param userData user param passed to the callback function
+ */
+static void SCTIMER_SequenceCallbackDMA(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static volatile uint32_t *SCTIMER_GetDmaRequestRegister(SCT_Type *base, sctimer_dma_request_t request)
+{
+    return (request == kSCTIMER_DmaRequest0) ? &base->DMAREQ0 : &base->DMAREQ1;
+}
+
+static void SCTIMER_SequenceCallbackDMA(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    sctimer_dma_handle_t *sctHandle = (sctimer_dma_handle_t *)userData;
+    status_t status                 = kStatus_Success;
+    uint32_t block                  = 0U;
+
+    /* Don't do anything if we don't have a valid handle. */
+    if ((handle == NULL) || (sctHandle == NULL))
+    {
+        return;
+    }
+
+    if (!transferDone)
+    {
+        DMA_AbortTransfer(sctHandle->dmaHandle);
+        sctHandle->busy = false;
+        status          = kStatus_Fail;
+    }
+    else if (intmode == (uint32_t)kDMA_IntB)
+    {
+        /* Only the last descriptor of the second ping-pong half raises INTB. */
+        block = 1U;
+    }
+    else if (sctHandle->mode == kSCTIMER_DmaOneShot)
+    {
+        /* The last descriptor of a one-shot sequence does not reload, the channel is idle. */
+        sctHandle->busy = false;
+    }
+    else
+    {
+        /* Intentional empty: first ping-pong half or one pass of a loop played. */
+    }
+
+    if (sctHandle->callback != NULL)
+    {
+        sctHandle->callback(sctHandle->base, sctHandle, status, block, sctHandle->userData);
+    }
+}
+
+/*!
+ * brief Init the SCTimer handle which is used to play a sequence of match values on one output.
+ *
+ * param base SCTimer peripheral base address.
+ * param handle pointer to sctimer_dma_handle_t structure.
+ * param callback pointer to user callback function, NULL to run without interrupts.
+ * param userData user param passed to the callback function.
+ * param dmaHandle DMA handle pointer.
+ * param descriptors Link descriptors, allocated with DMA_ALLOCATE_LINK_DESCRIPTORS().
+ * param descriptorCount Number of link descriptors, see SCTIMER_DMA_LINK_DESCRIPTOR_COUNT().
+ */
+void SCTIMER_SequenceCreateHandleDMA(SCT_Type *base,
+                                     sctimer_dma_handle_t *handle,
+                                     sctimer_dma_callback_t callback,
+                                     void *userData,
+                                     dma_handle_t *dmaHandle,
+                                     dma_descriptor_t *descriptors,
+                                     uint32_t descriptorCount)
+{
+    assert(handle != NULL);
+    assert(dmaHandle != NULL);
+    assert((descriptors != NULL) || (descriptorCount == 0U));
+    assert((((uint32_t)descriptors) & ((uint32_t)FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE - 1UL)) == 0UL);
+
+    /* Zero handle. */
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base            = base;
+    handle->dmaHandle       = dmaHandle;
+    handle->descriptors     = descriptors;
+    handle->descriptorCount = descriptorCount;
+    handle->callback        = callback;
+    handle->userData        = userData;
+
+    /* Several handles can share one SCTimer, so the handle itself is the DMA callback parameter. */
+    DMA_SetCallback(dmaHandle, SCTIMER_SequenceCallbackDMA, handle);
+}
+
+/*!
+ * brief Arms a sequence of match reload values.
+ *
+ * param base SCTimer peripheral base address.
+ * param handle pointer to sctimer_dma_handle_t structure.
+ * param sequence pointer to the sequence to play.
+ * retval kStatus_Success Sequence armed.
+ * retval kStatus_InvalidArgument Invalid values, or not enough link descriptors for them.
+ * retval kStatus_Busy A sequence is already playing on this handle.
+ */
+status_t SCTIMER_SequenceSubmitDMA(SCT_Type *base, sctimer_dma_handle_t *handle, const sctimer_dma_sequence_t *sequence)
+{
+    assert(handle != NULL);
+    assert(sequence != NULL);
+    assert(base == handle->base);
+
+    dma_channel_config_t transferConfig;
+    dma_channel_trigger_t trigger;
+    dma_descriptor_t *nextDesc;
+    const uint32_t *srcAddr;
+    void *dstAddr;
+    uint32_t blockLength, piecesPerBlock, pieceCount;
+    uint32_t block, offset, length;
+    uint32_t xferCfg, headXferCfg = 0U;
+    uint32_t i;
+    bool isLastOfBlock;
+    bool interrupt = (handle->callback != NULL);
+
+    if ((sequence->values == NULL) || (sequence->count == 0U) ||
+        (sequence->matchReg >= (uint32_t)FSL_FEATURE_SCT_NUMBER_OF_MATCH_CAPTURE) ||
+        ((sequence->mode == kSCTIMER_DmaPingPong) && ((sequence->count & 1U) != 0U)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    blockLength    = (sequence->mode == kSCTIMER_DmaPingPong) ? (sequence->count / 2U) : sequence->count;
+    piecesPerBlock = SCTIMER_DMA_PIECE_COUNT(blockLength);
+    pieceCount     = (sequence->mode == kSCTIMER_DmaPingPong) ? (2U * piecesPerBlock) : piecesPerBlock;
+
+    if (pieceCount > handle->descriptorCount)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (SCTIMER_SequenceIsBusyDMA(base, handle))
+    {
+        return kStatus_Busy;
+    }
+
+    dstAddr = (void *)(uint32_t)&base->MATCHREL[sequence->matchReg];
+
+    /* One value per request into the match reload register, the descriptors follow each other through the values
+     * and the last one links back to the first unless the sequence is played once. */
+    for (i = 0U; i < pieceCount; i++)
+    {
+        block         = i / piecesPerBlock;
+        offset        = (i % piecesPerBlock) * DMA_MAX_TRANSFER_COUNT;
+        length        = MIN(DMA_MAX_TRANSFER_COUNT, blockLength - offset);
+        srcAddr       = &sequence->values[(block * blockLength) + offset];
+        isLastOfBlock = ((offset + length) == blockLength);
+
+        if (i < (pieceCount - 1U))
+        {
+            nextDesc = &handle->descriptors[i + 1U];
+        }
+        else if (sequence->mode != kSCTIMER_DmaOneShot)
+        {
+            nextDesc = &handle->descriptors[0];
+        }
+        else
+        {
+            nextDesc = NULL;
+        }
+
+        xferCfg = DMA_CHANNEL_XFER(nextDesc != NULL, true, interrupt && isLastOfBlock && (block == 0U),
+                                   interrupt && isLastOfBlock && (block == 1U), sizeof(uint32_t),
+                                   kDMA_AddressInterleave1xWidth, kDMA_AddressInterleave0xWidth,
+                                   length * sizeof(uint32_t));
+
+        DMA_SetupDescriptor(&handle->descriptors[i], xferCfg, (void *)(uint32_t)srcAddr, dstAddr, nextDesc);
+
+        if (i == 0U)
+        {
+            headXferCfg = xferCfg;
+        }
+    }
+
+    trigger.type  = kDMA_RisingEdgeTrigger;
+    trigger.burst = kDMA_EdgeBurstTransfer1;
+    trigger.wrap  = kDMA_NoWrap;
+
+    /* The head descriptor plays the first piece and then enters the chain at the second one, or at the first one
+     * again when the whole sequence fits one piece. */
+    nextDesc = (pieceCount > 1U) ? &handle->descriptors[1] :
+                                   ((sequence->mode != kSCTIMER_DmaOneShot) ? &handle->descriptors[0] : NULL);
+    DMA_PrepareChannelTransfer(&transferConfig, (void *)(uint32_t)sequence->values, dstAddr, headXferCfg,
+                               kDMA_MemoryToMemory, &trigger, nextDesc);
+    if (DMA_SubmitChannelTransfer(handle->dmaHandle, &transferConfig) != kStatus_Success)
+    {
+        return kStatus_Busy;
+    }
+
+    handle->mode = sequence->mode;
+    handle->busy = true;
+
+    /* The channel now waits for the first request. */
+    DMA_StartTransfer(handle->dmaHandle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Aborts a sequence.
+ *
+ * param base SCTimer peripheral base address.
+ * param handle pointer to sctimer_dma_handle_t structure.
+ */
+void SCTIMER_SequenceAbortDMA(SCT_Type *base, sctimer_dma_handle_t *handle)
+{
+    assert(handle != NULL);
+    assert(base == handle->base);
+
+    if (handle->busy)
+    {
+        DMA_AbortTransfer(handle->dmaHandle);
+        handle->busy = false;
+    }
+}
+
+/*!
+ * brief Tells whether a sequence is playing on the handle.
+ *
+ * param base SCTimer peripheral base address.
+ * param handle pointer to sctimer_dma_handle_t structure.
+ * return True while a sequence is playing or armed, false otherwise.
+ */
+bool SCTIMER_SequenceIsBusyDMA(SCT_Type *base, sctimer_dma_handle_t *handle)
+{
+    assert(handle != NULL);
+    assert(base == handle->base);
+
+    DMA_Type *dmaBase = handle->dmaHandle->base;
+    uint32_t channel  = handle->dmaHandle->channel;
+
+    /* No interrupt ends a one-shot sequence played without a callback, it has ended once the channel went idle
+     * after its last descriptor, which does not reload. */
+    if (handle->busy && (handle->callback == NULL) && (handle->mode == kSCTIMER_DmaOneShot) &&
+        !DMA_ChannelIsActive(dmaBase, channel) &&
+        ((dmaBase->CHANNEL[channel].XFERCFG & DMA_CHANNEL_XFERCFG_CFGVALID_MASK) == 0U))
+    {
+        handle->busy = false;
+    }
+
+    return handle->busy;
+}
+
+/*!
+ * brief Starts the sequences armed on a DMA request.
+ *
+ * param base SCTimer peripheral base address.
+ * param request DMA request line the DMA channels are routed to.
+ * param event Event raising the request.
+ */
+void SCTIMER_StartSequenceDMA(SCT_Type *base, sctimer_dma_request_t request, uint32_t event)
+{
+    /* Only the first events can raise DMA requests. */
+    assert(0U != SCT_DMAREQ0_DEV_0(1UL << event));
+
+    volatile uint32_t *dmaRequest = SCTIMER_GetDmaRequestRegister(base, request);
+
+    *dmaRequest = SCT_DMAREQ0_DEV_0(1UL << event);
+}
+
+/*!
+ * brief Stops raising a DMA request, which pauses the sequences routed to it.
+ *
+ * param base SCTimer peripheral base address.
+ * param request DMA request line.
+ */
+void SCTIMER_StopSequenceDMA(SCT_Type *base, sctimer_dma_request_t request)
+{
+    volatile uint32_t *dmaRequest = SCTIMER_GetDmaRequestRegister(base, request);
+
+    *dmaRequest = 0U;
+}
@@ -0,0 +1,483 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_spi_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_minispi_dma"
+#endif
+
+/*<! Structure definition for spi_dma_private_handle_t. The structure is private. */
+typedef struct _spi_dma_private_handle
+{
+    SPI_Type *base;
+    spi_dma_handle_t *handle;
+} spi_dma_private_handle_t;
+
+/*! @brief SPI transfer state, which is used for SPI transactiaonl APIs' internal state. */
+enum _spi_dma_states_t
+{
+    kSPI_Idle = 0x0, /*!< SPI is idle state */
+    kSPI_Busy        /*!< SPI is busy tranferring data. */
+};
+
+/*<! One element of a DMA descriptor chain before it is written to the descriptor memory. */
+typedef struct _spi_dma_chain_item
+{
+    void *srcAddr;  /*!< Source start address. */
+    void *dstAddr;  /*!< Destination start address. */
+    uint32_t bytes; /*!< Bytes moved by this item. */
+    uint8_t width;  /*!< Transfer width in bytes. */
+    uint8_t srcInc; /*!< Source address interleave. */
+    uint8_t dstInc; /*!< Destination address interleave. */
+} spi_dma_chain_item_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief DMA callback for SPI TX.
+ *
+ * @param handle DMA handler for SPI TX
+ * @param userData user param passed to the callback function
+ */
+static void SPI_TxDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*!
+ * @brief DMA callback for SPI RX.
+ *
+ * @param handle DMA handler for SPI RX
+ * @param userData user param passed to the callback function
+ */
+static void SPI_RxDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*!
+ * @brief Appends a data item to a chain, split in pieces the DMA engine can move with one descriptor.
+ *
+ * @retval kStatus_Success Item appended.
+ * @retval kStatus_InvalidArgument Chain is full.
+ */
+static status_t SPI_AppendChainItem(spi_dma_chain_item_t *items,
+                                    uint32_t *count,
+                                    void *srcAddr,
+                                    void *dstAddr,
+                                    uint32_t bytes,
+                                    uint8_t width,
+                                    uint8_t srcInc,
+                                    uint8_t dstInc);
+
+/*!
+ * @brief Writes a chain to the link descriptors and submits it to a DMA channel.
+ */
+static void SPI_SubmitChainDMA(dma_handle_t *dmaHandle,
+                               spi_dma_chain_item_t *items,
+                               uint32_t count,
+                               dma_descriptor_t *descriptors,
+                               bool interruptOnEnd);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*<! Private handle only used for internally. */
+static spi_dma_private_handle_t s_dmaPrivateHandle[FSL_FEATURE_SOC_SPI_COUNT];
+
+/*<! Link descriptors of the TX and RX chains. */
+SDK_ALIGN(static dma_descriptor_t s_spiTxDescriptor[FSL_FEATURE_SOC_SPI_COUNT][SPI_DMA_MAX_LINK_DESCRIPTORS],
+          FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE);
+SDK_ALIGN(static dma_descriptor_t s_spiRxDescriptor[FSL_FEATURE_SOC_SPI_COUNT][SPI_DMA_MAX_LINK_DESCRIPTORS],
+          FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE);
+
+/*<! Receives the last frame of a transfer whose last segment has no receive buffer. */
+static uint32_t s_spiRxScratch[FSL_FEATURE_SOC_SPI_COUNT];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static status_t SPI_AppendChainItem(spi_dma_chain_item_t *items,
+                                    uint32_t *count,
+                                    void *srcAddr,
+                                    void *dstAddr,
+                                    uint32_t bytes,
+                                    uint8_t width,
+                                    uint8_t srcInc,
+                                    uint8_t dstInc)
+{
+    uint32_t chunk;
+
+    while (bytes != 0U)
+    {
+        /* The head descriptor is not a link descriptor. */
+        if (*count > SPI_DMA_MAX_LINK_DESCRIPTORS)
+        {
+            return kStatus_InvalidArgument;
+        }
+
+        chunk = MIN(bytes, DMA_MAX_TRANSFER_COUNT * (uint32_t)width);
+
+        items[*count].srcAddr = srcAddr;
+        items[*count].dstAddr = dstAddr;
+        items[*count].bytes   = chunk;
+        items[*count].width   = width;
+        items[*count].srcInc  = srcInc;
+        items[*count].dstInc  = dstInc;
+        (*count)++;
+
+        srcAddr = (void *)((uint32_t)srcAddr + (uint32_t)srcInc * chunk);
+        dstAddr = (void *)((uint32_t)dstAddr + (uint32_t)dstInc * chunk);
+        bytes -= chunk;
+    }
+
+    return kStatus_Success;
+}
+
+static void SPI_SubmitChainDMA(dma_handle_t *dmaHandle,
+                               spi_dma_chain_item_t *items,
+                               uint32_t count,
+                               dma_descriptor_t *descriptors,
+                               bool interruptOnEnd)
+{
+    dma_channel_config_t transferConfig;
+    dma_channel_trigger_t trigger;
+    uint32_t xferCfg;
+    uint32_t i;
+    bool isLast;
+
+    /* Item 0 goes to the channel descriptor, item i (i > 0) to link descriptor i - 1. Only the last descriptor
+     * stops the channel and, if requested, raises an interrupt. */
+    for (i = count; i-- > 0U;)
+    {
+        isLast  = (i == (count - 1U));
+        xferCfg = DMA_CHANNEL_XFER(!isLast, isLast, isLast && interruptOnEnd, false, items[i].width, items[i].srcInc,
+                                   items[i].dstInc, items[i].bytes);
+
+        if (i > 0U)
+        {
+            DMA_SetupDescriptor(&descriptors[i - 1U], xferCfg, items[i].srcAddr, items[i].dstAddr,
+                                isLast ? NULL : &descriptors[i]);
+        }
+        else
+        {
+            trigger.type  = kDMA_NoTrigger;
+            trigger.burst = kDMA_SingleTransfer;
+            trigger.wrap  = kDMA_NoWrap;
+
+            DMA_PrepareChannelTransfer(&transferConfig, items[0].srcAddr, items[0].dstAddr, xferCfg,
+                                       kDMA_StaticToStatic, &trigger, isLast ? NULL : &descriptors[0]);
+            (void)DMA_SubmitChannelTransfer(dmaHandle, &transferConfig);
+        }
+    }
+}
+
+static void SPI_TxDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    spi_dma_private_handle_t *privHandle = (spi_dma_private_handle_t *)userData;
+    spi_dma_handle_t *spiHandle          = privHandle->handle;
+
+    /* The TX chain raises no completion interrupt, only errors end up here. */
+    if (!transferDone)
+    {
+        SPI_MasterTransferAbortDMA(privHandle->base, spiHandle);
+        if (spiHandle->callback != NULL)
+        {
+            spiHandle->callback(privHandle->base, spiHandle, kStatus_SPI_Error, spiHandle->userData);
+        }
+    }
+}
+
+static void SPI_RxDMACallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    spi_dma_private_handle_t *privHandle = (spi_dma_private_handle_t *)userData;
+    spi_dma_handle_t *spiHandle          = privHandle->handle;
+    status_t status                      = kStatus_Success;
+
+    if (!transferDone)
+    {
+        SPI_MasterTransferAbortDMA(privHandle->base, spiHandle);
+        status = kStatus_SPI_Error;
+    }
+    else
+    {
+        /* The last frame of the transfer has been received, so it has been shifted out as well. */
+        spiHandle->txInProgress = false;
+        spiHandle->rxInProgress = false;
+        spiHandle->state        = (uint32_t)kSPI_Idle;
+    }
+
+    if (spiHandle->callback != NULL)
+    {
+        spiHandle->callback(privHandle->base, spiHandle, status, spiHandle->userData);
+    }
+}
+
+/*!
+ * brief Initialize the SPI master DMA handle.
+ *
+ * param base SPI peripheral base address.
+ * param handle SPI handle pointer.
+ * param callback User callback function called at the end of a transfer.
+ * param userData User data for callback.
+ * param txHandle DMA handle pointer for SPI Tx, the handle shall be static allocated by users.
+ * param rxHandle DMA handle pointer for SPI Rx, the handle shall be static allocated by users.
+ */
+status_t SPI_MasterTransferCreateHandleDMA(SPI_Type *base,
+                                           spi_dma_handle_t *handle,
+                                           spi_dma_callback_t callback,
+                                           void *userData,
+                                           dma_handle_t *txHandle,
+                                           dma_handle_t *rxHandle)
+{
+    uint32_t instance;
+
+    /* check 'base' */
+    assert(!(NULL == base));
+    /* check 'handle' */
+    assert(!(NULL == handle));
+    /* check DMA handles */
+    assert(!((NULL == txHandle) || (NULL == rxHandle)));
+
+    instance = SPI_GetInstance(base);
+
+    (void)memset(handle, 0, sizeof(*handle));
+    /* Set spi base to handle */
+    handle->txHandle = txHandle;
+    handle->rxHandle = rxHandle;
+    handle->callback = callback;
+    handle->userData = userData;
+
+    /* Set SPI state to idle */
+    handle->state = (uint32_t)kSPI_Idle;
+
+    /* Set handle to global state */
+    s_dmaPrivateHandle[instance].base   = base;
+    s_dmaPrivateHandle[instance].handle = handle;
+
+    /* Install callback for Tx dma channel */
+    DMA_SetCallback(handle->txHandle, SPI_TxDMACallback, &s_dmaPrivateHandle[instance]);
+    DMA_SetCallback(handle->rxHandle, SPI_RxDMACallback, &s_dmaPrivateHandle[instance]);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Perform a non-blocking SPI transfer using DMA.
+ *
+ * param base SPI peripheral base address.
+ * param handle SPI DMA handle pointer.
+ * param xfer Pointer to dma transfer structure.
+ * retval kStatus_Success Successfully start a transfer.
+ * retval kStatus_InvalidArgument Input argument is invalid.
+ * retval kStatus_SPI_Busy SPI is not idle, is running another transfer.
+ */
+status_t SPI_MasterTransferDMA(SPI_Type *base, spi_dma_handle_t *handle, spi_transfer_t *xfer)
+{
+    assert(NULL != xfer);
+
+    spi_dma_segment_t segment;
+
+    /* Keep the slave select already set in TXCTL. */
+    segment.xfer = *xfer;
+    segment.ssel = (spi_ssel_t)(int32_t)(base->TXCTL | ~(uint32_t)kSPI_SselDeAssertAll);
+
+    return SPI_MasterTransferSegmentsDMA(base, handle, &segment, 1U);
+}
+
+/*!
+ * brief Perform a chain of SPI transfers as one DMA operation.
+ *
+ * param base SPI peripheral base address.
+ * param handle SPI DMA handle pointer.
+ * param segments Array of segments.
+ * param count Number of segments, up to SPI_DMA_MAX_SEGMENTS.
+ * retval kStatus_Success Successfully start a transfer.
+ * retval kStatus_InvalidArgument Input argument is invalid or needs more than SPI_DMA_MAX_LINK_DESCRIPTORS.
+ * retval kStatus_SPI_Busy SPI is not idle, is running another transfer.
+ */
+status_t SPI_MasterTransferSegmentsDMA(SPI_Type *base,
+                                       spi_dma_handle_t *handle,
+                                       spi_dma_segment_t *segments,
+                                       uint32_t count)
+{
+    assert(!((NULL == handle) || (NULL == segments)));
+
+    spi_dma_chain_item_t txItems[SPI_DMA_MAX_LINK_DESCRIPTORS + 1U];
+    spi_dma_chain_item_t rxItems[SPI_DMA_MAX_LINK_DESCRIPTORS + 1U];
+    uint32_t txCount = 0U;
+    uint32_t rxCount = 0U;
+    uint32_t instance;
+    uint32_t dataWidth;
+    uint32_t baseCtrl;
+    uint32_t ctrl;
+    uint32_t lastCtrl;
+    uint32_t lastFrame;
+    uint32_t i;
+    bool isLast;
+    spi_transfer_t *xfer;
+    uint8_t width;
+    uint8_t *dummyAddr;
+    size_t totalSize = 0U;
+    status_t result  = kStatus_Success;
+
+    if ((count == 0U) || (count > SPI_DMA_MAX_SEGMENTS))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Check if the device is busy */
+    if (handle->state == (uint32_t)kSPI_Busy)
+    {
+        return kStatus_SPI_Busy;
+    }
+
+    instance  = SPI_GetInstance(base);
+    dummyAddr = (uint8_t *)(uint32_t)&s_dummyData[instance];
+
+    /* Read datawidth from TXCTL, the slave select comes with each segment. */
+    baseCtrl  = base->TXCTL & SPI_TXCTL_LEN_MASK;
+    dataWidth = (baseCtrl & SPI_TXCTL_LEN_MASK) >> SPI_TXCTL_LEN_SHIFT;
+    width     = (dataWidth > (uint32_t)kSPI_Data8Bits) ? 2U : 1U;
+
+    for (i = 0U; (i < count) && (result == kStatus_Success); i++)
+    {
+        xfer   = &segments[i].xfer;
+        isLast = (i == (count - 1U));
+
+        if ((xfer->dataSize == 0U) || ((xfer->dataSize % width) != 0U))
+        {
+            result = kStatus_InvalidArgument;
+            break;
+        }
+
+        ctrl = baseCtrl | ((uint32_t)segments[i].ssel & (uint32_t)kSPI_SselDeAssertAll) |
+               (xfer->configFlags & ((uint32_t)kSPI_EndOfFrame | (uint32_t)kSPI_ReceiveIgnore));
+        if (NULL == xfer->rxData)
+        {
+            ctrl |= (uint32_t)kSPI_ReceiveIgnore;
+        }
+
+        /* The last frame of the transfer is always received, its arrival in RXDAT ends the transfer. */
+        lastCtrl = isLast ? (ctrl & ~(uint32_t)kSPI_ReceiveIgnore) : ctrl;
+
+        /* Last frame of the segment, written with its control bits in a single TXDATCTL access. */
+        if (NULL != xfer->txData)
+        {
+            lastFrame = xfer->txData[xfer->dataSize - width];
+            if (width == 2U)
+            {
+                lastFrame |= ((uint32_t)xfer->txData[xfer->dataSize - 1U]) << 8U;
+            }
+        }
+        else
+        {
+            lastFrame = (uint32_t)s_dummyData[instance];
+        }
+
+        handle->txCtrlWord[i]    = ctrl;
+        handle->txLastDatCtrl[i] = lastFrame | lastCtrl | (xfer->configFlags & (uint32_t)kSPI_EndOfTransfer);
+
+        /* TX: control word, data frames but the last one, last frame with control. */
+        result = SPI_AppendChainItem(txItems, &txCount, &handle->txCtrlWord[i], (void *)(uint32_t)&base->TXCTL,
+                                     sizeof(uint32_t), sizeof(uint32_t), kDMA_AddressInterleave0xWidth,
+                                     kDMA_AddressInterleave0xWidth);
+        if ((result == kStatus_Success) && (xfer->dataSize > width))
+        {
+            if (NULL != xfer->txData)
+            {
+                result = SPI_AppendChainItem(txItems, &txCount, (void *)(uint32_t)xfer->txData,
+                                             (void *)(uint32_t)&base->TXDAT, xfer->dataSize - width, width,
+                                             kDMA_AddressInterleave1xWidth, kDMA_AddressInterleave0xWidth);
+            }
+            else
+            {
+                result = SPI_AppendChainItem(txItems, &txCount, dummyAddr, (void *)(uint32_t)&base->TXDAT,
+                                             xfer->dataSize - width, width, kDMA_AddressInterleave0xWidth,
+                                             kDMA_AddressInterleave0xWidth);
+            }
+        }
+        if (result == kStatus_Success)
+        {
+            result = SPI_AppendChainItem(txItems, &txCount, &handle->txLastDatCtrl[i],
+                                         (void *)(uint32_t)&base->TXDATCTL, sizeof(uint32_t), sizeof(uint32_t),
+                                         kDMA_AddressInterleave0xWidth, kDMA_AddressInterleave0xWidth);
+        }
+
+        /* RX: only segments which do not ignore the receive data produce frames in RXDAT. */
+        if ((result == kStatus_Success) && ((ctrl & (uint32_t)kSPI_ReceiveIgnore) == 0U))
+        {
+            result = SPI_AppendChainItem(rxItems, &rxCount, (void *)(uint32_t)&base->RXDAT, xfer->rxData,
+                                         xfer->dataSize, width, kDMA_AddressInterleave0xWidth,
+                                         kDMA_AddressInterleave1xWidth);
+        }
+        else if ((result == kStatus_Success) && isLast)
+        {
+            result = SPI_AppendChainItem(rxItems, &rxCount, (void *)(uint32_t)&base->RXDAT,
+                                         &s_spiRxScratch[instance], width, width, kDMA_AddressInterleave0xWidth,
+                                         kDMA_AddressInterleave0xWidth);
+        }
+        else
+        {
+            /* Intentional empty: the frames of this segment never reach RXDAT. */
+        }
+
+        totalSize += xfer->dataSize;
+    }
+
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+    handle->state         = (uint32_t)kSPI_Busy;
+    handle->bytesPerFrame = width;
+    handle->transferSize  = totalSize;
+    handle->rxInProgress  = true;
+    handle->txInProgress  = true;
+
+    /* Drop stale receive data so the RX channel only sees frames of this transfer. */
+    while ((base->STAT & SPI_STAT_RXRDY_MASK) != 0U)
+    {
+        (void)base->RXDAT;
+    }
+    SPI_ClearStatusFlags(base, SPI_STAT_RXOV_MASK | SPI_STAT_TXUR_MASK);
+
+    /* The receive channel has to be armed before the first frame is clocked. It reports the end of the transfer. */
+    SPI_SubmitChainDMA(handle->rxHandle, rxItems, rxCount, s_spiRxDescriptor[instance], true);
+    DMA_StartTransfer(handle->rxHandle);
+
+    SPI_SubmitChainDMA(handle->txHandle, txItems, txCount, s_spiTxDescriptor[instance], false);
+    DMA_StartTransfer(handle->txHandle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Abort a SPI transfer using DMA.
+ *
+ * param base SPI peripheral base address.
+ * param handle SPI DMA handle pointer.
+ */
+void SPI_MasterTransferAbortDMA(SPI_Type *base, spi_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    /* Stop tx transfer first */
+    DMA_AbortTransfer(handle->txHandle);
+    /* Then rx transfer */
+    DMA_AbortTransfer(handle->rxHandle);
+
+    /* Set the handle state */
+    handle->txInProgress = false;
+    handle->rxInProgress = false;
+    handle->state        = (uint32_t)kSPI_Idle;
+}
@@ -9,16 +9,24 @@
 #include "fsl_adapter_crc.h"
 #include "fsl_crc.h"
 
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void HAL_CrcStart(const hal_crc_config_t *crcConfig, uint32_t seed);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static CRC_Type *const s_CrcList[] = CRC_BASE_PTRS;
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
-uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length)
+static void HAL_CrcStart(const hal_crc_config_t *crcConfig, uint32_t seed)
 {
-    CRC_Type *const s_CrcList[] = CRC_BASE_PTRS;
     crc_config_t config;
-    uint32_t result;
 
-    config.seed          = crcConfig->crcSeed;
+    config.seed          = seed;
     config.reverseIn     = (bool)crcConfig->crcRefIn;
     config.complementIn  = false;
     config.complementOut = (bool)crcConfig->complementChecksum;
@@ -36,9 +44,36 @@ uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t l
     }
 
     CRC_Init(s_CrcList[0], &config);
+}
+
+void HAL_CrcInit(hal_crc_context_t *context, hal_crc_config_t *crcConfig)
+{
+    assert((NULL != context) && (NULL != crcConfig));
+
+    context->config    = *crcConfig;
+    context->crcState  = crcConfig->crcSeed;
+    context->skipCount = 0U;
+}
+
+void HAL_CrcUpdate(hal_crc_context_t *context, uint8_t *dataIn, uint32_t length)
+{
+    crc_config_t config;
+
+    /* The engine is shared, so the raw sum is saved in the context between updates. */
+    HAL_CrcStart(&context->config, context->crcState);
     CRC_WriteData(s_CrcList[0], dataIn, length);
+    CRC_GetConfig(s_CrcList[0], &config);
 
-    if (crcConfig->crcSize == 2U)
+    context->crcState = config.seed;
+}
+
+uint32_t HAL_CrcFinal(hal_crc_context_t *context)
+{
+    uint32_t result;
+
+    HAL_CrcStart(&context->config, context->crcState);
+
+    if (context->config.crcSize == 2U)
     {
         result = (uint32_t)CRC_Get16bitResult(s_CrcList[0]);
     }
@@ -49,3 +84,13 @@ uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t l
 
     return result;
 }
+
+uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length)
+{
+    hal_crc_context_t context;
+
+    HAL_CrcInit(&context, crcConfig);
+    HAL_CrcUpdate(&context, dataIn, length);
+
+    return HAL_CrcFinal(&context);
+}
@@ -8,69 +8,348 @@
 #include "fsl_common.h"
 #include "fsl_adapter_crc.h"
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#if !((HAL_CRC_SOFTWARE_TABLE_SLICES == 0U) || (HAL_CRC_SOFTWARE_TABLE_SLICES == 1U) || \
+      (HAL_CRC_SOFTWARE_TABLE_SLICES == 4U) || (HAL_CRC_SOFTWARE_TABLE_SLICES == 8U))
+#error "HAL_CRC_SOFTWARE_TABLE_SLICES must be 0, 1, 4 or 8."
+#endif
+
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES != 0U)
+/* Table polynomial, left aligned in the 32-bit shift register like in the bitwise engine. */
+#define HAL_CRC_TABLE_POLY    ((uint32_t)HAL_CRC_SOFTWARE_TABLE_POLY << ((4U - HAL_CRC_SOFTWARE_TABLE_SIZE) << 3U))
+#define HAL_CRC_TABLE_POLY_HI ((HAL_CRC_TABLE_POLY >> 16U) & 0xFFFFU)
+#define HAL_CRC_TABLE_POLY_LO (HAL_CRC_TABLE_POLY & 0xFFFFU)
+
+/*
+ * The register update is linear, so an entry is the XOR of the entries of its set bits. A(n) is the register after
+ * shifting in a single 1 bit followed by n zero bits, A(n + 1) is A(n) shifted once more. Entry bit i of slice k is
+ * A(i + 8k). The terms are enumerators split in 16-bit halves, so each one is evaluated once by the compiler instead
+ * of being expanded again by the preprocessor for every use.
+ */
+#define HAL_CRC_STEP_HI(n)                                                                                      \
+    ((((HAL_CRC_A##n##_HI << 1U) & 0xFFFFU) | (HAL_CRC_A##n##_LO >> 15U)) ^ \
+     ((HAL_CRC_A##n##_HI >> 15U) * HAL_CRC_TABLE_POLY_HI))
+#define HAL_CRC_STEP_LO(n) \
+    (((HAL_CRC_A##n##_LO << 1U) & 0xFFFFU) ^ ((HAL_CRC_A##n##_HI >> 15U) * HAL_CRC_TABLE_POLY_LO))
+#define HAL_CRC_A(m, n) HAL_CRC_A##m##_HI = HAL_CRC_STEP_HI(n), HAL_CRC_A##m##_LO = HAL_CRC_STEP_LO(n)
+
+/* Reflected terms, used when the input bytes are reflected: RA(n) is A(n) with its 32 bits reversed. */
+#define HAL_CRC_REV8(x)                                                                                       \
+    ((((x)&0x01U) << 7U) | (((x)&0x02U) << 5U) | (((x)&0x04U) << 3U) | (((x)&0x08U) << 1U) | \
+     (((x)&0x10U) >> 1U) | (((x)&0x20U) >> 3U) | (((x)&0x40U) >> 5U) | (((x)&0x80U) >> 7U))
+#define HAL_CRC_REV16(x) ((HAL_CRC_REV8((x)&0xFFU) << 8U) | HAL_CRC_REV8(((x) >> 8U) & 0xFFU))
+#define HAL_CRC_RA(n) HAL_CRC_RA##n##_HI = HAL_CRC_REV16(HAL_CRC_A##n##_LO), HAL_CRC_RA##n##_LO = HAL_CRC_REV16(HAL_CRC_A##n##_HI)
+
+/* Table entry of byte b built from the terms of its eight bits. */
+#define HAL_CRC_BIT(b, i, term) ((((uint32_t)(b) >> (i)) & 1U) * (uint32_t)(term))
+#define HAL_CRC_HALF(b, h, t0, t1, t2, t3, t4, t5, t6, t7)                                            \
+    (HAL_CRC_BIT(b, 0U, HAL_CRC_##t0##_##h) ^ HAL_CRC_BIT(b, 1U, HAL_CRC_##t1##_##h) ^ \
+     HAL_CRC_BIT(b, 2U, HAL_CRC_##t2##_##h) ^ HAL_CRC_BIT(b, 3U, HAL_CRC_##t3##_##h) ^ \
+     HAL_CRC_BIT(b, 4U, HAL_CRC_##t4##_##h) ^ HAL_CRC_BIT(b, 5U, HAL_CRC_##t5##_##h) ^ \
+     HAL_CRC_BIT(b, 6U, HAL_CRC_##t6##_##h) ^ HAL_CRC_BIT(b, 7U, HAL_CRC_##t7##_##h))
+#define HAL_CRC_ENTRY(b, t0, t1, t2, t3, t4, t5, t6, t7)                 \
+    ((HAL_CRC_HALF(b, HI, t0, t1, t2, t3, t4, t5, t6, t7) << 16U) | \
+     HAL_CRC_HALF(b, LO, t0, t1, t2, t3, t4, t5, t6, t7))
+
+#if (HAL_CRC_SOFTWARE_TABLE_REFIN != 0U)
+/* Reflected slice k: entry bit i is RA(7 - i + 8k). */
+#define HAL_CRC_T0(b) HAL_CRC_ENTRY(b, RA7, RA6, RA5, RA4, RA3, RA2, RA1, RA0)
+#define HAL_CRC_T1(b) HAL_CRC_ENTRY(b, RA15, RA14, RA13, RA12, RA11, RA10, RA9, RA8)
+#define HAL_CRC_T2(b) HAL_CRC_ENTRY(b, RA23, RA22, RA21, RA20, RA19, RA18, RA17, RA16)
+#define HAL_CRC_T3(b) HAL_CRC_ENTRY(b, RA31, RA30, RA29, RA28, RA27, RA26, RA25, RA24)
+#define HAL_CRC_T4(b) HAL_CRC_ENTRY(b, RA39, RA38, RA37, RA36, RA35, RA34, RA33, RA32)
+#define HAL_CRC_T5(b) HAL_CRC_ENTRY(b, RA47, RA46, RA45, RA44, RA43, RA42, RA41, RA40)
+#define HAL_CRC_T6(b) HAL_CRC_ENTRY(b, RA55, RA54, RA53, RA52, RA51, RA50, RA49, RA48)
+#define HAL_CRC_T7(b) HAL_CRC_ENTRY(b, RA63, RA62, RA61, RA60, RA59, RA58, RA57, RA56)
+#else
+#define HAL_CRC_T0(b) HAL_CRC_ENTRY(b, A0, A1, A2, A3, A4, A5, A6, A7)
+#define HAL_CRC_T1(b) HAL_CRC_ENTRY(b, A8, A9, A10, A11, A12, A13, A14, A15)
+#define HAL_CRC_T2(b) HAL_CRC_ENTRY(b, A16, A17, A18, A19, A20, A21, A22, A23)
+#define HAL_CRC_T3(b) HAL_CRC_ENTRY(b, A24, A25, A26, A27, A28, A29, A30, A31)
+#define HAL_CRC_T4(b) HAL_CRC_ENTRY(b, A32, A33, A34, A35, A36, A37, A38, A39)
+#define HAL_CRC_T5(b) HAL_CRC_ENTRY(b, A40, A41, A42, A43, A44, A45, A46, A47)
+#define HAL_CRC_T6(b) HAL_CRC_ENTRY(b, A48, A49, A50, A51, A52, A53, A54, A55)
+#define HAL_CRC_T7(b) HAL_CRC_ENTRY(b, A56, A57, A58, A59, A60, A61, A62, A63)
+#endif
+
+/* 256 entries of one slice. */
+#define HAL_CRC_ROW2(t, n)   t(n), t((n) + 1U)
+#define HAL_CRC_ROW4(t, n)   HAL_CRC_ROW2(t, n), HAL_CRC_ROW2(t, (n) + 2U)
+#define HAL_CRC_ROW8(t, n)   HAL_CRC_ROW4(t, n), HAL_CRC_ROW4(t, (n) + 4U)
+#define HAL_CRC_ROW16(t, n)  HAL_CRC_ROW8(t, n), HAL_CRC_ROW8(t, (n) + 8U)
+#define HAL_CRC_ROW32(t, n)  HAL_CRC_ROW16(t, n), HAL_CRC_ROW16(t, (n) + 16U)
+#define HAL_CRC_ROW64(t, n)  HAL_CRC_ROW32(t, n), HAL_CRC_ROW32(t, (n) + 32U)
+#define HAL_CRC_ROW128(t, n) HAL_CRC_ROW64(t, n), HAL_CRC_ROW64(t, (n) + 64U)
+#define HAL_CRC_ROW256(t)    HAL_CRC_ROW128(t, 0U), HAL_CRC_ROW128(t, 128U)
+
+/* Terms of the table entries. */
+enum _hal_crc_table_terms
+{
+    HAL_CRC_A0_HI = HAL_CRC_TABLE_POLY_HI,
+    HAL_CRC_A0_LO = HAL_CRC_TABLE_POLY_LO,
+    HAL_CRC_A(1, 0), HAL_CRC_A(2, 1), HAL_CRC_A(3, 2), HAL_CRC_A(4, 3), HAL_CRC_A(5, 4), HAL_CRC_A(6, 5),
+    HAL_CRC_A(7, 6), HAL_CRC_A(8, 7), HAL_CRC_A(9, 8), HAL_CRC_A(10, 9), HAL_CRC_A(11, 10), HAL_CRC_A(12, 11),
+    HAL_CRC_A(13, 12), HAL_CRC_A(14, 13), HAL_CRC_A(15, 14), HAL_CRC_A(16, 15), HAL_CRC_A(17, 16), HAL_CRC_A(18, 17),
+    HAL_CRC_A(19, 18), HAL_CRC_A(20, 19), HAL_CRC_A(21, 20), HAL_CRC_A(22, 21), HAL_CRC_A(23, 22), HAL_CRC_A(24, 23),
+    HAL_CRC_A(25, 24), HAL_CRC_A(26, 25), HAL_CRC_A(27, 26), HAL_CRC_A(28, 27), HAL_CRC_A(29, 28), HAL_CRC_A(30, 29),
+    HAL_CRC_A(31, 30), HAL_CRC_A(32, 31), HAL_CRC_A(33, 32), HAL_CRC_A(34, 33), HAL_CRC_A(35, 34), HAL_CRC_A(36, 35),
+    HAL_CRC_A(37, 36), HAL_CRC_A(38, 37), HAL_CRC_A(39, 38), HAL_CRC_A(40, 39), HAL_CRC_A(41, 40), HAL_CRC_A(42, 41),
+    HAL_CRC_A(43, 42), HAL_CRC_A(44, 43), HAL_CRC_A(45, 44), HAL_CRC_A(46, 45), HAL_CRC_A(47, 46), HAL_CRC_A(48, 47),
+    HAL_CRC_A(49, 48), HAL_CRC_A(50, 49), HAL_CRC_A(51, 50), HAL_CRC_A(52, 51), HAL_CRC_A(53, 52), HAL_CRC_A(54, 53),
+    HAL_CRC_A(55, 54), HAL_CRC_A(56, 55), HAL_CRC_A(57, 56), HAL_CRC_A(58, 57), HAL_CRC_A(59, 58), HAL_CRC_A(60, 59),
+    HAL_CRC_A(61, 60), HAL_CRC_A(62, 61), HAL_CRC_A(63, 62),
+#if (HAL_CRC_SOFTWARE_TABLE_REFIN != 0U)
+    HAL_CRC_RA(0), HAL_CRC_RA(1), HAL_CRC_RA(2), HAL_CRC_RA(3), HAL_CRC_RA(4), HAL_CRC_RA(5), HAL_CRC_RA(6), HAL_CRC_RA(7),
+    HAL_CRC_RA(8), HAL_CRC_RA(9), HAL_CRC_RA(10), HAL_CRC_RA(11), HAL_CRC_RA(12), HAL_CRC_RA(13), HAL_CRC_RA(14), HAL_CRC_RA(15),
+    HAL_CRC_RA(16), HAL_CRC_RA(17), HAL_CRC_RA(18), HAL_CRC_RA(19), HAL_CRC_RA(20), HAL_CRC_RA(21), HAL_CRC_RA(22), HAL_CRC_RA(23),
+    HAL_CRC_RA(24), HAL_CRC_RA(25), HAL_CRC_RA(26), HAL_CRC_RA(27), HAL_CRC_RA(28), HAL_CRC_RA(29), HAL_CRC_RA(30), HAL_CRC_RA(31),
+    HAL_CRC_RA(32), HAL_CRC_RA(33), HAL_CRC_RA(34), HAL_CRC_RA(35), HAL_CRC_RA(36), HAL_CRC_RA(37), HAL_CRC_RA(38), HAL_CRC_RA(39),
+    HAL_CRC_RA(40), HAL_CRC_RA(41), HAL_CRC_RA(42), HAL_CRC_RA(43), HAL_CRC_RA(44), HAL_CRC_RA(45), HAL_CRC_RA(46), HAL_CRC_RA(47),
+    HAL_CRC_RA(48), HAL_CRC_RA(49), HAL_CRC_RA(50), HAL_CRC_RA(51), HAL_CRC_RA(52), HAL_CRC_RA(53), HAL_CRC_RA(54), HAL_CRC_RA(55),
+    HAL_CRC_RA(56), HAL_CRC_RA(57), HAL_CRC_RA(58), HAL_CRC_RA(59), HAL_CRC_RA(60), HAL_CRC_RA(61), HAL_CRC_RA(62), HAL_CRC_RA(63),
+#endif
+};
+#endif /* HAL_CRC_SOFTWARE_TABLE_SLICES */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t HAL_CrcUpdateBitwise(const hal_crc_config_t *crcConfig,
+                                     uint32_t shiftReg,
+                                     const uint8_t *dataIn,
+                                     uint32_t length);
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES != 0U)
+static uint32_t HAL_CrcUpdateTable(uint32_t shiftReg, const uint8_t *dataIn, uint32_t length);
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES != 0U)
+/* Slice k gives the register contribution of a byte followed by k more bytes. */
+static const uint32_t s_crcTable[HAL_CRC_SOFTWARE_TABLE_SLICES][256] = {
+    {HAL_CRC_ROW256(HAL_CRC_T0)},
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES >= 4U)
+    {HAL_CRC_ROW256(HAL_CRC_T1)},
+    {HAL_CRC_ROW256(HAL_CRC_T2)},
+    {HAL_CRC_ROW256(HAL_CRC_T3)},
+#endif
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES >= 8U)
+    {HAL_CRC_ROW256(HAL_CRC_T4)},
+    {HAL_CRC_ROW256(HAL_CRC_T5)},
+    {HAL_CRC_ROW256(HAL_CRC_T6)},
+    {HAL_CRC_ROW256(HAL_CRC_T7)},
+#endif
+};
+#endif
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
-uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length)
+static uint32_t HAL_CrcUpdateBitwise(const hal_crc_config_t *crcConfig,
+                                     uint32_t shiftReg,
+                                     const uint8_t *dataIn,
+                                     uint32_t length)
 {
-    uint32_t shiftReg    = crcConfig->crcSeed << ((4U - crcConfig->crcSize) << 3U);
-    uint32_t crcPoly     = crcConfig->crcPoly << ((4U - crcConfig->crcSize) << 3U);
-    uint32_t crcXorOut   = crcConfig->crcXorOut << ((4U - crcConfig->crcSize) << 3U);
-    uint16_t startOffset = crcConfig->crcStartByte;
-    uint8_t crcBits      = 8U * crcConfig->crcSize;
-    uint32_t computedCRC = 0;
+    uint32_t crcPoly = crcConfig->crcPoly << ((4U - crcConfig->crcSize) << 3U);
+    uint8_t crcBits  = 8U * crcConfig->crcSize;
     uint32_t i, j;
     uint8_t data = 0;
     uint8_t bit;
 
-    /* Size 0 will bypass CRC calculation. */
-    if (crcConfig->crcSize != 0U)
+    for (i = 0; i < length; i++)
     {
-        for (i = 0UL + startOffset; i < length; i++)
+        data = dataIn[i];
+
+        if (crcConfig->crcRefIn == KHAL_CrcRefInput)
         {
-            data = dataIn[i];
+            bit = 0U;
+            for (j = 0U; j < 8U; j++)
+            {
+                bit = (bit << 1);
+                bit |= ((data & 1U) != 0U) ? 1U : 0U;
+                data = (data >> 1);
+            }
+            data = bit;
+        }
+
+        for (j = 0; j < 8U; j++)
+        {
+            bit  = ((data & 0x80U) != 0U) ? 1U : 0U;
+            data = (data << 1);
+
+            if ((shiftReg & 1UL << 31) != 0U)
+            {
+                bit = (bit != 0U) ? 0U : 1U;
+            }
+
+            shiftReg = (shiftReg << 1);
 
-            if (crcConfig->crcRefIn == KHAL_CrcRefInput)
+            if (bit != 0U)
             {
-                bit = 0U;
-                for (j = 0U; j < 8U; j++)
-                {
-                    bit = (bit << 1);
-                    bit |= ((data & 1U) != 0U) ? 1U : 0U;
-                    data = (data >> 1);
-                }
-                data = bit;
+                shiftReg ^= crcPoly;
             }
 
-            for (j = 0; j < 8U; j++)
+            if ((bool)bit && ((crcPoly & (1UL << (32U - crcBits))) != 0U))
+            {
+                shiftReg |= (1UL << (32U - crcBits));
+            }
+            else
             {
-                bit  = ((data & 0x80U) != 0U) ? 1U : 0U;
-                data = (data << 1);
-
-                if ((shiftReg & 1UL << 31) != 0U)
-                {
-                    bit = (bit != 0U) ? 0U : 1U;
-                }
-
-                shiftReg = (shiftReg << 1);
-
-                if (bit != 0U)
-                {
-                    shiftReg ^= crcPoly;
-                }
-
-                if ((bool)bit && ((crcPoly & (1UL << (32U - crcBits))) != 0U))
-                {
-                    shiftReg |= (1UL << (32U - crcBits));
-                }
-                else
-                {
-                    shiftReg &= ~(1UL << (32U - crcBits));
-                }
+                shiftReg &= ~(1UL << (32U - crcBits));
             }
         }
+    }
+
+    return shiftReg;
+}
+
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES != 0U)
+#if (HAL_CRC_SOFTWARE_TABLE_REFIN != 0U)
+static uint32_t HAL_CrcReflect32(uint32_t value)
+{
+    value = ((value >> 1U) & 0x55555555U) | ((value & 0x55555555U) << 1U);
+    value = ((value >> 2U) & 0x33333333U) | ((value & 0x33333333U) << 2U);
+    value = ((value >> 4U) & 0x0F0F0F0FU) | ((value & 0x0F0F0F0FU) << 4U);
+    value = ((value >> 8U) & 0x00FF00FFU) | ((value & 0x00FF00FFU) << 8U);
+
+    return (value >> 16U) | (value << 16U);
+}
+
+static uint32_t HAL_CrcUpdateTable(uint32_t shiftReg, const uint8_t *dataIn, uint32_t length)
+{
+    /* Run the reflected register so that the input bytes need no reflection. */
+    uint32_t crc = HAL_CrcReflect32(shiftReg);
+
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES >= 8U)
+    while (length >= 8U)
+    {
+        crc ^= (uint32_t)dataIn[0] | ((uint32_t)dataIn[1] << 8U) | ((uint32_t)dataIn[2] << 16U) |
+               ((uint32_t)dataIn[3] << 24U);
+        crc = s_crcTable[7][crc & 0xFFU] ^ s_crcTable[6][(crc >> 8U) & 0xFFU] ^ s_crcTable[5][(crc >> 16U) & 0xFFU] ^
+              s_crcTable[4][crc >> 24U] ^ s_crcTable[3][dataIn[4]] ^ s_crcTable[2][dataIn[5]] ^
+              s_crcTable[1][dataIn[6]] ^ s_crcTable[0][dataIn[7]];
+        dataIn += 8U;
+        length -= 8U;
+    }
+#endif
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES >= 4U)
+    while (length >= 4U)
+    {
+        crc ^= (uint32_t)dataIn[0] | ((uint32_t)dataIn[1] << 8U) | ((uint32_t)dataIn[2] << 16U) |
+               ((uint32_t)dataIn[3] << 24U);
+        crc = s_crcTable[3][crc & 0xFFU] ^ s_crcTable[2][(crc >> 8U) & 0xFFU] ^ s_crcTable[1][(crc >> 16U) & 0xFFU] ^
+              s_crcTable[0][crc >> 24U];
+        dataIn += 4U;
+        length -= 4U;
+    }
+#endif
+    while (length != 0U)
+    {
+        crc = (crc >> 8U) ^ s_crcTable[0][(crc ^ *dataIn) & 0xFFU];
+        dataIn++;
+        length--;
+    }
+
+    return HAL_CrcReflect32(crc);
+}
+#else
+static uint32_t HAL_CrcUpdateTable(uint32_t shiftReg, const uint8_t *dataIn, uint32_t length)
+{
+    uint32_t crc = shiftReg;
+
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES >= 8U)
+    while (length >= 8U)
+    {
+        crc ^= ((uint32_t)dataIn[0] << 24U) | ((uint32_t)dataIn[1] << 16U) | ((uint32_t)dataIn[2] << 8U) |
+               (uint32_t)dataIn[3];
+        crc = s_crcTable[7][crc >> 24U] ^ s_crcTable[6][(crc >> 16U) & 0xFFU] ^ s_crcTable[5][(crc >> 8U) & 0xFFU] ^
+              s_crcTable[4][crc & 0xFFU] ^ s_crcTable[3][dataIn[4]] ^ s_crcTable[2][dataIn[5]] ^
+              s_crcTable[1][dataIn[6]] ^ s_crcTable[0][dataIn[7]];
+        dataIn += 8U;
+        length -= 8U;
+    }
+#endif
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES >= 4U)
+    while (length >= 4U)
+    {
+        crc ^= ((uint32_t)dataIn[0] << 24U) | ((uint32_t)dataIn[1] << 16U) | ((uint32_t)dataIn[2] << 8U) |
+               (uint32_t)dataIn[3];
+        crc = s_crcTable[3][crc >> 24U] ^ s_crcTable[2][(crc >> 16U) & 0xFFU] ^ s_crcTable[1][(crc >> 8U) & 0xFFU] ^
+              s_crcTable[0][crc & 0xFFU];
+        dataIn += 4U;
+        length -= 4U;
+    }
+#endif
+    while (length != 0U)
+    {
+        crc = (crc << 8U) ^ s_crcTable[0][(crc >> 24U) ^ *dataIn];
+        dataIn++;
+        length--;
+    }
+
+    return crc;
+}
+#endif /* HAL_CRC_SOFTWARE_TABLE_REFIN */
+#endif /* HAL_CRC_SOFTWARE_TABLE_SLICES */
+
+void HAL_CrcInit(hal_crc_context_t *context, hal_crc_config_t *crcConfig)
+{
+    assert((NULL != context) && (NULL != crcConfig));
+
+    context->config    = *crcConfig;
+    context->skipCount = crcConfig->crcStartByte;
+    context->crcState  = 0U;
 
-        shiftReg ^= crcXorOut;
+    /* Size 0 will bypass CRC calculation. */
+    if (crcConfig->crcSize != 0U)
+    {
+        context->crcState = crcConfig->crcSeed << ((4U - crcConfig->crcSize) << 3U);
+    }
+}
+
+void HAL_CrcUpdate(hal_crc_context_t *context, uint8_t *dataIn, uint32_t length)
+{
+    hal_crc_config_t *crcConfig = &context->config;
+    uint32_t skip               = MIN(context->skipCount, length);
+
+    context->skipCount -= skip;
+    dataIn += skip;
+    length -= skip;
+
+    if ((crcConfig->crcSize == 0U) || (length == 0U))
+    {
+        return;
+    }
+
+#if (HAL_CRC_SOFTWARE_TABLE_SLICES != 0U)
+    if ((crcConfig->crcSize == HAL_CRC_SOFTWARE_TABLE_SIZE) &&
+        ((crcConfig->crcPoly << ((4U - crcConfig->crcSize) << 3U)) == HAL_CRC_TABLE_POLY) &&
+        ((crcConfig->crcRefIn == KHAL_CrcRefInput) == (HAL_CRC_SOFTWARE_TABLE_REFIN != 0U)))
+    {
+        context->crcState = HAL_CrcUpdateTable(context->crcState, dataIn, length);
+        return;
+    }
+#endif
+
+    context->crcState = HAL_CrcUpdateBitwise(crcConfig, context->crcState, dataIn, length);
+}
+
+uint32_t HAL_CrcFinal(hal_crc_context_t *context)
+{
+    hal_crc_config_t *crcConfig = &context->config;
+    uint32_t shiftReg           = context->crcState;
+    uint32_t computedCRC        = 0;
+    uint8_t crcBits;
+    uint32_t i, j;
+
+    /* Size 0 will bypass CRC calculation. */
+    if (crcConfig->crcSize != 0U)
+    {
+        crcBits = 8U * crcConfig->crcSize;
+        shiftReg ^= crcConfig->crcXorOut << ((4U - crcConfig->crcSize) << 3U);
 
         if (crcConfig->crcByteOrder == KHAL_CrcMSByteFirst)
         {
@@ -91,3 +370,13 @@ uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t l
 
     return computedCRC;
 }
+
+uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length)
+{
+    hal_crc_context_t context;
+
+    HAL_CrcInit(&context, crcConfig);
+    HAL_CrcUpdate(&context, dataIn, length);
+
+    return HAL_CrcFinal(&context);
+}
@@ -76,6 +76,15 @@
 #define TM_MIN_TIMER_INTERVAL 300U
 #endif
 
+#if ((TM_MAX_ACTIVE_TIMERS < 1U) || (TM_MAX_ACTIVE_TIMERS > 255U))
+#error "TM_MAX_ACTIVE_TIMERS must be in the range 1 - 255."
+#endif
+
+/**@brief Heaps of running timers, the low power timers are kept apart from the others. */
+#define kTimerHeapOther_c    0U
+#define kTimerHeapLowPower_c 1U
+#define kTimerHeapCount_c    2U
+
 /**@brief Timer status. */
 typedef enum _timer_state
 {
@@ -98,19 +107,30 @@ typedef struct _timer_handle_struct_t
     struct _timer_handle_struct_t *next; /*!< LIST_ element of the link */
     volatile uint8_t tmrStatus;          /*!< Timer status */
     volatile uint8_t tmrType;            /*!< Timer mode*/
+    uint8_t heapIndex;                   /*!< Position in the active timer heap */
     uint64_t timeoutInUs;                /*!< Time out of the timer, should be microseconds */
-    uint64_t remainingUs;                /*!< Remaining of the timer, should be microseconds */
+    uint64_t expireUs;                   /*!< Expiration time of the timer on the timer manager time base */
     timer_callback_t pfCallBack;         /*!< Callback function of the timer */
     void *param;                         /*!< Parameter of callback function of the timer */
 } timer_handle_struct_t;
+/*! @brief Heap of running timers, a min-heap on expiration time in the timer slots. The timers started since the last
+ *         task process follow the heap, the task takes them in. heapIndex of a timer is its position from the start
+ *         of the heap. */
+typedef struct _timer_heap
+{
+    uint8_t count; /*!< Number of timers in the heap */
+    uint8_t ready; /*!< Number of ready timers after the heap */
+} timer_heap_t;
 /*! @brief State structure for timer manager. */
 typedef struct _timermanager_state
 {
-    uint32_t mUsInTimerInterval;                  /*!< Timer intervl in microseconds */
-    uint32_t mUsActiveInTimerInterval;            /*!< Timer active intervl in microseconds */
-    uint32_t previousTimeInUs;                    /*!< Previous timer count in microseconds */
-    timer_handle_struct_t *timerHead;             /*!< Timer list head */
-    TIMER_HANDLE_DEFINE(halTimerHandle);          /*!< Timer handle buffer */
+    uint32_t mUsInTimerInterval;                            /*!< Timer intervl in microseconds */
+    uint32_t mUsActiveInTimerInterval;                      /*!< Timer active intervl in microseconds */
+    uint32_t previousTimeInUs;                              /*!< Previous timer count in microseconds */
+    uint64_t currentTimeUs;                                 /*!< Time base the timer expirations refer to */
+    timer_handle_struct_t *timerHead;                        /*!< Timer list head */
+    timer_handle_struct_t *timerSlots[TM_MAX_ACTIVE_TIMERS]; /*!< Running timers, see timer_heap_t */
+    TIMER_HANDLE_DEFINE(halTimerHandle);                     /*!< Timer handle buffer */
 #if (defined(TM_ENABLE_TIME_STAMP) && (TM_ENABLE_TIME_STAMP > 0U))
     TIME_STAMP_HANDLE_DEFINE(halTimeStampHandle); /*!< Time stamp handle buffer */
 #endif
@@ -124,6 +144,7 @@ typedef struct _timermanager_state
 #endif
     volatile uint8_t numberOfActiveTimers;         /*!< Number of active Timers*/
     volatile uint8_t numberOfLowPowerActiveTimers; /*!< Number of low power active Timers */
+    timer_heap_t timerHeap[kTimerHeapCount_c];     /*!< Heaps of the other and of the low power timers */
     volatile uint8_t timerHardwareIsRunning;       /*!< Hardware timer is runnig */
     uint8_t initialized;                           /*!< Timer is initialized */
 } timermanager_state_t;
@@ -156,7 +177,7 @@ static void TimerManagerTask(void *param);
 void TimerManagerTask(void *param);
 #endif /* TIMER_MANAGER_TASK_PUBLIC */
 
-TIMER_MANAGER_STATIC void TimerEnable(timer_handle_t timerHandle);
+TIMER_MANAGER_STATIC timer_status_t TimerEnable(timer_handle_t timerHandle);
 
 static timer_status_t TimerStop(timer_handle_t timerHandle);
 
@@ -276,39 +297,212 @@ static void NotifyTimersTask(void)
 }
 
 /*! -------------------------------------------------------------------------
- * \brief  Update Remaining Us for all Active timers
- * \return
+ * \brief     Returns the heap a timer runs in
+ * \param[in] th - the timer
+ * \return    kTimerHeapLowPower_c for a low power timer, kTimerHeapOther_c otherwise
  *---------------------------------------------------------------------------*/
-TIMER_MANAGER_STATIC void TimersUpdate(bool updateRemainingUs, bool updateOnlyPowerTimer, uint32_t remainingUs)
+static uint8_t TimerHeapOf(timer_handle_struct_t *th)
 {
-    timer_handle_struct_t *th = s_timermanager.timerHead;
+    return (0U != IsLowPowerTimer(TimerGetTimerType(th))) ? (uint8_t)kTimerHeapLowPower_c : (uint8_t)kTimerHeapOther_c;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Returns the timer slot at a position of a heap
+ * \param[in] heap - the heap
+ * \param[in] index - position from the start of the heap
+ * \return    the slot
+ *---------------------------------------------------------------------------*/
+static timer_handle_struct_t **TimerHeapSlot(uint8_t heap, uint32_t index)
+{
+    /* The low power heap runs down from the last slot, so both heaps share the slots. */
+    if (heap == kTimerHeapLowPower_c)
+    {
+        index = (uint32_t)TM_MAX_ACTIVE_TIMERS - 1U - index;
+    }
+    return &s_timermanager.timerSlots[index];
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Place a timer at a position of a heap
+ * \param[in] heap - the heap
+ * \param[in] th - the timer
+ * \param[in] index - position from the start of the heap
+ *---------------------------------------------------------------------------*/
+static void TimerHeapPlace(uint8_t heap, timer_handle_struct_t *th, uint32_t index)
+{
+    *TimerHeapSlot(heap, index) = th;
+    th->heapIndex               = (uint8_t)index;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Move a timer towards the heap root until its parent expires earlier
+ * \param[in] heap - the heap
+ * \param[in] index - position of the timer in the heap
+ *---------------------------------------------------------------------------*/
+static void TimerHeapSiftUp(uint8_t heap, uint32_t index)
+{
+    timer_handle_struct_t *th = *TimerHeapSlot(heap, index);
+    timer_handle_struct_t *parent;
+
+    while (index > 0U)
+    {
+        parent = *TimerHeapSlot(heap, (index - 1U) >> 1U);
+        if (parent->expireUs <= th->expireUs)
+        {
+            break;
+        }
+        TimerHeapPlace(heap, parent, index);
+        index = (index - 1U) >> 1U;
+    }
+    TimerHeapPlace(heap, th, index);
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Move a timer towards the heap leaves until its children expire later
+ * \param[in] heap - the heap
+ * \param[in] index - position of the timer in the heap
+ *---------------------------------------------------------------------------*/
+static void TimerHeapSiftDown(uint8_t heap, uint32_t index)
+{
+    timer_handle_struct_t *th = *TimerHeapSlot(heap, index);
+    timer_handle_struct_t *next;
+    uint32_t count = s_timermanager.timerHeap[heap].count;
+    uint32_t child = 2U * index + 1U;
+
+    while (child < count)
+    {
+        next = *TimerHeapSlot(heap, child);
+        if (((child + 1U) < count) && ((*TimerHeapSlot(heap, child + 1U))->expireUs < next->expireUs))
+        {
+            child++;
+            next = *TimerHeapSlot(heap, child);
+        }
+        if (th->expireUs <= next->expireUs)
+        {
+            break;
+        }
+        TimerHeapPlace(heap, next, index);
+        index = child;
+        child = 2U * child + 1U;
+    }
+    TimerHeapPlace(heap, th, index);
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Add a started timer after the heap it runs in, the task takes it in
+ * \param[in] th - the timer, expireUs must be set
+ * \return    true if the timer was added, false if all the slots are in use
+ *---------------------------------------------------------------------------*/
+static bool TimerHeapAddReady(timer_handle_struct_t *th)
+{
+    timer_heap_t *other    = &s_timermanager.timerHeap[kTimerHeapOther_c];
+    timer_heap_t *lowPower = &s_timermanager.timerHeap[kTimerHeapLowPower_c];
+    uint8_t heap           = TimerHeapOf(th);
+
+    if (((uint32_t)other->count + other->ready + lowPower->count + lowPower->ready) >= (uint32_t)TM_MAX_ACTIVE_TIMERS)
+    {
+        return false;
+    }
+    TimerHeapPlace(heap, th, (uint32_t)s_timermanager.timerHeap[heap].count + s_timermanager.timerHeap[heap].ready);
+    s_timermanager.timerHeap[heap].ready++;
+    return true;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Remove a ready or active timer from its heap
+ * \param[in] th - the timer
+ *---------------------------------------------------------------------------*/
+static void TimerHeapRemove(timer_handle_struct_t *th)
+{
+    uint8_t heap     = TimerHeapOf(th);
+    timer_heap_t *hp = &s_timermanager.timerHeap[heap];
+    uint32_t index   = th->heapIndex;
+    timer_handle_struct_t *last;
+
+    assert(*TimerHeapSlot(heap, index) == th);
+    if (index >= hp->count)
+    {
+        /* A ready timer, the last ready timer takes its place. */
+        hp->ready--;
+        TimerHeapPlace(heap, *TimerHeapSlot(heap, (uint32_t)hp->count + hp->ready), index);
+        return;
+    }
+
+    hp->count--;
+    if (index != hp->count)
+    {
+        /* Fill the hole with the last timer and restore the heap order around it. */
+        last = *TimerHeapSlot(heap, hp->count);
+        TimerHeapPlace(heap, last, index);
+        TimerHeapSiftUp(heap, index);
+        TimerHeapSiftDown(heap, last->heapIndex);
+    }
+    if (0U != hp->ready)
+    {
+        /* Keep the ready timers right after the heap. */
+        TimerHeapPlace(heap, *TimerHeapSlot(heap, (uint32_t)hp->count + hp->ready), hp->count);
+    }
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Take the ready timers of a heap in, they become active
+ * \param[in] heap - the heap
+ *---------------------------------------------------------------------------*/
+static void TimerHeapTakeReady(uint8_t heap)
+{
+    timer_heap_t *hp = &s_timermanager.timerHeap[heap];
+
+    while (0U != hp->ready)
+    {
+        TimerSetTimerStatus(*TimerHeapSlot(heap, hp->count), (uint8_t)kTimerStateActive_c);
+        hp->ready--;
+        hp->count++;
+        TimerHeapSiftUp(heap, (uint32_t)hp->count - 1U);
+    }
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief  Returns the active timer that expires first
+ * \return the timer, NULL if no timer is active
+ *---------------------------------------------------------------------------*/
+static timer_handle_struct_t *TimerHeapFirst(void)
+{
+    timer_handle_struct_t *first = NULL;
+    timer_handle_struct_t *th;
+    uint8_t heap;
 
-    if ((s_timermanager.numberOfLowPowerActiveTimers != 0U) || (s_timermanager.numberOfActiveTimers != 0U))
+    for (heap = 0U; heap < (uint8_t)kTimerHeapCount_c; heap++)
     {
-        while (th != NULL)
+        if (0U != s_timermanager.timerHeap[heap].count)
         {
-            if (updateRemainingUs)
+            th = *TimerHeapSlot(heap, 0U);
+            if ((NULL == first) || (th->expireUs < first->expireUs))
             {
-                if ((timer_state_t)TimerGetTimerStatus(th) == kTimerStateActive_c)
-                {
-                    if ((updateOnlyPowerTimer && (0U != IsLowPowerTimer(TimerGetTimerType(th)))) ||
-                        (!updateOnlyPowerTimer))
-
-                    {
-                        if (th->remainingUs > remainingUs)
-                        {
-                            th->remainingUs = th->remainingUs - remainingUs;
-                        }
-                        else
-                        {
-                            th->remainingUs = 0;
-                        }
-                    }
-                }
+                first = th;
             }
-            th = th->next;
         }
     }
+    return first;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief  Advance the time base the active timers expire on
+ * \return
+ *---------------------------------------------------------------------------*/
+TIMER_MANAGER_STATIC void TimersUpdate(uint32_t elapsedUs)
+{
+    /* Expirations are absolute, so no timer has to be visited to age it. */
+    s_timermanager.currentTimeUs += elapsedUs;
+}
+
+/*! -------------------------------------------------------------------------
+ * \brief     Returns the time until a timer expires
+ * \param[in] th - the timer
+ * \return    remaining time in microseconds, 0 if the timer has expired
+ *---------------------------------------------------------------------------*/
+static uint64_t TimerGetRemainingUs(timer_handle_struct_t *th)
+{
+    return (th->expireUs > s_timermanager.currentTimeUs) ? (th->expireUs - s_timermanager.currentTimeUs) : 0U;
 }
 
 /*! -------------------------------------------------------------------------
@@ -321,65 +515,59 @@ TIMER_MANAGER_STATIC void TimersUpdate(bool updateRemainingUs, bool updateOnlyPo
 static void TimerManagerTaskProcess(bool isInTaskContext)
 {
     uint8_t timerType;
-    timer_state_t state;
+    uint64_t remainingUs;
     uint32_t previousBeforeEnableTimeInUs;
     uint8_t activeLPTimerNum, activeTimerNum;
     uint32_t regPrimask               = DisableGlobalIRQ();
     s_timermanager.mUsInTimerInterval = HAL_TimerGetMaxTimeout((hal_timer_handle_t)s_timermanager.halTimerHandle);
-    timer_handle_struct_t *th         = s_timermanager.timerHead;
-    timer_handle_struct_t *th_next;
-    while (NULL != th)
+    timer_handle_struct_t *th;
+
+    /* Timers started since the last run are now taken into account. */
+    TimerHeapTakeReady((uint8_t)kTimerHeapOther_c);
+    TimerHeapTakeReady((uint8_t)kTimerHeapLowPower_c);
+
+    /* Active timers expiration will be processed only in the TimerManager task context
+     * this is to ensure the timers callbacks are called only in the task context.
+     * Timers started by a callback stay ready until the next run, which their start has requested. */
+    while (isInTaskContext == true)
     {
-        timerType = TimerGetTimerType(th);
-        state     = (timer_state_t)TimerGetTimerStatus(th);
-        th_next   = th->next;
-        if (kTimerStateReady_c == state)
+        th = TimerHeapFirst();
+        if ((NULL == th) || (th->expireUs > s_timermanager.currentTimeUs))
         {
-            TimerSetTimerStatus(th, (uint8_t)kTimerStateActive_c);
-            if (s_timermanager.mUsInTimerInterval > th->timeoutInUs)
-            {
-                s_timermanager.mUsInTimerInterval = (uint32_t)th->timeoutInUs;
-            }
+            break;
         }
 
-        if (kTimerStateActive_c == state)
+        /* If this is an interval timer, restart it. Otherwise, mark it as inactive. */
+        timerType = TimerGetTimerType(th);
+        if (0U != (timerType & (uint32_t)(kTimerModeSingleShot)))
         {
-            /* Active timers expiration will be processed only in the TimerManager task context
-             * this is to ensure the timers callbacks are called only in the task context */
-            if ((0U >= th->remainingUs) && (isInTaskContext == true))
-            {
-                /* If this is an interval timer, restart it. Otherwise, mark it as inactive. */
-                if (0U != (timerType & (uint32_t)(kTimerModeSingleShot)))
-                {
-                    th->remainingUs = 0;
-                    (void)TimerStop(th);
-                    state = (timer_state_t)TimerGetTimerStatus(th);
-                }
-                else
-                {
-                    th->remainingUs = th->timeoutInUs;
-                }
-
-                /* This timer has expired. */
-                /*Call callback if it is not NULL*/
-                EnableGlobalIRQ(regPrimask);
-                if (NULL != th->pfCallBack)
-                {
-                    th->pfCallBack(th->param);
-                }
-                regPrimask = DisableGlobalIRQ();
-            }
-
-            if ((kTimerStateActive_c == state) && (s_timermanager.mUsInTimerInterval > th->remainingUs))
-            {
-                s_timermanager.mUsInTimerInterval = (uint32_t)th->remainingUs;
-            }
+            (void)TimerStop(th);
         }
         else
         {
-            /* Ignore any timer that is not active. */
+            th->expireUs = s_timermanager.currentTimeUs + MAX(th->timeoutInUs, (uint64_t)TM_MIN_TIMER_INTERVAL);
+            TimerHeapSiftDown(TimerHeapOf(th), 0U);
+        }
+
+        /* This timer has expired. */
+        /*Call callback if it is not NULL*/
+        EnableGlobalIRQ(regPrimask);
+        if (NULL != th->pfCallBack)
+        {
+            th->pfCallBack(th->param);
+        }
+        regPrimask = DisableGlobalIRQ();
+    }
+
+    /* The first timer of the heaps sets the next hardware timeout. */
+    th = TimerHeapFirst();
+    if (NULL != th)
+    {
+        remainingUs = TimerGetRemainingUs(th);
+        if (s_timermanager.mUsInTimerInterval > remainingUs)
+        {
+            s_timermanager.mUsInTimerInterval = (uint32_t)remainingUs;
         }
-        th = th_next;
     }
     if (s_timermanager.mUsInTimerInterval < TM_MIN_TIMER_INTERVAL)
     {
@@ -400,9 +588,7 @@ static void TimerManagerTaskProcess(bool isInTaskContext)
             if (previousBeforeEnableTimeInUs >
                 s_timermanager.previousTimeInUs)
             {
-                TimersUpdate(true, false,
-                             (previousBeforeEnableTimeInUs -
-                              s_timermanager.previousTimeInUs));
+                TimersUpdate(previousBeforeEnableTimeInUs - s_timermanager.previousTimeInUs);
             }
             HAL_TimerDisable((hal_timer_handle_t)s_timermanager.halTimerHandle);
             previousBeforeEnableTimeInUs =
@@ -431,7 +617,7 @@ static void TimersCheckAndUpdate(uint32_t remainingUs)
 {
     if (remainingUs >= s_timermanager.previousTimeInUs)
     {
-        TimersUpdate(true, false, (remainingUs - s_timermanager.previousTimeInUs));
+        TimersUpdate(remainingUs - s_timermanager.previousTimeInUs);
     }
 }
 
@@ -535,6 +721,7 @@ static timer_status_t TimerStop(timer_handle_t timerHandle)
         status = kStatus_TimerSuccess;
         if ((state == kTimerStateActive_c) || (state == kTimerStateReady_c))
         {
+            TimerHeapRemove((timer_handle_struct_t *)timerHandle);
             TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateInactive_c);
             DecrementActiveTimerNumber(TimerGetTimerType(timerHandle));
             /* if no sw active timers are enabled, */
@@ -555,22 +742,34 @@ static timer_status_t TimerStop(timer_handle_t timerHandle)
 /*! -------------------------------------------------------------------------
  * \brief     Enable the specified timer
  * \param[in] timerHandle - the handle of the timer
+ * \return    see definition of timer_status_t
  *---------------------------------------------------------------------------*/
-TIMER_MANAGER_STATIC void TimerEnable(timer_handle_t timerHandle)
+TIMER_MANAGER_STATIC timer_status_t TimerEnable(timer_handle_t timerHandle)
 {
+    timer_handle_struct_t *th = timerHandle;
+    timer_status_t status     = kStatus_TimerSuccess;
     uint32_t currentTimerCount;
     assert(timerHandle);
     uint32_t regPrimask = DisableGlobalIRQ();
 
     if ((uint8_t)kTimerStateInactive_c == TimerGetTimerStatus(timerHandle))
     {
-        IncrementActiveTimerNumber(TimerGetTimerType(timerHandle));
-        TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateReady_c);
         currentTimerCount = HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle);
         TimersUpdateWithoutSyncTask(currentTimerCount);
+        th->expireUs = s_timermanager.currentTimeUs + th->timeoutInUs;
+        if (TimerHeapAddReady(th))
+        {
+            IncrementActiveTimerNumber(TimerGetTimerType(timerHandle));
+            TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateReady_c);
+        }
+        else
+        {
+            status = kStatus_TimerOutOfRange;
+        }
     }
     EnableGlobalIRQ(regPrimask);
     NotifyTimersTask();
+    return status;
 }
 
 /*****************************************************************************
@@ -712,18 +911,29 @@ void TM_EnterTickless(timer_handle_t timerHandle, uint64_t timerTimeout)
 
     uint32_t regPrimask = DisableGlobalIRQ();
 
+    remainingUs = HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle);
+
     if (timerTimeout > 0U)
     {
+        /* Restart the timer if it is already running */
+        (void)TimerStop(timerHandle);
+
         /* Set current timer as a single shot timer */
         TimerSetTimerType(timerHandle, timerType);
 
         /* Register timeout */
+        TimersUpdateWithoutSyncTask(remainingUs);
         th->timeoutInUs = timerTimeout;
-        th->remainingUs = timerTimeout;
+        th->expireUs    = s_timermanager.currentTimeUs + timerTimeout;
 
-        /* Enable timer */
-        ++s_timermanager.numberOfActiveTimers;
-        TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateReady_c);
+        /* Enable timer, without a free slot the device would not wake up in time */
+        bool added = TimerHeapAddReady(th);
+        assert(added);
+        if (added)
+        {
+            ++s_timermanager.numberOfActiveTimers;
+            TimerSetTimerStatus(timerHandle, (uint8_t)kTimerStateReady_c);
+        }
     }
 
     /* Sync directly the timer manager ressources while bypassing the task
@@ -731,7 +941,6 @@ void TM_EnterTickless(timer_handle_t timerHandle, uint64_t timerTimeout)
      * interrupts
      * This should guarantuee that the device will wake up at the latest in
      * timerTimeout usec */
-    remainingUs = HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle);
     TimersUpdateDirectSync(remainingUs);
 
     EnableGlobalIRQ(regPrimask);
@@ -929,6 +1138,7 @@ timer_status_t TM_InstallCallback(timer_handle_t timerHandle, timer_callback_t c
  *
  * @retval kStatus_TimerSuccess    Timer start succeed.
  * @retval kStatus_TimerError      An error occurred.
+ * @retval kStatus_TimerOutOfRange TM_MAX_ACTIVE_TIMERS timers are already running.
  */
 timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t timerTimeout)
 {
@@ -944,26 +1154,22 @@ timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t
     if (0U != ((uint8_t)timerType & (uint8_t)kTimerModeSetMinuteTimer))
     {
         th->timeoutInUs = (uint64_t)1000U * 1000U * 60U * timerTimeout;
-        th->remainingUs = (uint64_t)1000U * 1000U * 60U * timerTimeout;
     }
     else if (0U != ((uint8_t)timerType & (uint8_t)kTimerModeSetSecondTimer))
     {
         th->timeoutInUs = (uint64_t)1000U * 1000U * timerTimeout;
-        th->remainingUs = (uint64_t)1000U * 1000U * timerTimeout;
     }
     else if (0U != ((uint8_t)timerType & (uint8_t)kTimerModeSetMicrosTimer))
     {
         th->timeoutInUs = (uint64_t)timerTimeout;
-        th->remainingUs = (uint64_t)timerTimeout;
     }
     else
     {
         th->timeoutInUs = (uint64_t)1000U * timerTimeout;
-        th->remainingUs = (uint64_t)1000U * timerTimeout;
     }
 
     /* Enable timer, the timer task will do the rest of the work. */
-    TimerEnable(timerHandle);
+    status = TimerEnable(timerHandle);
 
     return status;
 }
@@ -1001,7 +1207,7 @@ uint32_t TM_GetRemainingTime(timer_handle_t timerHandle)
 {
     timer_handle_struct_t *timerState = timerHandle;
     assert(timerHandle);
-    return ((uint32_t)(timerState->remainingUs) -
+    return ((uint32_t)TimerGetRemainingUs(timerState) -
             (uint32_t)(HAL_TimerGetCurrentTimerCount((hal_timer_handle_t)s_timermanager.halTimerHandle) -
                        s_timermanager.previousTimeInUs));
 }
@@ -1017,11 +1223,14 @@ uint32_t TM_GetFirstExpireTime(uint8_t timerType)
 {
     uint32_t min = 0xFFFFFFFFU;
     uint32_t remainingTime;
+    timer_handle_struct_t *th;
+    uint8_t heap;
 
-    timer_handle_struct_t *th = s_timermanager.timerHead;
-    while (NULL != th)
+    /* Only the first timer of each heap can expire first. */
+    for (heap = 0U; heap < (uint8_t)kTimerHeapCount_c; heap++)
     {
-        if ((bool)TM_IsTimerActive(th) && ((timerType & TimerGetTimerType(th)) > 0U))
+        th = (0U != s_timermanager.timerHeap[heap].count) ? *TimerHeapSlot(heap, 0U) : NULL;
+        if ((NULL != th) && ((timerType & TimerGetTimerType(th)) > 0U))
         {
             remainingTime = TM_GetRemainingTime(th);
             if (remainingTime < min)
@@ -1029,7 +1238,6 @@ uint32_t TM_GetFirstExpireTime(uint8_t timerType)
                 min = remainingTime;
             }
         }
-        th = th->next;
     }
     return min;
 }
@@ -90,6 +90,18 @@
 #define TM_ENABLE_TIME_STAMP (0)
 #endif
 
+/*
+ * @brief   Configures the maximum number of timers running at the same time.
+ * Running timers are kept in min-heaps ordered by expiration time, this sets the number of heap slots, one pointer
+ * each. At most 8 timers run at once by default, TM_Start() returns kStatus_TimerOutOfRange when all the slots are
+ * in use. Applications that run more timers define it in their build, the timer armed by TM_EnterTickless() takes a
+ * slot too.
+ * VALID RANGE: 1 - 255
+ */
+#ifndef TM_MAX_ACTIVE_TIMERS
+#define TM_MAX_ACTIVE_TIMERS (8U)
+#endif
+
 /*! @brief Definition of timer manager handle size. */
 #define TIMER_HANDLE_SIZE (32U)
 
@@ -247,6 +259,7 @@ void TM_EnterLowpower(void);
  * Starts a timer and sync all timer manager ressources before programming HW
  * timer module. Everything is done by bypassing the timer manager task as this
  * function is usually called under masked interrupts (no context switch).
+ * The timer takes one of the TM_MAX_ACTIVE_TIMERS slots, a free one must be left for it.
  *
  * @param timerHandle    the handle of the timer
  * @param timerTimeout   The timer timeout in microseconds unit
@@ -325,6 +338,7 @@ timer_status_t TM_InstallCallback(timer_handle_t timerHandle, timer_callback_t c
  *                       kTimerModeSetMicrosTimer is used.
  *
  * @retval kStatus_TimerSuccess    Timer start succeed.
+ * @retval kStatus_TimerOutOfRange TM_MAX_ACTIVE_TIMERS timers are already running.
  * @retval kStatus_TimerError      An error occurred.
  */
 timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t timerTimeout);
@@ -369,6 +383,10 @@ uint32_t TM_GetRemainingTime(timer_handle_t timerHandle);
 /*!
  * @brief Get the first expire time of timer
  *
+ * Low power timers and the other timers are kept apart, and only the first timer to expire of each is checked against
+ * timerType, so the call takes constant time. Pass kTimerModeLowPowerTimer for the low power timers, or all the mode
+ * bits for every timer.
+ *
  * @param timerType  The mode of the timer, for example: kTimerModeSingleShot for the timer will expire
  *                   only once, kTimerModeIntervalTimer, the timer will restart each time it expires.
  *
@@ -0,0 +1,276 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_adc_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_adc_dma"
+#endif
+
+/*<! @brief Structure definition for adc_dma_handle_t. The structure is private. */
+typedef struct _adc_dma_private_handle
+{
+    ADC_Type *base;
+    adc_dma_handle_t *handle;
+} adc_dma_private_handle_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief DMA callback for ADC DMA driver.
+ *
+ * @param handle DMA handler for ADC DMA driver
+ * @param userData user param passed to the callback function
+ */
+static void ADC_TransferCallbackDMA(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*<! Private handle only used for internally. */
+static adc_dma_private_handle_t s_dmaPrivateHandle[FSL_FEATURE_SOC_ADC_COUNT];
+
+/*<! Ping-pong link descriptors, the first block uses the channel head descriptor and links into this table. */
+SDK_ALIGN(static dma_descriptor_t s_adcDmaDescriptor[FSL_FEATURE_SOC_ADC_COUNT][2],
+          FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE);
+
+/*******************************************************************************
+ * Codes
+ ******************************************************************************/
+
+static void ADC_TransferCallbackDMA(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    adc_dma_private_handle_t *dmaPrivateHandle = (adc_dma_private_handle_t *)userData;
+    adc_dma_handle_t *adcHandle;
+    status_t status = kStatus_Success;
+    uint32_t *block = NULL;
+
+    /* Don't do anything if we don't have a valid handle. */
+    if ((handle == NULL) || (dmaPrivateHandle == NULL))
+    {
+        return;
+    }
+
+    adcHandle = dmaPrivateHandle->handle;
+
+    if (transferDone)
+    {
+        /* Descriptor of block 0 raises INTA, descriptor of block 1 raises INTB. */
+        block = adcHandle->blockBuffer[(intmode == (uint32_t)kDMA_IntB) ? 1U : 0U];
+        adcHandle->blockCount++;
+    }
+    else
+    {
+        status = kStatus_ADC_DMA_TransferError;
+    }
+
+    if (adcHandle->callback != NULL)
+    {
+        adcHandle->callback(dmaPrivateHandle->base, adcHandle, status, block, adcHandle->userData);
+    }
+}
+
+/*!
+ * brief Init the ADC handle which is used in the DMA stream functions.
+ *
+ * param base ADC peripheral base address.
+ * param handle pointer to adc_dma_handle_t structure.
+ * param callback pointer to user callback function.
+ * param userData user param passed to the callback function.
+ * param dmaHandle DMA handle pointer.
+ */
+void ADC_TransferCreateHandleDMA(ADC_Type *base,
+                                 adc_dma_handle_t *handle,
+                                 adc_dma_block_callback_t callback,
+                                 void *userData,
+                                 dma_handle_t *dmaHandle)
+{
+    uint32_t instance;
+
+    assert(handle != NULL);
+    assert(dmaHandle != NULL);
+
+    /* Zero handle. */
+    (void)memset(handle, 0, sizeof(*handle));
+
+    /* Look up instance number */
+    instance = ADC_GetInstance(base);
+
+    /* Set the user callback and userData. */
+    handle->callback  = callback;
+    handle->userData  = userData;
+    handle->dmaHandle = dmaHandle;
+
+    s_dmaPrivateHandle[instance].base   = base;
+    s_dmaPrivateHandle[instance].handle = handle;
+
+    DMA_SetCallback(dmaHandle, ADC_TransferCallbackDMA, &s_dmaPrivateHandle[instance]);
+}
+
+/*!
+ * brief Starts continuous sampling of conversion sequence A into ping-pong buffers.
+ *
+ * param base ADC peripheral base address.
+ * param handle pointer to adc_dma_handle_t structure.
+ * param config pointer to stream configuration.
+ * retval kStatus_Success Stream started.
+ * retval kStatus_InvalidArgument Invalid buffer or block size.
+ * retval kStatus_ADC_DMA_Busy A stream is already running on this handle.
+ */
+status_t ADC_TransferStartStreamDMA(ADC_Type *base, adc_dma_handle_t *handle, const adc_dma_stream_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+
+    dma_channel_config_t transferConfig;
+    dma_channel_trigger_t trigger;
+    dma_descriptor_t *descriptor;
+    uint32_t xferCfg[2];
+    uint32_t seqCtrl;
+    uint32_t i;
+    void *gdatAddr = (void *)(uint32_t)&base->SEQ_GDAT[0];
+
+    if ((config->blockBuffer[0] == NULL) || (config->blockBuffer[1] == NULL) || (config->samplesPerBlock == 0U) ||
+        (config->samplesPerBlock > ADC_DMA_MAX_SAMPLES_PER_BLOCK))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (handle->isStreaming)
+    {
+        return kStatus_ADC_DMA_Busy;
+    }
+
+    descriptor = s_adcDmaDescriptor[ADC_GetInstance(base)];
+
+    handle->blockBuffer[0]  = config->blockBuffer[0];
+    handle->blockBuffer[1]  = config->blockBuffer[1];
+    handle->samplesPerBlock = config->samplesPerBlock;
+    handle->blockCount      = 0U;
+
+    /* Saved for ADC_TransferStopStreamDMA(), which hands the sequence back as it was found. */
+    handle->seqCtrlMode         = base->SEQ_CTRL[0] & ADC_SEQ_CTRL_MODE_MASK;
+    handle->seqInterruptEnabled = (base->INTEN & (uint32_t)kADC_ConvSeqAInterruptEnable) != 0U;
+
+    /* Raise the sequence A interrupt/DMA trigger at the end of each conversion instead of each sequence. The
+     * sequence has to be disabled while its mode is changed. */
+    seqCtrl           = base->SEQ_CTRL[0];
+    base->SEQ_CTRL[0] = seqCtrl & ~(ADC_SEQ_CTRL_SEQ_ENA_MASK | ADC_SEQ_CTRL_BURST_MASK);
+    base->SEQ_CTRL[0] = (seqCtrl & ~(ADC_SEQ_CTRL_MODE_MASK | ADC_SEQ_CTRL_BURST_MASK)) | ADC_SEQ_CTRL_SEQ_ENA_MASK;
+
+    /* One word per trigger from the global data register, then move on to the other block. */
+    for (i = 0U; i < 2U; i++)
+    {
+        xferCfg[i] = DMA_CHANNEL_XFER(true, true, i == 0U, i == 1U, sizeof(uint32_t), kDMA_AddressInterleave0xWidth,
+                                      kDMA_AddressInterleave1xWidth, config->samplesPerBlock * sizeof(uint32_t));
+    }
+
+    DMA_SetupDescriptor(&descriptor[0], xferCfg[0], gdatAddr, config->blockBuffer[0], &descriptor[1]);
+    DMA_SetupDescriptor(&descriptor[1], xferCfg[1], gdatAddr, config->blockBuffer[1], &descriptor[0]);
+
+    trigger.type  = kDMA_RisingEdgeTrigger;
+    trigger.burst = kDMA_EdgeBurstTransfer1;
+    trigger.wrap  = kDMA_NoWrap;
+
+    /* The head descriptor fills block 0 and then enters the ping-pong chain at block 1. */
+    DMA_PrepareChannelTransfer(&transferConfig, gdatAddr, config->blockBuffer[0], xferCfg[0], kDMA_MemoryToMemory,
+                               &trigger, &descriptor[1]);
+    if (DMA_SubmitChannelTransfer(handle->dmaHandle, &transferConfig) != kStatus_Success)
+    {
+        return kStatus_ADC_DMA_Busy;
+    }
+
+    /* Discard a stale result, otherwise the trigger stays asserted and the first edge is never seen. */
+    (void)base->SEQ_GDAT[0];
+
+    handle->isStreaming = true;
+
+    DMA_StartTransfer(handle->dmaHandle);
+    ADC_EnableInterrupts(base, (uint32_t)kADC_ConvSeqAInterruptEnable);
+
+    if (config->enableBurstMode)
+    {
+        ADC_EnableConvSeqABurstMode(base, true);
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops a running sequence A stream.
+ *
+ * Burst mode is turned off and sequence A gets back the interrupt mode and the interrupt enable it had before
+ * ADC_TransferStartStreamDMA().
+ *
+ * param base ADC peripheral base address.
+ * param handle pointer to adc_dma_handle_t structure.
+ */
+void ADC_TransferStopStreamDMA(ADC_Type *base, adc_dma_handle_t *handle)
+{
+    uint32_t seqCtrl;
+    uint32_t channelMask;
+
+    assert(handle != NULL);
+
+    if (handle->isStreaming)
+    {
+        ADC_EnableConvSeqABurstMode(base, false);
+        if (!handle->seqInterruptEnabled)
+        {
+            ADC_DisableInterrupts(base, (uint32_t)kADC_ConvSeqAInterruptEnable);
+        }
+        DMA_AbortTransfer(handle->dmaHandle);
+
+        /* A block finished just before the abort must not be reported to the next stream. */
+        channelMask = 1UL << DMA_CHANNEL_INDEX(handle->dmaHandle->base, handle->dmaHandle->channel);
+        DMA_COMMON_REG_SET(handle->dmaHandle->base, handle->dmaHandle->channel, INTA, channelMask);
+        DMA_COMMON_REG_SET(handle->dmaHandle->base, handle->dmaHandle->channel, INTB, channelMask);
+
+        /* Restore the interrupt mode, again with the sequence disabled while it changes. */
+        seqCtrl           = base->SEQ_CTRL[0];
+        base->SEQ_CTRL[0] = seqCtrl & ~ADC_SEQ_CTRL_SEQ_ENA_MASK;
+        base->SEQ_CTRL[0] = (seqCtrl & ~ADC_SEQ_CTRL_MODE_MASK) | handle->seqCtrlMode;
+
+        handle->isStreaming = false;
+    }
+}
+
+/*!
+ * brief Gets the number of blocks completed by a running stream.
+ *
+ * param base ADC peripheral base address.
+ * param handle pointer to adc_dma_handle_t structure.
+ * param count Number of blocks completed since the stream was started.
+ * retval kStatus_Success Count returned.
+ * retval kStatus_NoTransferInProgress No stream is running.
+ */
+status_t ADC_TransferGetBlockCountDMA(ADC_Type *base, adc_dma_handle_t *handle, uint32_t *count)
+{
+    assert(handle != NULL);
+
+    if (count == NULL)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (!handle->isStreaming)
+    {
+        *count = 0U;
+        return kStatus_NoTransferInProgress;
+    }
+
+    *count = handle->blockCount;
+    return kStatus_Success;
+}
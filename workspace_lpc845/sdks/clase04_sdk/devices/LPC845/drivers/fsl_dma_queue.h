@@ -0,0 +1,230 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_DMA_QUEUE_H_
+#define FSL_DMA_QUEUE_H_
+
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup dma_queue_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief DMA queue driver version. */
+#define FSL_DMA_QUEUE_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*! @brief _dma_queue_status DMA queue status */
+enum
+{
+    kStatus_DMA_QueueFull = MAKE_STATUS(kStatusGroup_DMA, 1), /*!< Not enough free descriptors in the pool. */
+};
+
+/*!
+ * @brief Number of pool descriptors used by a transfer of @p count units.
+ *
+ * The last unit of a transfer has a descriptor of its own and the others are split into pieces of up to
+ * DMA_MAX_TRANSFER_COUNT units. Use it to size the pool given to DMA_QueueCreateHandle(), for example
+ * DMA_ALLOCATE_LINK_DESCRIPTORS(s_txPool, 2U * DMA_QUEUE_DESCRIPTOR_COUNT(TX_BLOCK_SIZE)) for two transfers of
+ * TX_BLOCK_SIZE units in flight.
+ */
+#define DMA_QUEUE_DESCRIPTOR_COUNT(count) \
+    (((count) <= 1U) ? 1U : ((((count) - 2U) / DMA_MAX_TRANSFER_COUNT) + 2U))
+
+/*! @brief DMA queue handle typedef. */
+typedef struct _dma_queue_handle dma_queue_handle_t;
+
+/*! @brief DMA queue transfer typedef. */
+typedef struct _dma_queue_transfer dma_queue_transfer_t;
+
+/*!
+ * @brief DMA queue transfer callback typedef.
+ *
+ * Invoked from the DMA interrupt when @p transfer is done, with @p status kStatus_Success, or on a DMA error with
+ * @p status kStatus_Fail for each queued transfer after the channel has been aborted. The transfer is no longer
+ * queued, so the callback may submit it again or reuse its memory.
+ *
+ * Callbacks run in submission order. Completion is tracked with the INTA and INTB flags, raised alternately by
+ * consecutive transfers, so at most three transfers are linked into the hardware chain at a time: each interrupt
+ * then reports every transfer completed before it, however long it was held off.
+ */
+typedef void (*dma_queue_callback_t)(dma_queue_handle_t *handle,
+                                     dma_queue_transfer_t *transfer,
+                                     status_t status,
+                                     void *userData);
+
+/*!
+ * @brief DMA queue transfer structure.
+ *
+ * Owned by the application and linked into the queue without copying, so it must stay valid until its callback has
+ * been invoked.
+ */
+struct _dma_queue_transfer
+{
+    void *srcAddr;                 /*!< Source start address. */
+    void *dstAddr;                 /*!< Destination start address. */
+    uint32_t bytes;                /*!< Number of bytes, a multiple of the queue width. */
+    dma_queue_callback_t callback; /*!< Callback function, can be NULL. */
+    void *userData;                /*!< Callback parameter passed to callback function. */
+
+    /* Private members, set by the driver. */
+    dma_queue_transfer_t *next; /*!< Next transfer in the queue. */
+    uint32_t firstDescriptor;   /*!< Index of the first pool descriptor of the transfer. */
+    uint32_t descriptorCount;   /*!< Number of pool descriptors of the transfer. */
+    uint8_t tag;                /*!< 0 if the transfer ends with INTA, 1 with INTB. */
+    volatile bool queued;       /*!< Queued or running flag. */
+};
+
+/*! @brief Throughput counters of a DMA queue. */
+typedef struct _dma_queue_counters
+{
+    uint64_t bytes;           /*!< Bytes moved by the completed transfers. */
+    uint32_t transfers;       /*!< Completed transfers. */
+    uint32_t started;         /*!< Transfers that started an idle channel. */
+    uint32_t chained;         /*!< Transfers linked into the running chain, which follow the previous ones without
+                                   a gap. */
+    uint32_t restarts;        /*!< Times the channel stopped with transfers queued, because they were submitted
+                                   too late to be linked or the interrupt came too late to link them, and was
+                                   restarted from the interrupt. */
+    uint32_t rejected;        /*!< Submissions rejected for lack of free descriptors. */
+    uint32_t peakDescriptors; /*!< Most pool descriptors in use at a time. */
+} dma_queue_counters_t;
+
+/*!
+ * @brief DMA queue handle structure.
+ * @note The contents of this structure are private and subject to change.
+ */
+struct _dma_queue_handle
+{
+    dma_handle_t *dmaHandle;             /*!< The DMA handler used. */
+    dma_descriptor_t *pool;              /*!< Descriptor pool. */
+    uint32_t poolCount;                  /*!< Number of descriptors in the pool. */
+    uint32_t poolFirst;                  /*!< First descriptor in use, the pool is used as a ring. */
+    uint32_t poolUsed;                   /*!< Number of descriptors in use. */
+    uint32_t width;                      /*!< Unit width in bytes. */
+    uint32_t srcInc;                     /*!< Source address interleave. */
+    uint32_t dstInc;                     /*!< Destination address interleave. */
+    uint8_t nextTag;                     /*!< Tag of the next submitted transfer. */
+    dma_queue_transfer_t *volatile head; /*!< Oldest queued transfer. */
+    dma_queue_transfer_t *tail;          /*!< Last queued transfer. */
+    dma_queue_transfer_t *pending;       /*!< First transfer linked after the DMA loaded the end of the chain,
+                                              started from the interrupt. */
+    dma_queue_transfer_t *waiting;       /*!< First transfer not linked into the hardware chain yet. */
+    dma_queue_transfer_t *lastLinked;    /*!< Last transfer linked into the hardware chain. */
+    uint32_t linked;                     /*!< Transfers in the hardware chain, pending ones included. */
+    dma_queue_counters_t counters;       /*!< Throughput counters. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus. */
+
+/*!
+ * @name DMA Queue Operation
+ * @{
+ */
+
+/*!
+ * @brief Init the DMA queue handle of a channel.
+ *
+ * The queue keeps the channel busy with back-to-back transfers. Each submitted transfer gets its descriptors from a
+ * pool owned by the application and is linked behind the last descriptor of the running chain, so the DMA goes on
+ * with it without waiting for the interrupt. Up to three transfers are linked at a time, the others are linked from
+ * the interrupt as the transfers ahead of them complete. Transfers of any length are split into descriptors of up
+ * to DMA_MAX_TRANSFER_COUNT units. The queue owns the channel and its callback, DMA_SubmitChannelTransfer() and the
+ * other submit functions must not be used on it while the queue is in use.
+ *
+ * The channel runs without hardware trigger, paced by the peripheral request for the peripheral transfer types.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @param dmaHandle DMA handle pointer, created with DMA_CreateHandle().
+ * @param type transfer type, which selects the address increments and the peripheral request.
+ * @param width unit width in bytes, 1, 2 or 4.
+ * @param pool descriptor pool, allocated with DMA_ALLOCATE_LINK_DESCRIPTORS().
+ * @param poolCount number of descriptors in the pool, see DMA_QUEUE_DESCRIPTOR_COUNT().
+ */
+void DMA_QueueCreateHandle(dma_queue_handle_t *handle,
+                           dma_handle_t *dmaHandle,
+                           dma_transfer_type_t type,
+                           uint32_t width,
+                           dma_descriptor_t *pool,
+                           uint32_t poolCount);
+
+/*!
+ * @brief Queues a transfer.
+ *
+ * The transfer starts at once if the channel is idle. Otherwise it is linked into the running chain, or from the
+ * interrupt once the chain has room for it, unless the last descriptor of the chain has already been loaded by the
+ * DMA; the transfer then starts from the interrupt that completes the chain. The last unit of each transfer has a
+ * descriptor of its own, so that only happens to transfers submitted while the last unit of the previous one is
+ * moved. Can be called from interrupts, including the transfer callbacks.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @param transfer pointer to the transfer, its srcAddr, dstAddr, bytes, callback and userData members must be set.
+ * @retval kStatus_Success Transfer queued.
+ * @retval kStatus_InvalidArgument Invalid addresses or length, or more descriptors needed than the whole pool.
+ * @retval kStatus_Busy The transfer is still queued or running.
+ * @retval kStatus_DMA_QueueFull Not enough free descriptors in the pool, submit again once transfers completed.
+ */
+status_t DMA_QueueSubmit(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer);
+
+/*!
+ * @brief Aborts the running transfer and discards the queued ones.
+ *
+ * The callbacks of the discarded transfers are not invoked.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ */
+void DMA_QueueAbort(dma_queue_handle_t *handle);
+
+/*!
+ * @brief Gets the throughput counters of the queue.
+ *
+ * The transfer and byte counts are updated when the callbacks are invoked. Divided by the time elapsed since
+ * DMA_QueueResetCounters(), they give the throughput of the channel; a growing restarts count means transfers are
+ * submitted too late to keep the channel busy.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @param counters pointer to the structure the counters are copied to.
+ */
+void DMA_QueueGetCounters(dma_queue_handle_t *handle, dma_queue_counters_t *counters);
+
+/*!
+ * @brief Resets the throughput counters of the queue.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ */
+void DMA_QueueResetCounters(dma_queue_handle_t *handle);
+
+/*!
+ * @brief Tells whether transfers are queued or running.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @retval true A transfer is running.
+ * @retval false The queue is empty.
+ */
+static inline bool DMA_QueueIsBusy(dma_queue_handle_t *handle)
+{
+    return (handle->head != NULL);
+}
+
+/*! @} */
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus. */
+/*! @} */
+#endif /*FSL_DMA_QUEUE_H_*/
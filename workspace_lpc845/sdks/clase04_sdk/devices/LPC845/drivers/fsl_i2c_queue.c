@@ -0,0 +1,325 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_i2c_queue.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.i2c_queue"
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Appends a transfer to the queue and starts it if the queue was empty.
+ *
+ * Must be called with interrupts disabled.
+ *
+ * @param handle pointer to i2c_queue_handle_t structure.
+ * @param transfer pointer to the transfer, not queued.
+ */
+static void I2C_QueueAppend(i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer);
+
+/*!
+ * @brief Starts the transfer at the head of the queue.
+ *
+ * @param handle pointer to i2c_queue_handle_t structure.
+ */
+static void I2C_QueueStartHead(i2c_queue_handle_t *handle);
+
+/*!
+ * @brief Non-blocking master callback for the I2C queue driver.
+ *
+ * @param base I2C peripheral base address.
+ * @param masterHandle Non-blocking master handle of the queue.
+ * @param status Status of the finished transfer.
+ * @param userData Queue handle.
+ */
+static void I2C_QueueMasterCallback(I2C_Type *base, i2c_master_handle_t *masterHandle, status_t status, void *userData);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void I2C_QueueStartHead(i2c_queue_handle_t *handle)
+{
+    status_t result;
+
+    /* The master handle is idle whenever the queue head changes, and the subaddress size was checked on submit, so
+     * starting cannot fail. */
+    result = I2C_MasterTransferNonBlocking(handle->base, &handle->masterHandle, &handle->head->xfer);
+    assert(result == kStatus_Success);
+    (void)result;
+}
+
+static void I2C_QueueAppend(i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer)
+{
+    transfer->next   = NULL;
+    transfer->queued = true;
+
+    if (handle->head == NULL)
+    {
+        handle->head = transfer;
+        handle->tail = transfer;
+        I2C_QueueStartHead(handle);
+    }
+    else
+    {
+        handle->tail->next = transfer;
+        handle->tail       = transfer;
+    }
+}
+
+static void I2C_QueueMasterCallback(I2C_Type *base, i2c_master_handle_t *masterHandle, status_t status, void *userData)
+{
+    i2c_queue_handle_t *handle = (i2c_queue_handle_t *)userData;
+    i2c_queue_transfer_t *transfer;
+    uint32_t regPrimask;
+
+    (void)masterHandle;
+
+    regPrimask = DisableGlobalIRQ();
+
+    transfer     = handle->head;
+    handle->head = transfer->next;
+    if (handle->head == NULL)
+    {
+        handle->tail = NULL;
+    }
+    else
+    {
+        /* Start the next transfer before running the callback, so the bus does not wait for it. */
+        I2C_QueueStartHead(handle);
+    }
+    transfer->queued = false;
+
+    EnableGlobalIRQ(regPrimask);
+
+    if (transfer->callback != NULL)
+    {
+        transfer->callback(base, handle, transfer, status, transfer->userData);
+    }
+}
+
+/*!
+ * brief Init the I2C queue handle.
+ *
+ * The queue runs transfers to any number of devices on one bus one after the other, each started from the I2C
+ * interrupt that completes the previous one, so the bus is only idle while the interrupt handler runs. The queue
+ * uses the non-blocking master handle of the instance, I2C_MasterTransferNonBlocking() must not be used on the
+ * same instance while the queue is in use.
+ *
+ * param base I2C peripheral base address, the master must already be initialized with I2C_MasterInit().
+ * param handle pointer to i2c_queue_handle_t structure.
+ */
+void I2C_QueueCreateHandle(I2C_Type *base, i2c_queue_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    /* Zero handle. */
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base = base;
+
+    I2C_MasterTransferCreateHandle(base, &handle->masterHandle, I2C_QueueMasterCallback, handle);
+}
+
+/*!
+ * brief Queues a transfer.
+ *
+ * The transfer starts at once if the bus is idle, otherwise after the transfers queued before it. Can be called
+ * from interrupts, including the transfer callbacks.
+ *
+ * param base I2C peripheral base address.
+ * param handle pointer to i2c_queue_handle_t structure.
+ * param transfer pointer to the transfer, its xfer, callback and userData members must be set.
+ * retval kStatus_Success Transfer queued.
+ * retval kStatus_InvalidArgument Subaddress longer than 4 bytes.
+ * retval kStatus_I2C_Busy The transfer is still queued or running.
+ */
+status_t I2C_QueueSubmit(I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer)
+{
+    status_t result = kStatus_Success;
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+    assert(transfer != NULL);
+    assert(handle->base == base);
+
+    if (transfer->xfer.subaddressSize > sizeof(transfer->xfer.subaddress))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    regPrimask = DisableGlobalIRQ();
+
+    if (transfer->queued)
+    {
+        result = kStatus_I2C_Busy;
+    }
+    else
+    {
+        I2C_QueueAppend(handle, transfer);
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    return result;
+}
+
+/*!
+ * brief Adds a polling job.
+ *
+ * The transfer is queued every p periodTicks calls of I2C_QueueTick(), the first time after p periodTicks calls.
+ * Jobs due on the same tick are queued in the order they were added and run back to back, which batches the
+ * reads of several sensors into one bus burst. A job still queued from the previous period is not queued twice.
+ *
+ * param base I2C peripheral base address.
+ * param handle pointer to i2c_queue_handle_t structure.
+ * param transfer pointer to the transfer, its xfer, callback and userData members must be set.
+ * param periodTicks polling period in ticks, not 0.
+ */
+void I2C_QueueAddJob(I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer, uint32_t periodTicks)
+{
+    i2c_queue_transfer_t **link;
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+    assert(transfer != NULL);
+    assert(handle->base == base);
+    assert(periodTicks != 0U);
+    assert(transfer->xfer.subaddressSize <= sizeof(transfer->xfer.subaddress));
+
+    regPrimask = DisableGlobalIRQ();
+
+    transfer->periodTicks = periodTicks;
+    transfer->ticksLeft   = periodTicks;
+    transfer->nextJob     = NULL;
+
+    /* Keep the jobs in the order they were added, it is the order they run in when due on the same tick. */
+    link = &handle->jobs;
+    while (*link != NULL)
+    {
+        link = &(*link)->nextJob;
+    }
+    *link = transfer;
+
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Removes a polling job.
+ *
+ * A transfer of the job already queued still runs and invokes its callback.
+ *
+ * param base I2C peripheral base address.
+ * param handle pointer to i2c_queue_handle_t structure.
+ * param transfer pointer to the transfer given to I2C_QueueAddJob().
+ */
+void I2C_QueueRemoveJob(I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer)
+{
+    i2c_queue_transfer_t **link;
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+    assert(transfer != NULL);
+    assert(handle->base == base);
+
+    regPrimask = DisableGlobalIRQ();
+
+    link = &handle->jobs;
+    while ((*link != NULL) && (*link != transfer))
+    {
+        link = &(*link)->nextJob;
+    }
+    if (*link != NULL)
+    {
+        *link                 = transfer->nextJob;
+        transfer->nextJob     = NULL;
+        transfer->periodTicks = 0U;
+    }
+
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Advances the polling jobs by one tick.
+ *
+ * Call it periodically, for example from the SysTick or a timer interrupt.
+ *
+ * param base I2C peripheral base address.
+ * param handle pointer to i2c_queue_handle_t structure.
+ */
+void I2C_QueueTick(I2C_Type *base, i2c_queue_handle_t *handle)
+{
+    i2c_queue_transfer_t *job;
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+    assert(handle->base == base);
+
+    regPrimask = DisableGlobalIRQ();
+
+    for (job = handle->jobs; job != NULL; job = job->nextJob)
+    {
+        job->ticksLeft--;
+        if (job->ticksLeft == 0U)
+        {
+            job->ticksLeft = job->periodTicks;
+
+            /* Skip the period if the previous one is still queued, the bus is too slow for the polling rate. */
+            if (!job->queued)
+            {
+                I2C_QueueAppend(handle, job);
+            }
+        }
+    }
+
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Aborts the running transfer and discards the queued ones.
+ *
+ * The callbacks of the discarded transfers are not invoked. The polling jobs are kept and queued again on their
+ * next period.
+ *
+ * param base I2C peripheral base address.
+ * param handle pointer to i2c_queue_handle_t structure.
+ */
+void I2C_QueueAbort(I2C_Type *base, i2c_queue_handle_t *handle)
+{
+    i2c_queue_transfer_t *transfer;
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+    assert(handle->base == base);
+
+    regPrimask = DisableGlobalIRQ();
+
+    if (handle->head != NULL)
+    {
+        (void)I2C_MasterTransferAbort(base, &handle->masterHandle);
+    }
+
+    transfer = handle->head;
+    while (transfer != NULL)
+    {
+        transfer->queued = false;
+        transfer         = transfer->next;
+    }
+    handle->head = NULL;
+    handle->tail = NULL;
+
+    EnableGlobalIRQ(regPrimask);
+}
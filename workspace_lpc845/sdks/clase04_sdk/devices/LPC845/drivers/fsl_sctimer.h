@@ -23,7 +23,7 @@
 
 /*! @name Driver version */
 /*! @{ */
-#define FSL_SCTIMER_DRIVER_VERSION (MAKE_VERSION(2, 5, 1)) /*!< Version */
+#define FSL_SCTIMER_DRIVER_VERSION (MAKE_VERSION(2, 6, 0)) /*!< Version */
 /*! @} */
 
 #ifndef SCT_EV_STATE_STATEMSKn
@@ -90,6 +90,21 @@ typedef struct _sctimer_pwm_signal_param
                                            100 = always active signal (100% duty cycle).*/
 } sctimer_pwm_signal_param_t;
 
+/*! @brief Full scale of a Q16 PWM duty cycle, 100% duty cycle */
+#define SCTIMER_PWM_DUTY_Q16_MAX (0x10000UL)
+
+/*!
+ * @brief Precomputed state of a PWM signal, used to update its duty cycle while the counter runs
+ *
+ * Filled in once by SCTIMER_GetPwmChannel(), so that the duty cycle updates only have to write the
+ * match reload register of the pulse.
+ */
+typedef struct _sctimer_pwm_channel
+{
+    uint32_t period;        /*!< PWM period in counter ticks, the duty cycle for 100% */
+    uint32_t pulseMatchReg; /*!< Match register that ends the pulse */
+} sctimer_pwm_channel_t;
+
 /*! @brief SCTimer clock mode options */
 typedef enum _sctimer_clock_mode
 {
@@ -400,6 +415,117 @@ status_t SCTIMER_SetupPwm(SCT_Type *base,
  */
 void SCTIMER_UpdatePwmDutycycle(SCT_Type *base, sctimer_out_t output, uint8_t dutyCyclePercent, uint32_t event);
 
+/*!
+ * @brief Gets the precomputed state of a PWM signal for the duty cycle update functions below.
+ *
+ * SCTIMER_UpdatePwmDutycycle() stops the counter, computes the pulse width with a 64-bit division
+ * and restarts the counter on every call, which disturbs the waveform. The functions below instead
+ * only write the match reload register of the pulse, with the period read once by this function.
+ * The counter keeps running and the new pulse width takes effect at the next period boundary, when
+ * the SCTimer reloads its match registers, so every period is either entirely old or entirely new.
+ *
+ * @param base    SCTimer peripheral base address
+ * @param event   Event number associated with the PWM signal. This was returned to the user by the
+ *                function SCTIMER_SetupPwm().
+ * @param channel Pointer to the structure to fill in
+ */
+void SCTIMER_GetPwmChannel(SCT_Type *base, uint32_t event, sctimer_pwm_channel_t *channel);
+
+/*!
+ * @brief Converts a duty cycle in counter ticks to the pulse match value of a PWM signal.
+ *
+ * A duty cycle of channel->period ticks or more gives 100%, for which the match value is put beyond
+ * the period so that the pulse event never occurs, as SCTIMER_SetupPwm() does.
+ *
+ * @param channel   PWM signal, see SCTIMER_GetPwmChannel()
+ * @param dutyTicks Duty cycle in counter ticks, between 0 and channel->period
+ *
+ * @return The value to write to the pulse match reload register
+ */
+static inline uint32_t SCTIMER_GetPwmPulseMatch(const sctimer_pwm_channel_t *channel, uint32_t dutyTicks)
+{
+    return (dutyTicks >= channel->period) ? (channel->period + 2U) : dutyTicks;
+}
+
+/*!
+ * @brief Converts a Q16 duty cycle to counter ticks of a PWM signal.
+ *
+ * The period is split in two 16-bit halves so that the product fits in 32 bits, which avoids the
+ * 64-bit multiply and divide library calls on cores without a divider.
+ *
+ * @param channel  PWM signal, see SCTIMER_GetPwmChannel()
+ * @param dutyQ16  Duty cycle, 0 for 0% to SCTIMER_PWM_DUTY_Q16_MAX for 100%
+ *
+ * @return The duty cycle in counter ticks, rounded down
+ */
+static inline uint32_t SCTIMER_PwmDutyQ16ToTicks(const sctimer_pwm_channel_t *channel, uint32_t dutyQ16)
+{
+    assert(dutyQ16 <= SCTIMER_PWM_DUTY_Q16_MAX);
+
+    return ((channel->period >> 16U) * dutyQ16) + (((channel->period & 0xFFFFU) * dutyQ16) >> 16U);
+}
+
+/*!
+ * @brief Updates the duty cycle of one running PWM signal, in counter ticks.
+ *
+ * The new duty cycle takes effect at the next period boundary, the counter is not stopped. A single
+ * register is written, so the function can be called from an interrupt.
+ *
+ * @param base      SCTimer peripheral base address
+ * @param channel   PWM signal, see SCTIMER_GetPwmChannel()
+ * @param dutyTicks Duty cycle in counter ticks, between 0 and channel->period
+ */
+static inline void SCTIMER_SetPwmDutyTicks(SCT_Type *base, const sctimer_pwm_channel_t *channel, uint32_t dutyTicks)
+{
+    base->MATCHREL[channel->pulseMatchReg] = SCTIMER_GetPwmPulseMatch(channel, dutyTicks);
+}
+
+/*!
+ * @brief Updates the duty cycle of one running PWM signal, in Q16.
+ *
+ * @param base    SCTimer peripheral base address
+ * @param channel PWM signal, see SCTIMER_GetPwmChannel()
+ * @param dutyQ16 Duty cycle, 0 for 0% to SCTIMER_PWM_DUTY_Q16_MAX for 100%
+ */
+static inline void SCTIMER_SetPwmDutyQ16(SCT_Type *base, const sctimer_pwm_channel_t *channel, uint32_t dutyQ16)
+{
+    SCTIMER_SetPwmDutyTicks(base, channel, SCTIMER_PwmDutyQ16ToTicks(channel, dutyQ16));
+}
+
+/*!
+ * @brief Updates the duty cycles of several running PWM signals at the same period boundary.
+ *
+ * Match reloads are held off while the registers are written, so all the signals change in the same
+ * period even if a period boundary passes during the call. The counter is not stopped.
+ *
+ * @note CONFIG is read, modified and written, so this function must not be called at the same time
+ * as other functions that change the SCTimer configuration.
+ *
+ * @param base      SCTimer peripheral base address
+ * @param channels  Array of PWM signals, see SCTIMER_GetPwmChannel()
+ * @param dutyTicks Array of duty cycles in counter ticks, one for each signal
+ * @param count     Number of signals to update
+ */
+void SCTIMER_UpdatePwmDutyTicks(SCT_Type *base,
+                                const sctimer_pwm_channel_t *channels,
+                                const uint32_t *dutyTicks,
+                                uint32_t count);
+
+/*!
+ * @brief Updates the duty cycles of several running PWM signals at the same period boundary, in Q16.
+ *
+ * Same as SCTIMER_UpdatePwmDutyTicks() with the duty cycles given in Q16.
+ *
+ * @param base     SCTimer peripheral base address
+ * @param channels Array of PWM signals, see SCTIMER_GetPwmChannel()
+ * @param dutyQ16  Array of duty cycles, 0 for 0% to SCTIMER_PWM_DUTY_Q16_MAX for 100%, one for each signal
+ * @param count    Number of signals to update
+ */
+void SCTIMER_UpdatePwmDutyQ16(SCT_Type *base,
+                              const sctimer_pwm_channel_t *channels,
+                              const uint32_t *dutyQ16,
+                              uint32_t count);
+
 /*!
  * @name Interrupt Interface
  * @{
@@ -21,6 +21,42 @@
 *************************************************************************************
 ***********************************************************************************/
 
+/************************************************************************************
+*************************************************************************************
+* Public macros
+*************************************************************************************
+************************************************************************************/
+/*!
+ * @brief Number of lookup tables used by the software CRC adapter.
+ *
+ * 0 selects the bitwise engine, 1 a 256-entry byte table and 4 or 8 the slice-by-4 or slice-by-8 engine. Tables are
+ * generated at compile time for the polynomial, size and input reflection configured below and are placed in flash,
+ * each slice takes 1 KB. Configurations that do not match fall back to the bitwise engine.
+ */
+#ifndef HAL_CRC_SOFTWARE_TABLE_SLICES
+#define HAL_CRC_SOFTWARE_TABLE_SLICES (1U)
+#endif
+
+/*! @brief Polynomial the software CRC tables are generated for. */
+#ifndef HAL_CRC_SOFTWARE_TABLE_POLY
+#define HAL_CRC_SOFTWARE_TABLE_POLY KHAL_CrcPolynomial_CRC_32
+#endif
+
+/*! @brief Number of CRC octets the software CRC tables are generated for. */
+#ifndef HAL_CRC_SOFTWARE_TABLE_SIZE
+#define HAL_CRC_SOFTWARE_TABLE_SIZE (4U)
+#endif
+
+/*!
+ * @brief Input reflection the software CRC tables are generated for, 1 for KHAL_CrcRefInput.
+ *
+ * The defaults give tables for CRC-32 as used by Ethernet, zlib and PNG, which reflects its input and output. Set it
+ * to 0 for CRC-32/MPEG-2 or CRC-32/BZIP2.
+ */
+#ifndef HAL_CRC_SOFTWARE_TABLE_REFIN
+#define HAL_CRC_SOFTWARE_TABLE_REFIN (1U)
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Public types
@@ -69,6 +105,14 @@ typedef struct _hal_crc_config
     uint8_t crcStartByte; /*!< Start CRC with this byte position. Byte #0 is the first byte of Sync Address. */
 } hal_crc_config_t;
 
+/*! @brief CRC context used to compute a CRC over several chunks of data. */
+typedef struct _hal_crc_context
+{
+    hal_crc_config_t config; /*!< CRC configuration, copied by HAL_CrcInit. */
+    uint32_t crcState;       /*!< Intermediate CRC value. */
+    uint32_t skipCount;      /*!< Input bytes still to be skipped before crcStartByte is reached. */
+} hal_crc_context_t;
+
 /************************************************************************************
 *************************************************************************************
 * Public prototypes
@@ -115,6 +159,35 @@ extern "C" {
  */
 uint32_t HAL_CrcCompute(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length);
 
+/*!
+ * @brief Starts an incremental CRC computation.
+ *
+ * HAL_CrcInit, any number of HAL_CrcUpdate calls and HAL_CrcFinal give the same result as one HAL_CrcCompute call
+ * over the concatenated data, so large images or protocol frames can be checksummed chunk by chunk.
+ *
+ * @param context CRC context.
+ * @param crcConfig configuration structure, copied into the context.
+ */
+void HAL_CrcInit(hal_crc_context_t *context, hal_crc_config_t *crcConfig);
+
+/*!
+ * @brief Adds a chunk of data to an incremental CRC computation.
+ *
+ * @param context CRC context.
+ * @param dataIn input data buffer.
+ * @param length input data buffer size.
+ */
+void HAL_CrcUpdate(hal_crc_context_t *context, uint8_t *dataIn, uint32_t length);
+
+/*!
+ * @brief Finishes an incremental CRC computation.
+ *
+ * @param context CRC context.
+ *
+ * @retval Computed CRC value.
+ */
+uint32_t HAL_CrcFinal(hal_crc_context_t *context);
+
 /*! @} */
 
 #if defined(__cplusplus)
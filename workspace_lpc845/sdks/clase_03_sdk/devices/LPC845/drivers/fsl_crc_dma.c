@@ -0,0 +1,397 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_crc_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_crc_dma"
+#endif
+
+/*<! Structure definition for crc_dma_private_handle_t. The structure is private. */
+typedef struct _crc_dma_private_handle
+{
+    CRC_Type *base;
+    crc_dma_handle_t *handle;
+} crc_dma_private_handle_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Get the CRC instance from peripheral base address.
+ *
+ * @param base CRC peripheral base address.
+ * @return CRC instance.
+ */
+static uint32_t CRC_GetInstance(CRC_Type *base);
+
+/*!
+ * @brief Gets the next piece of the regions the DMA engine can move with one descriptor.
+ *
+ * Unaligned head and tail bytes are moved with 8-bit writes and the rest with 32-bit writes, the same way
+ * CRC_WriteData() feeds the engine.
+ *
+ * @param handle CRC DMA handle pointer.
+ * @param srcAddr Start address of the piece.
+ * @param width Transfer width of the piece.
+ * @return Size of the piece in bytes, 0 when all regions have been consumed.
+ */
+static size_t CRC_GetNextPieceDMA(crc_dma_handle_t *handle, const uint8_t **srcAddr, uint8_t *width);
+
+/*!
+ * @brief Writes the next part of the regions to the link descriptors and starts the DMA channel.
+ *
+ * @param handle CRC DMA handle pointer.
+ * @return true if a chain was started, false when all regions have been consumed.
+ */
+static bool CRC_SubmitChainDMA(crc_dma_handle_t *handle);
+
+/*!
+ * @brief DMA callback for CRC.
+ *
+ * @param handle DMA handler for CRC
+ * @param userData user param passed to the callback function
+ */
+static void CRC_TransferCallbackDMA(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*<! Private handle only used for internally. */
+static crc_dma_private_handle_t s_dmaPrivateHandle[FSL_FEATURE_SOC_CRC_COUNT];
+
+/*<! Link descriptors of the chain. */
+SDK_ALIGN(static dma_descriptor_t s_crcDescriptor[FSL_FEATURE_SOC_CRC_COUNT][CRC_DMA_MAX_LINK_DESCRIPTORS],
+          FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t CRC_GetInstance(CRC_Type *base)
+{
+    CRC_Type *const s_crcBases[] = CRC_BASE_PTRS;
+    uint32_t instance;
+
+    /* Find the instance index from base address mappings. */
+    for (instance = 0; instance < ARRAY_SIZE(s_crcBases); instance++)
+    {
+        if (s_crcBases[instance] == base)
+        {
+            break;
+        }
+    }
+
+    assert(instance < ARRAY_SIZE(s_crcBases));
+
+    return instance;
+}
+
+static size_t CRC_GetNextPieceDMA(crc_dma_handle_t *handle, const uint8_t **srcAddr, uint8_t *width)
+{
+    const crc_dma_region_t *region;
+    size_t remaining;
+    size_t piece;
+
+    /* Skip the consumed and the empty regions. */
+    while ((handle->regionIndex < handle->regionCount) &&
+           (handle->regionOffset >= handle->regions[handle->regionIndex].dataSize))
+    {
+        handle->regionIndex++;
+        handle->regionOffset = 0U;
+    }
+
+    if (handle->regionIndex >= handle->regionCount)
+    {
+        return 0U;
+    }
+
+    region    = &handle->regions[handle->regionIndex];
+    *srcAddr  = &region->data[handle->regionOffset];
+    remaining = region->dataSize - handle->regionOffset;
+
+    if ((((uint32_t)*srcAddr & 3U) != 0U) || (remaining < 4U))
+    {
+        /* Head bytes up to the next word boundary, or the tail bytes. */
+        piece  = MIN(remaining, 4U - ((uint32_t)*srcAddr & 3U));
+        *width = (uint8_t)kDMA_Transfer8BitWidth;
+    }
+    else
+    {
+        piece  = MIN(remaining & ~(size_t)3U, (size_t)DMA_MAX_TRANSFER_COUNT * 4U);
+        *width = (uint8_t)kDMA_Transfer32BitWidth;
+    }
+
+    handle->regionOffset += piece;
+
+    return piece;
+}
+
+static bool CRC_SubmitChainDMA(crc_dma_handle_t *handle)
+{
+    dma_descriptor_t *descriptors = s_crcDescriptor[CRC_GetInstance(handle->base)];
+    void *dstAddr                 = (void *)(uint32_t)&handle->base->WR_DATA;
+    dma_channel_config_t transferConfig;
+    dma_channel_trigger_t trigger;
+    const uint8_t *srcAddr[CRC_DMA_MAX_LINK_DESCRIPTORS + 1U];
+    size_t bytes[CRC_DMA_MAX_LINK_DESCRIPTORS + 1U];
+    uint8_t width[CRC_DMA_MAX_LINK_DESCRIPTORS + 1U];
+    uint32_t xferCfg;
+    uint32_t count = 0U;
+    uint32_t i;
+    bool isLast;
+
+    /* The head descriptor lives in the channel descriptor, the others are link descriptors. */
+    while (count < (CRC_DMA_MAX_LINK_DESCRIPTORS + 1U))
+    {
+        bytes[count] = CRC_GetNextPieceDMA(handle, &srcAddr[count], &width[count]);
+        if (bytes[count] == 0U)
+        {
+            break;
+        }
+        count++;
+    }
+
+    if (count == 0U)
+    {
+        return false;
+    }
+
+    /* No peripheral request: the software trigger stays set along the chain, only the last descriptor clears it and
+     * raises an interrupt. */
+    for (i = count; i-- > 0U;)
+    {
+        isLast  = (i == (count - 1U));
+        xferCfg = DMA_CHANNEL_XFER(!isLast, isLast, isLast, false, width[i], kDMA_AddressInterleave1xWidth,
+                                   kDMA_AddressInterleave0xWidth, bytes[i]);
+
+        if (i > 0U)
+        {
+            DMA_SetupDescriptor(&descriptors[i - 1U], xferCfg, (void *)(uint32_t)srcAddr[i], dstAddr,
+                                isLast ? NULL : &descriptors[i]);
+        }
+        else
+        {
+            trigger.type  = kDMA_NoTrigger;
+            trigger.burst = kDMA_SingleTransfer;
+            trigger.wrap  = kDMA_NoWrap;
+
+            DMA_PrepareChannelTransfer(&transferConfig, (void *)(uint32_t)srcAddr[0], dstAddr, xferCfg,
+                                       kDMA_MemoryToMemory, &trigger, isLast ? NULL : &descriptors[0]);
+            (void)DMA_SubmitChannelTransfer(handle->dmaHandle, &transferConfig);
+        }
+    }
+
+    DMA_StartTransfer(handle->dmaHandle);
+
+    return true;
+}
+
+static void CRC_TransferCallbackDMA(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    crc_dma_private_handle_t *privHandle = (crc_dma_private_handle_t *)userData;
+    crc_dma_handle_t *crcHandle          = privHandle->handle;
+    status_t status                      = kStatus_Success;
+
+    if (!transferDone)
+    {
+        DMA_AbortTransfer(crcHandle->dmaHandle);
+        status = kStatus_Fail;
+    }
+    else if (CRC_SubmitChainDMA(crcHandle))
+    {
+        /* More data, the next chain is running. */
+        return;
+    }
+    else
+    {
+        /* Intentional empty: all regions written. */
+    }
+
+    crcHandle->busy = false;
+
+    if (crcHandle->callback != NULL)
+    {
+        crcHandle->callback(privHandle->base, crcHandle, status, crcHandle->userData);
+    }
+}
+
+/*!
+ * brief Initializes the CRC DMA handle.
+ *
+ * param base CRC peripheral base address.
+ * param handle CRC DMA handle pointer.
+ * param callback Callback function called when all data has been written to the CRC engine.
+ * param userData User data for callback.
+ * param dmaHandle DMA handle pointer, the handle shall be static allocated by users.
+ */
+status_t CRC_TransferCreateHandleDMA(CRC_Type *base,
+                                     crc_dma_handle_t *handle,
+                                     crc_dma_callback_t callback,
+                                     void *userData,
+                                     dma_handle_t *dmaHandle)
+{
+    uint32_t instance;
+
+    assert(NULL != base);
+    assert(NULL != handle);
+    assert(NULL != dmaHandle);
+
+    instance = CRC_GetInstance(base);
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base      = base;
+    handle->dmaHandle = dmaHandle;
+    handle->callback  = callback;
+    handle->userData  = userData;
+
+    s_dmaPrivateHandle[instance].base   = base;
+    s_dmaPrivateHandle[instance].handle = handle;
+
+    DMA_SetCallback(dmaHandle, CRC_TransferCallbackDMA, &s_dmaPrivateHandle[instance]);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Writes data to the CRC engine using DMA.
+ *
+ * param base CRC peripheral base address.
+ * param handle CRC DMA handle pointer.
+ * param data Input data, must stay valid until the callback.
+ * param dataSize Size of the input data in bytes.
+ * retval kStatus_Success Transfer started.
+ * retval kStatus_InvalidArgument Input argument is invalid.
+ * retval kStatus_Busy Previous transfer on going.
+ */
+status_t CRC_WriteDataDMA(CRC_Type *base, crc_dma_handle_t *handle, const uint8_t *data, size_t dataSize)
+{
+    assert(NULL != handle);
+
+    if (handle->busy)
+    {
+        return kStatus_Busy;
+    }
+
+    handle->singleRegion.data     = data;
+    handle->singleRegion.dataSize = dataSize;
+
+    return CRC_WriteRegionsDMA(base, handle, &handle->singleRegion, 1U);
+}
+
+/*!
+ * brief Writes several discontiguous regions to the CRC engine using DMA.
+ *
+ * param base CRC peripheral base address.
+ * param handle CRC DMA handle pointer.
+ * param regions Array of regions, the array and the data must stay valid until the callback.
+ * param regionCount Number of regions.
+ * retval kStatus_Success Transfer started.
+ * retval kStatus_InvalidArgument Input argument is invalid.
+ * retval kStatus_Busy Previous transfer on going.
+ */
+status_t CRC_WriteRegionsDMA(CRC_Type *base,
+                             crc_dma_handle_t *handle,
+                             const crc_dma_region_t *regions,
+                             uint32_t regionCount)
+{
+    uint32_t i;
+
+    assert(NULL != handle);
+    assert(base == handle->base);
+
+    if ((NULL == regions) || (0U == regionCount))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (i = 0U; i < regionCount; i++)
+    {
+        if ((NULL == regions[i].data) && (0U != regions[i].dataSize))
+        {
+            return kStatus_InvalidArgument;
+        }
+    }
+
+    if (handle->busy)
+    {
+        return kStatus_Busy;
+    }
+
+    handle->regions      = regions;
+    handle->regionCount  = regionCount;
+    handle->regionIndex  = 0U;
+    handle->regionOffset = 0U;
+    handle->busy         = true;
+
+    if (!CRC_SubmitChainDMA(handle))
+    {
+        /* Only empty regions, nothing to write. */
+        handle->busy = false;
+        if (handle->callback != NULL)
+        {
+            handle->callback(base, handle, kStatus_Success, handle->userData);
+        }
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Computes the CRC of several regions asynchronously.
+ *
+ * param base CRC peripheral base address.
+ * param handle CRC DMA handle pointer.
+ * param config CRC configuration.
+ * param regions Array of regions, the array and the data must stay valid until the callback.
+ * param regionCount Number of regions.
+ * retval kStatus_Success Transfer started.
+ * retval kStatus_InvalidArgument Input argument is invalid.
+ * retval kStatus_Busy Previous transfer on going.
+ */
+status_t CRC_ComputeAsync(CRC_Type *base,
+                          crc_dma_handle_t *handle,
+                          const crc_config_t *config,
+                          const crc_dma_region_t *regions,
+                          uint32_t regionCount)
+{
+    assert(NULL != handle);
+    assert(NULL != config);
+
+    if (handle->busy)
+    {
+        return kStatus_Busy;
+    }
+
+    CRC_Init(base, config);
+
+    return CRC_WriteRegionsDMA(base, handle, regions, regionCount);
+}
+
+/*!
+ * brief Aborts a CRC DMA transfer.
+ *
+ * param base CRC peripheral base address.
+ * param handle CRC DMA handle pointer.
+ */
+void CRC_TransferAbortDMA(CRC_Type *base, crc_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    if (handle->busy)
+    {
+        DMA_AbortTransfer(handle->dmaHandle);
+        handle->busy = false;
+    }
+}
@@ -23,7 +23,7 @@
 /*! @name Driver version */
 /*! @{ */
 /*! @brief I2C DMA driver version. */
-#define FSL_I2C_DMA_DRIVER_VERSION (MAKE_VERSION(2, 1, 0))
+#define FSL_I2C_DMA_DRIVER_VERSION (MAKE_VERSION(2, 2, 0))
 /*! @} */
 
 /*! @brief Maximum lenght of single DMA transfer (determined by capability of the DMA engine) */
@@ -51,6 +51,11 @@ struct _i2c_master_dma_handle
     i2c_master_transfer_t transfer;                        /*!< Copy of the current transfer info. */
     i2c_master_dma_transfer_callback_t completionCallback; /*!< Callback function called after dma transfer finished. */
     void *userData;                                        /*!< Callback parameter passed to callback function. */
+    i2c_master_transfer_t *segments;                       /*!< Scatter-gather segments, NULL for a single transfer. */
+    uint32_t segmentCount;                                 /*!< Number of segments in the list. */
+    uint32_t segmentIndex;                                 /*!< First segment of the run of segments in progress. */
+    dma_descriptor_t *descriptors;                         /*!< Link descriptors of a scatter-gather DMA phase. */
+    uint32_t descriptorCount;                              /*!< Number of link descriptors. */
 };
 
 /*******************************************************************************
@@ -95,6 +100,44 @@ void I2C_MasterTransferCreateHandleDMA(I2C_Type *base,
  */
 status_t I2C_MasterTransferDMA(I2C_Type *base, i2c_master_dma_handle_t *handle, i2c_master_transfer_t *xfer);
 
+/*!
+ * @brief Performs a list of master transfers on the I2C bus with DMA, as one non-blocking transfer
+ *
+ * Reads several non-contiguous register blocks of a device, or writes and reads across devices, with one completion
+ * callback for the whole list. Each segment is an i2c_master_transfer_t:
+ * - Without flags, a segment starts with a start condition and ends with a stop condition.
+ * - With kI2C_TransferNoStopFlag on the last segment of a bus transfer, the next segment starts with a repeated
+ *   start instead, so the bus is kept.
+ * - With kI2C_TransferNoStartFlag, a segment continues the data of the previous one in the same direction, without
+ *   start condition, address or subaddress, which gathers or scatters one bus transfer over several buffers.
+ *
+ * The start, address and stop conditions must be driven by software, so the I2C interrupt runs them, directly from
+ * one segment to the next. All data, including the subaddresses, is moved by linked DMA descriptors that end by
+ * handing the bus back to the I2C interrupt, without DMA interrupts. A register block read ending with
+ * kI2C_TransferNoStopFlag costs two I2C interrupts.
+ *
+ * A DMA phase moves the subaddress and the data of a write, the subaddress of a read, or the data of a read but its
+ * last byte, each with the data of the segments continuing it. It needs one link descriptor for each piece of up to
+ * I2C_MAX_DMA_TRANSFER_COUNT bytes of each of its buffers, so a list of register block reads of up to
+ * I2C_MAX_DMA_TRANSFER_COUNT + 1 bytes each needs one.
+ *
+ * @param base I2C peripheral base address
+ * @param handle pointer to i2c_master_dma_handle_t structure
+ * @param segments pointer to the segment list, which must stay valid until the callback
+ * @param segmentCount number of segments
+ * @param descriptors link descriptors, allocated with DMA_ALLOCATE_LINK_DESCRIPTORS()
+ * @param descriptorCount number of link descriptors, enough for the largest DMA phase
+ * @retval kStatus_Success Transfer started.
+ * @retval kStatus_I2C_Busy Previous transmission still not finished.
+ * @retval kStatus_InvalidArgument Invalid segment list, or not enough link descriptors for it.
+ */
+status_t I2C_MasterTransferScatterGatherDMA(I2C_Type *base,
+                                            i2c_master_dma_handle_t *handle,
+                                            i2c_master_transfer_t *segments,
+                                            uint32_t segmentCount,
+                                            dma_descriptor_t *descriptors,
+                                            uint32_t descriptorCount);
+
 /*!
  * @brief Get master transfer status during a dma non-blocking transfer
  *
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_SPI_DMA_H_
+#define FSL_SPI_DMA_H_
+
+#include "fsl_spi.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup spi_dma_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief SPI DMA driver version. */
+#define FSL_SPI_DMA_DRIVER_VERSION (MAKE_VERSION(2, 1, 0))
+/*! @} */
+
+/*! @brief Maximum number of segments in one chained transfer. */
+#ifndef SPI_DMA_MAX_SEGMENTS
+#define SPI_DMA_MAX_SEGMENTS (4U)
+#endif
+
+/*!
+ * @brief Number of link descriptors reserved per SPI instance and direction.
+ *
+ * Each segment needs two TX descriptors for its control words plus one for every started 1024 frames of data. The RX
+ * chain needs one for every started 1024 received frames, and one more when the last segment has no receive buffer.
+ * The first descriptor of a chain lives in the DMA channel table and is not counted here.
+ */
+#ifndef SPI_DMA_MAX_LINK_DESCRIPTORS
+#define SPI_DMA_MAX_LINK_DESCRIPTORS (8U)
+#endif
+
+/*! @brief One segment of a chained SPI DMA transfer. */
+typedef struct _spi_dma_segment
+{
+    spi_transfer_t xfer; /*!< Buffers, size and config flags of the segment. */
+    spi_ssel_t ssel;     /*!< Slave select asserted while the segment is shifted, for example kSPI_Ssel1Assert. */
+} spi_dma_segment_t;
+
+/*! @brief SPI DMA handle typedef. */
+typedef struct _spi_dma_handle spi_dma_handle_t;
+
+/*! @brief SPI DMA callback called at the end of transfer. */
+typedef void (*spi_dma_callback_t)(SPI_Type *base, spi_dma_handle_t *handle, status_t status, void *userData);
+
+/*! @brief SPI DMA transfer handle, users should not touch the content of the handle.*/
+struct _spi_dma_handle
+{
+    volatile bool txInProgress;                   /*!< Send transfer finished */
+    volatile bool rxInProgress;                   /*!< Receive transfer finished */
+    dma_handle_t *txHandle;                       /*!< DMA handler for SPI send */
+    dma_handle_t *rxHandle;                       /*!< DMA handler for SPI receive */
+    uint8_t bytesPerFrame;                        /*!< Bytes in a frame for SPI transfer */
+    spi_dma_callback_t callback;                  /*!< Callback for SPI DMA transfer */
+    void *userData;                               /*!< User Data for SPI DMA callback */
+    uint32_t state;                               /*!< Internal state of SPI DMA transfer */
+    size_t transferSize;                          /*!< Bytes need to be transfer */
+    uint32_t txCtrlWord[SPI_DMA_MAX_SEGMENTS];    /*!< TXCTL value written by DMA before each segment. */
+    uint32_t txLastDatCtrl[SPI_DMA_MAX_SEGMENTS]; /*!< Last frame of each segment with its TXDATCTL control bits. */
+};
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name DMA Transactional
+ * @{
+ */
+
+/*!
+ * @brief Initialize the SPI master DMA handle.
+ *
+ * This function initializes the SPI master DMA handle which can be used for other SPI master transactional APIs.
+ * Usually, for a specified SPI instance, user need only call this API once to get the initialized handle.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI handle pointer.
+ * @param callback User callback function called at the end of a transfer.
+ * @param userData User data for callback.
+ * @param txHandle DMA handle pointer for SPI Tx, the handle shall be static allocated by users.
+ * @param rxHandle DMA handle pointer for SPI Rx, the handle shall be static allocated by users.
+ * @retval kStatus_Success Handle initialized.
+ */
+status_t SPI_MasterTransferCreateHandleDMA(SPI_Type *base,
+                                           spi_dma_handle_t *handle,
+                                           spi_dma_callback_t callback,
+                                           void *userData,
+                                           dma_handle_t *txHandle,
+                                           dma_handle_t *rxHandle);
+
+/*!
+ * @brief Perform a non-blocking SPI transfer using DMA.
+ *
+ * @note This interface returned immediately after transfer initiates, the callback is invoked with
+ * kStatus_Success once the last frame has been shifted in. The slave select is the one already set in TXCTL.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI DMA handle pointer.
+ * @param xfer Pointer to dma transfer structure.
+ * @retval kStatus_Success Successfully start a transfer.
+ * @retval kStatus_InvalidArgument Input argument is invalid.
+ * @retval kStatus_SPI_Busy SPI is not idle, is running another transfer.
+ */
+status_t SPI_MasterTransferDMA(SPI_Type *base, spi_dma_handle_t *handle, spi_transfer_t *xfer);
+
+/*!
+ * @brief Perform a chain of SPI transfers as one DMA operation.
+ *
+ * Each segment is sent with its own slave select and config flags, for example a command segment with
+ * kSPI_EndOfFrame followed by a data segment with kSPI_EndOfTransfer. The TX DMA channel writes the TXCTL control
+ * word ahead of each segment and the last frame of each segment together with its control bits to TXDATCTL, so slave
+ * select, end of frame and end of transfer are applied at the right frame without CPU intervention. A segment that
+ * selects another slave than the previous one should follow a segment ending with kSPI_EndOfTransfer.
+ *
+ * Segments without receive buffer set the receive ignore bit and are skipped by the RX DMA channel, except for the
+ * last frame of the transfer: it is always received, into a scratch word if needed, and the RX DMA completion of that
+ * frame ends the transfer. The CPU therefore handles a single DMA interrupt per transfer.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI DMA handle pointer.
+ * @param segments Array of segments.
+ * @param count Number of segments, up to @ref SPI_DMA_MAX_SEGMENTS.
+ * @retval kStatus_Success Successfully start a transfer.
+ * @retval kStatus_InvalidArgument Input argument is invalid or needs more than @ref SPI_DMA_MAX_LINK_DESCRIPTORS.
+ * @retval kStatus_SPI_Busy SPI is not idle, is running another transfer.
+ */
+status_t SPI_MasterTransferSegmentsDMA(SPI_Type *base,
+                                       spi_dma_handle_t *handle,
+                                       spi_dma_segment_t *segments,
+                                       uint32_t count);
+
+/*!
+ * @brief Abort a SPI transfer using DMA.
+ *
+ * @param base SPI peripheral base address.
+ * @param handle SPI DMA handle pointer.
+ */
+void SPI_MasterTransferAbortDMA(SPI_Type *base, spi_dma_handle_t *handle);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* FSL_SPI_DMA_H_ */
@@ -0,0 +1,662 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_usart_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_miniusart_dma"
+#endif
+
+/* USART transfer state. */
+enum
+{
+    kUSART_TxIdle, /* TX idle. */
+    kUSART_TxBusy, /* TX busy. */
+    kUSART_RxIdle, /* RX idle. */
+    kUSART_RxBusy, /* RX busy. */
+    kUSART_RxRing, /* RX ring buffer running. */
+};
+
+/*<! @brief Structure definition for usart_dma_handle_t. The structure is private. */
+typedef struct _usart_dma_private_handle
+{
+    USART_Type *base;
+    usart_dma_handle_t *handle;
+} usart_dma_private_handle_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief DMA callback for USART TX.
+ *
+ * @param handle DMA handler for USART TX
+ * @param param user param passed to the callback function
+ */
+static void USART_TransferSendDMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode);
+
+/*!
+ * @brief DMA callback for USART RX, used both by single receives and by the ring buffer.
+ *
+ * @param handle DMA handler for USART RX
+ * @param param user param passed to the callback function
+ */
+static void USART_TransferReceiveDMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode);
+
+/*!
+ * @brief Gets the number of bytes written to the ring buffer by the DMA.
+ *
+ * Must be called with the RX channel interrupt disabled.
+ *
+ * @param handle USART handle pointer.
+ * @param index Ring buffer index of the next byte to be written.
+ * @return Bytes written since the ring was started, free running.
+ */
+static uint32_t USART_GetRxRingWriteCount(usart_dma_handle_t *handle, uint16_t *index);
+
+/*!
+ * @brief Drops the ring buffer content if the DMA has overwritten unread data.
+ *
+ * Must be called with the RX channel interrupt disabled.
+ *
+ * @param handle USART handle pointer.
+ * @param writeCount Bytes written since the ring was started.
+ * @param writeIndex Ring buffer index of the next byte to be written.
+ * @return true if unread data was lost.
+ */
+static bool USART_CheckRxRingOverrun(usart_dma_handle_t *handle, uint32_t writeCount, uint16_t writeIndex);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/*<! Private handle only used for internally. */
+static usart_dma_private_handle_t s_dmaPrivateHandle[FSL_FEATURE_SOC_USART_COUNT];
+
+/*<! Link descriptors of the RX ring, one per half of the ring buffer. */
+SDK_ALIGN(static dma_descriptor_t s_usartRxRingDescriptor[FSL_FEATURE_SOC_USART_COUNT][2],
+          FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void USART_TransferSendDMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode)
+{
+    assert(handle != NULL);
+    assert(param != NULL);
+
+    usart_dma_private_handle_t *usartPrivateHandle = (usart_dma_private_handle_t *)param;
+    usart_dma_handle_t *usartHandle                = usartPrivateHandle->handle;
+    status_t status                                = transferDone ? kStatus_USART_TxIdle : kStatus_USART_TxError;
+
+    usartHandle->txState = (uint8_t)kUSART_TxIdle;
+
+    if (usartHandle->callback != NULL)
+    {
+        usartHandle->callback(usartPrivateHandle->base, usartHandle, status, usartHandle->userData);
+    }
+}
+
+static void USART_TransferReceiveDMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode)
+{
+    assert(handle != NULL);
+    assert(param != NULL);
+
+    usart_dma_private_handle_t *usartPrivateHandle = (usart_dma_private_handle_t *)param;
+    usart_dma_handle_t *usartHandle                = usartPrivateHandle->handle;
+    status_t status                                = kStatus_USART_RxIdle;
+    uint32_t halfSize;
+    uint32_t writeCount;
+
+    if (!transferDone)
+    {
+        status = kStatus_USART_RxError;
+    }
+    else if (usartHandle->rxState == (uint8_t)kUSART_RxRing)
+    {
+        /* One half of the ring is full, the DMA has already reloaded the descriptor of the other half. */
+        usartHandle->rxRingHalfCount++;
+
+        halfSize   = usartHandle->rxRingBufferSize / 2U;
+        writeCount = usartHandle->rxRingHalfCount * halfSize;
+        if (USART_CheckRxRingOverrun(usartHandle, writeCount,
+                                     (uint16_t)((usartHandle->rxRingHalfCount & 1U) * halfSize)))
+        {
+            status = kStatus_USART_RxRingBufferOverrun;
+        }
+    }
+    else
+    {
+        usartHandle->rxState = (uint8_t)kUSART_RxIdle;
+    }
+
+    if (usartHandle->callback != NULL)
+    {
+        usartHandle->callback(usartPrivateHandle->base, usartHandle, status, usartHandle->userData);
+    }
+}
+
+static uint32_t USART_GetRxRingWriteCount(usart_dma_handle_t *handle, uint16_t *index)
+{
+    dma_handle_t *dmaHandle = handle->rxDmaHandle;
+    uint32_t channelMask    = 1UL << DMA_CHANNEL_INDEX(dmaHandle->base, dmaHandle->channel);
+    uint32_t halfSize       = handle->rxRingBufferSize / 2U;
+    uint32_t halfCount      = handle->rxRingHalfCount;
+    uint32_t pending;
+    uint32_t remaining;
+
+    /* A half may already be complete while its interrupt is still pending, the remaining count then belongs to the
+     * other half. Sample the flag around the count so both refer to the same descriptor. */
+    do
+    {
+        pending   = ((halfCount & 1U) == 0U) ? DMA_COMMON_REG_GET(dmaHandle->base, dmaHandle->channel, INTA) :
+                                               DMA_COMMON_REG_GET(dmaHandle->base, dmaHandle->channel, INTB);
+        remaining = DMA_GetRemainingBytes(dmaHandle->base, dmaHandle->channel);
+    } while (pending != (((halfCount & 1U) == 0U) ? DMA_COMMON_REG_GET(dmaHandle->base, dmaHandle->channel, INTA) :
+                                                    DMA_COMMON_REG_GET(dmaHandle->base, dmaHandle->channel, INTB)));
+
+    if ((pending & channelMask) != 0U)
+    {
+        halfCount++;
+    }
+
+    if (remaining > halfSize)
+    {
+        remaining = halfSize;
+    }
+
+    *index = (uint16_t)(((halfCount & 1U) * halfSize) + (halfSize - remaining));
+
+    return (halfCount * halfSize) + (halfSize - remaining);
+}
+
+static bool USART_CheckRxRingOverrun(usart_dma_handle_t *handle, uint32_t writeCount, uint16_t writeIndex)
+{
+    if ((writeCount - handle->rxRingReadCount) <= handle->rxRingBufferSize)
+    {
+        return false;
+    }
+
+    /* The oldest data has been overwritten, discard everything received so far. */
+    handle->rxRingReadCount  = writeCount;
+    handle->rxRingBufferTail = writeIndex;
+
+    return true;
+}
+
+/*!
+ * brief Initializes the USART handle which is used in transactional functions.
+ *
+ * param base USART peripheral base address.
+ * param handle Pointer to usart_dma_handle_t structure.
+ * param callback Callback function.
+ * param userData User data.
+ * param txDmaHandle User-requested DMA handle for TX DMA transfer.
+ * param rxDmaHandle User-requested DMA handle for RX DMA transfer.
+ */
+status_t USART_TransferCreateHandleDMA(USART_Type *base,
+                                       usart_dma_handle_t *handle,
+                                       usart_dma_transfer_callback_t callback,
+                                       void *userData,
+                                       dma_handle_t *txDmaHandle,
+                                       dma_handle_t *rxDmaHandle)
+{
+    uint32_t instance = 0;
+
+    /* check 'base' */
+    assert(!(NULL == base));
+    /* check 'handle' */
+    assert(!(NULL == handle));
+
+    instance = USART_GetInstance(base);
+
+    (void)memset(handle, 0, sizeof(*handle));
+    /* assign 'base' and 'handle' */
+    s_dmaPrivateHandle[instance].base   = base;
+    s_dmaPrivateHandle[instance].handle = handle;
+
+    /* set tx/rx 'idle' state */
+    handle->rxState = (uint8_t)kUSART_RxIdle;
+    handle->txState = (uint8_t)kUSART_TxIdle;
+
+    handle->base     = base;
+    handle->callback = callback;
+    handle->userData = userData;
+
+    handle->rxDmaHandle = rxDmaHandle;
+    handle->txDmaHandle = txDmaHandle;
+
+    /* Configure TX dma callback */
+    if (txDmaHandle != NULL)
+    {
+        DMA_SetCallback(txDmaHandle, USART_TransferSendDMACallback, &s_dmaPrivateHandle[instance]);
+    }
+
+    /* Configure RX dma callback */
+    if (rxDmaHandle != NULL)
+    {
+        DMA_SetCallback(rxDmaHandle, USART_TransferReceiveDMACallback, &s_dmaPrivateHandle[instance]);
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Sends data using DMA.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param xfer USART DMA transfer structure. See usart_transfer_t.
+ * retval kStatus_Success if succeed, others failed.
+ * retval kStatus_USART_TxBusy Previous transfer on going.
+ * retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferSendDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer)
+{
+    assert(handle != NULL);
+    assert(handle->txDmaHandle != NULL);
+    assert(xfer != NULL);
+
+    dma_transfer_config_t xferConfig;
+
+    /* Check if the device is busy */
+    if (handle->txState == (uint8_t)kUSART_TxBusy)
+    {
+        return kStatus_USART_TxBusy;
+    }
+
+    if ((xfer->data == NULL) || (xfer->dataSize == 0U) || (xfer->dataSize > USART_MAX_DMA_TRANSFER_COUNT))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    handle->txState       = (uint8_t)kUSART_TxBusy;
+    handle->txDataSizeAll = xfer->dataSize;
+
+    /* Prepare transfer. */
+    DMA_PrepareTransfer(&xferConfig, xfer->data, (void *)(uint32_t)&base->TXDAT, sizeof(uint8_t), xfer->dataSize,
+                        kDMA_MemoryToPeripheral, NULL);
+
+    /* Submit transfer. */
+    (void)DMA_SubmitTransfer(handle->txDmaHandle, &xferConfig);
+    DMA_StartTransfer(handle->txDmaHandle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Receives data using DMA.
+ *
+ * param base USART peripheral base address.
+ * param handle Pointer to usart_dma_handle_t structure.
+ * param xfer USART DMA transfer structure. See usart_transfer_t.
+ * retval kStatus_Success if succeed, others failed.
+ * retval kStatus_USART_RxBusy Previous transfer on going or the RX ring buffer is running.
+ * retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferReceiveDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer)
+{
+    assert(handle != NULL);
+    assert(handle->rxDmaHandle != NULL);
+    assert(xfer != NULL);
+
+    dma_transfer_config_t xferConfig;
+
+    /* Check if the device is busy */
+    if (handle->rxState != (uint8_t)kUSART_RxIdle)
+    {
+        return kStatus_USART_RxBusy;
+    }
+
+    if ((xfer->data == NULL) || (xfer->dataSize == 0U) || (xfer->dataSize > USART_MAX_DMA_TRANSFER_COUNT))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    handle->rxState       = (uint8_t)kUSART_RxBusy;
+    handle->rxDataSizeAll = xfer->dataSize;
+
+    /* Prepare transfer. */
+    DMA_PrepareTransfer(&xferConfig, (void *)(uint32_t)&base->RXDAT, xfer->data, sizeof(uint8_t), xfer->dataSize,
+                        kDMA_PeripheralToMemory, NULL);
+
+    /* Submit transfer. */
+    (void)DMA_SubmitTransfer(handle->rxDmaHandle, &xferConfig);
+    DMA_StartTransfer(handle->rxDmaHandle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Aborts the sent data using DMA.
+ *
+ * param base USART peripheral base address
+ * param handle Pointer to usart_dma_handle_t structure
+ */
+void USART_TransferAbortSendDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->txDmaHandle);
+
+    /* Stop transfer. */
+    DMA_AbortTransfer(handle->txDmaHandle);
+    handle->txState = (uint8_t)kUSART_TxIdle;
+}
+
+/*!
+ * brief Aborts the received data using DMA.
+ *
+ * This function also stops a running RX ring buffer.
+ *
+ * param base USART peripheral base address
+ * param handle Pointer to usart_dma_handle_t structure
+ */
+void USART_TransferAbortReceiveDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxDmaHandle);
+
+    /* Stop transfer. */
+    DMA_AbortTransfer(handle->rxDmaHandle);
+    handle->rxState = (uint8_t)kUSART_RxIdle;
+}
+
+/*!
+ * brief Get the number of bytes that have been sent.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param count Sent bytes count.
+ * retval kStatus_NoTransferInProgress No send in progress.
+ * retval kStatus_InvalidArgument Parameter is invalid.
+ * retval kStatus_Success Get successfully through the parameter \p count;
+ */
+status_t USART_TransferGetSendCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->txDmaHandle);
+
+    if (NULL == count)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Cannot get count when transfer is not started. */
+    if ((uint8_t)kUSART_TxIdle == handle->txState)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    *count = handle->txDataSizeAll -
+             DMA_GetRemainingBytes(handle->txDmaHandle->base, handle->txDmaHandle->channel);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Get the number of bytes that have been received.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param count Receive bytes count.
+ * retval kStatus_NoTransferInProgress No receive in progress.
+ * retval kStatus_InvalidArgument Parameter is invalid.
+ * retval kStatus_Success Get successfully through the parameter \p count;
+ */
+status_t USART_TransferGetReceiveCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxDmaHandle);
+
+    if (NULL == count)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Cannot get count when transfer is not started, the ring buffer reports its length instead. */
+    if ((uint8_t)kUSART_RxBusy != handle->rxState)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    *count = handle->rxDataSizeAll -
+             DMA_GetRemainingBytes(handle->rxDmaHandle->base, handle->rxDmaHandle->channel);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Starts continuous reception into a circular DMA ring buffer.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param ringBuffer Start address of the ring buffer. The buffer must stay valid while the ring is running.
+ * param ringBufferSize Size of the ring buffer, an even number up to USART_DMA_MAX_RING_BUFFER_SIZE.
+ * retval kStatus_Success Ring started.
+ * retval kStatus_USART_RxBusy A receive is in progress.
+ * retval kStatus_InvalidArgument Invalid ring buffer.
+ */
+status_t USART_TransferStartRingBufferDMA(USART_Type *base,
+                                          usart_dma_handle_t *handle,
+                                          uint8_t *ringBuffer,
+                                          size_t ringBufferSize)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxDmaHandle);
+
+    dma_channel_config_t transferConfig;
+    dma_channel_trigger_t trigger;
+    dma_descriptor_t *descriptor;
+    uint32_t halfSize = ringBufferSize / 2U;
+    uint32_t xferCfg[2];
+    void *rxdatAddr = (void *)(uint32_t)&base->RXDAT;
+
+    if ((NULL == ringBuffer) || (ringBufferSize < 2U) || ((ringBufferSize & 1U) != 0U) ||
+        (ringBufferSize > USART_DMA_MAX_RING_BUFFER_SIZE))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (handle->rxState != (uint8_t)kUSART_RxIdle)
+    {
+        return kStatus_USART_RxBusy;
+    }
+
+    descriptor = s_usartRxRingDescriptor[USART_GetInstance(base)];
+
+    handle->rxRingBuffer         = ringBuffer;
+    handle->rxRingBufferSize     = ringBufferSize;
+    handle->rxRingHalfCount      = 0U;
+    handle->rxRingReadCount      = 0U;
+    handle->rxRingBufferTail     = 0U;
+    handle->rxRingIdlePollCount  = 0U;
+    handle->rxRingIdleFlushCount = 0U;
+
+    /* First half raises INTA, second half raises INTB, each descriptor reloads the other one. */
+    xferCfg[0] = DMA_CHANNEL_XFER(true, false, true, false, sizeof(uint8_t), kDMA_AddressInterleave0xWidth,
+                                  kDMA_AddressInterleave1xWidth, halfSize);
+    xferCfg[1] = DMA_CHANNEL_XFER(true, false, false, true, sizeof(uint8_t), kDMA_AddressInterleave0xWidth,
+                                  kDMA_AddressInterleave1xWidth, halfSize);
+
+    DMA_SetupDescriptor(&descriptor[0], xferCfg[0], rxdatAddr, &ringBuffer[0], &descriptor[1]);
+    DMA_SetupDescriptor(&descriptor[1], xferCfg[1], rxdatAddr, &ringBuffer[halfSize], &descriptor[0]);
+
+    trigger.type  = kDMA_NoTrigger;
+    trigger.burst = kDMA_SingleTransfer;
+    trigger.wrap  = kDMA_NoWrap;
+
+    DMA_PrepareChannelTransfer(&transferConfig, rxdatAddr, &ringBuffer[0], xferCfg[0], kDMA_PeripheralToMemory,
+                               &trigger, &descriptor[1]);
+    if (DMA_SubmitChannelTransfer(handle->rxDmaHandle, &transferConfig) != kStatus_Success)
+    {
+        return kStatus_USART_RxBusy;
+    }
+
+    handle->rxState = (uint8_t)kUSART_RxRing;
+    DMA_StartTransfer(handle->rxDmaHandle);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops the DMA ring buffer.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ */
+void USART_TransferStopRingBufferDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    if (handle->rxState == (uint8_t)kUSART_RxRing)
+    {
+        USART_TransferAbortReceiveDMA(base, handle);
+    }
+
+    handle->rxRingBuffer     = NULL;
+    handle->rxRingBufferSize = 0U;
+}
+
+/*!
+ * brief Get the length of received data in the DMA RX ring buffer.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * return Length of received data in RX ring buffer.
+ */
+size_t USART_TransferGetRxRingBufferLengthDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    dma_handle_t *dmaHandle = handle->rxDmaHandle;
+    uint32_t writeCount;
+    uint16_t writeIndex;
+    size_t size;
+
+    if (handle->rxState != (uint8_t)kUSART_RxRing)
+    {
+        return 0U;
+    }
+
+    DMA_DisableChannelInterrupts(dmaHandle->base, dmaHandle->channel);
+    writeCount = USART_GetRxRingWriteCount(handle, &writeIndex);
+    size       = (size_t)(writeCount - handle->rxRingReadCount);
+    DMA_EnableChannelInterrupts(dmaHandle->base, dmaHandle->channel);
+
+    return (size > handle->rxRingBufferSize) ? handle->rxRingBufferSize : size;
+}
+
+/*!
+ * brief Reads data out of the DMA RX ring buffer.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ * param data Buffer to store the data.
+ * param length Maximum number of bytes to read.
+ * return Number of bytes copied to data.
+ */
+size_t USART_TransferReadRingBufferDMA(USART_Type *base, usart_dma_handle_t *handle, uint8_t *data, size_t length)
+{
+    assert(NULL != handle);
+    assert(NULL != data);
+
+    dma_handle_t *dmaHandle = handle->rxDmaHandle;
+    uint32_t writeCount;
+    uint16_t writeIndex;
+    size_t bytesToCopy = 0U;
+    size_t i;
+    bool overrun;
+
+    if (handle->rxState != (uint8_t)kUSART_RxRing)
+    {
+        return 0U;
+    }
+
+    /* Disable the RX channel interrupt so that the ring state is not updated by the DMA callback while copying,
+     * as the non-DMA ring buffer does with the RX ready interrupt. */
+    DMA_DisableChannelInterrupts(dmaHandle->base, dmaHandle->channel);
+
+    writeCount = USART_GetRxRingWriteCount(handle, &writeIndex);
+    overrun    = USART_CheckRxRingOverrun(handle, writeCount, writeIndex);
+
+    if (!overrun)
+    {
+        bytesToCopy = MIN((size_t)(writeCount - handle->rxRingReadCount), length);
+
+        for (i = 0U; i < bytesToCopy; i++)
+        {
+            data[i] = handle->rxRingBuffer[handle->rxRingBufferTail];
+
+            if ((size_t)handle->rxRingBufferTail + 1U == handle->rxRingBufferSize)
+            {
+                handle->rxRingBufferTail = 0U;
+            }
+            else
+            {
+                handle->rxRingBufferTail++;
+            }
+        }
+
+        handle->rxRingReadCount += (uint32_t)bytesToCopy;
+    }
+
+    DMA_EnableChannelInterrupts(dmaHandle->base, dmaHandle->channel);
+
+    if (overrun && (handle->callback != NULL))
+    {
+        handle->callback(base, handle, kStatus_USART_RxRingBufferOverrun, handle->userData);
+    }
+
+    return bytesToCopy;
+}
+
+/*!
+ * brief Detects the RX line going idle and flushes the ring buffer to the application.
+ *
+ * param base USART peripheral base address.
+ * param handle USART handle pointer.
+ */
+void USART_TransferHandleRxIdleDMA(USART_Type *base, usart_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    dma_handle_t *dmaHandle = handle->rxDmaHandle;
+    uint32_t writeCount;
+    uint16_t writeIndex;
+    bool isIdle = false;
+
+    if (handle->rxState != (uint8_t)kUSART_RxRing)
+    {
+        return;
+    }
+
+    DMA_DisableChannelInterrupts(dmaHandle->base, dmaHandle->channel);
+    writeCount = USART_GetRxRingWriteCount(handle, &writeIndex);
+    DMA_EnableChannelInterrupts(dmaHandle->base, dmaHandle->channel);
+
+    /* Nothing received for a whole poll period after some data arrived, and no character is being shifted in. */
+    if ((writeCount == handle->rxRingIdlePollCount) && (writeCount != handle->rxRingIdleFlushCount) &&
+        ((USART_GetStatusFlags(base) & (uint32_t)kUSART_RxIdleFlag) != 0U))
+    {
+        handle->rxRingIdleFlushCount = writeCount;
+        isIdle                       = true;
+    }
+
+    handle->rxRingIdlePollCount = writeCount;
+
+    if (isIdle && (handle->callback != NULL))
+    {
+        handle->callback(base, handle, kStatus_USART_DMA_RxRingIdle, handle->userData);
+    }
+}
@@ -0,0 +1,340 @@
+/*
+ * Register-mock test of the ADC sequence A DMA stream (fsl_adc_dma.c) at the maximum conversion rate.
+ *
+ * fsl_adc.c, fsl_adc_dma.c and fsl_dma.c run unchanged against the DMA model in mock/ and the ADC model below.
+ * Time advances in system clock cycles (30 MHz); at 1.2 Msps the ADC finishes a conversion every 25 cycles.
+ *
+ * ADC model: in burst mode sequence A converts the lowest channel of its channel mask back to back. Every result
+ * goes to SEQ_GDAT0 with DATAVALID set; a result that lands on an unread one sets OVERRUN, which is what a dropped
+ * sample looks like on the real part. With MODE = end of conversion the sequence A interrupt flag follows DATAVALID,
+ * and when the interrupt is enabled it drives the hardware trigger of the DMA channel (the INPUTMUX route is taken
+ * as set up). A DMA read of SEQ_GDAT0 clears DATAVALID and OVERRUN. CPU reads are not trapped, so the model must
+ * not leave a stale result behind between streams.
+ */
+
+#include <stdio.h>
+
+#include "fsl_adc_dma.h"
+#include "mock_device.h"
+#include "mock_dma.h"
+
+void DMA0_DriverIRQHandler(void);
+
+#define ADC_CHANNEL 3U
+#define DMA_CHANNEL 0U
+
+#define CONVERSION_CYCLES 25U /* 1.2 Msps at 30 MHz. */
+#define IRQ_LATENCY_CYCLES 16U
+
+#define CHECK(cond)                                                          \
+    do                                                                       \
+    {                                                                        \
+        if (!(cond))                                                         \
+        {                                                                    \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (0)
+
+static int s_failures;
+
+/* ADC model state. */
+static uint32_t s_adcCycle;
+static uint32_t s_adcNextResult;
+static uint32_t s_adcOverruns;
+
+/* System model state. */
+static uint32_t s_dmaEvery; /* The DMA gets the bus every s_dmaEvery cycles, 1 when it is idle otherwise. */
+static uint32_t s_irqWait;
+static uint32_t s_irqCount;
+
+/* Consumer state. */
+static uint32_t s_blockBuffer[2][128];
+static uint32_t s_samplesPerBlock;
+static uint32_t *s_expectedBlock;
+static uint32_t s_expectedResult;
+static bool s_expectedResultValid;
+static uint32_t s_blocks;
+static uint32_t s_badBlocks;
+static uint32_t s_badSamples;
+static status_t s_lastStatus;
+
+static dma_handle_t s_dmaHandle;
+static adc_dma_handle_t s_adcHandle;
+
+static void ADC_ModelUpdateTrigger(void)
+{
+    bool flag = ((ADC0->SEQ_CTRL[0] & ADC_SEQ_CTRL_MODE_MASK) == 0U) &&
+                ((ADC0->SEQ_GDAT[0] & ADC_SEQ_GDAT_DATAVALID_MASK) != 0U);
+
+    if (flag)
+    {
+        ADC0->FLAGS |= ADC_FLAGS_SEQA_INT_MASK;
+    }
+    else
+    {
+        ADC0->FLAGS &= ~ADC_FLAGS_SEQA_INT_MASK;
+    }
+    MOCK_DMA_SetTrigger(DMA_CHANNEL, flag && ((ADC0->INTEN & ADC_INTEN_SEQA_INTEN_MASK) != 0U));
+}
+
+static void ADC_ModelCycle(void)
+{
+    uint32_t seqCtrl = ADC0->SEQ_CTRL[0];
+    uint32_t channels = seqCtrl & ADC_SEQ_CTRL_CHANNELS_MASK;
+    uint32_t gdat;
+
+    if (((seqCtrl & ADC_SEQ_CTRL_SEQ_ENA_MASK) == 0U) || ((seqCtrl & ADC_SEQ_CTRL_BURST_MASK) == 0U) ||
+        (channels == 0U))
+    {
+        s_adcCycle = 0U;
+        return;
+    }
+
+    if (++s_adcCycle < CONVERSION_CYCLES)
+    {
+        return;
+    }
+    s_adcCycle = 0U;
+
+    gdat = ADC_SEQ_GDAT_DATAVALID_MASK | ADC_SEQ_GDAT_RESULT(s_adcNextResult) |
+           ADC_SEQ_GDAT_CHN((uint32_t)__builtin_ctz(channels));
+    if ((ADC0->SEQ_GDAT[0] & ADC_SEQ_GDAT_DATAVALID_MASK) != 0U)
+    {
+        gdat |= ADC_SEQ_GDAT_OVERRUN_MASK;
+        s_adcOverruns++;
+    }
+    MOCK_REG(ADC0->SEQ_GDAT[0]) = gdat;
+    s_adcNextResult   = (s_adcNextResult + 1U) & 0xFFFU;
+    ADC_ModelUpdateTrigger();
+}
+
+static void ADC_ModelBusAccess(uintptr_t address, bool write)
+{
+    if (!write && (address == (uintptr_t)&ADC0->SEQ_GDAT[0]))
+    {
+        MOCK_REG(ADC0->SEQ_GDAT[0]) &= ~(ADC_SEQ_GDAT_DATAVALID_MASK | ADC_SEQ_GDAT_OVERRUN_MASK);
+        ADC_ModelUpdateTrigger();
+    }
+}
+
+static void RunCycles(uint32_t cycles)
+{
+    for (uint32_t i = 0U; i < cycles; i++)
+    {
+        ADC_ModelCycle();
+
+        if ((i % s_dmaEvery) == 0U)
+        {
+            (void)MOCK_DMA_Step();
+        }
+
+        if (MOCK_DMA_IrqLine() && MOCK_IrqDeliverable(DMA0_IRQn))
+        {
+            if (++s_irqWait >= IRQ_LATENCY_CYCLES)
+            {
+                s_irqWait = 0U;
+                s_irqCount++;
+                DMA0_DriverIRQHandler();
+            }
+        }
+        else
+        {
+            s_irqWait = 0U;
+        }
+    }
+}
+
+/* Consumer: blocks have to alternate and hold consecutive results without OVERRUN. */
+static void BlockCallback(ADC_Type *base, adc_dma_handle_t *handle, status_t status, uint32_t *block, void *userData)
+{
+    bool bad = false;
+
+    (void)base;
+    (void)handle;
+    (void)userData;
+
+    s_lastStatus = status;
+    if (status != kStatus_Success)
+    {
+        s_badBlocks++;
+        return;
+    }
+
+    if (block != s_expectedBlock)
+    {
+        bad = true;
+    }
+    s_expectedBlock = (block == s_blockBuffer[0]) ? s_blockBuffer[1] : s_blockBuffer[0];
+
+    for (uint32_t i = 0U; i < s_samplesPerBlock; i++)
+    {
+        uint32_t sample = block[i];
+        uint32_t result = ADC_DMA_SAMPLE_RESULT(sample);
+
+        if (((sample & ADC_SEQ_GDAT_OVERRUN_MASK) != 0U) || (ADC_DMA_SAMPLE_CHANNEL(sample) != ADC_CHANNEL) ||
+            (s_expectedResultValid && (result != s_expectedResult)))
+        {
+            s_badSamples++;
+        }
+        s_expectedResult      = (result + 1U) & 0xFFFU;
+        s_expectedResultValid = true;
+    }
+    s_blocks++;
+    if (bad)
+    {
+        s_badBlocks++;
+    }
+}
+
+static void SetUp(uint32_t seqCtrlMode, bool seqInterruptEnabled)
+{
+    adc_conv_seq_config_t seqConfig;
+
+    MOCK_DeviceReset();
+    MOCK_DMA_Reset();
+    MOCK_DMA_SetBusHook(ADC_ModelBusAccess);
+
+    s_adcCycle      = 0U;
+    s_adcNextResult = 0U;
+    s_adcOverruns   = 0U;
+    s_dmaEvery      = 1U;
+    s_irqWait       = 0U;
+    s_irqCount      = 0U;
+
+    memset(&seqConfig, 0, sizeof(seqConfig));
+    seqConfig.channelMask   = 1UL << ADC_CHANNEL;
+    seqConfig.interruptMode = (seqCtrlMode != 0U) ? kADC_InterruptForEachSequence : kADC_InterruptForEachConversion;
+    ADC_SetConvSeqAConfig(ADC0, &seqConfig);
+    ADC_EnableConvSeqA(ADC0, true);
+    if (seqInterruptEnabled)
+    {
+        ADC_EnableInterrupts(ADC0, (uint32_t)kADC_ConvSeqAInterruptEnable);
+    }
+
+    DMA_Init(DMA0);
+    DMA_CreateHandle(&s_dmaHandle, DMA0, DMA_CHANNEL);
+    ADC_TransferCreateHandleDMA(ADC0, &s_adcHandle, BlockCallback, NULL, &s_dmaHandle);
+}
+
+static status_t StartStream(uint32_t samplesPerBlock)
+{
+    adc_dma_stream_config_t config;
+
+    s_samplesPerBlock     = samplesPerBlock;
+    s_expectedBlock       = s_blockBuffer[0];
+    s_expectedResultValid = false;
+    s_blocks              = 0U;
+    s_badBlocks           = 0U;
+    s_badSamples          = 0U;
+    s_lastStatus          = kStatus_Success;
+
+    config.blockBuffer[0]  = s_blockBuffer[0];
+    config.blockBuffer[1]  = s_blockBuffer[1];
+    config.samplesPerBlock = samplesPerBlock;
+    config.enableBurstMode = true;
+    return ADC_TransferStartStreamDMA(ADC0, &s_adcHandle, &config);
+}
+
+static void TestMaxRate(uint32_t samplesPerBlock, uint32_t blocks)
+{
+    uint32_t count = 0U;
+
+    printf("max rate, %u samples per block, %u blocks\n", (unsigned)samplesPerBlock, (unsigned)blocks);
+    SetUp(0U, false);
+
+    CHECK(StartStream(samplesPerBlock) == kStatus_Success);
+    RunCycles(blocks * samplesPerBlock * CONVERSION_CYCLES + IRQ_LATENCY_CYCLES);
+
+    CHECK(s_adcOverruns == 0U);
+    CHECK(s_badSamples == 0U);
+    CHECK(s_badBlocks == 0U);
+    CHECK(s_blocks == blocks);
+    CHECK(s_irqCount == blocks);
+    CHECK(ADC_TransferGetBlockCountDMA(ADC0, &s_adcHandle, &count) == kStatus_Success);
+    CHECK(count == blocks);
+    CHECK(MOCK_DMA_GetTransferCount() == blocks * samplesPerBlock);
+
+    ADC_TransferStopStreamDMA(ADC0, &s_adcHandle);
+}
+
+/* The check above has to notice drops: a DMA that only gets the bus every 30 cycles can't keep up. */
+static void TestStarvedDmaIsCaught(void)
+{
+    printf("starved DMA shows up as dropped samples\n");
+    SetUp(0U, false);
+    s_dmaEvery = CONVERSION_CYCLES + 5U;
+
+    CHECK(StartStream(32U) == kStatus_Success);
+    RunCycles(8U * 32U * CONVERSION_CYCLES);
+
+    CHECK(s_adcOverruns != 0U);
+    CHECK(s_badSamples != 0U);
+
+    ADC_TransferStopStreamDMA(ADC0, &s_adcHandle);
+}
+
+static void TestStopRestoresSequence(bool seqInterruptEnabled)
+{
+    printf("stop restores sequence A, interrupt %s before the stream\n", seqInterruptEnabled ? "on" : "off");
+    SetUp(ADC_SEQ_CTRL_MODE_MASK, seqInterruptEnabled);
+
+    CHECK(StartStream(16U) == kStatus_Success);
+    CHECK((ADC0->SEQ_CTRL[0] & ADC_SEQ_CTRL_MODE_MASK) == 0U);
+    CHECK((ADC0->INTEN & ADC_INTEN_SEQA_INTEN_MASK) != 0U);
+    CHECK(StartStream(16U) == kStatus_ADC_DMA_Busy);
+
+    RunCycles(4U * 16U * CONVERSION_CYCLES);
+    CHECK(s_blocks == 3U);
+    CHECK(s_badSamples == 0U);
+
+    ADC_TransferStopStreamDMA(ADC0, &s_adcHandle);
+
+    CHECK((ADC0->SEQ_CTRL[0] & ADC_SEQ_CTRL_MODE_MASK) == ADC_SEQ_CTRL_MODE_MASK);
+    CHECK((ADC0->SEQ_CTRL[0] & ADC_SEQ_CTRL_BURST_MASK) == 0U);
+    CHECK((ADC0->SEQ_CTRL[0] & ADC_SEQ_CTRL_SEQ_ENA_MASK) != 0U);
+    CHECK(((ADC0->INTEN & ADC_INTEN_SEQA_INTEN_MASK) != 0U) == seqInterruptEnabled);
+    CHECK(!DMA_ChannelIsActive(DMA0, DMA_CHANNEL));
+
+    /* Nothing moves once the stream is down. */
+    uint32_t transfers = MOCK_DMA_GetTransferCount();
+    RunCycles(4U * 16U * CONVERSION_CYCLES);
+    CHECK(MOCK_DMA_GetTransferCount() == transfers);
+}
+
+static void TestRestart(void)
+{
+    printf("restart after stop\n");
+    SetUp(0U, false);
+
+    /* Stopped with the interrupt of the fifth block still pending. */
+    CHECK(StartStream(32U) == kStatus_Success);
+    RunCycles(5U * 32U * CONVERSION_CYCLES + 7U);
+    CHECK(s_blocks == 4U);
+    ADC_TransferStopStreamDMA(ADC0, &s_adcHandle);
+
+    CHECK(StartStream(32U) == kStatus_Success);
+    RunCycles(6U * 32U * CONVERSION_CYCLES + IRQ_LATENCY_CYCLES);
+
+    CHECK(s_blocks == 6U);
+    CHECK(s_badSamples == 0U);
+    CHECK(s_badBlocks == 0U);
+    CHECK(s_lastStatus == kStatus_Success);
+    CHECK(s_adcOverruns == 0U);
+
+    ADC_TransferStopStreamDMA(ADC0, &s_adcHandle);
+}
+
+int main(void)
+{
+    TestMaxRate(1U, 64U);
+    TestMaxRate(64U, 40U);
+    TestMaxRate(128U, 20U);
+    TestStarvedDmaIsCaught();
+    TestStopRestoresSequence(false);
+    TestStopRestoresSequence(true);
+    TestRestart();
+
+    printf("%s, %d failures\n", (s_failures != 0) ? "FAILED" : "passed", s_failures);
+    return (s_failures != 0) ? 1 : 0;
+}
@@ -0,0 +1,372 @@
+/*
+ * Host benchmark and cross-check of the CRC adapters.
+ *
+ * The software adapter (fsl_adapter_software_crc.c) is linked once per table configuration, see CRC_ENGINES in
+ * CMakeLists.txt: the bitwise engine, the byte table, slice-by-4 and slice-by-8 with the default tables for reflected
+ * input, and slice-by-8 with tables for input that is not reflected. Every engine has to give the catalogue check values, the results of the LPC adapter (fsl_adapter_lpc_crc.c
+ * on fsl_crc.c and the CRC engine model in mock_crc.c) for every configuration the hardware supports, and the results
+ * of the bitwise engine for every other configuration, in one call or split in chunks. The throughput of each engine
+ * is then measured on a 64 KiB buffer, for CRC-32/MPEG-2 and for CRC-32: engines whose tables were built for the other
+ * input reflection fall back to the bitwise engine.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "fsl_adapter_crc.h"
+#include "mock_device.h"
+
+#define BENCH_BYTES  (64U * 1024U)
+#define BENCH_ROUNDS 32U
+
+#define CROSS_CHECK_ROUNDS 4000U
+#define MAX_FRAME_BYTES    300U
+
+#define CHECK(cond)                                                          \
+    do                                                                       \
+    {                                                                        \
+        if (!(cond))                                                         \
+        {                                                                    \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (0)
+
+#define CRC_ENGINE_DECLARE(name)                                                               \
+    uint32_t HAL_CrcCompute_##name(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length); \
+    void HAL_CrcInit_##name(hal_crc_context_t *context, hal_crc_config_t *crcConfig);             \
+    void HAL_CrcUpdate_##name(hal_crc_context_t *context, uint8_t *dataIn, uint32_t length);      \
+    uint32_t HAL_CrcFinal_##name(hal_crc_context_t *context)
+
+#define CRC_ENGINE(name, label, refIn)                                                                    \
+    {                                                                                                     \
+        label, refIn, HAL_CrcCompute_##name, HAL_CrcInit_##name, HAL_CrcUpdate_##name, HAL_CrcFinal_##name \
+    }
+
+CRC_ENGINE_DECLARE(Slices0);
+CRC_ENGINE_DECLARE(Slices1);
+CRC_ENGINE_DECLARE(Slices4);
+CRC_ENGINE_DECLARE(Slices8);
+CRC_ENGINE_DECLARE(Slices8NoRef);
+
+typedef struct _crc_engine
+{
+    const char *name;
+    bool refIn; /* Tables built for reflected input, the bitwise engine has none. */
+    uint32_t (*compute)(hal_crc_config_t *crcConfig, uint8_t *dataIn, uint32_t length);
+    void (*init)(hal_crc_context_t *context, hal_crc_config_t *crcConfig);
+    void (*update)(hal_crc_context_t *context, uint8_t *dataIn, uint32_t length);
+    uint32_t (*final)(hal_crc_context_t *context);
+} crc_engine_t;
+
+/* The bitwise engine comes first. */
+static const crc_engine_t s_engines[] = {
+    CRC_ENGINE(Slices0, "bitwise", true),
+    CRC_ENGINE(Slices1, "byte table", true),
+    CRC_ENGINE(Slices4, "slice-by-4", true),
+    CRC_ENGINE(Slices8, "slice-by-8", true),
+    CRC_ENGINE(Slices8NoRef, "slice-by-8, not reflected", false),
+};
+
+/* A CRC the LPC CRC engine can compute. */
+typedef struct _crc_model
+{
+    const char *name;
+    uint8_t size;
+    bool refIn;
+    bool refOut;
+    bool complement;
+    uint32_t seed;
+    uint32_t check; /* CRC of "123456789" */
+} crc_model_t;
+
+static const crc_model_t s_catalogue[] = {
+    {"CRC-32", 4U, true, true, true, 0xFFFFFFFFU, 0xCBF43926U},
+    {"CRC-32/BZIP2", 4U, false, false, true, 0xFFFFFFFFU, 0xFC891918U},
+    {"CRC-32/MPEG-2", 4U, false, false, false, 0xFFFFFFFFU, 0x0376E6E7U},
+    {"CRC-16/IBM-3740", 2U, false, false, false, 0xFFFFU, 0x29B1U},
+    {"CRC-16/XMODEM", 2U, false, false, false, 0x0000U, 0x31C3U},
+    {"CRC-16/KERMIT", 2U, true, true, false, 0x0000U, 0x2189U},
+    {"CRC-16/GENIBUS", 2U, false, false, true, 0xFFFFU, 0xD64EU},
+    {"CRC-16/IBM-SDLC", 2U, true, true, true, 0xFFFFU, 0x906EU},
+};
+
+static int s_failures;
+static uint32_t s_random = 1U;
+static uint8_t s_buffer[BENCH_BYTES + 4U];
+
+static uint64_t NowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+static uint32_t Random(void)
+{
+    s_random ^= s_random << 13U;
+    s_random ^= s_random >> 17U;
+    s_random ^= s_random << 5U;
+    return s_random;
+}
+
+static uint32_t SizeMask(uint8_t size)
+{
+    return 0xFFFFFFFFU >> (8U * (4U - (uint32_t)size));
+}
+
+/* Software adapter configuration: the output is reflected by the LS byte first order, complemented by crcXorOut. */
+static hal_crc_config_t SoftwareConfig(const crc_model_t *model)
+{
+    hal_crc_config_t config = {
+        .crcRefIn           = model->refIn ? KHAL_CrcRefInput : KHAL_CrcInputNoRef,
+        .crcRefOut          = model->refOut ? KHAL_CrcRefOutput : KHAL_CrcOutputNoRef,
+        .crcByteOrder       = model->refOut ? KHAL_CrcLSByteFirst : KHAL_CrcMSByteFirst,
+        .crcSeed            = model->seed,
+        .crcPoly            = (model->size == 4U) ? KHAL_CrcPolynomial_CRC_32 : KHAL_CrcPolynomial_CRC_16,
+        .crcXorOut          = model->complement ? SizeMask(model->size) : 0U,
+        .complementChecksum = 0U,
+        .crcSize            = model->size,
+        .crcStartByte       = 0U,
+    };
+
+    return config;
+}
+
+/* LPC adapter configuration: the engine reflects and complements the sum itself. */
+static hal_crc_config_t HardwareConfig(const crc_model_t *model)
+{
+    hal_crc_config_t config = SoftwareConfig(model);
+
+    config.crcXorOut          = 0U;
+    config.complementChecksum = model->complement ? 1U : 0U;
+    return config;
+}
+
+/* Runs a computation in random chunks of up to 17 bytes. */
+static uint32_t ComputeInChunks(const crc_engine_t *engine, hal_crc_config_t *config, uint8_t *data, uint32_t length)
+{
+    hal_crc_context_t context;
+    uint32_t chunk;
+
+    engine->init(&context, config);
+    while (length != 0U)
+    {
+        chunk = Random() % 18U;
+        chunk = MIN(chunk, length);
+        engine->update(&context, data, chunk);
+        data += chunk;
+        length -= chunk;
+    }
+    return engine->final(&context);
+}
+
+static uint32_t HardwareInChunks(hal_crc_config_t *config, uint8_t *data, uint32_t length)
+{
+    hal_crc_context_t context;
+    uint32_t chunk;
+
+    HAL_CrcInit(&context, config);
+    while (length != 0U)
+    {
+        chunk = Random() % 18U;
+        chunk = MIN(chunk, length);
+        HAL_CrcUpdate(&context, data, chunk);
+        data += chunk;
+        length -= chunk;
+    }
+    return HAL_CrcFinal(&context);
+}
+
+static void TestCatalogue(void)
+{
+    hal_crc_config_t config;
+
+    printf("catalogue check values\n");
+
+    for (uint32_t i = 0U; i < ARRAY_SIZE(s_catalogue); i++)
+    {
+        /* Every alignment, so fsl_crc.c writes both bytes and words. */
+        for (uint32_t offset = 0U; offset < 4U; offset++)
+        {
+            memcpy(&s_buffer[offset], "123456789", 9U);
+
+            config = HardwareConfig(&s_catalogue[i]);
+            CHECK(HAL_CrcCompute(&config, &s_buffer[offset], 9U) == s_catalogue[i].check);
+
+            config = SoftwareConfig(&s_catalogue[i]);
+            for (uint32_t e = 0U; e < ARRAY_SIZE(s_engines); e++)
+            {
+                CHECK(s_engines[e].compute(&config, &s_buffer[offset], 9U) == s_catalogue[i].check);
+            }
+        }
+    }
+}
+
+static void TestHardwareCrossCheck(void)
+{
+    crc_model_t model = {.name = "random"};
+    hal_crc_config_t hardware;
+    hal_crc_config_t software;
+    uint32_t offset;
+    uint32_t length;
+    uint32_t expected;
+    uint32_t mismatches = 0U;
+
+    printf("cross-check against the LPC CRC engine, %u frames\n", (unsigned)CROSS_CHECK_ROUNDS);
+
+    for (uint32_t round = 0U; round < CROSS_CHECK_ROUNDS; round++)
+    {
+        model.size       = ((Random() & 1U) != 0U) ? 4U : 2U;
+        model.refIn      = (Random() & 1U) != 0U;
+        model.refOut     = (Random() & 1U) != 0U;
+        model.complement = (Random() & 1U) != 0U;
+        model.seed       = Random() & SizeMask(model.size);
+        hardware         = HardwareConfig(&model);
+        software         = SoftwareConfig(&model);
+
+        offset = Random() % 4U;
+        length = Random() % (MAX_FRAME_BYTES + 1U);
+        for (uint32_t i = 0U; i < length; i++)
+        {
+            s_buffer[offset + i] = (uint8_t)Random();
+        }
+
+        expected = HAL_CrcCompute(&hardware, &s_buffer[offset], length);
+        if (HardwareInChunks(&hardware, &s_buffer[offset], length) != expected)
+        {
+            mismatches++;
+        }
+        for (uint32_t e = 0U; e < ARRAY_SIZE(s_engines); e++)
+        {
+            if ((s_engines[e].compute(&software, &s_buffer[offset], length) != expected) ||
+                (ComputeInChunks(&s_engines[e], &software, &s_buffer[offset], length) != expected))
+            {
+                if (mismatches < 5U)
+                {
+                    printf("  %s: size %u refIn %u refOut %u complement %u seed 0x%08x length %u\n", s_engines[e].name,
+                           (unsigned)model.size, (unsigned)model.refIn, (unsigned)model.refOut,
+                           (unsigned)model.complement, (unsigned)model.seed, (unsigned)length);
+                }
+                mismatches++;
+            }
+        }
+    }
+    CHECK(mismatches == 0U);
+}
+
+static void TestSoftwareEngines(void)
+{
+    static const uint32_t polys[] = {KHAL_CrcPolynomial_CRC_32, KHAL_CrcPolynomial_CRC_16,
+                                     KHAL_CrcPolynomial_CRC_8_CCITT, 0x8005U, 0x1EDC6F41U};
+    static const uint8_t sizes[]  = {4U, 2U, 1U, 2U, 4U};
+    hal_crc_config_t config;
+    uint32_t length;
+    uint32_t expected;
+    uint32_t mismatches = 0U;
+    uint32_t p;
+
+    printf("software engines against the bitwise engine, %u frames\n", (unsigned)CROSS_CHECK_ROUNDS);
+
+    for (uint32_t round = 0U; round < CROSS_CHECK_ROUNDS; round++)
+    {
+        p = Random() % ARRAY_SIZE(polys);
+        (void)memset(&config, 0, sizeof(config));
+        config.crcPoly      = polys[p];
+        config.crcSize      = sizes[p];
+        config.crcRefIn     = ((Random() & 1U) != 0U) ? KHAL_CrcRefInput : KHAL_CrcInputNoRef;
+        config.crcRefOut    = ((Random() & 1U) != 0U) ? KHAL_CrcRefOutput : KHAL_CrcOutputNoRef;
+        config.crcByteOrder = ((Random() & 1U) != 0U) ? KHAL_CrcMSByteFirst : KHAL_CrcLSByteFirst;
+        config.crcSeed      = Random() & SizeMask(config.crcSize);
+        config.crcXorOut    = ((Random() & 1U) != 0U) ? SizeMask(config.crcSize) : 0U;
+        config.crcStartByte = (uint8_t)(Random() % 4U);
+
+        length = Random() % (MAX_FRAME_BYTES + 1U);
+        for (uint32_t i = 0U; i < length; i++)
+        {
+            s_buffer[i] = (uint8_t)Random();
+        }
+
+        expected = s_engines[0].compute(&config, s_buffer, length);
+        for (uint32_t e = 0U; e < ARRAY_SIZE(s_engines); e++)
+        {
+            if ((s_engines[e].compute(&config, s_buffer, length) != expected) ||
+                (ComputeInChunks(&s_engines[e], &config, s_buffer, length) != expected))
+            {
+                if (mismatches < 5U)
+                {
+                    printf("  %s: poly 0x%x size %u refIn %u length %u\n", s_engines[e].name, (unsigned)config.crcPoly,
+                           (unsigned)config.crcSize, (unsigned)config.crcRefIn, (unsigned)length);
+                }
+                mismatches++;
+            }
+        }
+    }
+    CHECK(mismatches == 0U);
+}
+
+/* Returns the time per byte in ns. */
+static double BenchEngine(const crc_engine_t *engine, const crc_model_t *model)
+{
+    hal_crc_config_t config = SoftwareConfig(model);
+    volatile uint32_t crc;
+    uint64_t start;
+    double nsPerByte;
+
+    start = NowNs();
+    for (uint32_t round = 0U; round < BENCH_ROUNDS; round++)
+    {
+        crc = engine->compute(&config, s_buffer, BENCH_BYTES);
+    }
+    nsPerByte = (double)(NowNs() - start) / ((double)BENCH_ROUNDS * (double)BENCH_BYTES);
+    (void)crc;
+
+    return nsPerByte;
+}
+
+static void BenchThroughput(const crc_model_t *model)
+{
+    double bitwise = 0.0;
+    double nsPerByte;
+    bool tables;
+
+    printf("%s throughput, %u KiB\n", model->name, (unsigned)(BENCH_BYTES / 1024U));
+
+    for (uint32_t i = 0U; i < BENCH_BYTES; i++)
+    {
+        s_buffer[i] = (uint8_t)Random();
+    }
+
+    for (uint32_t e = 0U; e < ARRAY_SIZE(s_engines); e++)
+    {
+        nsPerByte = BenchEngine(&s_engines[e], model);
+        if (e == 0U)
+        {
+            bitwise = nsPerByte;
+        }
+        printf("  %-28s %7.2f ns/byte %8.1f MB/s %6.1fx\n", s_engines[e].name, nsPerByte, 1000.0 / nsPerByte,
+               bitwise / nsPerByte);
+
+        /* Engines whose tables match the configuration have to beat the bitwise one. */
+        tables = (e != 0U) && (model->refIn == s_engines[e].refIn);
+        if (tables)
+        {
+            CHECK(nsPerByte < bitwise);
+        }
+    }
+}
+
+int main(void)
+{
+    MOCK_DeviceReset();
+
+    TestCatalogue();
+    TestHardwareCrossCheck();
+    TestSoftwareEngines();
+    BenchThroughput(&s_catalogue[2]);
+    BenchThroughput(&s_catalogue[0]);
+
+    printf("%s, %d failures\n", (s_failures != 0) ? "FAILED" : "passed", s_failures);
+    return (s_failures != 0) ? 1 : 0;
+}
@@ -0,0 +1,420 @@
+/*
+ * Register-mock test of the DMA transfer queue (fsl_dma_queue.c).
+ *
+ * fsl_dma_queue.c and fsl_dma.c run unchanged against the DMA model in mock/ on a memory-to-memory channel, which
+ * moves one unit every cycle. The DMA interrupt is served a set number of cycles after its request rises, so the
+ * tests can hold it off while several transfers complete.
+ *
+ * Every transfer ends at a known unit count of the channel. After each interrupt the test checks that the queue
+ * reported all the transfers finished by then, and in every callback that the transfer's last unit has been moved.
+ */
+
+#include <stdio.h>
+
+#include "fsl_dma_queue.h"
+#include "mock_device.h"
+#include "mock_dma.h"
+
+void DMA0_DriverIRQHandler(void);
+
+#define DMA_CHANNEL 0U
+#define POOL_SIZE 32U
+#define MAX_TRANSFERS 1024U
+#define SLOTS 8U
+
+#define CHECK(cond)                                                          \
+    do                                                                       \
+    {                                                                        \
+        if (!(cond))                                                         \
+        {                                                                    \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (0)
+
+/* A transfer and the unit count of the channel at which it ends. */
+typedef struct _test_transfer
+{
+    dma_queue_transfer_t transfer;
+    uint32_t index;
+    uint32_t endUnit;
+} test_transfer_t;
+
+static int s_failures;
+static uint32_t s_random = 0x1234567U;
+
+static dma_handle_t s_dmaHandle;
+static dma_queue_handle_t s_queue;
+DMA_ALLOCATE_LINK_DESCRIPTORS(s_pool, POOL_SIZE);
+
+/* Static, the DMA descriptors hold 32-bit addresses. */
+static uint8_t s_src[32768];
+static uint8_t s_dst[32768];
+static test_transfer_t s_transfers[SLOTS];
+
+static uint32_t s_width;
+static uint32_t s_irqLatency;
+static uint32_t s_irqWait;
+static uint32_t s_isrCount;
+static uint32_t s_idleRun;
+static uint32_t s_gapCycles;
+
+static uint32_t s_submitted;
+static uint32_t s_submittedUnits;
+static uint32_t s_endUnits[MAX_TRANSFERS];
+static uint32_t s_reported;
+static uint32_t s_early;
+static uint32_t s_late;
+static uint32_t s_outOfOrder;
+static uint32_t s_badData;
+static void (*s_onDone)(test_transfer_t *transfer);
+
+static uint32_t Random(void)
+{
+    s_random ^= s_random << 13U;
+    s_random ^= s_random >> 17U;
+    s_random ^= s_random << 5U;
+    return s_random;
+}
+
+static void Callback(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer, status_t status, void *userData)
+{
+    test_transfer_t *test = (test_transfer_t *)userData;
+
+    (void)handle;
+    (void)transfer;
+
+    if (test->index != s_reported)
+    {
+        s_outOfOrder++;
+    }
+    if (MOCK_DMA_GetTransferCount() < test->endUnit)
+    {
+        s_early++;
+    }
+    if ((status != kStatus_Success) ||
+        (memcmp(test->transfer.dstAddr, test->transfer.srcAddr, test->transfer.bytes) != 0))
+    {
+        s_badData++;
+    }
+    s_reported++;
+
+    if (s_onDone != NULL)
+    {
+        s_onDone(test);
+    }
+}
+
+static void SetUp(uint32_t width, uint32_t irqLatency)
+{
+    MOCK_DeviceReset();
+    MOCK_DMA_Reset();
+
+    DMA_Init(DMA0);
+    DMA_EnableChannel(DMA0, DMA_CHANNEL);
+    DMA_CreateHandle(&s_dmaHandle, DMA0, DMA_CHANNEL);
+    DMA_QueueCreateHandle(&s_queue, &s_dmaHandle, kDMA_MemoryToMemory, width, s_pool, POOL_SIZE);
+
+    for (uint32_t i = 0U; i < sizeof(s_src); i++)
+    {
+        s_src[i] = (uint8_t)Random();
+    }
+    memset(s_dst, 0, sizeof(s_dst));
+    memset(s_transfers, 0, sizeof(s_transfers));
+
+    s_width          = width;
+    s_irqLatency     = irqLatency;
+    s_irqWait        = 0U;
+    s_isrCount       = 0U;
+    s_idleRun        = 0U;
+    s_gapCycles      = 0U;
+    s_submitted      = 0U;
+    s_submittedUnits = 0U;
+    s_reported       = 0U;
+    s_early          = 0U;
+    s_late           = 0U;
+    s_outOfOrder     = 0U;
+    s_badData        = 0U;
+    s_onDone         = NULL;
+}
+
+static status_t Submit(test_transfer_t *test, uint32_t offset, uint32_t bytes)
+{
+    status_t status;
+
+    test->transfer.srcAddr  = &s_src[offset];
+    test->transfer.dstAddr  = &s_dst[offset];
+    test->transfer.bytes    = bytes;
+    test->transfer.callback = Callback;
+    test->transfer.userData = test;
+
+    status = DMA_QueueSubmit(&s_queue, &test->transfer);
+    if (status == kStatus_Success)
+    {
+        s_submittedUnits += bytes / s_width;
+        test->index             = s_submitted;
+        test->endUnit           = s_submittedUnits;
+        s_endUnits[s_submitted] = s_submittedUnits;
+        s_submitted++;
+    }
+    return status;
+}
+
+/* Every transfer whose last unit was moved before the interrupt must have been reported by it. */
+static void CheckReported(void)
+{
+    if ((s_reported < s_submitted) && (s_endUnits[s_reported] <= MOCK_DMA_GetTransferCount()))
+    {
+        s_late++;
+    }
+}
+
+static void RunCycles(uint32_t cycles)
+{
+    for (uint32_t i = 0U; i < cycles; i++)
+    {
+        /* Cycles without a unit moved between two moved units are gaps in the stream. */
+        if (MOCK_DMA_Step())
+        {
+            s_gapCycles += s_idleRun;
+            s_idleRun = 0U;
+        }
+        else if (MOCK_DMA_GetTransferCount() != 0U)
+        {
+            s_idleRun++;
+        }
+        else
+        {
+            /* Not started yet. */
+        }
+
+        if (MOCK_DMA_IrqLine() && MOCK_IrqDeliverable(DMA0_IRQn))
+        {
+            if (++s_irqWait >= s_irqLatency)
+            {
+                s_irqWait = 0U;
+                s_isrCount++;
+                DMA0_DriverIRQHandler();
+                CheckReported();
+            }
+        }
+        else
+        {
+            s_irqWait = 0U;
+        }
+    }
+}
+
+static void RunUntilIdle(void)
+{
+    for (uint32_t i = 0U; (i < 1000000U) && (DMA_QueueIsBusy(&s_queue) || MOCK_DMA_IrqLine()); i++)
+    {
+        RunCycles(1U);
+    }
+    CHECK(!DMA_QueueIsBusy(&s_queue));
+}
+
+static void CheckClean(void)
+{
+    CHECK(s_reported == s_submitted);
+    CHECK(s_early == 0U);
+    CHECK(s_late == 0U);
+    CHECK(s_outOfOrder == 0U);
+    CHECK(s_badData == 0U);
+}
+
+/*
+ * Five short transfers queued at once, with the interrupt held off until the first three are done. The flags of
+ * the first and the third transfer merge into one, the first interrupt still has to report all three.
+ */
+static void TestMergedFlags(void)
+{
+    dma_queue_counters_t counters;
+
+    printf("merged flags: 5 x 16 B, interrupt held off 40 cycles\n");
+    SetUp(1U, 40U);
+
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+        CHECK(Submit(&s_transfers[i], i * 16U, 16U) == kStatus_Success);
+    }
+
+    /* The first interrupt comes 40 cycles after the first transfer, with three of them done. */
+    RunCycles(16U + 40U);
+    CHECK(s_isrCount == 1U);
+    CHECK(s_reported == 3U);
+
+    RunUntilIdle();
+    DMA_QueueGetCounters(&s_queue, &counters);
+    printf("  %u interrupts, %u chained, %u restarts\n", s_isrCount, counters.chained, counters.restarts);
+    CheckClean();
+    CHECK(counters.transfers == 5U);
+    CHECK(counters.bytes == 80U);
+}
+
+/* The queue is topped up from the callbacks; with the interrupt served in time the channel never stops. */
+static uint32_t s_streamLeft;
+static uint32_t s_streamOffset;
+
+static void StreamNext(test_transfer_t *test)
+{
+    if (s_streamLeft != 0U)
+    {
+        s_streamLeft--;
+        CHECK(Submit(test, s_streamOffset, 64U) == kStatus_Success);
+        s_streamOffset = (s_streamOffset + 64U) % 4096U;
+    }
+}
+
+static void TestStream(uint32_t depth)
+{
+    dma_queue_counters_t counters;
+
+    printf("stream: 40 x 64 B, %u queued, interrupt after 16 cycles\n", depth);
+    SetUp(1U, 16U);
+
+    s_onDone       = StreamNext;
+    s_streamLeft   = 40U - depth;
+    s_streamOffset = 0U;
+    for (uint32_t i = 0U; i < depth; i++)
+    {
+        CHECK(Submit(&s_transfers[i], s_streamOffset, 64U) == kStatus_Success);
+        s_streamOffset += 64U;
+    }
+    RunUntilIdle();
+
+    DMA_QueueGetCounters(&s_queue, &counters);
+    printf("  %u interrupts, %u chained, %u restarts, %u gap cycles, peak %u descriptors\n", s_isrCount,
+           counters.chained, counters.restarts, s_gapCycles, counters.peakDescriptors);
+    CheckClean();
+    CHECK(counters.transfers == 40U);
+    CHECK(counters.started == 1U);
+    CHECK(counters.restarts == 0U);
+    CHECK(s_gapCycles == 0U);
+}
+
+/* A transfer submitted once the DMA has loaded the last unit of the chain starts from the interrupt. */
+static void TestLateLink(void)
+{
+    dma_queue_counters_t counters;
+
+    printf("late link: second transfer submitted while the last unit of the first runs\n");
+    SetUp(1U, 8U);
+
+    CHECK(Submit(&s_transfers[0], 0U, 16U) == kStatus_Success);
+    RunCycles(15U);
+    CHECK(Submit(&s_transfers[1], 16U, 16U) == kStatus_Success);
+    RunUntilIdle();
+
+    DMA_QueueGetCounters(&s_queue, &counters);
+    CheckClean();
+    CHECK(counters.started == 1U);
+    CHECK(counters.chained == 0U);
+    CHECK(counters.restarts == 1U);
+}
+
+/* 5000 units of 32 bits take six descriptors: four of 1024 units, one of 903 and the last unit. */
+static void TestSplit(void)
+{
+    dma_queue_counters_t counters;
+
+    printf("split: 5000 x 32-bit units\n");
+    SetUp(4U, 16U);
+
+    CHECK(Submit(&s_transfers[0], 0U, 5000U * 4U) == kStatus_Success);
+    RunUntilIdle();
+
+    DMA_QueueGetCounters(&s_queue, &counters);
+    CheckClean();
+    CHECK(s_isrCount == 1U);
+    CHECK(counters.peakDescriptors == 6U);
+    CHECK(MOCK_DMA_GetTransferCount() == 5000U);
+}
+
+/* Aborting discards the linked and the waiting transfers, the queue takes new ones afterwards. */
+static void TestAbort(void)
+{
+    printf("abort with transfers linked and waiting\n");
+    SetUp(1U, 8U);
+
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+        CHECK(Submit(&s_transfers[i], i * 16U, 16U) == kStatus_Success);
+    }
+    RunCycles(20U);
+    DMA_QueueAbort(&s_queue);
+    CHECK(!DMA_QueueIsBusy(&s_queue));
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+        CHECK(!s_transfers[i].transfer.queued);
+    }
+    RunCycles(100U);
+
+    /* Start over, the unit count goes on from where the abort left it. */
+    s_submitted      = s_reported;
+    s_submittedUnits = MOCK_DMA_GetTransferCount();
+    CHECK(Submit(&s_transfers[0], 1024U, 100U) == kStatus_Success);
+    RunUntilIdle();
+    CheckClean();
+}
+
+/* Random lengths, submission times and interrupt latencies, checked after every interrupt. */
+static uint32_t s_slotsFree;
+
+static void ReleaseSlot(test_transfer_t *test)
+{
+    (void)test;
+    s_slotsFree++;
+}
+
+static void TestRandom(void)
+{
+    dma_queue_counters_t counters;
+    uint32_t next = 0U;
+    uint32_t bytes;
+
+    printf("random: 600 transfers of 1 to 300 B, interrupt after 1 to 400 cycles\n");
+    SetUp(1U, 1U);
+
+    s_onDone    = ReleaseSlot;
+    s_slotsFree = SLOTS;
+    while (s_submitted < 600U)
+    {
+        if ((Random() % 64U) == 0U)
+        {
+            s_irqLatency = 1U + (Random() % 400U);
+        }
+        /* Slots are released in submission order, so the next one is free when any is. */
+        if ((s_slotsFree != 0U) && ((Random() % 4U) == 0U))
+        {
+            bytes = 1U + (Random() % 300U);
+            if (Submit(&s_transfers[next], (Random() % 4096U), bytes) == kStatus_Success)
+            {
+                s_slotsFree--;
+                next = (next + 1U) % SLOTS;
+            }
+        }
+        RunCycles(Random() % 32U);
+    }
+    RunUntilIdle();
+
+    DMA_QueueGetCounters(&s_queue, &counters);
+    printf("  %u interrupts, %u chained, %u restarts, %u rejected\n", s_isrCount, counters.chained,
+           counters.restarts, counters.rejected);
+    CheckClean();
+    CHECK(counters.transfers == 600U);
+}
+
+int main(void)
+{
+    TestMergedFlags();
+    TestStream(2U);
+    TestStream(4U);
+    TestLateLink();
+    TestSplit();
+    TestAbort();
+    TestRandom();
+
+    printf("%s, %d failures\n", (s_failures != 0) ? "FAILED" : "passed", s_failures);
+    return (s_failures != 0) ? 1 : 0;
+}
@@ -0,0 +1,402 @@
+/*
+ * Register-mock test of the scatter-gather I2C master DMA transfer (I2C_MasterTransferScatterGatherDMA()).
+ *
+ * fsl_i2c.c, fsl_i2c_dma.c and fsl_dma.c run against the I2C and DMA models in mock/, with an IMU (register file
+ * reading back its register number XOR 0x5A) and an EEPROM on a 400 kHz bus. The I2C master DMA request drives
+ * DMA channel 15 and every DMA element takes one system clock cycle (30 MHz). Every interrupt costs ISR_CYCLES on
+ * top of the modelled register accesses, the sum is reported as the CPU time of the transfer.
+ *
+ * fsl_i2c_dma.c keeps its master interrupt handler in its own statics, so the I2C interrupt of this test calls
+ * I2C_MasterTransferDMAHandleIRQ() directly.
+ */
+
+#include <stdio.h>
+
+#include "fsl_i2c_dma.h"
+#include "mock_device.h"
+#include "mock_dma.h"
+#include "mock_i2c.h"
+
+void DMA0_DriverIRQHandler(void);
+void I2C_MasterTransferDMAHandleIRQ(I2C_Type *base, void *i2cHandle);
+
+#define CORE_CLOCK_HZ 30000000U
+#define CYCLES_PER_US (CORE_CLOCK_HZ / 1000000U)
+#define CYCLES_PER_MS (CORE_CLOCK_HZ / 1000U)
+
+#define ISR_CYCLES (28U + 40U) /* Entry and exit, plus the driver code around the register accesses. */
+
+#define I2C_DMA_CHANNEL ((uint32_t)kDmaRequestI2C0_MST_DMA)
+
+#define IMU_ADDRESS 0x68U
+#define EEPROM_ADDRESS 0x50U
+#define MISSING_ADDRESS 0x33U
+
+#define IMU_VALUE(reg) ((uint8_t)((reg) ^ 0x5AU))
+
+#define CHECK(cond)                                                          \
+    do                                                                       \
+    {                                                                        \
+        if (!(cond))                                                         \
+        {                                                                    \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (0)
+
+static int s_failures;
+
+static mock_i2c_device_t s_devices[2];
+static uint32_t s_i2cIsrCount;
+static uint32_t s_dmaIsrCount;
+
+static dma_handle_t s_dmaHandle;
+static i2c_master_dma_handle_t s_handle;
+DMA_ALLOCATE_LINK_DESCRIPTORS(s_descriptors, 4U);
+
+static uint32_t s_callbacks;
+static status_t s_lastStatus;
+static uint64_t s_doneAt;
+static void (*s_onDone)(void);
+
+static uint8_t s_block0[4];
+static uint8_t s_block1[6];
+static uint8_t s_block2[1];
+static uint8_t s_large[1500];
+
+static i2c_master_transfer_t s_single[3];
+static uint32_t s_singleNext;
+
+static void Callback(I2C_Type *base, i2c_master_dma_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)userData;
+    s_callbacks++;
+    s_lastStatus = status;
+    s_doneAt     = MOCK_I2C_Now();
+    if (s_onDone != NULL)
+    {
+        s_onDone();
+    }
+}
+
+static void SetUp(void)
+{
+    i2c_master_config_t config;
+
+    MOCK_DeviceReset();
+    MOCK_DMA_Reset();
+    MOCK_DMA_SetBusHook(MOCK_I2C_BusAccess);
+
+    memset(s_devices, 0, sizeof(s_devices));
+    s_devices[0].address         = IMU_ADDRESS;
+    s_devices[0].registerPointer = true;
+    s_devices[1].address         = EEPROM_ADDRESS;
+    s_devices[1].registerPointer = true;
+    for (uint32_t i = 0U; i < 256U; i++)
+    {
+        s_devices[0].regs[i] = IMU_VALUE(i);
+    }
+    MOCK_I2C_Reset(s_devices, ARRAY_SIZE(s_devices));
+
+    I2C_MasterGetDefaultConfig(&config);
+    config.baudRate_Bps = 400000U;
+    I2C_MasterInit(I2C0, &config, CORE_CLOCK_HZ);
+
+    DMA_Init(DMA0);
+    DMA_EnableChannel(DMA0, I2C_DMA_CHANNEL);
+    DMA_CreateHandle(&s_dmaHandle, DMA0, I2C_DMA_CHANNEL);
+    I2C_MasterTransferCreateHandleDMA(I2C0, &s_handle, Callback, NULL, &s_dmaHandle);
+
+    s_i2cIsrCount = 0U;
+    s_dmaIsrCount = 0U;
+    s_callbacks   = 0U;
+    s_doneAt      = 0U;
+    s_onDone      = NULL;
+    memset(s_block0, 0, sizeof(s_block0));
+    memset(s_block1, 0, sizeof(s_block1));
+    memset(s_block2, 0, sizeof(s_block2));
+}
+
+/* Runs the system until the given time, or until the bus and the DMA have nothing left to do. */
+static void RunUntil(uint64_t until)
+{
+    while (MOCK_I2C_Now() < until)
+    {
+        if (MOCK_DMA_Step())
+        {
+            MOCK_I2C_Advance(1U);
+            continue;
+        }
+        if (MOCK_DMA_IrqLine() && MOCK_IrqDeliverable(DMA0_IRQn))
+        {
+            s_dmaIsrCount++;
+            MOCK_I2C_Advance(ISR_CYCLES);
+            DMA0_DriverIRQHandler();
+            continue;
+        }
+        if (MOCK_I2C_IrqLine() && MOCK_IrqDeliverable(I2C0_IRQn))
+        {
+            s_i2cIsrCount++;
+            MOCK_I2C_Advance(ISR_CYCLES);
+            I2C_MasterTransferDMAHandleIRQ(I2C0, &s_handle);
+            continue;
+        }
+        if (MOCK_I2C_NextEvent() == UINT64_MAX)
+        {
+            break;
+        }
+        MOCK_I2C_Advance(MIN(until, MOCK_I2C_NextEvent()) - MOCK_I2C_Now());
+    }
+}
+
+static void Report(void)
+{
+    uint32_t starts;
+    uint32_t stops;
+    uint64_t cpuCycles =
+        ((uint64_t)(s_i2cIsrCount + s_dmaIsrCount) * ISR_CYCLES) +
+        ((uint64_t)MOCK_I2C_GetRegisterAccesses() * MOCK_I2C_REG_CYCLES);
+
+    MOCK_I2C_GetConditions(&starts, &stops);
+    printf("  %u I2C and %u DMA interrupts, CPU %.1f us, done after %.1f us, %u starts, %u stops\n",
+           (unsigned)s_i2cIsrCount, (unsigned)s_dmaIsrCount, (double)cpuCycles / CYCLES_PER_US,
+           (double)s_doneAt / CYCLES_PER_US, (unsigned)starts, (unsigned)stops);
+}
+
+static i2c_master_transfer_t Segment(
+    uint8_t address, i2c_direction_t direction, uint32_t subaddress, uint8_t subaddressSize, void *data, size_t size,
+    uint32_t flags)
+{
+    i2c_master_transfer_t segment;
+
+    memset(&segment, 0, sizeof(segment));
+    segment.slaveAddress   = address;
+    segment.direction      = direction;
+    segment.subaddress     = subaddress;
+    segment.subaddressSize = subaddressSize;
+    segment.data           = data;
+    segment.dataSize       = size;
+    segment.flags          = flags;
+    return segment;
+}
+
+static bool ImuBlockOk(const uint8_t *block, uint8_t reg, size_t size)
+{
+    for (size_t i = 0U; i < size; i++)
+    {
+        if (block[i] != IMU_VALUE((uint8_t)(reg + i)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool ImuBlocksOk(void)
+{
+    return ImuBlockOk(s_block0, 0x10U, sizeof(s_block0)) && ImuBlockOk(s_block1, 0x40U, sizeof(s_block1)) &&
+           ImuBlockOk(s_block2, 0x80U, sizeof(s_block2));
+}
+
+static void StartNextSingle(void)
+{
+    if (s_singleNext < ARRAY_SIZE(s_single))
+    {
+        CHECK(I2C_MasterTransferDMA(I2C0, &s_handle, &s_single[s_singleNext++]) == kStatus_Success);
+    }
+}
+
+/* Three register blocks of the IMU with the single transfer API, each started from the previous callback. */
+static void TestBlocksSingle(void)
+{
+    printf("Three blocks, I2C_MasterTransferDMA() from the callback\n");
+    SetUp();
+    s_single[0]  = Segment(IMU_ADDRESS, kI2C_Read, 0x10U, 1U, s_block0, sizeof(s_block0), kI2C_TransferDefaultFlag);
+    s_single[1]  = Segment(IMU_ADDRESS, kI2C_Read, 0x40U, 1U, s_block1, sizeof(s_block1), kI2C_TransferDefaultFlag);
+    s_single[2]  = Segment(IMU_ADDRESS, kI2C_Read, 0x80U, 1U, s_block2, sizeof(s_block2), kI2C_TransferDefaultFlag);
+    s_singleNext = 0U;
+    s_onDone     = StartNextSingle;
+    StartNextSingle();
+    RunUntil(10U * CYCLES_PER_MS);
+
+    CHECK(s_callbacks == 3U);
+    CHECK(s_lastStatus == kStatus_Success);
+    CHECK(ImuBlocksOk());
+    CHECK(MOCK_I2C_GetProtocolErrors() == 0U);
+    Report();
+}
+
+/* The same three blocks as one list, with one callback. */
+static void TestBlocks(uint32_t flags, const char *name)
+{
+    i2c_master_transfer_t segments[3];
+    uint32_t starts;
+    uint32_t stops;
+
+    printf("Three blocks, scatter-gather, %s\n", name);
+    SetUp();
+    segments[0] = Segment(IMU_ADDRESS, kI2C_Read, 0x10U, 1U, s_block0, sizeof(s_block0), flags);
+    segments[1] = Segment(IMU_ADDRESS, kI2C_Read, 0x40U, 1U, s_block1, sizeof(s_block1), flags);
+    segments[2] = Segment(IMU_ADDRESS, kI2C_Read, 0x80U, 1U, s_block2, sizeof(s_block2), kI2C_TransferDefaultFlag);
+
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, segments, 3U, s_descriptors, 1U) == kStatus_Success);
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, segments, 3U, s_descriptors, 1U) == kStatus_I2C_Busy);
+    RunUntil(10U * CYCLES_PER_MS);
+
+    MOCK_I2C_GetConditions(&starts, &stops);
+    CHECK(s_callbacks == 1U);
+    CHECK(s_lastStatus == kStatus_Success);
+    CHECK(ImuBlocksOk());
+    CHECK(s_handle.transferCount == (sizeof(s_block0) + sizeof(s_block1) + sizeof(s_block2)));
+    CHECK(stops == ((flags == kI2C_TransferNoStopFlag) ? 1U : 3U));
+    CHECK(!MOCK_I2C_BusOwned());
+    CHECK(s_dmaIsrCount == 0U);
+    CHECK(MOCK_I2C_GetProtocolErrors() == 0U);
+    Report();
+}
+
+/* A gather write over two buffers, then a scatter read back over two buffers that ends without a stop. */
+static void TestGatherScatter(void)
+{
+    /* Static, the DMA descriptors hold 32-bit addresses. */
+    static const uint8_t written[] = {1U, 2U, 3U, 4U, 5U};
+    static uint8_t write0[2]       = {1U, 2U};
+    static uint8_t write1[3]       = {3U, 4U, 5U};
+    static uint8_t read0[1];
+    static uint8_t read1[4];
+    i2c_master_transfer_t segments[4];
+    uint32_t starts;
+    uint32_t stops;
+
+    printf("Gather write, scatter read without final stop\n");
+    SetUp();
+    segments[0] = Segment(EEPROM_ADDRESS, kI2C_Write, 0x20U, 1U, write0, sizeof(write0), kI2C_TransferDefaultFlag);
+    segments[1] = Segment(0U, kI2C_Write, 0U, 0U, write1, sizeof(write1), kI2C_TransferNoStartFlag);
+    segments[2] = Segment(EEPROM_ADDRESS, kI2C_Read, 0x20U, 1U, read0, sizeof(read0), kI2C_TransferDefaultFlag);
+    segments[3] = Segment(0U, kI2C_Read, 0U, 0U, read1, sizeof(read1),
+                          kI2C_TransferNoStartFlag | kI2C_TransferNoStopFlag);
+
+    /* The write phase has three pieces: subaddress and two buffers. */
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, segments, 4U, s_descriptors, 2U) ==
+          kStatus_InvalidArgument);
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, segments, 4U, s_descriptors, 3U) == kStatus_Success);
+    RunUntil(10U * CYCLES_PER_MS);
+
+    MOCK_I2C_GetConditions(&starts, &stops);
+    CHECK(s_callbacks == 1U);
+    CHECK(s_lastStatus == kStatus_Success);
+    CHECK(memcmp(&s_devices[1].regs[0x20], written, sizeof(written)) == 0);
+    CHECK(read0[0] == 1U);
+    CHECK(memcmp(read1, &written[1], sizeof(read1)) == 0);
+    CHECK(s_handle.transferCount == 10U);
+    /* The read ends without stop, the bus stays owned as with I2C_MasterTransferDMA(). */
+    CHECK(MOCK_I2C_BusOwned());
+    CHECK(stops == 1U);
+    CHECK(MOCK_I2C_GetProtocolErrors() == 0U);
+    Report();
+}
+
+/* More than I2C_MAX_DMA_TRANSFER_COUNT bytes split over link descriptors, after a write without subaddress. */
+static void TestLarge(void)
+{
+    static uint8_t pointer = 0x30U;
+    i2c_master_transfer_t segments[2];
+    bool ok = true;
+
+    printf("1500 byte read in two DMA pieces\n");
+    SetUp();
+    segments[0] = Segment(IMU_ADDRESS, kI2C_Write, 0U, 0U, &pointer, 1U, kI2C_TransferNoStopFlag);
+    segments[1] = Segment(IMU_ADDRESS, kI2C_Read, 0U, 0U, s_large, sizeof(s_large), kI2C_TransferDefaultFlag);
+
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, segments, 2U, s_descriptors, 1U) ==
+          kStatus_InvalidArgument);
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, segments, 2U, s_descriptors, 2U) == kStatus_Success);
+    RunUntil(100U * CYCLES_PER_MS);
+
+    CHECK(s_callbacks == 1U);
+    CHECK(s_lastStatus == kStatus_Success);
+    for (size_t i = 0U; i < sizeof(s_large); i++)
+    {
+        ok = ok && (s_large[i] == IMU_VALUE((uint8_t)(0x30U + i)));
+    }
+    CHECK(ok);
+    CHECK(MOCK_I2C_GetProtocolErrors() == 0U);
+    Report();
+}
+
+/* A missing device ends the list with one NAK callback, and the handle takes a transfer afterwards. */
+static void TestNak(void)
+{
+    i2c_master_transfer_t segments[3];
+    i2c_master_transfer_t single;
+
+    printf("NAK in the middle of the list\n");
+    SetUp();
+    segments[0] = Segment(IMU_ADDRESS, kI2C_Read, 0x10U, 1U, s_block0, sizeof(s_block0), kI2C_TransferNoStopFlag);
+    segments[1] = Segment(MISSING_ADDRESS, kI2C_Read, 0x40U, 1U, s_block1, sizeof(s_block1), kI2C_TransferNoStopFlag);
+    segments[2] = Segment(IMU_ADDRESS, kI2C_Read, 0x80U, 1U, s_block2, sizeof(s_block2), kI2C_TransferDefaultFlag);
+
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, segments, 3U, s_descriptors, 1U) == kStatus_Success);
+    RunUntil(10U * CYCLES_PER_MS);
+
+    CHECK(s_callbacks == 1U);
+    CHECK(s_lastStatus == kStatus_I2C_Nak);
+    CHECK(s_handle.segments == NULL);
+    CHECK(s_handle.state == (uint8_t)kIdleState);
+    CHECK(!MOCK_I2C_BusOwned());
+
+    single = Segment(IMU_ADDRESS, kI2C_Read, 0x80U, 1U, s_block2, sizeof(s_block2), kI2C_TransferDefaultFlag);
+    CHECK(I2C_MasterTransferDMA(I2C0, &s_handle, &single) == kStatus_Success);
+    RunUntil(20U * CYCLES_PER_MS);
+
+    CHECK(s_callbacks == 2U);
+    CHECK(s_lastStatus == kStatus_Success);
+    CHECK(ImuBlockOk(s_block2, 0x80U, sizeof(s_block2)));
+    CHECK(MOCK_I2C_GetProtocolErrors() == 0U);
+}
+
+/* Invalid lists are refused before the bus is touched. */
+static void TestInvalid(void)
+{
+    i2c_master_transfer_t noStart[1];
+    i2c_master_transfer_t mixed[2];
+    i2c_master_transfer_t empty[1];
+    i2c_master_transfer_t longSubaddress[1];
+
+    printf("Invalid lists\n");
+    SetUp();
+    noStart[0] = Segment(IMU_ADDRESS, kI2C_Read, 0U, 0U, s_block0, sizeof(s_block0), kI2C_TransferNoStartFlag);
+    mixed[0]   = Segment(IMU_ADDRESS, kI2C_Write, 0x10U, 1U, s_block0, sizeof(s_block0), kI2C_TransferDefaultFlag);
+    mixed[1]   = Segment(0U, kI2C_Read, 0U, 0U, s_block1, 4U, kI2C_TransferNoStartFlag);
+    empty[0]   = Segment(IMU_ADDRESS, kI2C_Read, 0x10U, 1U, s_block0, 0U, kI2C_TransferDefaultFlag);
+    longSubaddress[0] = Segment(IMU_ADDRESS, kI2C_Read, 0x10U, 5U, s_block0, sizeof(s_block0), kI2C_TransferDefaultFlag);
+
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, noStart, 1U, s_descriptors, 4U) ==
+          kStatus_InvalidArgument);
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, mixed, 2U, s_descriptors, 4U) ==
+          kStatus_InvalidArgument);
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, empty, 1U, s_descriptors, 4U) ==
+          kStatus_InvalidArgument);
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, longSubaddress, 1U, s_descriptors, 4U) ==
+          kStatus_InvalidArgument);
+    CHECK(I2C_MasterTransferScatterGatherDMA(I2C0, &s_handle, noStart, 0U, s_descriptors, 4U) ==
+          kStatus_InvalidArgument);
+    CHECK(s_handle.state == (uint8_t)kIdleState);
+    CHECK(I2C0->INTENSET == 0U);
+}
+
+int main(void)
+{
+    TestBlocksSingle();
+    TestBlocks(kI2C_TransferDefaultFlag, "stop between blocks");
+    TestBlocks(kI2C_TransferNoStopFlag, "repeated starts");
+    TestGatherScatter();
+    TestLarge();
+    TestNak();
+    TestInvalid();
+
+    printf("%s, %d failures\n", (s_failures != 0) ? "FAILED" : "passed", s_failures);
+    return (s_failures != 0) ? 1 : 0;
+}
@@ -0,0 +1,481 @@
+/*
+ * Register-mock test of the I2C transfer queue (fsl_i2c_queue.c) and of the bus idle time between its transfers.
+ *
+ * fsl_i2c.c and fsl_i2c_queue.c run against the I2C model in mock/ with three devices on a 400 kHz bus: a light
+ * sensor read without a register pointer, an IMU read with a repeated start, and an EEPROM written through its
+ * register pointer. Time advances in system clock cycles (30 MHz). Every interrupt costs ISR_CYCLES of entry, exit
+ * and driver code on top of the modelled register accesses, so a gap is the CPU time from the STOP of one transfer
+ * to the START of the next one.
+ *
+ * The queue starts the next transfer from the interrupt that completes the previous one. The baseline starts every
+ * non-blocking transfer from the main loop once the previous one is done, so its gaps grow with the main loop work.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "fsl_i2c_queue.h"
+#include "mock_device.h"
+#include "mock_i2c.h"
+
+void I2C0_DriverIRQHandler(void);
+
+#define CORE_CLOCK_HZ 30000000U
+#define CYCLES_PER_US (CORE_CLOCK_HZ / 1000000U)
+#define CYCLES_PER_MS (CORE_CLOCK_HZ / 1000U)
+
+#define ISR_CYCLES (28U + 40U) /* Entry and exit, plus the driver code around the register accesses. */
+#define MAIN_LOOP_CYCLES 20U
+
+#define LIGHT_ADDRESS 0x23U
+#define IMU_ADDRESS 0x68U
+#define EEPROM_ADDRESS 0x50U
+#define MISSING_ADDRESS 0x77U
+
+#define TRANSFERS 30U
+#define HOST_ROUNDS 200000U
+
+#define CHECK(cond)                                                          \
+    do                                                                       \
+    {                                                                        \
+        if (!(cond))                                                         \
+        {                                                                    \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (0)
+
+static int s_failures;
+
+static mock_i2c_device_t s_devices[3];
+static uint32_t s_isrCount;
+
+static uint8_t s_rxBuffer[TRANSFERS][64];
+static uint8_t s_txBuffer[2] = {0x12U, 0x34U};
+
+static i2c_queue_handle_t s_queueHandle;
+static i2c_queue_transfer_t s_queueTransfers[TRANSFERS];
+static uint32_t s_doneOrder[TRANSFERS];
+static status_t s_doneStatus[TRANSFERS];
+static uint32_t s_doneCount;
+static uint32_t s_chainLeft;
+static uint32_t s_jobDone[3];
+
+static i2c_master_handle_t s_masterHandle;
+static i2c_master_transfer_t s_baselineTransfers[TRANSFERS];
+static volatile bool s_baselineBusy;
+static uint32_t s_baselineNext;
+static uint32_t s_baselineDone;
+static uint32_t s_mainWorkCycles;
+
+static void SetUp(void)
+{
+    i2c_master_config_t config;
+
+    MOCK_DeviceReset();
+    memset(s_devices, 0, sizeof(s_devices));
+    s_devices[0].address         = LIGHT_ADDRESS;
+    s_devices[1].address         = IMU_ADDRESS;
+    s_devices[1].registerPointer = true;
+    s_devices[2].address         = EEPROM_ADDRESS;
+    s_devices[2].registerPointer = true;
+    for (uint32_t i = 0U; i < 256U; i++)
+    {
+        s_devices[0].regs[i] = (uint8_t)(0xA0U + i);
+        s_devices[1].regs[i] = (uint8_t)i;
+    }
+    MOCK_I2C_Reset(s_devices, ARRAY_SIZE(s_devices));
+
+    I2C_MasterGetDefaultConfig(&config);
+    config.baudRate_Bps = 400000U;
+    I2C_MasterInit(I2C0, &config, CORE_CLOCK_HZ);
+
+    s_isrCount = 0U;
+    memset(s_rxBuffer, 0, sizeof(s_rxBuffer));
+}
+
+/*
+ * Runs the system until the given time. tick is called every tickCycles from a timer interrupt, mainStep runs one
+ * main loop iteration and returns its CPU time. The I2C interrupt preempts the main loop work.
+ */
+static void RunUntil(uint64_t until, uint32_t tickCycles, void (*tick)(void), uint32_t (*mainStep)(void))
+{
+    uint64_t nextTick      = MOCK_I2C_Now() + tickCycles;
+    uint64_t mainBusyUntil = MOCK_I2C_Now();
+    uint64_t next;
+
+    while (MOCK_I2C_Now() < until)
+    {
+        if (MOCK_I2C_IrqLine() && MOCK_IrqDeliverable(I2C0_IRQn))
+        {
+            s_isrCount++;
+            MOCK_I2C_Advance(ISR_CYCLES);
+            I2C0_DriverIRQHandler();
+            continue;
+        }
+        if ((tick != NULL) && (MOCK_I2C_Now() >= nextTick))
+        {
+            MOCK_I2C_Advance(ISR_CYCLES);
+            tick();
+            nextTick += tickCycles;
+            continue;
+        }
+        if ((mainStep != NULL) && (MOCK_I2C_Now() >= mainBusyUntil))
+        {
+            mainBusyUntil = MOCK_I2C_Now() + mainStep();
+            continue;
+        }
+
+        /* Sleep, or main loop work, until the next event. */
+        next = MIN(until, MOCK_I2C_NextEvent());
+        if (tick != NULL)
+        {
+            next = MIN(next, nextTick);
+        }
+        if (mainStep != NULL)
+        {
+            next = MIN(next, mainBusyUntil);
+        }
+        MOCK_I2C_Advance(next - MOCK_I2C_Now());
+    }
+}
+
+static void ReportGaps(void)
+{
+    mock_i2c_gaps_t gaps;
+    uint32_t count;
+
+    MOCK_I2C_GetGaps(&gaps);
+    count = MAX(gaps.count, 1U);
+    printf("  %u gaps, avg %.2f us, max %.2f us, %.2f register accesses per gap, %u interrupts\n",
+           (unsigned)gaps.count, (double)gaps.totalCycles / count / CYCLES_PER_US,
+           (double)gaps.maxCycles / CYCLES_PER_US, (double)gaps.registerAccesses / count, (unsigned)s_isrCount);
+}
+
+/* A mix of the three transfer kinds. */
+static void MakeTransfer(i2c_master_transfer_t *xfer, uint32_t i)
+{
+    memset(xfer, 0, sizeof(*xfer));
+    switch (i % 3U)
+    {
+        case 0U:
+            xfer->slaveAddress = LIGHT_ADDRESS;
+            xfer->direction    = kI2C_Read;
+            xfer->data         = s_rxBuffer[i];
+            xfer->dataSize     = 2U;
+            break;
+        case 1U:
+            xfer->slaveAddress   = IMU_ADDRESS;
+            xfer->direction      = kI2C_Read;
+            xfer->subaddress     = 0x3BU;
+            xfer->subaddressSize = 1U;
+            xfer->data           = s_rxBuffer[i];
+            xfer->dataSize       = 6U;
+            break;
+        default:
+            xfer->slaveAddress   = EEPROM_ADDRESS;
+            xfer->direction      = kI2C_Write;
+            xfer->subaddress     = 0x10U;
+            xfer->subaddressSize = 1U;
+            xfer->data           = s_txBuffer;
+            xfer->dataSize       = sizeof(s_txBuffer);
+            break;
+    }
+}
+
+static bool TransferDataOk(uint32_t i)
+{
+    static const uint8_t imu[] = {0x3BU, 0x3CU, 0x3DU, 0x3EU, 0x3FU, 0x40U};
+
+    switch (i % 3U)
+    {
+        case 0U:
+            return (s_rxBuffer[i][0] == 0xA0U) && (s_rxBuffer[i][1] == 0xA1U);
+        case 1U:
+            return memcmp(s_rxBuffer[i], imu, sizeof(imu)) == 0;
+        default:
+            return true;
+    }
+}
+
+static void QueueCallback(
+    I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)transfer;
+    s_doneStatus[s_doneCount] = status;
+    s_doneOrder[s_doneCount]  = (uint32_t)(uintptr_t)userData;
+    s_doneCount++;
+}
+
+static bool QueueWorkWaiting(void)
+{
+    return (s_queueHandle.head != NULL) && (s_queueHandle.head->next != NULL);
+}
+
+static void SetUpQueue(uint32_t transfers, i2c_queue_callback_t callback)
+{
+    SetUp();
+    MOCK_I2C_SetWorkWaiting(QueueWorkWaiting);
+    I2C_QueueCreateHandle(I2C0, &s_queueHandle);
+    s_doneCount = 0U;
+    for (uint32_t i = 0U; i < transfers; i++)
+    {
+        MakeTransfer(&s_queueTransfers[i].xfer, i);
+        s_queueTransfers[i].callback = callback;
+        s_queueTransfers[i].userData = (void *)(uintptr_t)i;
+    }
+}
+
+static void TestQueueBurst(void)
+{
+    printf("Queue burst\n");
+    SetUpQueue(TRANSFERS, QueueCallback);
+
+    for (uint32_t i = 0U; i < TRANSFERS; i++)
+    {
+        CHECK(I2C_QueueSubmit(I2C0, &s_queueHandle, &s_queueTransfers[i]) == kStatus_Success);
+    }
+    CHECK(I2C_QueueSubmit(I2C0, &s_queueHandle, &s_queueTransfers[5]) == kStatus_I2C_Busy);
+    RunUntil(10U * CYCLES_PER_MS, 0U, NULL, NULL);
+
+    CHECK(s_doneCount == TRANSFERS);
+    for (uint32_t i = 0U; i < s_doneCount; i++)
+    {
+        CHECK(s_doneOrder[i] == i);
+        CHECK(s_doneStatus[i] == kStatus_Success);
+        CHECK(TransferDataOk(i));
+    }
+    CHECK(s_devices[2].writes == (2U * (TRANSFERS / 3U)));
+    CHECK(s_devices[2].regs[0x10] == 0x12U);
+    CHECK(s_devices[2].regs[0x11] == 0x34U);
+    CHECK(!I2C_QueueIsBusy(&s_queueHandle));
+    ReportGaps();
+}
+
+/* A missing device NAKs the address, the queue reports it and goes on. */
+static void TestQueueNak(void)
+{
+    printf("Queue NAK\n");
+    SetUpQueue(3U, QueueCallback);
+    s_queueTransfers[1].xfer.slaveAddress = MISSING_ADDRESS;
+
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        CHECK(I2C_QueueSubmit(I2C0, &s_queueHandle, &s_queueTransfers[i]) == kStatus_Success);
+    }
+    RunUntil(CYCLES_PER_MS, 0U, NULL, NULL);
+
+    CHECK(s_doneCount == 3U);
+    CHECK(s_doneStatus[0] == kStatus_Success);
+    CHECK(s_doneStatus[1] == kStatus_I2C_Nak);
+    CHECK(s_doneStatus[2] == kStatus_Success);
+    CHECK(TransferDataOk(0U));
+    CHECK(TransferDataOk(2U));
+}
+
+static void ChainCallback(
+    I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer, status_t status, void *userData)
+{
+    (void)userData;
+    CHECK(status == kStatus_Success);
+    if (--s_chainLeft > 0U)
+    {
+        CHECK(I2C_QueueSubmit(base, handle, transfer) == kStatus_Success);
+    }
+}
+
+static bool ChainWorkWaiting(void)
+{
+    return s_chainLeft > 1U;
+}
+
+/* Submitting again from the callback chains the transfers without any thread. */
+static void TestQueueChain(void)
+{
+    printf("Queue chain\n");
+    SetUpQueue(2U, ChainCallback);
+    MOCK_I2C_SetWorkWaiting(ChainWorkWaiting);
+    s_chainLeft = 10U;
+
+    CHECK(I2C_QueueSubmit(I2C0, &s_queueHandle, &s_queueTransfers[1]) == kStatus_Success);
+    RunUntil(5U * CYCLES_PER_MS, 0U, NULL, NULL);
+
+    CHECK(s_chainLeft == 0U);
+    CHECK(s_devices[1].reads == 10U);
+    CHECK(TransferDataOk(1U));
+    ReportGaps();
+}
+
+static void JobCallback(
+    I2C_Type *base, i2c_queue_handle_t *handle, i2c_queue_transfer_t *transfer, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)transfer;
+    CHECK(status == kStatus_Success);
+    s_jobDone[(uintptr_t)userData]++;
+}
+
+static void QueueTick(void)
+{
+    I2C_QueueTick(I2C0, &s_queueHandle);
+}
+
+/* Three polling jobs ticked every 1 ms for one second, the second one reading imuBytes. */
+static void TestQueueJobs(const uint32_t periods[3], size_t imuBytes, const char *name)
+{
+    uint32_t removedDone;
+
+    printf("Queue jobs, %s\n", name);
+    SetUpQueue(3U, JobCallback);
+    memset(s_jobDone, 0, sizeof(s_jobDone));
+    s_queueTransfers[1].xfer.dataSize = imuBytes;
+
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        I2C_QueueAddJob(I2C0, &s_queueHandle, &s_queueTransfers[i], periods[i]);
+    }
+    RunUntil((1000U * CYCLES_PER_MS) + (CYCLES_PER_MS / 2U), CYCLES_PER_MS, QueueTick, NULL);
+
+    printf("  jobs done %u %u %u of %u %u %u periods\n", (unsigned)s_jobDone[0], (unsigned)s_jobDone[1],
+           (unsigned)s_jobDone[2], (unsigned)(1000U / periods[0]), (unsigned)(1000U / periods[1]),
+           (unsigned)(1000U / periods[2]));
+    if (imuBytes <= 8U)
+    {
+        for (uint32_t i = 0U; i < 3U; i++)
+        {
+            CHECK(s_jobDone[i] == (1000U / periods[i]));
+        }
+    }
+    else
+    {
+        /* Overloaded: polls are skipped, never queued twice. */
+        CHECK(s_jobDone[1] < (1000U / periods[1]));
+        CHECK(s_jobDone[0] <= (1000U / periods[0]));
+        CHECK(s_jobDone[2] <= (1000U / periods[2]));
+    }
+
+    /* A removed job runs at most the transfer it already had queued. */
+    I2C_QueueRemoveJob(I2C0, &s_queueHandle, &s_queueTransfers[1]);
+    removedDone = s_jobDone[1];
+    RunUntil(MOCK_I2C_Now() + (100U * CYCLES_PER_MS), CYCLES_PER_MS, QueueTick, NULL);
+    CHECK(s_jobDone[1] <= (removedDone + 1U));
+    ReportGaps();
+}
+
+static void BaselineCallback(I2C_Type *base, i2c_master_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)userData;
+    CHECK(status == kStatus_Success);
+    s_baselineBusy = false;
+    s_baselineDone++;
+}
+
+static bool BaselineWorkWaiting(void)
+{
+    return s_baselineNext < TRANSFERS;
+}
+
+static uint32_t BaselineMainStep(void)
+{
+    if (!s_baselineBusy && (s_baselineNext < TRANSFERS))
+    {
+        s_baselineBusy = true;
+        CHECK(I2C_MasterTransferNonBlocking(I2C0, &s_masterHandle, &s_baselineTransfers[s_baselineNext++]) ==
+              kStatus_Success);
+    }
+    return MAIN_LOOP_CYCLES + s_mainWorkCycles;
+}
+
+/* One non-blocking transfer at a time, started from a main loop that does workUs of other work per iteration. */
+static void TestBaseline(uint32_t workUs, const char *name)
+{
+    printf("Baseline, %s\n", name);
+    SetUp();
+    MOCK_I2C_SetWorkWaiting(BaselineWorkWaiting);
+    I2C_MasterTransferCreateHandle(I2C0, &s_masterHandle, BaselineCallback, NULL);
+    s_mainWorkCycles = workUs * CYCLES_PER_US;
+    s_baselineBusy   = false;
+    s_baselineNext   = 0U;
+    s_baselineDone   = 0U;
+    for (uint32_t i = 0U; i < TRANSFERS; i++)
+    {
+        MakeTransfer(&s_baselineTransfers[i], i);
+    }
+
+    RunUntil(30U * CYCLES_PER_MS, 0U, NULL, BaselineMainStep);
+
+    CHECK(s_baselineDone == TRANSFERS);
+    for (uint32_t i = 0U; i < TRANSFERS; i++)
+    {
+        CHECK(TransferDataOk(i));
+    }
+    ReportGaps();
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+/* Host time of the interrupt that completes a transfer and starts the next one, for scale. */
+static void TestHostTiming(void)
+{
+    uint64_t elapsedNs = 0U;
+    uint64_t start;
+    bool completing;
+
+    printf("Host timing\n");
+    SetUpQueue(2U, NULL);
+    s_queueTransfers[1].xfer = s_queueTransfers[0].xfer;
+
+    for (uint32_t round = 0U; round < HOST_ROUNDS; round++)
+    {
+        CHECK(I2C_QueueSubmit(I2C0, &s_queueHandle, &s_queueTransfers[0]) == kStatus_Success);
+        CHECK(I2C_QueueSubmit(I2C0, &s_queueHandle, &s_queueTransfers[1]) == kStatus_Success);
+        while (I2C_QueueIsBusy(&s_queueHandle))
+        {
+            if (!MOCK_I2C_IrqLine())
+            {
+                MOCK_I2C_Advance(MOCK_I2C_NextEvent() - MOCK_I2C_Now());
+                continue;
+            }
+            completing = (s_queueHandle.head == &s_queueTransfers[0]);
+            start      = NowNs();
+            I2C0_DriverIRQHandler();
+            if (completing && (s_queueHandle.head != &s_queueTransfers[0]))
+            {
+                elapsedNs += NowNs() - start;
+            }
+        }
+    }
+    CHECK(s_devices[0].reads == (2U * HOST_ROUNDS));
+    printf("  %.0f ns per completing interrupt, including the start of the next transfer\n",
+           (double)elapsedNs / HOST_ROUNDS);
+}
+
+int main(void)
+{
+    static const uint32_t jobPeriods[3]       = {10U, 5U, 20U};
+    static const uint32_t overloadedPeriods[3] = {1U, 1U, 1U};
+
+    TestQueueBurst();
+    TestQueueNak();
+    TestQueueChain();
+    TestBaseline(0U, "idle main loop");
+    TestBaseline(50U, "main loop 50 us work");
+    TestBaseline(500U, "main loop 500 us work");
+    TestQueueJobs(jobPeriods, 6U, "5/10/20 ms, 1 ms tick");
+    TestQueueJobs(overloadedPeriods, 64U, "overloaded 1 ms");
+    TestHostTiming();
+
+    printf("%s, %d failures\n", (s_failures != 0) ? "FAILED" : "passed", s_failures);
+    return (s_failures != 0) ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * Host stand-in for fsl_common.h.
+ *
+ * Keeps the status codes, the helper macros and the IRQ API of the real header, with the interrupt controller
+ * replaced by the model in mock_device.c.
+ */
+
+#ifndef FSL_COMMON_H_
+#define FSL_COMMON_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fsl_device_registers.h"
+
+#define MAKE_STATUS(group, code) ((((group)*100L) + (code)))
+#define MAKE_VERSION(major, minor, bugfix) (((major) << 16) | ((minor) << 8) | (bugfix))
+
+/*! @brief Status group numbers, values as in the SDK header. */
+enum _status_groups
+{
+    kStatusGroup_Generic      = 0,
+    kStatusGroup_DMA          = 50,
+    kStatusGroup_LPC_SPI      = 56,
+    kStatusGroup_LPC_USART    = 57,
+    kStatusGroup_LPC_I2C      = 66,
+    kStatusGroup_LPC_MINISPI  = 76,
+    kStatusGroup_HAL_TIMER    = 123,
+    kStatusGroup_TIMERMANAGER = 135,
+    kStatusGroup_LPC_ADC      = 174,
+};
+
+enum
+{
+    kStatus_Success              = MAKE_STATUS(kStatusGroup_Generic, 0),
+    kStatus_Fail                 = MAKE_STATUS(kStatusGroup_Generic, 1),
+    kStatus_ReadOnly             = MAKE_STATUS(kStatusGroup_Generic, 2),
+    kStatus_OutOfRange           = MAKE_STATUS(kStatusGroup_Generic, 3),
+    kStatus_InvalidArgument      = MAKE_STATUS(kStatusGroup_Generic, 4),
+    kStatus_Timeout              = MAKE_STATUS(kStatusGroup_Generic, 5),
+    kStatus_NoTransferInProgress = MAKE_STATUS(kStatusGroup_Generic, 6),
+    kStatus_Busy                 = MAKE_STATUS(kStatusGroup_Generic, 7),
+    kStatus_NoData               = MAKE_STATUS(kStatusGroup_Generic, 8),
+};
+
+typedef int32_t status_t;
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+#define SDK_ALIGN(var, alignbytes)                      var __attribute__((aligned(alignbytes)))
+#define AT_NONCACHEABLE_SECTION(var)                    var
+#define AT_NONCACHEABLE_SECTION_ALIGN(var, alignbytes)  SDK_ALIGN(var, alignbytes)
+#define AT_NONCACHEABLE_SECTION_INIT(var)               var
+#define AT_QUICKACCESS_SECTION_CODE(func)               func
+#define MSDK_REG_SECURE_ADDR(x)                         (x)
+#define MSDK_REG_NONSECURE_ADDR(x)                      (x)
+#define SDK_ISR_EXIT_BARRIER
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Interrupt controller model, see mock_device.c. */
+uint32_t DisableGlobalIRQ(void);
+void EnableGlobalIRQ(uint32_t primask);
+status_t EnableIRQ(IRQn_Type interrupt);
+status_t DisableIRQ(IRQn_Type interrupt);
+
+/* Busy waits take no simulated time. */
+void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz);
+
+/* Write to a DMA channel group register, see mock_dma.c. */
+void MOCK_DMA_WriteCommon(volatile uint32_t *reg, uint32_t value);
+
+/* CRC engine accesses, see mock_crc.c. */
+void MOCK_CRC_WriteSeed(CRC_Type *base, uint32_t seed);
+void MOCK_CRC_WriteData(CRC_Type *base, uint32_t data, uint32_t bytes);
+uint32_t MOCK_CRC_ReadSum(CRC_Type *base);
+
+/* I2C master register accesses, see mock_i2c.c. */
+uint32_t MOCK_I2C_Read(I2C_Type *base, const volatile uint32_t *reg);
+void MOCK_I2C_Write(I2C_Type *base, volatile uint32_t *reg, uint32_t value);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#include "fsl_clock.h"
+#include "fsl_reset.h"
+
+#endif /* FSL_COMMON_H_ */
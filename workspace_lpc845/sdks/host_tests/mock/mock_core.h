@@ -0,0 +1,31 @@
+/*
+ * Host stand-in for the CMSIS Cortex-M0+ core header, just enough for the LPC845 device headers and the drivers.
+ */
+
+#ifndef MOCK_CORE_H_
+#define MOCK_CORE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+#define __I volatile
+#else
+#define __I volatile const
+#endif
+#define __O  volatile
+#define __IO volatile
+
+#define __IM  volatile const
+#define __OM  volatile
+#define __IOM volatile
+
+#define __STATIC_INLINE static inline
+#define __WEAK          __attribute__((weak))
+#define __ASM           __asm__
+
+#define __NOP() ((void)0)
+#define __DSB() __sync_synchronize()
+#define __ISB() __sync_synchronize()
+#define __DMB() __sync_synchronize()
+
+#endif /* MOCK_CORE_H_ */
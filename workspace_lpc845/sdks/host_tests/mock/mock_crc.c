@@ -0,0 +1,94 @@
+/*
+ * Register-level host model of the LPC845 CRC engine.
+ *
+ * SUM and WR_DATA share an address, so plain memory can't model the engine. The copy of fsl_crc.c used by the tests
+ * routes its SEED and WR_DATA writes and its SUM reads through the functions below; MODE stays plain memory and is
+ * read at every access, as the hardware does.
+ *
+ * The sum is an MSB-first shift register seeded by SEED. Every written byte is complemented (CMPL_WR) and bit
+ * reversed (BIT_RVS_WR) before it is shifted in, wider writes are taken a byte at a time from the lowest address.
+ * Reads of SUM are bit reversed over the CRC width (BIT_RVS_SUM) and complemented (CMPL_SUM).
+ */
+
+#include "fsl_crc.h"
+
+static uint32_t s_crcSum;
+
+static uint32_t MOCK_CRC_Width(uint32_t mode)
+{
+    return ((mode & CRC_MODE_CRC_POLY_MASK) >= (uint32_t)kCRC_Polynomial_CRC_32) ? 32U : 16U;
+}
+
+static uint32_t MOCK_CRC_Poly(uint32_t mode)
+{
+    static const uint32_t polys[] = {0x1021U, 0x8005U, 0x04C11DB7U, 0x04C11DB7U};
+
+    return polys[mode & CRC_MODE_CRC_POLY_MASK];
+}
+
+static uint32_t MOCK_CRC_Mask(uint32_t width)
+{
+    return (width == 32U) ? 0xFFFFFFFFU : ((1UL << width) - 1U);
+}
+
+static uint32_t MOCK_CRC_Reverse(uint32_t value, uint32_t width)
+{
+    uint32_t reversed = 0U;
+
+    for (uint32_t bit = 0U; bit < width; bit++)
+    {
+        reversed = (reversed << 1U) | ((value >> bit) & 1U);
+    }
+    return reversed;
+}
+
+void MOCK_CRC_WriteSeed(CRC_Type *base, uint32_t seed)
+{
+    base->SEED = seed;
+    s_crcSum   = seed & MOCK_CRC_Mask(MOCK_CRC_Width(base->MODE));
+}
+
+void MOCK_CRC_WriteData(CRC_Type *base, uint32_t data, uint32_t bytes)
+{
+    uint32_t mode  = base->MODE;
+    uint32_t width = MOCK_CRC_Width(mode);
+    uint32_t poly  = MOCK_CRC_Poly(mode);
+    uint32_t top   = 1UL << (width - 1U);
+    uint32_t value;
+
+    for (uint32_t i = 0U; i < bytes; i++)
+    {
+        value = (data >> (8U * i)) & 0xFFU;
+        if ((mode & CRC_MODE_CMPL_WR_MASK) != 0U)
+        {
+            value ^= 0xFFU;
+        }
+        if ((mode & CRC_MODE_BIT_RVS_WR_MASK) != 0U)
+        {
+            value = MOCK_CRC_Reverse(value, 8U);
+        }
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            bool feedback = ((s_crcSum & top) != 0U) != (((value << bit) & 0x80U) != 0U);
+
+            s_crcSum = ((s_crcSum << 1U) ^ (feedback ? poly : 0U)) & MOCK_CRC_Mask(width);
+        }
+    }
+}
+
+uint32_t MOCK_CRC_ReadSum(CRC_Type *base)
+{
+    uint32_t mode  = base->MODE;
+    uint32_t width = MOCK_CRC_Width(mode);
+    uint32_t sum   = s_crcSum;
+
+    if ((mode & CRC_MODE_BIT_RVS_SUM_MASK) != 0U)
+    {
+        sum = MOCK_CRC_Reverse(sum, width);
+    }
+    if ((mode & CRC_MODE_CMPL_SUM_MASK) != 0U)
+    {
+        sum ^= MOCK_CRC_Mask(width);
+    }
+    return sum;
+}
@@ -0,0 +1,101 @@
+/*
+ * Host model of the LPC845 address map and interrupt controller.
+ */
+
+#include <stdio.h>
+#include <sys/mman.h>
+
+#include "mock_device.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+typedef struct _mock_region
+{
+    uintptr_t base;
+    size_t size;
+} mock_region_t;
+
+/* APB peripherals, AHB peripherals (CRC, SCT, DMA, MTB) and the GPIO/PINT block. */
+static const mock_region_t s_regions[] = {
+    {0x40000000U, 0x00080000U},
+    {0x50000000U, 0x00010000U},
+    {0xA0000000U, 0x00008000U},
+};
+
+static uint32_t s_nvicEnabled;
+static uint32_t s_primask;
+
+__attribute__((constructor)) static void MOCK_MapPeripherals(void)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(s_regions); i++)
+    {
+        void *addr = mmap((void *)s_regions[i].base, s_regions[i].size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (addr != (void *)s_regions[i].base)
+        {
+            fprintf(stderr, "mock: cannot map peripherals at 0x%08lx\n", (unsigned long)s_regions[i].base);
+            abort();
+        }
+    }
+}
+
+void MOCK_DeviceReset(void)
+{
+    for (size_t i = 0; i < ARRAY_SIZE(s_regions); i++)
+    {
+        memset((void *)s_regions[i].base, 0, s_regions[i].size);
+    }
+    s_nvicEnabled = 0U;
+    s_primask     = 0U;
+}
+
+bool MOCK_IrqEnabled(IRQn_Type interrupt)
+{
+    return (s_nvicEnabled & (1UL << (uint32_t)interrupt)) != 0U;
+}
+
+bool MOCK_IrqDeliverable(IRQn_Type interrupt)
+{
+    return (s_primask == 0U) && MOCK_IrqEnabled(interrupt);
+}
+
+uint32_t DisableGlobalIRQ(void)
+{
+    uint32_t primask = s_primask;
+
+    s_primask = 1U;
+    return primask;
+}
+
+void EnableGlobalIRQ(uint32_t primask)
+{
+    s_primask = primask;
+}
+
+status_t EnableIRQ(IRQn_Type interrupt)
+{
+    if ((int32_t)interrupt < 0)
+    {
+        return kStatus_Fail;
+    }
+    s_nvicEnabled |= 1UL << (uint32_t)interrupt;
+    return kStatus_Success;
+}
+
+status_t DisableIRQ(IRQn_Type interrupt)
+{
+    if ((int32_t)interrupt < 0)
+    {
+        return kStatus_Fail;
+    }
+    s_nvicEnabled &= ~(1UL << (uint32_t)interrupt);
+    return kStatus_Success;
+}
+
+void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz)
+{
+    (void)delayTime_us;
+    (void)coreClock_Hz;
+}
@@ -0,0 +1,33 @@
+/*
+ * Host model of the LPC845 address map and interrupt controller.
+ *
+ * The APB, AHB peripheral and GPIO ranges are mapped at their device addresses before main() runs, so the driver
+ * register accesses through the real base pointers land in ordinary memory that a test can inspect and update.
+ */
+
+#ifndef MOCK_DEVICE_H_
+#define MOCK_DEVICE_H_
+
+#include "fsl_common.h"
+
+/*! @brief Write access to a register the device headers declare read-only, for the peripheral models. */
+#define MOCK_REG(reg) (*(volatile uint32_t *)&(reg))
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*! @brief Clears all mapped peripheral registers and the interrupt controller state. */
+void MOCK_DeviceReset(void);
+
+/*! @brief Returns true when the interrupt is enabled in the NVIC and interrupts are not masked globally. */
+bool MOCK_IrqDeliverable(IRQn_Type interrupt);
+
+/*! @brief Returns true when the interrupt is enabled in the NVIC. */
+bool MOCK_IrqEnabled(IRQn_Type interrupt);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* MOCK_DEVICE_H_ */
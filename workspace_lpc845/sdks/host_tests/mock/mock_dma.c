@@ -0,0 +1,317 @@
+/*
+ * Register-level host model of the LPC845 DMA controller.
+ */
+
+#include "fsl_dma.h"
+#include "mock_device.h"
+#include "mock_dma.h"
+
+#define MOCK_DMA_CHANNELS FSL_FEATURE_DMA_NUMBER_OF_CHANNELS
+
+typedef struct _mock_dma_channel
+{
+    bool triggered;     /* Channel is active: triggered and not yet cleared by CLRTRIG, exhaustion or abort. */
+    bool triggerLevel;  /* Hardware trigger input. */
+    bool request;       /* Peripheral request input. */
+    uint32_t burstLeft; /* Elements left in the burst started by the last trigger edge. */
+} mock_dma_channel_t;
+
+static mock_dma_channel_t s_channel[MOCK_DMA_CHANNELS];
+static mock_dma_bus_hook_t s_busHook;
+static uint32_t s_transferCount;
+
+static uint32_t MOCK_DMA_Bit(uint32_t channel)
+{
+    return 1UL << channel;
+}
+
+static void MOCK_DMA_UpdateActive(void)
+{
+    uint32_t active = 0U;
+
+    for (uint32_t ch = 0U; ch < MOCK_DMA_CHANNELS; ch++)
+    {
+        if (s_channel[ch].triggered)
+        {
+            active |= MOCK_DMA_Bit(ch);
+        }
+    }
+    MOCK_REG(DMA0->COMMON[0].ACTIVE) = active;
+    MOCK_REG(DMA0->COMMON[0].BUSY)   = 0U;
+}
+
+static dma_descriptor_t *MOCK_DMA_ChannelDescriptor(uint32_t channel)
+{
+    return &((dma_descriptor_t *)(uintptr_t)DMA0->SRAMBASE)[channel];
+}
+
+static bool MOCK_DMA_Ready(uint32_t channel)
+{
+    return ((DMA0->COMMON[0].ENABLESET & MOCK_DMA_Bit(channel)) != 0U) &&
+           ((DMA0->CHANNEL[channel].XFERCFG & DMA_CHANNEL_XFERCFG_CFGVALID_MASK) != 0U);
+}
+
+/* Software trigger: SETTRIG or SWTRIG in XFERCFG, the latter also when it comes in with a reloaded descriptor. */
+static void MOCK_DMA_SoftwareTrigger(uint32_t channel)
+{
+    volatile uint32_t *xfercfg = &DMA0->CHANNEL[channel].XFERCFG;
+
+    if (((*xfercfg & DMA_CHANNEL_XFERCFG_SWTRIG_MASK) != 0U) && MOCK_DMA_Ready(channel))
+    {
+        *xfercfg &= ~DMA_CHANNEL_XFERCFG_SWTRIG_MASK;
+        s_channel[channel].triggered = true;
+        s_channel[channel].burstLeft = UINT32_MAX;
+    }
+}
+
+static void MOCK_DMA_Abort(uint32_t channel)
+{
+    s_channel[channel].triggered = false;
+    s_channel[channel].burstLeft = 0U;
+}
+
+void MOCK_DMA_Reset(void)
+{
+    memset(s_channel, 0, sizeof(s_channel));
+    s_busHook       = NULL;
+    s_transferCount = 0U;
+}
+
+void MOCK_DMA_SetBusHook(mock_dma_bus_hook_t hook)
+{
+    s_busHook = hook;
+}
+
+void MOCK_DMA_WriteCommon(volatile uint32_t *reg, uint32_t value)
+{
+    volatile uint32_t *r = (volatile uint32_t *)&DMA0->COMMON[0];
+
+    if (reg == &DMA0->COMMON[0].ENABLESET)
+    {
+        *reg |= value;
+    }
+    else if (reg == &DMA0->COMMON[0].ENABLECLR)
+    {
+        DMA0->COMMON[0].ENABLESET &= ~value;
+    }
+    else if (reg == &DMA0->COMMON[0].INTENSET)
+    {
+        *reg |= value;
+    }
+    else if (reg == &DMA0->COMMON[0].INTENCLR)
+    {
+        DMA0->COMMON[0].INTENSET &= ~value;
+    }
+    else if ((reg == &DMA0->COMMON[0].INTA) || (reg == &DMA0->COMMON[0].INTB) || (reg == &DMA0->COMMON[0].ERRINT))
+    {
+        *reg &= ~value;
+    }
+    else if (reg == &DMA0->COMMON[0].SETVALID)
+    {
+        for (uint32_t ch = 0U; ch < MOCK_DMA_CHANNELS; ch++)
+        {
+            if ((value & MOCK_DMA_Bit(ch)) != 0U)
+            {
+                DMA0->CHANNEL[ch].XFERCFG |= DMA_CHANNEL_XFERCFG_CFGVALID_MASK;
+            }
+        }
+    }
+    else if (reg == &DMA0->COMMON[0].SETTRIG)
+    {
+        for (uint32_t ch = 0U; ch < MOCK_DMA_CHANNELS; ch++)
+        {
+            if (((value & MOCK_DMA_Bit(ch)) != 0U) && MOCK_DMA_Ready(ch))
+            {
+                s_channel[ch].triggered = true;
+                s_channel[ch].burstLeft = UINT32_MAX;
+            }
+        }
+    }
+    else if (reg == &DMA0->COMMON[0].ABORT)
+    {
+        for (uint32_t ch = 0U; ch < MOCK_DMA_CHANNELS; ch++)
+        {
+            if ((value & MOCK_DMA_Bit(ch)) != 0U)
+            {
+                MOCK_DMA_Abort(ch);
+            }
+        }
+    }
+    else
+    {
+        /* ACTIVE and BUSY are read-only. */
+        assert((reg >= r) && (reg < (volatile uint32_t *)&DMA0->CHANNEL[0]));
+    }
+    MOCK_DMA_UpdateActive();
+}
+
+void MOCK_DMA_SetTrigger(uint32_t channel, bool level)
+{
+    mock_dma_channel_t *ch = &s_channel[channel];
+    uint32_t cfg           = DMA0->CHANNEL[channel].CFG;
+    bool activeHigh        = (cfg & DMA_CHANNEL_CFG_TRIGPOL_MASK) != 0U;
+    bool edge              = (cfg & DMA_CHANNEL_CFG_TRIGTYPE_MASK) == 0U;
+    bool wasActive         = ch->triggerLevel == activeHigh;
+
+    ch->triggerLevel = level;
+
+    if (((cfg & DMA_CHANNEL_CFG_HWTRIGEN_MASK) == 0U) || !MOCK_DMA_Ready(channel))
+    {
+        return;
+    }
+
+    if ((level == activeHigh) && (!edge || !wasActive))
+    {
+        ch->triggered = true;
+        if ((cfg & DMA_CHANNEL_CFG_TRIGBURST_MASK) != 0U)
+        {
+            ch->burstLeft =
+                1UL << ((cfg & DMA_CHANNEL_CFG_BURSTPOWER_MASK) >> DMA_CHANNEL_CFG_BURSTPOWER_SHIFT);
+        }
+        else
+        {
+            ch->burstLeft = UINT32_MAX;
+        }
+        MOCK_DMA_UpdateActive();
+    }
+}
+
+void MOCK_DMA_SetRequest(uint32_t channel, bool asserted)
+{
+    s_channel[channel].request = asserted;
+}
+
+static bool MOCK_DMA_HasWork(uint32_t channel)
+{
+    mock_dma_channel_t *ch = &s_channel[channel];
+    uint32_t cfg           = DMA0->CHANNEL[channel].CFG;
+
+    MOCK_DMA_SoftwareTrigger(channel);
+
+    if (!ch->triggered || (ch->burstLeft == 0U) || !MOCK_DMA_Ready(channel))
+    {
+        return false;
+    }
+    /* Level triggered bursts only run while the trigger is held. */
+    if (((cfg & DMA_CHANNEL_CFG_HWTRIGEN_MASK) != 0U) && ((cfg & DMA_CHANNEL_CFG_TRIGTYPE_MASK) != 0U) &&
+        ((cfg & DMA_CHANNEL_CFG_TRIGBURST_MASK) != 0U) &&
+        (ch->triggerLevel != ((cfg & DMA_CHANNEL_CFG_TRIGPOL_MASK) != 0U)))
+    {
+        return false;
+    }
+    if (((cfg & DMA_CHANNEL_CFG_PERIPHREQEN_MASK) != 0U) && !ch->request)
+    {
+        return false;
+    }
+    return true;
+}
+
+static uint32_t MOCK_DMA_Interleave(uint32_t field)
+{
+    return (field == 3U) ? 4U : field;
+}
+
+static void MOCK_DMA_Exhausted(uint32_t channel, uint32_t xfercfg)
+{
+    dma_descriptor_t *head = MOCK_DMA_ChannelDescriptor(channel);
+    dma_descriptor_t *next = (dma_descriptor_t *)head->linkToNextDesc;
+
+    if ((xfercfg & DMA_CHANNEL_XFERCFG_SETINTA_MASK) != 0U)
+    {
+        DMA0->COMMON[0].INTA |= MOCK_DMA_Bit(channel);
+    }
+    if ((xfercfg & DMA_CHANNEL_XFERCFG_SETINTB_MASK) != 0U)
+    {
+        DMA0->COMMON[0].INTB |= MOCK_DMA_Bit(channel);
+    }
+
+    if (((xfercfg & DMA_CHANNEL_XFERCFG_RELOAD_MASK) != 0U) && (next != NULL))
+    {
+        /* The linked descriptor becomes the channel descriptor. */
+        head->srcEndAddr              = next->srcEndAddr;
+        head->dstEndAddr              = next->dstEndAddr;
+        head->linkToNextDesc          = next->linkToNextDesc;
+        head->xfercfg                 = next->xfercfg;
+        DMA0->CHANNEL[channel].XFERCFG = next->xfercfg;
+        if ((xfercfg & DMA_CHANNEL_XFERCFG_CLRTRIG_MASK) != 0U)
+        {
+            MOCK_DMA_Abort(channel);
+        }
+    }
+    else
+    {
+        DMA0->CHANNEL[channel].XFERCFG =
+            (xfercfg & ~DMA_CHANNEL_XFERCFG_CFGVALID_MASK) | DMA_CHANNEL_XFERCFG_XFERCOUNT_MASK;
+        MOCK_DMA_Abort(channel);
+    }
+}
+
+bool MOCK_DMA_Step(void)
+{
+    for (uint32_t channel = 0U; channel < MOCK_DMA_CHANNELS; channel++)
+    {
+        if (!MOCK_DMA_HasWork(channel))
+        {
+            continue;
+        }
+
+        dma_descriptor_t *head = MOCK_DMA_ChannelDescriptor(channel);
+        uint32_t xfercfg       = DMA0->CHANNEL[channel].XFERCFG;
+        uint32_t remaining =
+            (xfercfg & DMA_CHANNEL_XFERCFG_XFERCOUNT_MASK) >> DMA_CHANNEL_XFERCFG_XFERCOUNT_SHIFT;
+        uint32_t width = 1UL << ((xfercfg & DMA_CHANNEL_XFERCFG_WIDTH_MASK) >> DMA_CHANNEL_XFERCFG_WIDTH_SHIFT);
+        uint32_t srcInc =
+            MOCK_DMA_Interleave((xfercfg & DMA_CHANNEL_XFERCFG_SRCINC_MASK) >> DMA_CHANNEL_XFERCFG_SRCINC_SHIFT);
+        uint32_t dstInc =
+            MOCK_DMA_Interleave((xfercfg & DMA_CHANNEL_XFERCFG_DSTINC_MASK) >> DMA_CHANNEL_XFERCFG_DSTINC_SHIFT);
+
+        if ((head->srcEndAddr == NULL) || (head->dstEndAddr == NULL))
+        {
+            /* What DMA_SetupDescriptor() leaves behind for misaligned buffers. */
+            DMA0->COMMON[0].ERRINT |= MOCK_DMA_Bit(channel);
+            MOCK_DMA_Abort(channel);
+            MOCK_DMA_UpdateActive();
+            return false;
+        }
+
+        /* Descriptors hold end addresses, XFERCOUNT counts the elements left after the current one. */
+        uintptr_t src = (uintptr_t)head->srcEndAddr - remaining * width * srcInc;
+        uintptr_t dst = (uintptr_t)head->dstEndAddr - remaining * width * dstInc;
+
+        memcpy((void *)dst, (const void *)src, width);
+        s_transferCount++;
+        if (s_busHook != NULL)
+        {
+            s_busHook(src, false);
+            s_busHook(dst, true);
+        }
+
+        if (s_channel[channel].burstLeft != UINT32_MAX)
+        {
+            s_channel[channel].burstLeft--;
+        }
+
+        if (remaining == 0U)
+        {
+            MOCK_DMA_Exhausted(channel, xfercfg);
+        }
+        else
+        {
+            DMA0->CHANNEL[channel].XFERCFG = (xfercfg & ~DMA_CHANNEL_XFERCFG_XFERCOUNT_MASK) |
+                                             DMA_CHANNEL_XFERCFG_XFERCOUNT(remaining - 1U);
+        }
+        MOCK_DMA_UpdateActive();
+        return true;
+    }
+    return false;
+}
+
+bool MOCK_DMA_IrqLine(void)
+{
+    return ((DMA0->COMMON[0].INTA | DMA0->COMMON[0].INTB | DMA0->COMMON[0].ERRINT) & DMA0->COMMON[0].INTENSET) != 0U;
+}
+
+uint32_t MOCK_DMA_GetTransferCount(void)
+{
+    return s_transferCount;
+}
@@ -0,0 +1,55 @@
+/*
+ * Register-level host model of the LPC845 DMA controller.
+ *
+ * The model works on the DMA0 registers mapped by mock_device.c and on the descriptors in memory, the same way the
+ * hardware does: channel descriptors from SRAMBASE, XFERCFG in the channel registers, end addresses in the
+ * descriptors, RELOAD/CLRTRIG/SETINTA/SETINTB on exhaustion. fsl_dma.c is used unchanged, apart from its channel
+ * group writes that are routed through MOCK_DMA_WriteCommon().
+ *
+ * Time is advanced by the test: every MOCK_DMA_Step() moves at most one element.
+ */
+
+#ifndef MOCK_DMA_H_
+#define MOCK_DMA_H_
+
+#include "fsl_common.h"
+
+/*! @brief Called after the DMA read or wrote an element, so peripheral models can apply access side effects. */
+typedef void (*mock_dma_bus_hook_t)(uintptr_t address, bool write);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*! @brief Resets the channel state. Call after MOCK_DeviceReset(). */
+void MOCK_DMA_Reset(void);
+
+/*! @brief Installs the bus access hook, NULL removes it. */
+void MOCK_DMA_SetBusHook(mock_dma_bus_hook_t hook);
+
+/*! @brief Drives the hardware trigger input of a channel. */
+void MOCK_DMA_SetTrigger(uint32_t channel, bool level);
+
+/*! @brief Drives the peripheral request input of a channel. */
+void MOCK_DMA_SetRequest(uint32_t channel, bool asserted);
+
+/*!
+ * @brief Runs one DMA cycle.
+ *
+ * The lowest numbered channel with work moves one element.
+ *
+ * @return true if an element was moved.
+ */
+bool MOCK_DMA_Step(void);
+
+/*! @brief Level of the DMA0 interrupt request. */
+bool MOCK_DMA_IrqLine(void);
+
+/*! @brief Number of elements moved since the last reset. */
+uint32_t MOCK_DMA_GetTransferCount(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* MOCK_DMA_H_ */
@@ -0,0 +1,357 @@
+/*
+ * Register-level host model of the LPC845 I2C0 master and of the devices on its bus.
+ */
+
+#include "fsl_i2c.h"
+#include "mock_device.h"
+#include "mock_dma.h"
+#include "mock_i2c.h"
+
+#define MOCK_I2C_START_BITS 10U      /* START and address byte with its ACK. */
+#define MOCK_I2C_START_READ_BITS 19U /* The same, followed by the first received byte. */
+#define MOCK_I2C_BYTE_BITS 9U
+#define MOCK_I2C_STOP_BITS 1U
+
+/* DMA channel wired to the I2C0 master request. */
+#define MOCK_I2C_DMA_CHANNEL ((uint32_t)kDmaRequestI2C0_MST_DMA)
+
+static mock_i2c_device_t *s_devices;
+static uint32_t s_deviceCount;
+static mock_i2c_device_t *s_device; /* Device addressed by the last START, NULL if nobody answered. */
+static mock_i2c_work_waiting_t s_workWaiting;
+
+static uint64_t s_now;
+static uint32_t s_registerAccesses;
+
+static bool s_pending;      /* MSTPENDING. */
+static uint32_t s_state;    /* MSTSTATE. */
+static bool s_opActive;     /* A bus operation is running. */
+static uint64_t s_opEnd;    /* End of the running bus operation. */
+static uint32_t s_opState;  /* MSTSTATE when it ends. */
+static bool s_busOwned;     /* Between START and STOP. */
+static bool s_firstWrite;   /* The next written byte is the first one after the address. */
+static bool s_dmaMode;      /* MSTDMA. */
+
+static uint32_t s_starts;
+static uint32_t s_stops;
+static uint32_t s_protocolErrors;
+
+static bool s_gapOpen;
+static uint64_t s_gapStart;
+static uint32_t s_gapRegisterStart;
+static mock_i2c_gaps_t s_gaps;
+
+static uint64_t MOCK_I2C_BitCycles(void)
+{
+    uint32_t divider = ((I2C0->CLKDIV & I2C_CLKDIV_DIVVAL_MASK) >> I2C_CLKDIV_DIVVAL_SHIFT) + 1U;
+    uint32_t low     = ((I2C0->MSTTIME & I2C_MSTTIME_MSTSCLLOW_MASK) >> I2C_MSTTIME_MSTSCLLOW_SHIFT) + 2U;
+    uint32_t high    = ((I2C0->MSTTIME & I2C_MSTTIME_MSTSCLHIGH_MASK) >> I2C_MSTTIME_MSTSCLHIGH_SHIFT) + 2U;
+
+    return (uint64_t)divider * (low + high);
+}
+
+static mock_i2c_device_t *MOCK_I2C_FindDevice(uint8_t address)
+{
+    for (uint32_t i = 0U; i < s_deviceCount; i++)
+    {
+        if (s_devices[i].address == address)
+        {
+            return &s_devices[i];
+        }
+    }
+    return NULL;
+}
+
+/* In DMA mode the DMA request takes the place of the interrupt for the data states. */
+static bool MOCK_I2C_DmaServed(void)
+{
+    return s_dmaMode && ((s_state == I2C_STAT_MSTCODE_TXREADY) || (s_state == I2C_STAT_MSTCODE_RXREADY));
+}
+
+static void MOCK_I2C_UpdateRequest(void)
+{
+    MOCK_DMA_SetRequest(MOCK_I2C_DMA_CHANNEL, s_pending && MOCK_I2C_DmaServed());
+}
+
+static void MOCK_I2C_StartOp(uint32_t bits, uint32_t state)
+{
+    s_pending  = false;
+    s_opActive = true;
+    s_opEnd    = s_now + (bits * MOCK_I2C_BitCycles());
+    s_opState  = state;
+    MOCK_I2C_UpdateRequest();
+}
+
+static void MOCK_I2C_ReceiveByte(void)
+{
+    MOCK_REG(I2C0->MSTDAT) = s_device->regs[s_device->pointer++];
+}
+
+static void MOCK_I2C_CompleteOp(void)
+{
+    s_opActive = false;
+    s_pending  = true;
+    s_state    = s_opState;
+
+    if (s_state == I2C_STAT_MSTCODE_IDLE)
+    {
+        s_busOwned = false;
+        if ((s_device != NULL) && !s_device->registerPointer)
+        {
+            s_device->pointer = 0U;
+        }
+        if ((s_workWaiting != NULL) && s_workWaiting())
+        {
+            s_gapOpen          = true;
+            s_gapStart         = s_now;
+            s_gapRegisterStart = s_registerAccesses;
+        }
+    }
+    MOCK_I2C_UpdateRequest();
+}
+
+static void MOCK_I2C_Start(void)
+{
+    uint32_t mstdat = I2C0->MSTDAT;
+    uint64_t gap;
+
+    if (!s_busOwned && s_gapOpen)
+    {
+        gap = s_now - s_gapStart;
+        s_gaps.count++;
+        s_gaps.totalCycles += gap;
+        s_gaps.maxCycles = MAX(s_gaps.maxCycles, gap);
+        s_gaps.registerAccesses += s_registerAccesses - s_gapRegisterStart;
+    }
+    s_starts++;
+    s_gapOpen    = false;
+    s_busOwned   = true;
+    s_firstWrite = true;
+    s_device     = MOCK_I2C_FindDevice((uint8_t)(mstdat >> 1U));
+
+    if (s_device == NULL)
+    {
+        MOCK_I2C_StartOp(MOCK_I2C_START_BITS, I2C_STAT_MSTCODE_NACKADR);
+    }
+    else if ((mstdat & 1U) != 0U)
+    {
+        s_device->reads++;
+        MOCK_I2C_ReceiveByte();
+        MOCK_I2C_StartOp(MOCK_I2C_START_READ_BITS, I2C_STAT_MSTCODE_RXREADY);
+    }
+    else
+    {
+        MOCK_I2C_StartOp(MOCK_I2C_START_BITS, I2C_STAT_MSTCODE_TXREADY);
+    }
+}
+
+static void MOCK_I2C_Continue(void)
+{
+    if (!s_pending || (s_device == NULL))
+    {
+        s_protocolErrors++;
+    }
+    else if (s_state == I2C_STAT_MSTCODE_TXREADY)
+    {
+        if (s_device->registerPointer && s_firstWrite)
+        {
+            s_device->pointer = (uint8_t)I2C0->MSTDAT;
+        }
+        else
+        {
+            s_device->regs[s_device->pointer++] = (uint8_t)I2C0->MSTDAT;
+            s_device->writes++;
+        }
+        s_firstWrite = false;
+        MOCK_I2C_StartOp(MOCK_I2C_BYTE_BITS, I2C_STAT_MSTCODE_TXREADY);
+    }
+    else if (s_state == I2C_STAT_MSTCODE_RXREADY)
+    {
+        MOCK_I2C_ReceiveByte();
+        MOCK_I2C_StartOp(MOCK_I2C_BYTE_BITS, I2C_STAT_MSTCODE_RXREADY);
+    }
+    else
+    {
+        s_protocolErrors++;
+    }
+}
+
+/* MSTCTL write, by the CPU or by the DMA. */
+static void MOCK_I2C_Control(uint32_t value)
+{
+    s_dmaMode = (value & I2C_MSTCTL_MSTDMA_MASK) != 0U;
+
+    if ((value & I2C_MSTCTL_MSTSTART_MASK) != 0U)
+    {
+        MOCK_I2C_Start();
+    }
+    else if ((value & I2C_MSTCTL_MSTSTOP_MASK) != 0U)
+    {
+        s_stops++;
+        MOCK_I2C_StartOp(MOCK_I2C_STOP_BITS, I2C_STAT_MSTCODE_IDLE);
+    }
+    else if ((value & I2C_MSTCTL_MSTCONTINUE_MASK) != 0U)
+    {
+        MOCK_I2C_Continue();
+    }
+    else
+    {
+        MOCK_I2C_UpdateRequest();
+    }
+}
+
+static uint32_t MOCK_I2C_Status(void)
+{
+    return (s_pending ? I2C_STAT_MSTPENDING_MASK : 0U) | I2C_STAT_MSTSTATE(s_state);
+}
+
+void MOCK_I2C_Reset(mock_i2c_device_t *devices, uint32_t count)
+{
+    s_devices          = devices;
+    s_deviceCount      = count;
+    s_device           = NULL;
+    s_workWaiting      = NULL;
+    s_now              = 0U;
+    s_registerAccesses = 0U;
+    s_pending          = true;
+    s_state            = I2C_STAT_MSTCODE_IDLE;
+    s_opActive         = false;
+    s_busOwned         = false;
+    s_dmaMode          = false;
+    s_starts           = 0U;
+    s_stops            = 0U;
+    s_protocolErrors   = 0U;
+    s_gapOpen          = false;
+    memset(&s_gaps, 0, sizeof(s_gaps));
+}
+
+void MOCK_I2C_SetWorkWaiting(mock_i2c_work_waiting_t workWaiting)
+{
+    s_workWaiting = workWaiting;
+}
+
+void MOCK_I2C_Advance(uint64_t cycles)
+{
+    uint64_t end = s_now + cycles;
+
+    if (s_opActive && (s_opEnd <= end))
+    {
+        s_now = s_opEnd;
+        MOCK_I2C_CompleteOp();
+    }
+    s_now = end;
+}
+
+uint64_t MOCK_I2C_Now(void)
+{
+    return s_now;
+}
+
+uint64_t MOCK_I2C_NextEvent(void)
+{
+    return s_opActive ? s_opEnd : UINT64_MAX;
+}
+
+bool MOCK_I2C_IrqLine(void)
+{
+    uint32_t status = MOCK_I2C_Status();
+
+    if (MOCK_I2C_DmaServed())
+    {
+        status &= ~I2C_STAT_MSTPENDING_MASK;
+    }
+    return (status & I2C0->INTENSET) != 0U;
+}
+
+bool MOCK_I2C_BusOwned(void)
+{
+    return s_busOwned;
+}
+
+void MOCK_I2C_GetConditions(uint32_t *starts, uint32_t *stops)
+{
+    *starts = s_starts;
+    *stops  = s_stops;
+}
+
+uint32_t MOCK_I2C_GetProtocolErrors(void)
+{
+    return s_protocolErrors;
+}
+
+void MOCK_I2C_BusAccess(uintptr_t address, bool write)
+{
+    if (write && (address == (uintptr_t)&I2C0->MSTCTL))
+    {
+        MOCK_I2C_Control(I2C0->MSTCTL);
+    }
+    else if (address == (uintptr_t)&I2C0->MSTDAT)
+    {
+        /* A DMA access to MSTDAT acknowledges the data state, like a CPU write of MSTCONTINUE. */
+        if (!MOCK_I2C_DmaServed() || (write != (s_state == I2C_STAT_MSTCODE_TXREADY)))
+        {
+            s_protocolErrors++;
+        }
+        else
+        {
+            MOCK_I2C_Continue();
+        }
+    }
+    else
+    {
+        /* Not an I2C register. */
+    }
+}
+
+uint32_t MOCK_I2C_GetRegisterAccesses(void)
+{
+    return s_registerAccesses;
+}
+
+void MOCK_I2C_GetGaps(mock_i2c_gaps_t *gaps)
+{
+    *gaps = s_gaps;
+}
+
+uint32_t MOCK_I2C_Read(I2C_Type *base, const volatile uint32_t *reg)
+{
+    s_registerAccesses++;
+    MOCK_I2C_Advance(MOCK_I2C_REG_CYCLES);
+
+    if (reg == &base->STAT)
+    {
+        return MOCK_I2C_Status();
+    }
+    if (reg == &base->INTSTAT)
+    {
+        return MOCK_I2C_Status() & base->INTENSET;
+    }
+    return *reg;
+}
+
+void MOCK_I2C_Write(I2C_Type *base, volatile uint32_t *reg, uint32_t value)
+{
+    s_registerAccesses++;
+    MOCK_I2C_Advance(MOCK_I2C_REG_CYCLES);
+
+    if (reg == &base->STAT)
+    {
+        /* Only the write-one-to-clear error and slave flags, which the model never sets. */
+    }
+    else if (reg == &base->INTENSET)
+    {
+        base->INTENSET |= value;
+    }
+    else if (reg == &base->INTENCLR)
+    {
+        base->INTENSET &= ~value;
+    }
+    else if (reg == &base->MSTCTL)
+    {
+        MOCK_I2C_Control(value);
+    }
+    else
+    {
+        *reg = value;
+    }
+}
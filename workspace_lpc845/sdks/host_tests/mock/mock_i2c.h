@@ -0,0 +1,103 @@
+/*
+ * Register-level host model of the LPC845 I2C0 master and of the devices on its bus.
+ *
+ * STAT, MSTCTL and MSTDAT have side effects that plain memory can't model, so the copies of fsl_i2c.h and fsl_i2c.c
+ * used by the tests route every CPU access to CFG, STAT, INTENSET, INTENCLR, INTSTAT, MSTCTL and MSTDAT through
+ * MOCK_I2C_Read() and MOCK_I2C_Write(). The other registers stay plain memory; the bit time is taken from CLKDIV and
+ * MSTTIME as programmed by I2C_MasterInit().
+ *
+ * Time is counted in system clock cycles and advanced by the test with MOCK_I2C_Advance(); every trapped register
+ * access also takes MOCK_I2C_REG_CYCLES, so the CPU time of the driver shows up on the bus. A bus operation
+ * started from MSTCTL runs for the bits it puts on the wire and then sets MSTPENDING with the next master state:
+ * START 10 bits (19 for a read, which also receives the first byte), CONTINUE 9 bits, STOP 1 bit.
+ *
+ * With MSTDMA set, the TXREADY and RXREADY states raise the DMA request of the I2C0 master channel in the DMA model
+ * instead of the interrupt. A DMA write of MSTDAT sends the byte and a DMA read takes the received one and receives
+ * the next, as MSTCONTINUE does; a DMA write of MSTCTL acts as a CPU one. Install MOCK_I2C_BusAccess() as the DMA bus
+ * hook for that.
+ *
+ * Bus idle gaps are measured from a STOP that leaves work waiting, as told by the work waiting callback, to the
+ * next START.
+ */
+
+#ifndef MOCK_I2C_H_
+#define MOCK_I2C_H_
+
+#include "fsl_common.h"
+
+/*! @brief Cycles of a CPU access to a trapped I2C register. */
+#define MOCK_I2C_REG_CYCLES 3U
+
+/*! @brief A device on the bus, a 256 byte register file. */
+typedef struct _mock_i2c_device
+{
+    uint8_t address;      /*!< 7-bit address. */
+    bool registerPointer; /*!< The first written byte sets the register pointer, otherwise every STOP resets it. */
+    uint8_t regs[256];    /*!< Register file, read and written from the pointer on. */
+    uint8_t pointer;      /*!< Register pointer. */
+    uint32_t reads;       /*!< Read transfers addressed to the device. */
+    uint32_t writes;      /*!< Register bytes written. */
+} mock_i2c_device_t;
+
+/*! @brief Bus idle gap statistics. */
+typedef struct _mock_i2c_gaps
+{
+    uint32_t count;            /*!< Gaps measured. */
+    uint64_t totalCycles;      /*!< Sum of the gap lengths. */
+    uint64_t maxCycles;        /*!< Longest gap. */
+    uint64_t registerAccesses; /*!< Trapped register accesses made during the gaps. */
+} mock_i2c_gaps_t;
+
+/*! @brief Tells whether a transfer is waiting for the bus, called when a STOP completes. */
+typedef bool (*mock_i2c_work_waiting_t)(void);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Resets the master state, the time and the gap statistics. Call after MOCK_DeviceReset().
+ *
+ * @param devices devices on the bus, kept by the model until the next reset.
+ * @param count number of devices.
+ */
+void MOCK_I2C_Reset(mock_i2c_device_t *devices, uint32_t count);
+
+/*! @brief Installs the work waiting callback, NULL disables the gap measurement. */
+void MOCK_I2C_SetWorkWaiting(mock_i2c_work_waiting_t workWaiting);
+
+/*! @brief Advances the time, completing the bus operation that ends on the way. */
+void MOCK_I2C_Advance(uint64_t cycles);
+
+/*! @brief Current time in system clock cycles. */
+uint64_t MOCK_I2C_Now(void);
+
+/*! @brief End of the running bus operation, UINT64_MAX if the bus operation is done. */
+uint64_t MOCK_I2C_NextEvent(void);
+
+/*! @brief Level of the I2C0 interrupt request. */
+bool MOCK_I2C_IrqLine(void);
+
+/*! @brief Tells whether the master holds the bus, between a START and the end of a STOP. */
+bool MOCK_I2C_BusOwned(void);
+
+/*! @brief Numbers of START (including repeated START) and STOP conditions since the last reset. */
+void MOCK_I2C_GetConditions(uint32_t *starts, uint32_t *stops);
+
+/*! @brief Number of data accesses made out of the matching master state since the last reset. */
+uint32_t MOCK_I2C_GetProtocolErrors(void);
+
+/*! @brief DMA bus hook, see MOCK_DMA_SetBusHook(). */
+void MOCK_I2C_BusAccess(uintptr_t address, bool write);
+
+/*! @brief Number of trapped register accesses since the last reset. */
+uint32_t MOCK_I2C_GetRegisterAccesses(void);
+
+/*! @brief Gap statistics since the last reset. */
+void MOCK_I2C_GetGaps(mock_i2c_gaps_t *gaps);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* MOCK_I2C_H_ */
@@ -0,0 +1,294 @@
+/*
+ * Host benchmark of the timer manager (fsl_component_timer_manager.c) with 1, 16 and 128 running timers.
+ *
+ * The timer manager runs unchanged on a model of the HAL timer adapter below, without OSA, so every hardware timer
+ * interrupt processes the expired timers before it returns. Time is simulated in microseconds and only advances
+ * between interrupts. The benchmark reports the host time spent per interrupt, per timer expiry, per TM_Start() and
+ * per TM_GetFirstExpireTime(); all of them should stay flat as the number of timers grows.
+ *
+ * HAL timer model: the counter counts microseconds from the last enable and the interrupt fires when it reaches the
+ * timeout, after which it restarts from 0, as the MRT does in repeat mode. HAL_TimerUpdateTimeout() stops it.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "fsl_adapter_timer.h"
+#include "fsl_component_timer_manager.h"
+
+#define MAX_TIMERS 128U
+
+#define RUN_US (10U * 1000U * 1000U)
+
+#define BASE_PERIOD_US 1000U
+#define PERIOD_STEP_US 97U
+
+/* Shortest hardware timeout the timer manager programs, TM_MIN_TIMER_INTERVAL in the source. */
+#define MIN_INTERVAL_US 300U
+
+#define START_ROUNDS 100U
+#define FIRST_EXPIRE_ROUNDS 100000U
+
+#define CHECK(cond)                                                          \
+    do                                                                       \
+    {                                                                        \
+        if (!(cond))                                                         \
+        {                                                                    \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            s_failures++;                                                    \
+        }                                                                    \
+    } while (0)
+
+static int s_failures;
+
+/* HAL timer model state. */
+static uint64_t s_nowUs;
+static uint64_t s_halStartUs;
+static uint32_t s_halTimeoutUs;
+static bool s_halEnabled;
+static hal_timer_callback_t s_halCallback;
+static void *s_halCallbackParam;
+
+/* Timers under test. */
+static uint32_t s_timerHandles[MAX_TIMERS + 1U][(TIMER_HANDLE_SIZE + sizeof(uint32_t) - 1U) / sizeof(uint32_t)];
+static uint32_t s_periodUs[MAX_TIMERS + 1U];
+static uint64_t s_dueUs[MAX_TIMERS + 1U];
+static uint32_t s_expiries[MAX_TIMERS + 1U];
+static uint32_t s_earlyExpiries;
+static uint64_t s_maxLatenessUs;
+static uint32_t s_totalExpiries;
+
+static uint64_t NowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+hal_timer_status_t HAL_TimerInit(hal_timer_handle_t halTimerHandle, hal_timer_config_t *halTimerConfig)
+{
+    (void)halTimerHandle;
+    s_halTimeoutUs = halTimerConfig->timeout;
+    s_halEnabled   = false;
+    return kStatus_HAL_TimerSuccess;
+}
+
+void HAL_TimerDeinit(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    s_halEnabled = false;
+}
+
+void HAL_TimerEnable(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    s_halStartUs = s_nowUs;
+    s_halEnabled = true;
+}
+
+void HAL_TimerDisable(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    s_halEnabled = false;
+}
+
+void HAL_TimerInstallCallback(hal_timer_handle_t halTimerHandle, hal_timer_callback_t callback, void *callbackParam)
+{
+    (void)halTimerHandle;
+    s_halCallback      = callback;
+    s_halCallbackParam = callbackParam;
+}
+
+uint32_t HAL_TimerGetCurrentTimerCount(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    return s_halEnabled ? (uint32_t)(s_nowUs - s_halStartUs) : 0U;
+}
+
+hal_timer_status_t HAL_TimerUpdateTimeout(hal_timer_handle_t halTimerHandle, uint32_t timeout)
+{
+    (void)halTimerHandle;
+    s_halTimeoutUs = timeout;
+    s_halEnabled   = false;
+    return kStatus_HAL_TimerSuccess;
+}
+
+uint32_t HAL_TimerGetMaxTimeout(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+    return 0xFFFFFFFFU - 4000U;
+}
+
+void HAL_TimerExitLowpower(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+}
+
+void HAL_TimerEnterLowpower(hal_timer_handle_t halTimerHandle)
+{
+    (void)halTimerHandle;
+}
+
+static void TimerCallback(void *param)
+{
+    uint32_t timer = (uint32_t)(uintptr_t)param;
+
+    if (s_nowUs < s_dueUs[timer])
+    {
+        s_earlyExpiries++;
+    }
+    else if ((s_nowUs - s_dueUs[timer]) > s_maxLatenessUs)
+    {
+        s_maxLatenessUs = s_nowUs - s_dueUs[timer];
+    }
+    s_dueUs[timer] = s_nowUs + s_periodUs[timer];
+    s_expiries[timer]++;
+    s_totalExpiries++;
+}
+
+/*
+ * Runs the timer interrupts up to endUs, returns the number of interrupts and adds their host time to *elapsedNs.
+ * Time stops at the last interrupt: in between, a timer can be overdue by up to MIN_INTERVAL_US, and the remaining
+ * time of an overdue timer wraps around.
+ */
+static uint32_t RunUntil(uint64_t endUs, uint64_t *elapsedNs)
+{
+    uint32_t interrupts = 0U;
+    uint64_t start;
+
+    while (s_halEnabled && ((s_halStartUs + s_halTimeoutUs) <= endUs))
+    {
+        s_nowUs      = s_halStartUs + s_halTimeoutUs;
+        s_halStartUs = s_nowUs;
+
+        start = NowNs();
+        s_halCallback(s_halCallbackParam);
+        *elapsedNs += NowNs() - start;
+        interrupts++;
+    }
+    return interrupts;
+}
+
+static uint8_t TimerType(uint32_t timer)
+{
+    /* Every other timer is a low power timer, so both heaps of the timer manager are used. */
+    return (uint8_t)(kTimerModeIntervalTimer | kTimerModeSetMicrosTimer |
+                     (((timer & 1U) != 0U) ? kTimerModeLowPowerTimer : 0U));
+}
+
+static uint32_t FirstExpireTime(uint8_t timerType, uint32_t timers)
+{
+    uint32_t first = 0xFFFFFFFFU;
+
+    for (uint32_t timer = 0U; timer < timers; timer++)
+    {
+        if ((TimerType(timer) & timerType) != 0U)
+        {
+            first = MIN(first, TM_GetRemainingTime((timer_handle_t)s_timerHandles[timer]));
+        }
+    }
+    return first;
+}
+
+static void BenchTimers(uint32_t timers)
+{
+    timer_config_t config = {.srcClock_Hz = 1000000U};
+    uint64_t interruptNs  = 0U;
+    uint64_t startNs;
+    uint64_t firstNs;
+    uint64_t start;
+    uint32_t interrupts;
+    volatile uint32_t first;
+
+    printf("%u timers\n", (unsigned)timers);
+
+    s_nowUs         = 0U;
+    s_earlyExpiries = 0U;
+    s_maxLatenessUs = 0U;
+    s_totalExpiries = 0U;
+    CHECK(TM_Init(&config) == kStatus_TimerSuccess);
+
+    for (uint32_t timer = 0U; timer < timers; timer++)
+    {
+        s_periodUs[timer] = BASE_PERIOD_US + (PERIOD_STEP_US * timer);
+        s_dueUs[timer]    = s_periodUs[timer];
+        s_expiries[timer] = 0U;
+        CHECK(TM_Open((timer_handle_t)s_timerHandles[timer]) == kStatus_TimerSuccess);
+        CHECK(TM_InstallCallback((timer_handle_t)s_timerHandles[timer], TimerCallback, (void *)(uintptr_t)timer) ==
+              kStatus_TimerSuccess);
+        CHECK(TM_Start((timer_handle_t)s_timerHandles[timer], TimerType(timer), s_periodUs[timer]) ==
+              kStatus_TimerSuccess);
+    }
+
+    interrupts = RunUntil(RUN_US, &interruptNs);
+
+    /* Intervals restart from the processing time, which is at most MIN_INTERVAL_US late. */
+    CHECK(s_earlyExpiries == 0U);
+    CHECK(s_maxLatenessUs <= MIN_INTERVAL_US);
+    for (uint32_t timer = 0U; timer < timers; timer++)
+    {
+        CHECK(s_expiries[timer] <= (RUN_US / s_periodUs[timer]));
+        CHECK(s_expiries[timer] >= ((RUN_US / (s_periodUs[timer] + MIN_INTERVAL_US)) - 1U));
+    }
+
+    CHECK(TM_GetFirstExpireTime(kTimerModeLowPowerTimer) == FirstExpireTime(kTimerModeLowPowerTimer, timers));
+    CHECK(TM_GetFirstExpireTime(kTimerModeIntervalTimer) == FirstExpireTime(kTimerModeIntervalTimer, timers));
+
+    /* Restarting a timer takes it out of the heap and puts it back. */
+    start = NowNs();
+    for (uint32_t round = 0U; round < START_ROUNDS; round++)
+    {
+        for (uint32_t timer = 0U; timer < timers; timer++)
+        {
+            (void)TM_Start((timer_handle_t)s_timerHandles[timer], TimerType(timer), s_periodUs[timer]);
+        }
+    }
+    startNs = NowNs() - start;
+
+    start = NowNs();
+    for (uint32_t round = 0U; round < FIRST_EXPIRE_ROUNDS; round++)
+    {
+        first = TM_GetFirstExpireTime(kTimerModeLowPowerTimer);
+    }
+    firstNs = NowNs() - start;
+    (void)first;
+
+    printf("  %u interrupts, %u expiries, %.1f ns/interrupt, %.1f ns/expiry\n", (unsigned)interrupts,
+           (unsigned)s_totalExpiries, (double)interruptNs / (double)interrupts,
+           (double)interruptNs / (double)s_totalExpiries);
+    printf("  %.1f ns/TM_Start, %.1f ns/TM_GetFirstExpireTime\n",
+           (double)startNs / (double)(START_ROUNDS * timers), (double)firstNs / (double)FIRST_EXPIRE_ROUNDS);
+
+    if (timers == TM_MAX_ACTIVE_TIMERS)
+    {
+        /* Every slot is in use. */
+        CHECK(TM_Open((timer_handle_t)s_timerHandles[timers]) == kStatus_TimerSuccess);
+        CHECK(TM_Start((timer_handle_t)s_timerHandles[timers], TimerType(timers), BASE_PERIOD_US) ==
+              kStatus_TimerOutOfRange);
+        CHECK(TM_Stop((timer_handle_t)s_timerHandles[0]) == kStatus_TimerSuccess);
+        CHECK(TM_Start((timer_handle_t)s_timerHandles[timers], TimerType(timers), BASE_PERIOD_US) ==
+              kStatus_TimerSuccess);
+        CHECK(TM_Close((timer_handle_t)s_timerHandles[timers]) == kStatus_TimerSuccess);
+    }
+
+    for (uint32_t timer = 0U; timer < timers; timer++)
+    {
+        CHECK(TM_Close((timer_handle_t)s_timerHandles[timer]) == kStatus_TimerSuccess);
+    }
+    CHECK(TM_AreAllTimersOff() == 1U);
+    TM_Deinit();
+}
+
+int main(void)
+{
+    static const uint32_t timers[] = {1U, 16U, MAX_TIMERS};
+
+    for (uint32_t i = 0U; i < ARRAY_SIZE(timers); i++)
+    {
+        BenchTimers(timers[i]);
+    }
+
+    printf("%s, %d failures\n", (s_failures != 0) ? "FAILED" : "passed", s_failures);
+    return (s_failures != 0) ? 1 : 0;
+}
@@ -0,0 +1,549 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_dma_queue.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.lpc_dma_queue"
+#endif
+
+/* Transfers linked into the hardware chain at a time. The INTA and INTB flags can't count completions, a flag raised
+ * twice before the interrupt is served reads as once. With three transfers linked, a flag can only stand for two
+ * of them when the later one ends the chain, which then shows as an idle channel, see DMA_QueueCallback(). */
+#define DMA_QUEUE_LINKED_TRANSFERS 3U
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Sets up the pool descriptors of a transfer, chained one to the next.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @param transfer pointer to the transfer, its firstDescriptor, descriptorCount and tag members must be set.
+ */
+static void DMA_QueueSetupDescriptors(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer);
+
+/*!
+ * @brief Starts the channel with a transfer and those linked behind it.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @param transfer pointer to the first transfer.
+ */
+static void DMA_QueueStart(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer);
+
+/*!
+ * @brief Links a transfer into the hardware chain, starting the channel if the chain is empty.
+ *
+ * Must be called with interrupts disabled.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @param transfer pointer to the transfer, its descriptors set up.
+ */
+static void DMA_QueueLink(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer);
+
+/*!
+ * @brief Appends a transfer to the queue, linking it into the hardware chain if the chain has room for it.
+ *
+ * Must be called with interrupts disabled.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @param transfer pointer to the transfer, its descriptors set up.
+ */
+static void DMA_QueueAppend(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer);
+
+/*!
+ * @brief Tells whether the head transfer is in the hardware chain the DMA runs.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ */
+static bool DMA_QueueHeadRunning(dma_queue_handle_t *handle);
+
+/*!
+ * @brief Removes the head transfer from the queue and adds it to a list of finished transfers.
+ *
+ * Must be called with interrupts disabled.
+ *
+ * @param handle pointer to dma_queue_handle_t structure.
+ * @param doneTail pointer to the next member of the last finished transfer, updated.
+ */
+static void DMA_QueueRetireHead(dma_queue_handle_t *handle, dma_queue_transfer_t ***doneTail);
+
+/*!
+ * @brief DMA callback for the DMA queue driver.
+ *
+ * @param handle DMA handler of the queue.
+ * @param userData Queue handle.
+ * @param transferDone false on a DMA error.
+ * @param intmode Interrupt flag, kDMA_IntA or kDMA_IntB.
+ */
+static void DMA_QueueCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void DMA_QueueSetupDescriptors(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer)
+{
+    uint8_t *srcAddr = (uint8_t *)transfer->srcAddr;
+    uint8_t *dstAddr = (uint8_t *)transfer->dstAddr;
+    uint32_t units   = transfer->bytes / handle->width;
+    uint32_t index   = transfer->firstDescriptor;
+    uint32_t next;
+    uint32_t length;
+    uint32_t xferCfg;
+    uint32_t i;
+    bool isLast;
+
+    for (i = 0U; i < transfer->descriptorCount; i++)
+    {
+        isLast = (i == (transfer->descriptorCount - 1U));
+        next   = (index + 1U) % handle->poolCount;
+
+        /* The last unit is moved by a descriptor of its own, which keeps the end of the chain linkable until the
+         * very end of the transfer, see DMA_QueueAppend(). */
+        length = isLast ? units : MIN(units - 1U, DMA_MAX_TRANSFER_COUNT);
+
+        /* The last descriptor ends the chain until the next transfer is linked behind it, and raises INTA or INTB
+         * by the tag of the transfer. */
+        xferCfg = DMA_CHANNEL_XFER(!isLast, false, isLast && (transfer->tag == 0U), isLast && (transfer->tag != 0U),
+                                   handle->width, handle->srcInc, handle->dstInc, length * handle->width);
+
+        DMA_SetupDescriptor(&handle->pool[index], xferCfg, srcAddr, dstAddr, isLast ? NULL : &handle->pool[next]);
+
+        srcAddr += length * handle->width * handle->srcInc;
+        dstAddr += length * handle->width * handle->dstInc;
+        units -= length;
+        index = next;
+    }
+}
+
+static void DMA_QueueStart(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer)
+{
+    /* The head descriptor of the channel is a copy of the first pool descriptor, the chain goes on in the pool. */
+    DMA_SubmitChannelDescriptor(handle->dmaHandle, &handle->pool[transfer->firstDescriptor]);
+    DMA_StartTransfer(handle->dmaHandle);
+}
+
+static void DMA_QueueLink(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer)
+{
+    DMA_Type *base = handle->dmaHandle->base;
+    uint32_t channel = handle->dmaHandle->channel;
+    dma_queue_transfer_t *previous = handle->lastLinked;
+    dma_descriptor_t *last;
+
+    handle->lastLinked = transfer;
+    handle->linked++;
+
+    if (handle->linked == 1U)
+    {
+        DMA_QueueStart(handle, transfer);
+        return;
+    }
+
+    /* Link the transfer behind the last descriptor of the chain, the link first so that the DMA cannot follow a
+     * reload without it. */
+    last = &handle->pool[(previous->firstDescriptor + previous->descriptorCount - 1U) % handle->poolCount];
+    last->linkToNextDesc = &handle->pool[transfer->firstDescriptor];
+    __DSB();
+    last->xfercfg |= DMA_CHANNEL_XFERCFG_RELOAD_MASK;
+    __DSB();
+
+    if (handle->pending != NULL)
+    {
+        /* Linked behind transfers that wait for the channel to stop, they start together. */
+        return;
+    }
+
+    /* The DMA reads a descriptor, link included, when it loads it. Every descriptor of the chain but the last one
+     * reloads, so the channel register has the reload bit clear only once the last descriptor has been loaded,
+     * before it was linked: the channel then stops after it and the transfer starts from that interrupt. */
+    if ((base->CHANNEL[channel].XFERCFG & DMA_CHANNEL_XFERCFG_RELOAD_MASK) == 0U)
+    {
+        handle->pending = transfer;
+    }
+    else
+    {
+        handle->counters.chained++;
+    }
+}
+
+static void DMA_QueueAppend(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer)
+{
+    if (handle->head == NULL)
+    {
+        handle->head = transfer;
+    }
+    else
+    {
+        handle->tail->next = transfer;
+    }
+    handle->tail = transfer;
+
+    if ((handle->waiting != NULL) || (handle->linked == DMA_QUEUE_LINKED_TRANSFERS))
+    {
+        /* Linked from the interrupt once transfers ahead of it complete. */
+        if (handle->waiting == NULL)
+        {
+            handle->waiting = transfer;
+        }
+        return;
+    }
+
+    if (handle->linked == 0U)
+    {
+        handle->counters.started++;
+    }
+    DMA_QueueLink(handle, transfer);
+}
+
+static bool DMA_QueueHeadRunning(dma_queue_handle_t *handle)
+{
+    return (handle->head != NULL) && (handle->head != handle->pending) && (handle->head != handle->waiting);
+}
+
+static void DMA_QueueRetireHead(dma_queue_handle_t *handle, dma_queue_transfer_t ***doneTail)
+{
+    dma_queue_transfer_t *transfer = handle->head;
+
+    handle->head = transfer->next;
+    if (handle->head == NULL)
+    {
+        handle->tail = NULL;
+    }
+
+    if (transfer == handle->waiting)
+    {
+        handle->waiting = transfer->next;
+    }
+    else
+    {
+        handle->linked--;
+    }
+
+    handle->poolFirst = (handle->poolFirst + transfer->descriptorCount) % handle->poolCount;
+    handle->poolUsed -= transfer->descriptorCount;
+
+    handle->counters.transfers++;
+    handle->counters.bytes += transfer->bytes;
+
+    transfer->next = NULL;
+    **doneTail     = transfer;
+    *doneTail      = &transfer->next;
+}
+
+static void DMA_QueueCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    dma_queue_handle_t *queue = (dma_queue_handle_t *)userData;
+    dma_queue_transfer_t *done = NULL;
+    dma_queue_transfer_t **doneTail = &done;
+    dma_queue_transfer_t *transfer;
+    dma_queue_transfer_t *next;
+    status_t status = kStatus_Success;
+    uint32_t channelMask;
+    uint32_t tags;
+    uint32_t regPrimask;
+
+    /* Don't do anything if we don't have a valid handle. */
+    if ((handle == NULL) || (queue == NULL))
+    {
+        return;
+    }
+
+    channelMask = 1UL << DMA_CHANNEL_INDEX(handle->base, handle->channel);
+
+    regPrimask = DisableGlobalIRQ();
+
+    if (!transferDone)
+    {
+        /* Error, the channel is aborted and every queued transfer fails. */
+        DMA_AbortTransfer(handle);
+        DMA_COMMON_REG_SET(handle->base, handle->channel, INTA, channelMask);
+        DMA_COMMON_REG_SET(handle->base, handle->channel, INTB, channelMask);
+        queue->pending = NULL;
+        while (queue->head != NULL)
+        {
+            DMA_QueueRetireHead(queue, &doneTail);
+        }
+        status = kStatus_Fail;
+    }
+    else
+    {
+        /* Take both flags at once, the other one is cleared so that it is not handled again. */
+        tags = (intmode == (uint32_t)kDMA_IntA) ? 1U : 2U;
+        if ((DMA_COMMON_REG_GET(handle->base, handle->channel, INTA) & channelMask) != 0U)
+        {
+            DMA_COMMON_REG_SET(handle->base, handle->channel, INTA, channelMask);
+            tags |= 1U;
+        }
+        if ((DMA_COMMON_REG_GET(handle->base, handle->channel, INTB) & channelMask) != 0U)
+        {
+            DMA_COMMON_REG_SET(handle->base, handle->channel, INTB, channelMask);
+            tags |= 2U;
+        }
+
+        /* Transfers complete in order and alternate their tags, each flag completes the transfers up to the first
+         * one raising it. */
+        while ((tags != 0U) && DMA_QueueHeadRunning(queue))
+        {
+            tags &= ~(1UL << queue->head->tag);
+            DMA_QueueRetireHead(queue, &doneTail);
+        }
+
+        /* An idle channel has completed the whole chain, including a third transfer whose flag was merged with the
+         * one of the first. Flags raised since they were read belong to those transfers too, so they are cleared
+         * before the next ones start. */
+        if (!DMA_ChannelIsActive(handle->base, handle->channel))
+        {
+            DMA_COMMON_REG_SET(handle->base, handle->channel, INTA, channelMask);
+            DMA_COMMON_REG_SET(handle->base, handle->channel, INTB, channelMask);
+            while (DMA_QueueHeadRunning(queue))
+            {
+                DMA_QueueRetireHead(queue, &doneTail);
+            }
+        }
+
+        /* The chain ended before the pending transfers were linked, start them before running the callbacks. */
+        if ((queue->pending != NULL) && (queue->head == queue->pending))
+        {
+            DMA_QueueStart(queue, queue->pending);
+            queue->pending = NULL;
+            queue->counters.restarts++;
+        }
+
+        /* Link the waiting transfers in place of the completed ones, the channel stopped if none is left. */
+        while ((queue->waiting != NULL) && (queue->linked < DMA_QUEUE_LINKED_TRANSFERS))
+        {
+            transfer       = queue->waiting;
+            queue->waiting = transfer->next;
+            if (queue->linked == 0U)
+            {
+                queue->counters.restarts++;
+            }
+            DMA_QueueLink(queue, transfer);
+        }
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    for (transfer = done; transfer != NULL; transfer = next)
+    {
+        next             = transfer->next;
+        transfer->queued = false;
+        if (transfer->callback != NULL)
+        {
+            transfer->callback(queue, transfer, status, transfer->userData);
+        }
+    }
+}
+
+/*!
+ * brief Init the DMA queue handle of a channel.
+ *
+ * The queue keeps the channel busy with back-to-back transfers. Each submitted transfer gets its descriptors from a
+ * pool owned by the application and is linked behind the last descriptor of the running chain, so the DMA goes on
+ * with it without waiting for the interrupt. Up to three transfers are linked at a time, the others are linked from
+ * the interrupt as the transfers ahead of them complete. Transfers of any length are split into descriptors of up
+ * to DMA_MAX_TRANSFER_COUNT units. The queue owns the channel and its callback, DMA_SubmitChannelTransfer() and the
+ * other submit functions must not be used on it while the queue is in use.
+ *
+ * The channel runs without hardware trigger, paced by the peripheral request for the peripheral transfer types.
+ *
+ * param handle pointer to dma_queue_handle_t structure.
+ * param dmaHandle DMA handle pointer, created with DMA_CreateHandle().
+ * param type transfer type, which selects the address increments and the peripheral request.
+ * param width unit width in bytes, 1, 2 or 4.
+ * param pool descriptor pool, allocated with DMA_ALLOCATE_LINK_DESCRIPTORS().
+ * param poolCount number of descriptors in the pool, see DMA_QUEUE_DESCRIPTOR_COUNT().
+ */
+void DMA_QueueCreateHandle(dma_queue_handle_t *handle,
+                           dma_handle_t *dmaHandle,
+                           dma_transfer_type_t type,
+                           uint32_t width,
+                           dma_descriptor_t *pool,
+                           uint32_t poolCount)
+{
+    assert(handle != NULL);
+    assert(dmaHandle != NULL);
+    assert((pool != NULL) && (poolCount != 0U));
+    assert((((uint32_t)(uint32_t *)pool) & ((uint32_t)FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE - 1UL)) == 0UL);
+    assert((width == (uint32_t)kDMA_Transfer8BitWidth) || (width == (uint32_t)kDMA_Transfer16BitWidth) ||
+           (width == (uint32_t)kDMA_Transfer32BitWidth));
+
+    /* Zero handle. */
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->dmaHandle = dmaHandle;
+    handle->pool      = pool;
+    handle->poolCount = poolCount;
+    handle->width     = width;
+    handle->srcInc    = ((type == kDMA_MemoryToMemory) || (type == kDMA_MemoryToPeripheral)) ?
+                            (uint32_t)kDMA_AddressInterleave1xWidth :
+                            (uint32_t)kDMA_AddressInterleave0xWidth;
+    handle->dstInc    = ((type == kDMA_MemoryToMemory) || (type == kDMA_PeripheralToMemory)) ?
+                            (uint32_t)kDMA_AddressInterleave1xWidth :
+                            (uint32_t)kDMA_AddressInterleave0xWidth;
+
+    DMA_SetChannelConfig(dmaHandle->base, dmaHandle->channel, NULL, type != kDMA_MemoryToMemory);
+    DMA_SetCallback(dmaHandle, DMA_QueueCallback, handle);
+}
+
+/*!
+ * brief Queues a transfer.
+ *
+ * The transfer starts at once if the channel is idle. Otherwise it is linked into the running chain, or from the
+ * interrupt once the chain has room for it, unless the last descriptor of the chain has already been loaded by the
+ * DMA; the transfer then starts from the interrupt that completes the chain. The last unit of each transfer has a
+ * descriptor of its own, so that only happens to transfers submitted while the last unit of the previous one is
+ * moved. Can be called from interrupts, including the transfer callbacks.
+ *
+ * param handle pointer to dma_queue_handle_t structure.
+ * param transfer pointer to the transfer, its srcAddr, dstAddr, bytes, callback and userData members must be set.
+ * retval kStatus_Success Transfer queued.
+ * retval kStatus_InvalidArgument Invalid addresses or length, or more descriptors needed than the whole pool.
+ * retval kStatus_Busy The transfer is still queued or running.
+ * retval kStatus_DMA_QueueFull Not enough free descriptors in the pool, submit again once transfers completed.
+ */
+status_t DMA_QueueSubmit(dma_queue_handle_t *handle, dma_queue_transfer_t *transfer)
+{
+    status_t result = kStatus_Success;
+    uint32_t descriptorCount;
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+    assert(transfer != NULL);
+
+    if ((transfer->srcAddr == NULL) || (transfer->dstAddr == NULL) || (transfer->bytes == 0U) ||
+        ((transfer->bytes % handle->width) != 0U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    descriptorCount = DMA_QUEUE_DESCRIPTOR_COUNT(transfer->bytes / handle->width);
+    if (descriptorCount > handle->poolCount)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    regPrimask = DisableGlobalIRQ();
+
+    if (transfer->queued)
+    {
+        result = kStatus_Busy;
+    }
+    else if (descriptorCount > (handle->poolCount - handle->poolUsed))
+    {
+        handle->counters.rejected++;
+        result = kStatus_DMA_QueueFull;
+    }
+    else
+    {
+        /* Transfers complete in order, so the pool is used as a ring. */
+        transfer->firstDescriptor = (handle->poolFirst + handle->poolUsed) % handle->poolCount;
+        transfer->descriptorCount = descriptorCount;
+        transfer->tag             = handle->nextTag;
+        transfer->next            = NULL;
+        transfer->queued          = true;
+        handle->nextTag ^= 1U;
+
+        handle->poolUsed += descriptorCount;
+        handle->counters.peakDescriptors = MAX(handle->counters.peakDescriptors, handle->poolUsed);
+
+        DMA_QueueSetupDescriptors(handle, transfer);
+        DMA_QueueAppend(handle, transfer);
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    return result;
+}
+
+/*!
+ * brief Aborts the running transfer and discards the queued ones.
+ *
+ * The callbacks of the discarded transfers are not invoked.
+ *
+ * param handle pointer to dma_queue_handle_t structure.
+ */
+void DMA_QueueAbort(dma_queue_handle_t *handle)
+{
+    dma_queue_transfer_t *transfer;
+    uint32_t channelMask;
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+
+    channelMask = 1UL << DMA_CHANNEL_INDEX(handle->dmaHandle->base, handle->dmaHandle->channel);
+
+    regPrimask = DisableGlobalIRQ();
+
+    if (handle->head != NULL)
+    {
+        DMA_AbortTransfer(handle->dmaHandle);
+
+        /* Flags raised before the abort must not complete the next transfers. */
+        DMA_COMMON_REG_SET(handle->dmaHandle->base, handle->dmaHandle->channel, INTA, channelMask);
+        DMA_COMMON_REG_SET(handle->dmaHandle->base, handle->dmaHandle->channel, INTB, channelMask);
+    }
+
+    transfer = handle->head;
+    while (transfer != NULL)
+    {
+        transfer->queued = false;
+        transfer         = transfer->next;
+    }
+    handle->head       = NULL;
+    handle->tail       = NULL;
+    handle->pending    = NULL;
+    handle->waiting    = NULL;
+    handle->lastLinked = NULL;
+    handle->linked     = 0U;
+    handle->poolFirst  = 0U;
+    handle->poolUsed   = 0U;
+
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Gets the throughput counters of the queue.
+ *
+ * param handle pointer to dma_queue_handle_t structure.
+ * param counters pointer to the structure the counters are copied to.
+ */
+void DMA_QueueGetCounters(dma_queue_handle_t *handle, dma_queue_counters_t *counters)
+{
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+    assert(counters != NULL);
+
+    regPrimask = DisableGlobalIRQ();
+    *counters  = handle->counters;
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Resets the throughput counters of the queue.
+ *
+ * param handle pointer to dma_queue_handle_t structure.
+ */
+void DMA_QueueResetCounters(dma_queue_handle_t *handle)
+{
+    uint32_t regPrimask;
+
+    assert(handle != NULL);
+
+    regPrimask = DisableGlobalIRQ();
+    (void)memset(&handle->counters, 0, sizeof(handle->counters));
+    handle->counters.peakDescriptors = handle->poolUsed;
+    EnableGlobalIRQ(regPrimask);
+}
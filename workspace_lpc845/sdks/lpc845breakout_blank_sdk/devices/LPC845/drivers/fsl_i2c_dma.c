@@ -71,6 +71,9 @@ static status_t I2C_InitTransferStateMachineDMA(I2C_Type *base,
 /*<! Private handle only used for internally. */
 static i2c_master_dma_private_handle_t s_dmaPrivateHandle[FSL_FEATURE_SOC_I2C_COUNT];
 
+/*<! Written to MSTCTL by the last descriptor of a scatter-gather DMA phase, clears MSTDMA. */
+static uint32_t s_i2cDmaPhaseEnd = 0U;
+
 /*******************************************************************************
  * Codes
  ******************************************************************************/
@@ -408,6 +411,377 @@ static status_t I2C_RunTransferStateMachineDMA(I2C_Type *base, i2c_master_dma_ha
     return err;
 }
 
+/*!
+ * @brief Finds the run of segments starting at a segment, which is the segments continuing it without start condition.
+ *
+ * @param segments segment list.
+ * @param segmentCount number of segments.
+ * @param first first segment of the run.
+ * @param[out] runBytes number of data bytes of the run.
+ * @return Index of the segment after the run.
+ */
+static uint32_t I2C_GetSegmentRunDMA(i2c_master_transfer_t *segments,
+                                     uint32_t segmentCount,
+                                     uint32_t first,
+                                     size_t *runBytes)
+{
+    uint32_t end = first;
+    size_t bytes = 0U;
+
+    do
+    {
+        bytes += segments[end].dataSize;
+        end++;
+    } while ((end < segmentCount) && ((segments[end].flags & (uint32_t)kI2C_TransferNoStartFlag) != 0U));
+
+    *runBytes = bytes;
+    return end;
+}
+
+/*!
+ * @brief Adds the pieces of one buffer to a scatter-gather DMA phase.
+ *
+ * The first piece of the phase is set up in the channel descriptor and piece n in link descriptor n - 1, each piece
+ * linking to the next link descriptor.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_master_dma_handle_t structure, NULL to only count the pieces.
+ * @param pieceCount number of pieces already in the phase.
+ * @param buf buffer.
+ * @param size buffer size in bytes.
+ * @param direction kI2C_Write to send the buffer, kI2C_Read to receive it.
+ * @return Number of pieces in the phase with those of the buffer.
+ */
+static uint32_t I2C_AddPhaseBufferDMA(I2C_Type *base,
+                                      i2c_master_dma_handle_t *handle,
+                                      uint32_t pieceCount,
+                                      uint8_t *buf,
+                                      size_t size,
+                                      i2c_direction_t direction)
+{
+    dma_channel_config_t transferConfig;
+    void *mstdat = (void *)&base->MSTDAT;
+    bool isWrite = (direction == kI2C_Write);
+    uint32_t length;
+    uint32_t xferCfg;
+
+    while (size != 0U)
+    {
+        length = MIN(size, I2C_MAX_DMA_TRANSFER_COUNT);
+
+        if (handle != NULL)
+        {
+            xferCfg = DMA_CHANNEL_XFER(true, false, false, false, sizeof(uint8_t),
+                                       isWrite ? kDMA_AddressInterleave1xWidth : kDMA_AddressInterleave0xWidth,
+                                       isWrite ? kDMA_AddressInterleave0xWidth : kDMA_AddressInterleave1xWidth, length);
+            if (pieceCount == 0U)
+            {
+                DMA_PrepareChannelTransfer(&transferConfig, isWrite ? (void *)buf : mstdat,
+                                           isWrite ? mstdat : (void *)buf, xferCfg,
+                                           isWrite ? kDMA_MemoryToPeripheral : kDMA_PeripheralToMemory, NULL,
+                                           &handle->descriptors[0]);
+                (void)DMA_SubmitChannelTransfer(handle->dmaHandle, &transferConfig);
+            }
+            else
+            {
+                DMA_SetupDescriptor(&handle->descriptors[pieceCount - 1U], xferCfg, isWrite ? (void *)buf : mstdat,
+                                    isWrite ? mstdat : (void *)buf, &handle->descriptors[pieceCount]);
+            }
+        }
+
+        pieceCount++;
+        buf += length;
+        size -= length;
+    }
+
+    return pieceCount;
+}
+
+/*!
+ * @brief Sets up and starts a scatter-gather DMA phase, or counts the link descriptors it needs.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_master_dma_handle_t structure.
+ * @param segments segment list.
+ * @param first first segment of the run.
+ * @param end segment after the run.
+ * @param subaddrSize number of subaddress bytes to send first, from the subaddress buffer of the handle.
+ * @param dataBytes number of data bytes of the run to move after the subaddress.
+ * @param setup true to set up and start the phase, false to only count.
+ * @return Number of link descriptors the phase needs.
+ */
+static uint32_t I2C_RunPhaseDMA(I2C_Type *base,
+                                i2c_master_dma_handle_t *handle,
+                                i2c_master_transfer_t *segments,
+                                uint32_t first,
+                                uint32_t end,
+                                size_t subaddrSize,
+                                size_t dataBytes,
+                                bool setup)
+{
+    i2c_master_dma_handle_t *setupHandle = setup ? handle : NULL;
+    uint32_t pieceCount;
+    size_t length;
+    uint32_t i;
+
+    pieceCount = I2C_AddPhaseBufferDMA(base, setupHandle, 0U, handle->subaddrBuf, subaddrSize, kI2C_Write);
+
+    for (i = first; (i < end) && (dataBytes != 0U); i++)
+    {
+        length     = MIN(segments[i].dataSize, dataBytes);
+        pieceCount = I2C_AddPhaseBufferDMA(base, setupHandle, pieceCount, (uint8_t *)segments[i].data, length,
+                                           segments[first].direction);
+        dataBytes -= length;
+    }
+
+    if (setup)
+    {
+        /* The last descriptor runs on the request that follows the last byte and clears MSTDMA, which hands the
+         * bus back to the I2C interrupt without a DMA interrupt. */
+        DMA_SetupDescriptor(&handle->descriptors[pieceCount - 1U],
+                            DMA_CHANNEL_XFER(false, true, false, false, sizeof(uint32_t),
+                                             kDMA_AddressInterleave0xWidth, kDMA_AddressInterleave0xWidth,
+                                             sizeof(uint32_t)),
+                            &s_i2cDmaPhaseEnd, (void *)&base->MSTCTL, NULL);
+        DMA_StartTransfer(handle->dmaHandle);
+    }
+
+    return pieceCount;
+}
+
+/*!
+ * @brief Sends the address and starts the data of the run of segments in progress.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_master_dma_handle_t structure.
+ * @param end segment after the run.
+ * @param runBytes number of data bytes of the run.
+ */
+static void I2C_StartRunDataDMA(I2C_Type *base, i2c_master_dma_handle_t *handle, uint32_t end, size_t runBytes)
+{
+    i2c_master_transfer_t *segment = &handle->segments[handle->segmentIndex];
+    uint32_t control               = I2C_MSTCTL_MSTSTART_MASK;
+    size_t dmaBytes;
+
+    if (segment->direction == kI2C_Write)
+    {
+        base->MSTDAT  = (uint32_t)segment->slaveAddress << 1;
+        dmaBytes      = runBytes;
+        handle->state = (uint8_t)kStopState;
+    }
+    else
+    {
+        base->MSTDAT = ((uint32_t)segment->slaveAddress << 1) | 1u;
+        /* The very last byte is always received by means of SW */
+        dmaBytes      = runBytes - 1U;
+        handle->state = (uint8_t)kReceiveLastDataState;
+    }
+
+    if (dmaBytes != 0U)
+    {
+        (void)I2C_RunPhaseDMA(base, handle, handle->segments, handle->segmentIndex, end, 0U, dmaBytes, true);
+        control |= I2C_MSTCTL_MSTDMA_MASK;
+    }
+
+    base->MSTCTL = control;
+}
+
+/*!
+ * @brief Starts the run of segments at the current segment, with a start or repeated start condition.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_master_dma_handle_t structure.
+ */
+static void I2C_StartRunDMA(I2C_Type *base, i2c_master_dma_handle_t *handle)
+{
+    i2c_master_transfer_t *segment = &handle->segments[handle->segmentIndex];
+    uint32_t subaddress;
+    size_t runBytes;
+    uint32_t end;
+    int i;
+
+    end = I2C_GetSegmentRunDMA(handle->segments, handle->segmentCount, handle->segmentIndex, &runBytes);
+
+    if (segment->subaddressSize == 0U)
+    {
+        I2C_StartRunDataDMA(base, handle, end, runBytes);
+        return;
+    }
+
+    /* Prepare subaddress transmit buffer, most significant byte is stored at the lowest address */
+    subaddress = segment->subaddress;
+    for (i = (int)segment->subaddressSize - 1; i >= 0; i--)
+    {
+        handle->subaddrBuf[i] = (uint8_t)subaddress & 0xffU;
+        subaddress >>= 8;
+    }
+
+    /* The data of a write follows the subaddress in the same DMA phase, a read needs a repeated start first. */
+    base->MSTDAT = (uint32_t)segment->slaveAddress << 1;
+    (void)I2C_RunPhaseDMA(base, handle, handle->segments, handle->segmentIndex, end, segment->subaddressSize,
+                          (segment->direction == kI2C_Write) ? runBytes : 0U, true);
+    base->MSTCTL  = I2C_MSTCTL_MSTSTART_MASK | I2C_MSTCTL_MSTDMA_MASK;
+    handle->state = (segment->direction == kI2C_Read) ? (uint8_t)kTransmitSubaddrState : (uint8_t)kStopState;
+}
+
+/*!
+ * @brief Ends the run of segments in progress and goes on with the next one.
+ *
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_master_dma_handle_t structure.
+ * @param end segment after the run.
+ * @param runBytes number of data bytes of the run.
+ * @param[out] isDone Set to true if the last segment has completed.
+ */
+static void I2C_EndRunDMA(I2C_Type *base, i2c_master_dma_handle_t *handle, uint32_t end, size_t runBytes, bool *isDone)
+{
+    bool noStop = ((handle->segments[end - 1U].flags & (uint32_t)kI2C_TransferNoStopFlag) != 0U);
+
+    handle->transferCount += (uint32_t)runBytes;
+    handle->segmentIndex = end;
+
+    if (!noStop)
+    {
+        /* Send stop condition, the next run starts once the bus is idle */
+        base->MSTCTL  = I2C_MSTCTL_MSTSTOP_MASK;
+        handle->state = (uint8_t)kWaitForCompletionState;
+    }
+    else if (end < handle->segmentCount)
+    {
+        /* Repeated start right away, it also leaves the last byte of a read not acknowledged */
+        I2C_StartRunDMA(base, handle);
+    }
+    else
+    {
+        /* Stop condition is omitted, we are done */
+        *isDone       = true;
+        handle->state = (uint8_t)kIdleState;
+    }
+}
+
+/*!
+ * @brief Execute the protocol steps of a scatter-gather transfer, the data is moved by DMA.
+ * @param base I2C peripheral base address.
+ * @param handle pointer to i2c_master_dma_handle_t structure.
+ * @param[out] isDone Set to true if the transfer has completed.
+ * @retval #kStatus_Success
+ * @retval #kStatus_I2C_ArbitrationLost
+ * @retval #kStatus_I2C_Nak
+ */
+static status_t I2C_RunScatterGatherDMA(I2C_Type *base, i2c_master_dma_handle_t *handle, bool *isDone)
+{
+    i2c_master_transfer_t *segment;
+    uint32_t status;
+    uint32_t master_state;
+    size_t runBytes;
+    uint32_t end;
+    uint32_t i;
+    status_t err = kStatus_Success;
+
+    *isDone = false;
+
+    status = I2C_GetStatusFlags(base);
+
+    if ((status & I2C_STAT_MSTARBLOSS_MASK) != 0U)
+    {
+        I2C_MasterClearStatusFlags(base, I2C_STAT_MSTARBLOSS_MASK);
+        DMA_AbortTransfer(handle->dmaHandle);
+        base->MSTCTL = 0;
+        return kStatus_I2C_ArbitrationLost;
+    }
+
+    if ((status & I2C_STAT_MSTSTSTPERR_MASK) != 0U)
+    {
+        I2C_MasterClearStatusFlags(base, I2C_STAT_MSTSTSTPERR_MASK);
+        DMA_AbortTransfer(handle->dmaHandle);
+        base->MSTCTL = 0;
+        return kStatus_I2C_StartStopError;
+    }
+
+    if ((status & I2C_STAT_MSTPENDING_MASK) == 0U)
+    {
+        return kStatus_I2C_Busy;
+    }
+
+    /* Get the state of the I2C module */
+    master_state = (status & I2C_STAT_MSTSTATE_MASK) >> (uint32_t)I2C_STAT_MSTSTATE_SHIFT;
+
+    if ((master_state == I2C_STAT_MSTCODE_NACKADR) || (master_state == I2C_STAT_MSTCODE_NACKDAT))
+    {
+        /* Slave NACKed last byte, issue stop and return error */
+        DMA_AbortTransfer(handle->dmaHandle);
+        base->MSTCTL  = I2C_MSTCTL_MSTSTOP_MASK;
+        handle->state = (uint8_t)kWaitForCompletionState;
+        return kStatus_I2C_Nak;
+    }
+
+    switch (handle->state)
+    {
+        case (uint8_t)kStartState:
+            I2C_StartRunDMA(base, handle);
+            break;
+
+        case (uint8_t)kTransmitSubaddrState:
+            if (master_state != (uint32_t)I2C_STAT_MSTCODE_TXREADY)
+            {
+                return kStatus_I2C_UnexpectedState;
+            }
+
+            /* Subaddress sent, repeated start to read */
+            end = I2C_GetSegmentRunDMA(handle->segments, handle->segmentCount, handle->segmentIndex, &runBytes);
+            I2C_StartRunDataDMA(base, handle, end, runBytes);
+            break;
+
+        case (uint8_t)kReceiveLastDataState:
+            if (master_state != (uint32_t)I2C_STAT_MSTCODE_RXREADY)
+            {
+                return kStatus_I2C_UnexpectedState;
+            }
+
+            /* The last byte goes to the last segment of the run with data */
+            end = I2C_GetSegmentRunDMA(handle->segments, handle->segmentCount, handle->segmentIndex, &runBytes);
+            i   = end;
+            do
+            {
+                i--;
+                segment = &handle->segments[i];
+            } while (segment->dataSize == 0U);
+            ((uint8_t *)segment->data)[segment->dataSize - 1U] = (uint8_t)base->MSTDAT;
+
+            I2C_EndRunDMA(base, handle, end, runBytes, isDone);
+            break;
+
+        case (uint8_t)kStopState:
+            if (master_state != (uint32_t)I2C_STAT_MSTCODE_TXREADY)
+            {
+                return kStatus_I2C_UnexpectedState;
+            }
+
+            end = I2C_GetSegmentRunDMA(handle->segments, handle->segmentCount, handle->segmentIndex, &runBytes);
+            I2C_EndRunDMA(base, handle, end, runBytes, isDone);
+            break;
+
+        case (uint8_t)kWaitForCompletionState:
+            if (handle->segmentIndex < handle->segmentCount)
+            {
+                /* Bus idle after the stop condition, start the next run */
+                I2C_StartRunDMA(base, handle);
+                break;
+            }
+            *isDone       = true;
+            handle->state = (uint8_t)kIdleState;
+            break;
+
+        case (uint8_t)kIdleState:
+        default:
+            /* State machine shall not be invoked again once it enters the idle state */
+            err = kStatus_I2C_UnexpectedState;
+            break;
+    }
+
+    return err;
+}
+
 void I2C_MasterTransferDMAHandleIRQ(I2C_Type *base, void *i2cHandle)
 {
     assert(i2cHandle != NULL);
@@ -422,12 +796,20 @@ void I2C_MasterTransferDMAHandleIRQ(I2C_Type *base, void *i2cHandle)
         return;
     }
 
-    result = I2C_RunTransferStateMachineDMA(base, handle, &isDone);
+    if (handle->segments != NULL)
+    {
+        result = I2C_RunScatterGatherDMA(base, handle, &isDone);
+    }
+    else
+    {
+        result = I2C_RunTransferStateMachineDMA(base, handle, &isDone);
+    }
 
     if ((result != kStatus_Success) || isDone)
     {
         /* Restore handle to idle state. */
-        handle->state = (uint8_t)kIdleState;
+        handle->state    = (uint8_t)kIdleState;
+        handle->segments = NULL;
 
         /* Disable internal IRQ enables. */
         I2C_DisableInterrupts(base,
@@ -544,6 +926,124 @@ status_t I2C_MasterTransferDMA(I2C_Type *base, i2c_master_dma_handle_t *handle,
     return result;
 }
 
+/*!
+ * brief Performs a list of master transfers on the I2C bus with DMA, as one non-blocking transfer
+ *
+ * Reads several non-contiguous register blocks of a device, or writes and reads across devices, with one completion
+ * callback for the whole list. Each segment is an i2c_master_transfer_t:
+ * - Without flags, a segment starts with a start condition and ends with a stop condition.
+ * - With kI2C_TransferNoStopFlag on the last segment of a bus transfer, the next segment starts with a repeated
+ *   start instead, so the bus is kept.
+ * - With kI2C_TransferNoStartFlag, a segment continues the data of the previous one in the same direction, without
+ *   start condition, address or subaddress, which gathers or scatters one bus transfer over several buffers.
+ *
+ * The start, address and stop conditions must be driven by software, so the I2C interrupt runs them, directly from
+ * one segment to the next. All data, including the subaddresses, is moved by linked DMA descriptors that end by
+ * handing the bus back to the I2C interrupt, without DMA interrupts. A register block read ending with
+ * kI2C_TransferNoStopFlag costs two I2C interrupts.
+ *
+ * A DMA phase moves the subaddress and the data of a write, the subaddress of a read, or the data of a read but its
+ * last byte, each with the data of the segments continuing it. It needs one link descriptor for each piece of up to
+ * I2C_MAX_DMA_TRANSFER_COUNT bytes of each of its buffers, so a list of register block reads of up to
+ * I2C_MAX_DMA_TRANSFER_COUNT + 1 bytes each needs one.
+ *
+ * param base I2C peripheral base address
+ * param handle pointer to i2c_master_dma_handle_t structure
+ * param segments pointer to the segment list, which must stay valid until the callback
+ * param segmentCount number of segments
+ * param descriptors link descriptors, allocated with DMA_ALLOCATE_LINK_DESCRIPTORS()
+ * param descriptorCount number of link descriptors, enough for the largest DMA phase
+ * retval kStatus_Success Transfer started.
+ * retval kStatus_I2C_Busy Previous transmission still not finished.
+ * retval kStatus_InvalidArgument Invalid segment list, or not enough link descriptors for it.
+ */
+status_t I2C_MasterTransferScatterGatherDMA(I2C_Type *base,
+                                            i2c_master_dma_handle_t *handle,
+                                            i2c_master_transfer_t *segments,
+                                            uint32_t segmentCount,
+                                            dma_descriptor_t *descriptors,
+                                            uint32_t descriptorCount)
+{
+    i2c_master_transfer_t *segment;
+    uint32_t first;
+    uint32_t end;
+    uint32_t i;
+    size_t runBytes;
+    uint32_t needed;
+
+    assert(handle != NULL);
+    assert(segments != NULL);
+    assert((((uint32_t)(uint32_t *)descriptors) & ((uint32_t)FSL_FEATURE_DMA_LINK_DESCRIPTOR_ALIGN_SIZE - 1UL)) == 0UL);
+
+    /* Return busy if another transaction is in progress. */
+    if (handle->state != (uint8_t)kIdleState)
+    {
+        return kStatus_I2C_Busy;
+    }
+
+    if (segmentCount == 0U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Check the segment list and the link descriptors it needs before touching the bus. */
+    for (first = 0U; first < segmentCount; first = end)
+    {
+        segment = &segments[first];
+        if (((segment->flags & (uint32_t)kI2C_TransferNoStartFlag) != 0U) ||
+            (segment->subaddressSize > sizeof(segment->subaddress)))
+        {
+            return kStatus_InvalidArgument;
+        }
+
+        end = I2C_GetSegmentRunDMA(segments, segmentCount, first, &runBytes);
+        for (i = first + 1U; i < end; i++)
+        {
+            if (segments[i].direction != segment->direction)
+            {
+                return kStatus_InvalidArgument;
+            }
+        }
+
+        if (segment->direction == kI2C_Write)
+        {
+            needed = I2C_RunPhaseDMA(base, handle, segments, first, end, segment->subaddressSize, runBytes, false);
+        }
+        else
+        {
+            /* A read needs at least the last byte, received by means of SW */
+            if (runBytes == 0U)
+            {
+                return kStatus_InvalidArgument;
+            }
+            needed = MAX(I2C_RunPhaseDMA(base, handle, segments, first, end, segment->subaddressSize, 0U, false),
+                         I2C_RunPhaseDMA(base, handle, segments, first, end, 0U, runBytes - 1U, false));
+        }
+
+        if (needed > descriptorCount)
+        {
+            return kStatus_InvalidArgument;
+        }
+    }
+
+    handle->segments        = segments;
+    handle->segmentCount    = segmentCount;
+    handle->segmentIndex    = 0U;
+    handle->descriptors     = descriptors;
+    handle->descriptorCount = descriptorCount;
+    handle->transferCount   = 0U;
+    handle->state           = (uint8_t)kStartState;
+
+    /* Clear error flags. */
+    I2C_MasterClearStatusFlags(base, I2C_STAT_MSTARBLOSS_MASK | I2C_STAT_MSTSTSTPERR_MASK);
+
+    /* Enable I2C internal IRQ sources, the first segment starts from the interrupt of the idle bus */
+    I2C_EnableInterrupts(base,
+                         I2C_INTSTAT_MSTARBLOSS_MASK | I2C_INTSTAT_MSTSTSTPERR_MASK | I2C_INTSTAT_MSTPENDING_MASK);
+
+    return kStatus_Success;
+}
+
 /*!
  * brief Get master transfer status during a dma non-blocking transfer
  *
@@ -622,6 +1122,7 @@ void I2C_MasterTransferAbortDMA(I2C_Type *base, i2c_master_dma_handle_t *handle)
         }
 
         /* Reset the state to idle. */
-        handle->state = (uint8_t)kIdleState;
+        handle->state    = (uint8_t)kIdleState;
+        handle->segments = NULL;
     }
 }
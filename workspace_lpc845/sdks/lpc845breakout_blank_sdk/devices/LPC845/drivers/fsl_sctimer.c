@@ -451,6 +451,96 @@ void SCTIMER_UpdatePwmDutycycle(SCT_Type *base, sctimer_out_t output, uint8_t du
     SCTIMER_StartTimer(base, (uint32_t)kSCTIMER_Counter_U);
 }
 
+/*!
+ * brief Gets the precomputed state of a PWM signal for the duty cycle update functions below.
+ *
+ * SCTIMER_UpdatePwmDutycycle() stops the counter, computes the pulse width with a 64-bit division
+ * and restarts the counter on every call, which disturbs the waveform. The functions below instead
+ * only write the match reload register of the pulse, with the period read once by this function.
+ * The counter keeps running and the new pulse width takes effect at the next period boundary, when
+ * the SCTimer reloads its match registers, so every period is either entirely old or entirely new.
+ *
+ * param base    SCTimer peripheral base address
+ * param event   Event number associated with the PWM signal. This was returned to the user by the
+ *               function SCTIMER_SetupPwm().
+ * param channel Pointer to the structure to fill in
+ */
+void SCTIMER_GetPwmChannel(SCT_Type *base, uint32_t event, sctimer_pwm_channel_t *channel)
+{
+    assert(NULL != channel);
+    assert((event + 1U) < (uint32_t)FSL_FEATURE_SCT_NUMBER_OF_EVENTS);
+    assert(1U == (base->CONFIG & SCT_CONFIG_UNIFY_MASK));
+
+    /* SCTIMER_SetupPwm() creates the pulse event right after the period event */
+    channel->period        = base->MATCHREL[base->EV[event].CTRL & SCT_EV_CTRL_MATCHSEL_MASK];
+    channel->pulseMatchReg = base->EV[event + 1U].CTRL & SCT_EV_CTRL_MATCHSEL_MASK;
+}
+
+/*!
+ * brief Updates the duty cycles of several running PWM signals at the same period boundary.
+ *
+ * Match reloads are held off while the registers are written, so all the signals change in the same
+ * period even if a period boundary passes during the call. The counter is not stopped.
+ *
+ * note CONFIG is read, modified and written, so this function must not be called at the same time
+ * as other functions that change the SCTimer configuration.
+ *
+ * param base      SCTimer peripheral base address
+ * param channels  Array of PWM signals, see SCTIMER_GetPwmChannel()
+ * param dutyTicks Array of duty cycles in counter ticks, one for each signal
+ * param count     Number of signals to update
+ */
+void SCTIMER_UpdatePwmDutyTicks(SCT_Type *base,
+                                const sctimer_pwm_channel_t *channels,
+                                const uint32_t *dutyTicks,
+                                uint32_t count)
+{
+    assert(NULL != channels);
+    assert(NULL != dutyTicks);
+
+    uint32_t i;
+
+    base->CONFIG |= SCT_CONFIG_NORELOAD_L_MASK;
+
+    for (i = 0U; i < count; i++)
+    {
+        base->MATCHREL[channels[i].pulseMatchReg] = SCTIMER_GetPwmPulseMatch(&channels[i], dutyTicks[i]);
+    }
+
+    base->CONFIG &= ~SCT_CONFIG_NORELOAD_L_MASK;
+}
+
+/*!
+ * brief Updates the duty cycles of several running PWM signals at the same period boundary, in Q16.
+ *
+ * Same as SCTIMER_UpdatePwmDutyTicks() with the duty cycles given in Q16.
+ *
+ * param base     SCTimer peripheral base address
+ * param channels Array of PWM signals, see SCTIMER_GetPwmChannel()
+ * param dutyQ16  Array of duty cycles, 0 for 0% to SCTIMER_PWM_DUTY_Q16_MAX for 100%, one for each signal
+ * param count    Number of signals to update
+ */
+void SCTIMER_UpdatePwmDutyQ16(SCT_Type *base,
+                              const sctimer_pwm_channel_t *channels,
+                              const uint32_t *dutyQ16,
+                              uint32_t count)
+{
+    assert(NULL != channels);
+    assert(NULL != dutyQ16);
+
+    uint32_t i;
+
+    base->CONFIG |= SCT_CONFIG_NORELOAD_L_MASK;
+
+    for (i = 0U; i < count; i++)
+    {
+        base->MATCHREL[channels[i].pulseMatchReg] =
+            SCTIMER_GetPwmPulseMatch(&channels[i], SCTIMER_PwmDutyQ16ToTicks(&channels[i], dutyQ16[i]));
+    }
+
+    base->CONFIG &= ~SCT_CONFIG_NORELOAD_L_MASK;
+}
+
 /*!
  * brief Create an event that is triggered on a match or IO and schedule in current state.
  *
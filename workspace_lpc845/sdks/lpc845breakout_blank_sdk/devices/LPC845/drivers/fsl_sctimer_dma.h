@@ -0,0 +1,203 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_SCTIMER_DMA_H_
+#define FSL_SCTIMER_DMA_H_
+
+#include "fsl_sctimer.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup sctimer_dma_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief SCTimer DMA driver version. */
+#define FSL_SCTIMER_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*! @brief Number of descriptors needed to play @p count values with single DMA descriptors. */
+#define SCTIMER_DMA_PIECE_COUNT(count) (((count) + DMA_MAX_TRANSFER_COUNT - 1U) / DMA_MAX_TRANSFER_COUNT)
+
+/*!
+ * @brief Number of link descriptors needed by a sequence of @p count values played in @p mode.
+ *
+ * Use it to size the descriptor memory given to SCTIMER_SequenceCreateHandleDMA(), for example
+ * DMA_ALLOCATE_LINK_DESCRIPTORS(s_ledDescriptors, SCTIMER_DMA_LINK_DESCRIPTOR_COUNT(LED_BITS, kSCTIMER_DmaOneShot)).
+ */
+#define SCTIMER_DMA_LINK_DESCRIPTOR_COUNT(count, mode)                                                          \
+    (((mode) == kSCTIMER_DmaPingPong) ? (2U * SCTIMER_DMA_PIECE_COUNT((count) / 2U)) : SCTIMER_DMA_PIECE_COUNT(count))
+
+/*! @brief SCTimer DMA request lines, each can be routed to DMA channels through INPUTMUX. */
+typedef enum _sctimer_dma_request
+{
+    kSCTIMER_DmaRequest0 = 0U, /*!< DMA request 0, INPUTMUX signal kINPUTMUX_SctDma0ToDma */
+    kSCTIMER_DmaRequest1,      /*!< DMA request 1, INPUTMUX signal kINPUTMUX_SctDma1ToDma */
+} sctimer_dma_request_t;
+
+/*! @brief Playback modes of a sequence. */
+typedef enum _sctimer_dma_mode
+{
+    kSCTIMER_DmaOneShot = 0U, /*!< Play the values once. The last value stays in effect afterwards. */
+    kSCTIMER_DmaLoop,         /*!< Play the values over and over until the sequence is aborted. */
+    kSCTIMER_DmaPingPong,     /*!< As kSCTIMER_DmaLoop, the callback reports each half played so it can be refilled. */
+} sctimer_dma_mode_t;
+
+/*! @brief SCTimer DMA handle typedef. */
+typedef struct _sctimer_dma_handle sctimer_dma_handle_t;
+
+/*!
+ * @brief SCTimer DMA callback typedef.
+ *
+ * Invoked from the DMA interrupt:
+ * - kSCTIMER_DmaOneShot: once, when the last value has been written.
+ * - kSCTIMER_DmaLoop: each time the last value has been written.
+ * - kSCTIMER_DmaPingPong: each time the last value of a half has been written, @p block is 0 for the first half
+ *   and 1 for the second. The DMA plays the other half meanwhile, so the half must be refilled before that one
+ *   ends.
+ * - On a DMA error, with @p status kStatus_Fail, after the sequence has been aborted.
+ */
+typedef void (*sctimer_dma_callback_t)(
+    SCT_Type *base, sctimer_dma_handle_t *handle, status_t status, uint32_t block, void *userData);
+
+/*! @brief SCTimer DMA sequence. */
+typedef struct _sctimer_dma_sequence
+{
+    uint32_t matchReg;       /*!< Match register reloaded with the values, for a PWM signal the pulseMatchReg
+                                  member of sctimer_pwm_channel_t, see SCTIMER_GetPwmChannel(). */
+    const uint32_t *values;  /*!< Match reload values, one for each period. Must stay valid while the sequence
+                                  plays. */
+    uint32_t count;          /*!< Number of values, even in kSCTIMER_DmaPingPong mode. */
+    sctimer_dma_mode_t mode; /*!< Playback mode. */
+} sctimer_dma_sequence_t;
+
+/*! @brief SCTimer DMA handle structure. */
+struct _sctimer_dma_handle
+{
+    SCT_Type *base;                  /*!< SCTimer peripheral base address. */
+    dma_handle_t *dmaHandle;         /*!< The DMA handler used. */
+    dma_descriptor_t *descriptors;   /*!< Link descriptors of the sequence. */
+    uint32_t descriptorCount;        /*!< Number of link descriptors. */
+    sctimer_dma_mode_t mode;         /*!< Playback mode of the current sequence. */
+    volatile bool busy;              /*!< Sequence playing flag, see SCTIMER_SequenceIsBusyDMA(). */
+    sctimer_dma_callback_t callback; /*!< Callback function. */
+    void *userData;                  /*!< Callback parameter passed to callback function. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*_cplusplus. */
+
+/*!
+ * @name SCTimer DMA Sequence Operation
+ * @{
+ */
+
+/*!
+ * @brief Init the SCTimer handle which is used to play a sequence of match values on one output.
+ *
+ * A sequence writes one match reload register, so an output that changes every period, such as a WS2812 data line,
+ * a micro-stepping profile or an IR carrier burst, needs one handle and one DMA channel. The DMA channel must be
+ * routed to the SCTimer DMA request by the application, for example with
+ * INPUTMUX_AttachSignal(INPUTMUX, channel, kINPUTMUX_SctDma0ToDma). Several channels can be routed to the same
+ * request to play sequences on several outputs in step.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param handle pointer to sctimer_dma_handle_t structure.
+ * @param callback pointer to user callback function, NULL to run without interrupts.
+ * @param userData user param passed to the callback function.
+ * @param dmaHandle DMA handle pointer.
+ * @param descriptors Link descriptors, allocated with DMA_ALLOCATE_LINK_DESCRIPTORS().
+ * @param descriptorCount Number of link descriptors, see SCTIMER_DMA_LINK_DESCRIPTOR_COUNT().
+ */
+void SCTIMER_SequenceCreateHandleDMA(SCT_Type *base,
+                                     sctimer_dma_handle_t *handle,
+                                     sctimer_dma_callback_t callback,
+                                     void *userData,
+                                     dma_handle_t *dmaHandle,
+                                     dma_descriptor_t *descriptors,
+                                     uint32_t descriptorCount);
+
+/*!
+ * @brief Arms a sequence of match reload values.
+ *
+ * The values are split into pieces of up to DMA_MAX_TRANSFER_COUNT values, one for each link descriptor, and the
+ * descriptors are linked so that the DMA moves one value for each SCTimer DMA request without CPU intervention, the
+ * last descriptor linking back to the first in the repeating modes. The sequence starts with the next request after
+ * SCTIMER_StartSequenceDMA().
+ *
+ * A value written on a period event is loaded into the match register at the end of that period, so each value
+ * is in effect for the period after the one it was written in.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param handle pointer to sctimer_dma_handle_t structure.
+ * @param sequence pointer to the sequence to play.
+ * @retval kStatus_Success Sequence armed.
+ * @retval kStatus_InvalidArgument Invalid values, or not enough link descriptors for them.
+ * @retval kStatus_Busy A sequence is already playing on this handle, see SCTIMER_SequenceIsBusyDMA().
+ */
+status_t SCTIMER_SequenceSubmitDMA(SCT_Type *base, sctimer_dma_handle_t *handle, const sctimer_dma_sequence_t *sequence);
+
+/*!
+ * @brief Aborts a sequence.
+ *
+ * The match reload register keeps the last value written.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param handle pointer to sctimer_dma_handle_t structure.
+ */
+void SCTIMER_SequenceAbortDMA(SCT_Type *base, sctimer_dma_handle_t *handle);
+
+/*!
+ * @brief Tells whether a sequence is playing on the handle.
+ *
+ * With a callback the end of a one-shot sequence is reported by its interrupt. Without one the DMA channel is
+ * asked instead: the sequence has ended once the channel is no longer active and its last descriptor is used up.
+ * Repeating sequences play until they are aborted.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param handle pointer to sctimer_dma_handle_t structure.
+ * @return True while a sequence is playing or armed, false otherwise.
+ */
+bool SCTIMER_SequenceIsBusyDMA(SCT_Type *base, sctimer_dma_handle_t *handle);
+
+/*!
+ * @brief Starts the sequences armed on a DMA request.
+ *
+ * Makes @p event raise the DMA request, normally the period event returned by SCTIMER_SetupPwm(), so that every
+ * armed sequence routed to the request moves its next value on each period. Sequences armed on the same request
+ * start in the same period.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param request DMA request line the DMA channels are routed to.
+ * @param event Event raising the request.
+ */
+void SCTIMER_StartSequenceDMA(SCT_Type *base, sctimer_dma_request_t request, uint32_t event);
+
+/*!
+ * @brief Stops raising a DMA request, which pauses the sequences routed to it.
+ *
+ * @param base SCTimer peripheral base address.
+ * @param request DMA request line.
+ */
+void SCTIMER_StopSequenceDMA(SCT_Type *base, sctimer_dma_request_t request);
+
+/*! @} */
+#if defined(__cplusplus)
+}
+#endif /*_cplusplus. */
+/*! @} */
+#endif /*FSL_SCTIMER_DMA_H_*/
@@ -0,0 +1,275 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef FSL_USART_DMA_H_
+#define FSL_USART_DMA_H_
+
+#include "fsl_usart.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup usart_dma_driver
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*! @{ */
+/*! @brief USART DMA driver version. */
+#define FSL_USART_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*! @} */
+
+/*! @brief Maximum length of single DMA transfer (determined by capability of the DMA engine) */
+#define USART_MAX_DMA_TRANSFER_COUNT DMA_MAX_TRANSFER_COUNT
+
+/*!
+ * @brief Maximum size of the DMA RX ring buffer.
+ *
+ * The ring is filled by two linked descriptors of half the ring size each. A half is kept below the DMA transfer
+ * limit so that the remaining count of the active descriptor is never ambiguous.
+ */
+#define USART_DMA_MAX_RING_BUFFER_SIZE (2U * (DMA_MAX_TRANSFER_COUNT - 1U))
+
+/*! @brief USART DMA transfer status, numbered after the codes of the USART driver. */
+enum
+{
+    kStatus_USART_DMA_RxRingIdle = MAKE_STATUS(kStatusGroup_LPC_USART, 32), /*!< RX line idle with data in the ring. */
+};
+
+/* Forward declaration of the handle typedef. */
+typedef struct _usart_dma_handle usart_dma_handle_t;
+
+/*! @brief USART DMA transfer callback function. */
+typedef void (*usart_dma_transfer_callback_t)(USART_Type *base,
+                                              usart_dma_handle_t *handle,
+                                              status_t status,
+                                              void *userData);
+
+/*!
+ * @brief USART DMA handle structure.
+ */
+struct _usart_dma_handle
+{
+    USART_Type *base; /*!< USART peripheral base address. */
+
+    usart_dma_transfer_callback_t callback; /*!< Callback function. */
+    void *userData;                         /*!< USART callback function parameter.*/
+    size_t rxDataSizeAll;                   /*!< Size of the data to receive. */
+    size_t txDataSizeAll;                   /*!< Size of the data to send out. */
+
+    dma_handle_t *txDmaHandle; /*!< The DMA TX channel used. */
+    dma_handle_t *rxDmaHandle; /*!< The DMA RX channel used. */
+
+    uint8_t *rxRingBuffer;              /*!< Start address of the DMA RX ring buffer. */
+    size_t rxRingBufferSize;            /*!< Size of the DMA RX ring buffer. */
+    volatile uint32_t rxRingHalfCount;  /*!< Number of ring halves completed by the DMA, free running. */
+    volatile uint32_t rxRingReadCount;  /*!< Number of bytes consumed by the user, free running. */
+    volatile uint16_t rxRingBufferTail; /*!< Index for the user to get data from the ring buffer. */
+    uint32_t rxRingIdlePollCount;       /*!< Write count seen by the previous idle poll. */
+    uint32_t rxRingIdleFlushCount;      /*!< Write count reported by the previous idle flush. */
+
+    volatile uint8_t txState; /*!< TX transfer state. */
+    volatile uint8_t rxState; /*!< RX transfer state */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @name DMA transactional
+ * @{
+ */
+
+/*!
+ * @brief Initializes the USART handle which is used in transactional functions.
+ *
+ * The DMA channels must be the USART request channels of this instance, for example channel 0 (RX) and channel 1
+ * (TX) for USART0.
+ *
+ * @param base USART peripheral base address.
+ * @param handle Pointer to usart_dma_handle_t structure.
+ * @param callback Callback function.
+ * @param userData User data.
+ * @param txDmaHandle User-requested DMA handle for TX DMA transfer.
+ * @param rxDmaHandle User-requested DMA handle for RX DMA transfer.
+ * @retval kStatus_Success Handle initialized.
+ */
+status_t USART_TransferCreateHandleDMA(USART_Type *base,
+                                       usart_dma_handle_t *handle,
+                                       usart_dma_transfer_callback_t callback,
+                                       void *userData,
+                                       dma_handle_t *txDmaHandle,
+                                       dma_handle_t *rxDmaHandle);
+
+/*!
+ * @brief Sends data using DMA.
+ *
+ * This function sends data using DMA. This is a non-blocking function, which returns right away. When all data
+ * is written to the TX register, the callback is invoked with @ref kStatus_USART_TxIdle.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param xfer USART DMA transfer structure. See usart_transfer_t.
+ * @retval kStatus_Success if succeed, others failed.
+ * @retval kStatus_USART_TxBusy Previous transfer on going.
+ * @retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferSendDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer);
+
+/*!
+ * @brief Receives data using DMA.
+ *
+ * This function receives data using DMA. This is a non-blocking function, which returns right away. When all data
+ * is received, the callback is invoked with @ref kStatus_USART_RxIdle.
+ *
+ * @param base USART peripheral base address.
+ * @param handle Pointer to usart_dma_handle_t structure.
+ * @param xfer USART DMA transfer structure. See usart_transfer_t.
+ * @retval kStatus_Success if succeed, others failed.
+ * @retval kStatus_USART_RxBusy Previous transfer on going or the RX ring buffer is running.
+ * @retval kStatus_InvalidArgument Invalid argument.
+ */
+status_t USART_TransferReceiveDMA(USART_Type *base, usart_dma_handle_t *handle, usart_transfer_t *xfer);
+
+/*!
+ * @brief Aborts the sent data using DMA.
+ *
+ * This function aborts send data using DMA.
+ *
+ * @param base USART peripheral base address
+ * @param handle Pointer to usart_dma_handle_t structure
+ */
+void USART_TransferAbortSendDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*!
+ * @brief Aborts the received data using DMA.
+ *
+ * This function aborts the data receive using DMA.
+ *
+ * @param base USART peripheral base address
+ * @param handle Pointer to usart_dma_handle_t structure
+ */
+void USART_TransferAbortReceiveDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*!
+ * @brief Get the number of bytes that have been sent.
+ *
+ * This function gets the number of bytes that have been sent.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param count Sent bytes count.
+ * @retval kStatus_NoTransferInProgress No send in progress.
+ * @retval kStatus_InvalidArgument Parameter is invalid.
+ * @retval kStatus_Success Get successfully through the parameter \p count;
+ */
+status_t USART_TransferGetSendCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count);
+
+/*!
+ * @brief Get the number of bytes that have been received.
+ *
+ * This function gets the number of bytes that have been received.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param count Receive bytes count.
+ * @retval kStatus_NoTransferInProgress No receive in progress.
+ * @retval kStatus_InvalidArgument Parameter is invalid.
+ * @retval kStatus_Success Get successfully through the parameter \p count;
+ */
+status_t USART_TransferGetReceiveCountDMA(USART_Type *base, usart_dma_handle_t *handle, uint32_t *count);
+
+/*! @} */
+
+/*!
+ * @name DMA ring buffer
+ * @{
+ */
+
+/*!
+ * @brief Starts continuous reception into a circular DMA ring buffer.
+ *
+ * Two linked descriptors, each covering half of the ring, reload each other so the RX channel never stops. No
+ * interrupt is taken per received byte: the callback is invoked with @ref kStatus_USART_RxIdle each time a half
+ * of the ring is filled, and with @ref kStatus_USART_RxRingBufferOverrun when unread data was overwritten. Short
+ * messages that do not fill a half are reported by USART_TransferHandleRxIdleDMA().
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param ringBuffer Start address of the ring buffer. The buffer must stay valid while the ring is running.
+ * @param ringBufferSize Size of the ring buffer, an even number up to @ref USART_DMA_MAX_RING_BUFFER_SIZE.
+ * @retval kStatus_Success Ring started.
+ * @retval kStatus_USART_RxBusy A receive is in progress.
+ * @retval kStatus_InvalidArgument Invalid ring buffer.
+ */
+status_t USART_TransferStartRingBufferDMA(USART_Type *base,
+                                          usart_dma_handle_t *handle,
+                                          uint8_t *ringBuffer,
+                                          size_t ringBufferSize);
+
+/*!
+ * @brief Stops the DMA ring buffer.
+ *
+ * Data still in the ring when it is stopped is discarded.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ */
+void USART_TransferStopRingBufferDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*!
+ * @brief Get the length of received data in the DMA RX ring buffer.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @return Length of received data in RX ring buffer.
+ */
+size_t USART_TransferGetRxRingBufferLengthDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*!
+ * @brief Reads data out of the DMA RX ring buffer.
+ *
+ * Copies at most @p length bytes and returns immediately, it never waits for more data to arrive.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ * @param data Buffer to store the data.
+ * @param length Maximum number of bytes to read.
+ * @return Number of bytes copied to @p data.
+ */
+size_t USART_TransferReadRingBufferDMA(USART_Type *base, usart_dma_handle_t *handle, uint8_t *data, size_t length);
+
+/*!
+ * @brief Detects the RX line going idle and flushes the ring buffer to the application.
+ *
+ * The LPC845 USART has no receive idle timeout interrupt, so the idle line is detected by polling. Call this
+ * function periodically, for example from an MRT or SysTick interrupt. When data arrived since the previous flush,
+ * no byte was received since the previous call and the receiver is idle, the callback is invoked with
+ * @ref kStatus_USART_DMA_RxRingIdle. The call period is therefore the idle timeout; a few character times is
+ * usually enough.
+ *
+ * @param base USART peripheral base address.
+ * @param handle USART handle pointer.
+ */
+void USART_TransferHandleRxIdleDMA(USART_Type *base, usart_dma_handle_t *handle);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* FSL_USART_DMA_H_ */